@@ -14,6 +14,9 @@ function(generate_config_file)
     check_function_exists("mmap" HAVE_MMAP)
     check_function_exists("posix_memalign" HAVE_POSIX_MEMALIGN)
     check_include_file("sys/mman.h" HAVE_SYS_MMAN_H)
+    if(CMAKE_USE_PTHREADS_INIT)
+        set(HAVE_PTHREAD 1)
+    endif()
     if(CMAKE_CROSSCOMPILING)
         unset(HAVE_UNALIGNED_ACCESS)
     else()
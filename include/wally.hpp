@@ -2,6 +2,8 @@
 #define LIBWALLY_CORE_WALLY_HPP
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <type_traits>
 #include <string>
 #include <wally_address.h>
@@ -320,6 +322,12 @@ inline int bip39_mnemonic_validate(const W& w, const char* mnemonic) {
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+template <class MNEMONICS, class BYTES_OUT>
+inline int bip39_mnemonics_validate_batch(const MNEMONICS& mnemonics, uint32_t flags, BYTES_OUT& bytes_out) {
+    int ret = ::bip39_mnemonics_validate_batch(detail::get_p(mnemonics), flags, bytes_out.data(), bytes_out.size());
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 template <class HDKEY, class LANG, class BYTES_OUT>
 inline int bip85_get_bip39_entropy(const HDKEY& hdkey, const LANG& lang, uint32_t num_words, uint32_t index, BYTES_OUT& bytes_out, size_t* written) {
     int ret = ::bip85_get_bip39_entropy(detail::get_p(hdkey), detail::get_p(lang), num_words, index, bytes_out.data(), bytes_out.size(), written);
@@ -343,6 +351,18 @@ inline int addr_segwit_from_bytes(const BYTES& bytes, const ADDR_FAMILY& addr_fa
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+template <class BYTES, class ADDR_FAMILY, class OUTPUT>
+inline int addr_segwit_from_bytes_batch(const BYTES& bytes, const ADDR_FAMILY& addr_family, uint32_t flags, const OUTPUT& output, size_t len, size_t* written) {
+    int ret = ::wally_addr_segwit_from_bytes_batch(bytes.data(), bytes.size(), detail::get_p(addr_family), flags, detail::get_p(output), len, written);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
+template <class BYTES, class ADDR_FAMILY, class STR_OUT>
+inline int addr_segwit_from_bytes_into(const BYTES& bytes, const ADDR_FAMILY& addr_family, uint32_t flags, const STR_OUT& str_out, size_t len, size_t* written) {
+    int ret = ::wally_addr_segwit_from_bytes_into(bytes.data(), bytes.size(), detail::get_p(addr_family), flags, detail::get_p(str_out), len, written);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 template <class ADDR, class ADDR_FAMILY>
 inline int addr_segwit_get_version(const ADDR& addr, const ADDR_FAMILY& addr_family, uint32_t flags, size_t* written) {
     int ret = ::wally_addr_segwit_get_version(detail::get_p(addr), detail::get_p(addr_family), flags, written);
@@ -367,6 +387,18 @@ inline int addr_segwit_to_bytes(const ADDR& addr, const ADDR_FAMILY& addr_family
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+template <class ADDRS, class ADDR_FAMILY, class BYTES_OUT>
+inline int addr_segwit_to_bytes_batch(const ADDRS& addrs, size_t addrs_len, const ADDR_FAMILY& addr_family, uint32_t flags, BYTES_OUT& bytes_out, size_t* written) {
+    int ret = ::wally_addr_segwit_to_bytes_batch(detail::get_p(addrs), addrs_len, detail::get_p(addr_family), flags, bytes_out.data(), bytes_out.size(), written);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
+template <class ADDRS, class ADDR_FAMILY, class BYTES_OUT>
+inline int addr_segwit_verify_batch(const ADDRS& addrs, size_t addrs_len, const ADDR_FAMILY& addr_family, uint32_t flags, BYTES_OUT& bytes_out) {
+    int ret = ::wally_addr_segwit_verify_batch(detail::get_p(addrs), addrs_len, detail::get_p(addr_family), flags, bytes_out.data(), bytes_out.size());
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 template <class ADDR, class BYTES_OUT>
 inline int address_to_scriptpubkey(const ADDR& addr, uint32_t network, BYTES_OUT& bytes_out, size_t* written) {
     int ret = ::wally_address_to_scriptpubkey(detail::get_p(addr), network, bytes_out.data(), bytes_out.size(), written);
@@ -439,6 +471,12 @@ inline int base58_from_bytes(const BYTES& bytes, uint32_t flags, char** output)
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+template <class BYTES, class STR_OUT>
+inline int base58_from_bytes_into(const BYTES& bytes, uint32_t flags, const STR_OUT& str_out, size_t len, size_t* written) {
+    int ret = ::wally_base58_from_bytes_into(bytes.data(), bytes.size(), flags, detail::get_p(str_out), len, written);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 template <class STR_IN>
 inline int base58_get_length(const STR_IN& str_in, size_t* written) {
     int ret = ::wally_base58_get_length(detail::get_p(str_in), written);
@@ -499,18 +537,36 @@ inline int bip32_key_to_addr_segwit(const HDKEY& hdkey, const ADDR_FAMILY& addr_
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+template <class HDKEY, class ADDR_FAMILY, class STR_OUT>
+inline int bip32_key_to_addr_segwit_into(const HDKEY& hdkey, const ADDR_FAMILY& addr_family, uint32_t flags, const STR_OUT& str_out, size_t len, size_t* written) {
+    int ret = ::wally_bip32_key_to_addr_segwit_into(detail::get_p(hdkey), detail::get_p(addr_family), flags, detail::get_p(str_out), len, written);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 template <class HDKEY>
 inline int bip32_key_to_address(const HDKEY& hdkey, uint32_t flags, uint32_t version, char** output) {
     int ret = ::wally_bip32_key_to_address(detail::get_p(hdkey), flags, version, output);
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+template <class HDKEY, class STR_OUT>
+inline int bip32_key_to_address_into(const HDKEY& hdkey, uint32_t flags, uint32_t version, const STR_OUT& str_out, size_t len, size_t* written) {
+    int ret = ::wally_bip32_key_to_address_into(detail::get_p(hdkey), flags, version, detail::get_p(str_out), len, written);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 template <class BYTES, class TAG, class BYTES_OUT>
 inline int bip340_tagged_hash(const BYTES& bytes, const TAG& tag, BYTES_OUT& bytes_out) {
     int ret = ::wally_bip340_tagged_hash(bytes.data(), bytes.size(), detail::get_p(tag), bytes_out.data(), bytes_out.size());
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+template <class SCAN_PRIV_KEY, class SPEND_PUB_KEY, class OUTPOINTS, class PUB_KEYS, class NUM_PUB_KEYS, class OUTPUT_KEYS, class NUM_OUTPUT_KEYS, class BYTES_OUT>
+inline int bip352_scan(const SCAN_PRIV_KEY& scan_priv_key, const SPEND_PUB_KEY& spend_pub_key, const OUTPOINTS& outpoints, const PUB_KEYS& pub_keys, const NUM_PUB_KEYS& num_pub_keys, const OUTPUT_KEYS& output_keys, const NUM_OUTPUT_KEYS& num_output_keys, uint32_t flags, BYTES_OUT& bytes_out, size_t* written) {
+    int ret = ::wally_bip352_scan(scan_priv_key.data(), scan_priv_key.size(), spend_pub_key.data(), spend_pub_key.size(), outpoints.data(), outpoints.size(), pub_keys.data(), pub_keys.size(), num_pub_keys.data(), num_pub_keys.size(), output_keys.data(), output_keys.size(), num_output_keys.data(), num_output_keys.size(), flags, bytes_out.data(), bytes_out.size(), written);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 template <class BYTES>
 inline int bzero(BYTES& bytes) {
     int ret = ::wally_bzero(bytes.data(), bytes.size());
@@ -522,6 +578,12 @@ inline int cleanup(uint32_t flags) {
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+template <class VALUES, class WEIGHTS>
+inline int coinselect(const VALUES& values, const WEIGHTS& weights, uint64_t target, uint64_t fee_rate, uint64_t long_term_fee_rate, uint64_t cost_of_change, uint64_t attempts, uint32_t flags, uint32_t* indices_out, size_t indices_out_len, size_t* written) {
+    int ret = ::wally_coinselect(values.data(), values.size(), weights.data(), weights.size(), target, fee_rate, long_term_fee_rate, cost_of_change, attempts, flags, indices_out, indices_out_len, written);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 template <class DESCRIPTOR>
 inline int descriptor_canonicalize(const DESCRIPTOR& descriptor, uint32_t flags, char** output) {
     int ret = ::wally_descriptor_canonicalize(detail::get_p(descriptor), flags, output);
@@ -641,6 +703,12 @@ inline int descriptor_to_addresses(const DESCRIPTOR& descriptor, uint32_t varian
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+template <class DESCRIPTOR, class OUTPUT>
+inline int descriptor_to_addresses_into(const DESCRIPTOR& descriptor, uint32_t variant, uint32_t multi_index, uint32_t child_num, uint32_t flags, const OUTPUT& output, size_t len) {
+    int ret = ::wally_descriptor_to_addresses_into(detail::get_p(descriptor), variant, multi_index, child_num, flags, detail::get_p(output), len);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 template <class DESCRIPTOR, class BYTES_OUT>
 inline int descriptor_to_script(const DESCRIPTOR& descriptor, uint32_t depth, uint32_t index, uint32_t variant, uint32_t multi_index, uint32_t child_num, uint32_t flags, BYTES_OUT& bytes_out, size_t* written) {
     int ret = ::wally_descriptor_to_script(detail::get_p(descriptor), depth, index, variant, multi_index, child_num, flags, bytes_out.data(), bytes_out.size(), written);
@@ -755,6 +823,18 @@ inline int ec_sig_from_bytes_aux_len(const PRIV_KEY& priv_key, const BYTES& byte
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+template <class PRIV_KEY, class BYTES, class AUX_RAND, class BYTES_OUT>
+inline int ec_sig_from_bytes_batch(const PRIV_KEY& priv_key, const BYTES& bytes, const AUX_RAND& aux_rand, uint32_t flags, BYTES_OUT& bytes_out) {
+    int ret = ::wally_ec_sig_from_bytes_batch(priv_key.data(), priv_key.size(), bytes.data(), bytes.size(), aux_rand.data(), aux_rand.size(), flags, bytes_out.data(), bytes_out.size());
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
+template <class PRIV_KEY, class BYTES, class AUX_RAND>
+inline int ec_sig_from_bytes_batch_len(const PRIV_KEY& priv_key, const BYTES& bytes, const AUX_RAND& aux_rand, uint32_t flags, size_t* written) {
+    int ret = ::wally_ec_sig_from_bytes_batch_len(priv_key.data(), priv_key.size(), bytes.data(), bytes.size(), aux_rand.data(), aux_rand.size(), flags, written);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 template <class PRIV_KEY, class BYTES>
 inline int ec_sig_from_bytes_len(const PRIV_KEY& priv_key, const BYTES& bytes, uint32_t flags, size_t* written) {
     int ret = ::wally_ec_sig_from_bytes_len(priv_key.data(), priv_key.size(), bytes.data(), bytes.size(), flags, written);
@@ -830,12 +910,24 @@ inline int get_operations(struct wally_operations* output) {
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+template <class OUTPUT>
+inline int get_stats(uint32_t flags, const OUTPUT& output, size_t num_output) {
+    int ret = ::wally_get_stats(flags, detail::get_p(output), num_output);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 template <class BYTES, class BYTES_OUT>
 inline int hash160(const BYTES& bytes, BYTES_OUT& bytes_out) {
     int ret = ::wally_hash160(bytes.data(), bytes.size(), bytes_out.data(), bytes_out.size());
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+template <class BYTES, class BYTES_OUT>
+inline int hash160_batch(const BYTES& bytes, size_t item_len, BYTES_OUT& bytes_out) {
+    int ret = ::wally_hash160_batch(bytes.data(), bytes.size(), item_len, bytes_out.data(), bytes_out.size());
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 template <class BYTES>
 inline int hex_from_bytes(const BYTES& bytes, char** output) {
     int ret = ::wally_hex_from_bytes(bytes.data(), bytes.size(), output);
@@ -1168,6 +1260,11 @@ inline int pbkdf2_hmac_sha512(const PASS& pass, const SALT& salt, uint32_t flags
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+inline int pool_get_stats(struct wally_pool_stats* output) {
+    int ret = ::wally_pool_get_stats(output);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 template <class PSBT, class PUB_KEY, class FINGERPRINT, class CHILD_PATH>
 inline int psbt_add_input_keypath(const PSBT& psbt, uint32_t index, const PUB_KEY& pub_key, const FINGERPRINT& fingerprint, const CHILD_PATH& child_path) {
     int ret = ::wally_psbt_add_input_keypath(detail::get_p(psbt), index, pub_key.data(), pub_key.size(), fingerprint.data(), fingerprint.size(), child_path.data(), child_path.size());
@@ -1204,6 +1301,12 @@ inline int psbt_add_tx_output_at(const PSBT& psbt, uint32_t index, uint32_t flag
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+template <class PSBT, class BYTES>
+inline int psbt_apply_patch(const PSBT& psbt, const BYTES& bytes, uint32_t flags) {
+    int ret = ::wally_psbt_apply_patch(detail::get_p(psbt), bytes.data(), bytes.size(), flags);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 inline int psbt_clear_fallback_locktime(struct wally_psbt* psbt) {
     int ret = ::wally_psbt_clear_fallback_locktime(psbt);
     return detail::check_ret(__FUNCTION__, ret);
@@ -1251,6 +1354,12 @@ inline int psbt_find_input_spending_utxo(const PSBT& psbt, const TXHASH& txhash,
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+template <class PSBT, class TXHASHES, class UTXO_INDICES>
+inline int psbt_find_inputs_spending_utxos(const PSBT& psbt, const TXHASHES& txhashes, const UTXO_INDICES& utxo_indices, uint32_t* indices_out, size_t indices_out_len, size_t* written) {
+    int ret = ::wally_psbt_find_inputs_spending_utxos(detail::get_p(psbt), txhashes.data(), txhashes.size(), utxo_indices.data(), utxo_indices.size(), indices_out, indices_out_len, written);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 inline int psbt_free(struct wally_psbt* psbt) {
     int ret = ::wally_psbt_free(psbt);
     return detail::check_ret(__FUNCTION__, ret);
@@ -1334,6 +1443,18 @@ inline int psbt_get_locktime(const PSBT& psbt, size_t* written) {
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+template <class BASE, class PSBT, class BYTES_OUT>
+inline int psbt_get_patch(const BASE& base, const PSBT& psbt, uint32_t flags, BYTES_OUT& bytes_out, size_t* written) {
+    int ret = ::wally_psbt_get_patch(detail::get_p(base), detail::get_p(psbt), flags, bytes_out.data(), bytes_out.size(), written);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
+template <class BASE, class PSBT>
+inline int psbt_get_patch_length(const BASE& base, const PSBT& psbt, uint32_t flags, size_t* written) {
+    int ret = ::wally_psbt_get_patch_length(detail::get_p(base), detail::get_p(psbt), flags, written);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 template <class PSBT>
 inline int psbt_get_tx_version(const PSBT& psbt, size_t* written) {
     int ret = ::wally_psbt_get_tx_version(detail::get_p(psbt), written);
@@ -1528,6 +1649,18 @@ inline int psbt_is_input_finalized(const PSBT& psbt, size_t index, size_t* writt
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+template <class PSBT>
+inline int psbt_outpoint_index_disable(const PSBT& psbt) {
+    int ret = ::wally_psbt_outpoint_index_disable(detail::get_p(psbt));
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
+template <class PSBT>
+inline int psbt_outpoint_index_enable(const PSBT& psbt, uint32_t flags) {
+    int ret = ::wally_psbt_outpoint_index_enable(detail::get_p(psbt), flags);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 inline int psbt_output_clear_amount(struct wally_psbt_output* output) {
     int ret = ::wally_psbt_output_clear_amount(output);
     return detail::check_ret(__FUNCTION__, ret);
@@ -1766,6 +1899,12 @@ inline int scriptpubkey_to_address(const SCRIPTPUBKEY& scriptpubkey, uint32_t ne
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+template <class SCRIPTPUBKEY, class STR_OUT>
+inline int scriptpubkey_to_address_into(const SCRIPTPUBKEY& scriptpubkey, uint32_t network, const STR_OUT& str_out, size_t len, size_t* written) {
+    int ret = ::wally_scriptpubkey_to_address_into(scriptpubkey.data(), scriptpubkey.size(), network, detail::get_p(str_out), len, written);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 template <class SCRIPT, class BYTES, class SIGHASH, class BYTES_OUT>
 inline int scriptsig_multisig_from_bytes(const SCRIPT& script, const BYTES& bytes, const SIGHASH& sighash, uint32_t flags, BYTES_OUT& bytes_out, size_t* written) {
     int ret = ::wally_scriptsig_multisig_from_bytes(script.data(), script.size(), bytes.data(), bytes.size(), sighash.data(), sighash.size(), flags, bytes_out.data(), bytes_out.size(), written);
@@ -1796,6 +1935,21 @@ inline int secp_randomize(const BYTES& bytes) {
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+inline int secure_arena_free(uint32_t flags) {
+    int ret = ::wally_secure_arena_free(flags);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
+inline int secure_arena_init(size_t len, uint32_t flags) {
+    int ret = ::wally_secure_arena_init(len, flags);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
+inline int secure_arena_reset(uint32_t flags, size_t* written) {
+    int ret = ::wally_secure_arena_reset(flags, written);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 inline int set_operations(const struct wally_operations* ops) {
     int ret = ::wally_set_operations(ops);
     return detail::check_ret(__FUNCTION__, ret);
@@ -1932,6 +2086,12 @@ inline int tx_get_input_signature_hash(const TX& tx, size_t index, const SCRIPTS
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+template <class TX, class SCRIPTS, class ASSETS, class VALUES, class GENESIS_BLOCKHASH, class CACHE, class BYTES_OUT>
+inline int tx_get_input_signature_hash_batch(const TX& tx, const SCRIPTS& scripts, const ASSETS& assets, const VALUES& values, const GENESIS_BLOCKHASH& genesis_blockhash, uint32_t sighash, uint32_t flags, const CACHE& cache, BYTES_OUT& bytes_out) {
+    int ret = ::wally_tx_get_input_signature_hash_batch(detail::get_p(tx), detail::get_p(scripts), detail::get_p(assets), detail::get_p(values), genesis_blockhash.data(), genesis_blockhash.size(), sighash, flags, detail::get_p(cache), bytes_out.data(), bytes_out.size());
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 template <class TX>
 inline int tx_get_length(const TX& tx, uint32_t flags, size_t* written) {
     int ret = ::wally_tx_get_length(detail::get_p(tx), flags, written);
@@ -1956,6 +2116,12 @@ inline int tx_get_txid(const TX& tx, BYTES_OUT& bytes_out) {
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+template <class BYTES, class BYTES_OUT>
+inline int tx_get_txids_batch(const BYTES& bytes, uint32_t flags, BYTES_OUT& bytes_out, size_t* written) {
+    int ret = ::wally_tx_get_txids_batch(bytes.data(), bytes.size(), flags, bytes_out.data(), bytes_out.size(), written);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 template <class TX>
 inline int tx_get_vsize(const TX& tx, size_t* written) {
     int ret = ::wally_tx_get_vsize(detail::get_p(tx), written);
@@ -2367,6 +2533,12 @@ inline int coinselect_assets(const VALUES& values, uint64_t target, uint64_t att
     return detail::check_ret(__FUNCTION__, ret);
 }
 
+template <class VALUES>
+inline int coinselect_assets_split(const VALUES& values, uint64_t target, uint64_t attempts, uint32_t io_ratio, uint32_t num_subtrees, uint32_t* indices_out, size_t indices_out_len, size_t* written) {
+    int ret = ::wally_coinselect_assets_split(values.data(), values.size(), target, attempts, io_ratio, num_subtrees, indices_out, indices_out_len, written);
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 template <class ADDRESS, class PUB_KEY>
 inline int confidential_addr_from_addr(const ADDRESS& address, uint32_t prefix, const PUB_KEY& pub_key, char** output) {
     int ret = ::wally_confidential_addr_from_addr(detail::get_p(address), prefix, pub_key.data(), pub_key.size(), output);
@@ -3262,6 +3434,248 @@ inline bool is_elements_build()
     return ret != 0;
 }
 
+/* A non-owning view of contiguous elements, similar to C++20 std::span.
+ * Containers with data() and size() convert to spans, and spans can be
+ * passed to any wrapper above that accepts a container.
+ */
+template <typename T> class span {
+public:
+    using element_type = T;
+    using value_type = typename std::remove_cv<T>::type;
+    using size_type = size_t;
+    using iterator = T*;
+
+    constexpr span() noexcept : m_data(nullptr), m_size(0) {}
+    constexpr span(T* data, size_t size) noexcept : m_data(data), m_size(size) {}
+    template <class C, typename = typename std::enable_if<
+                  std::is_convertible<decltype(std::declval<C&>().data()), T*>::value>::type>
+    constexpr span(C& c) noexcept : m_data(c.data()), m_size(c.size()) {}
+
+    constexpr T* data() const noexcept { return m_data; }
+    constexpr size_t size() const noexcept { return m_size; }
+    constexpr bool empty() const noexcept { return m_size == 0; }
+    constexpr T* begin() const noexcept { return m_data; }
+    constexpr T* end() const noexcept { return m_data + m_size; }
+    constexpr T& operator[](size_t i) const { return m_data[i]; }
+    constexpr span subspan(size_t offset, size_t count = static_cast<size_t>(-1)) const {
+        offset = offset < m_size ? offset : m_size;
+        return span(m_data + offset, count < m_size - offset ? count : m_size - offset);
+    }
+
+private:
+    T* m_data;
+    size_t m_size;
+};
+
+using byte_span = span<const unsigned char>;
+
+/* Views of the data held by wally structures. These do not copy: the
+ * returned spans are invalidated if the owning object is changed or freed.
+ */
+inline span<const struct wally_tx_input> inputs(const struct wally_tx& tx) {
+    return { tx.inputs, tx.num_inputs };
+}
+
+inline span<const struct wally_tx_output> outputs(const struct wally_tx& tx) {
+    return { tx.outputs, tx.num_outputs };
+}
+
+inline byte_span script(const struct wally_tx_input& input) {
+    return { input.script, input.script_len };
+}
+
+inline byte_span script(const struct wally_tx_output& output) {
+    return { output.script, output.script_len };
+}
+
+inline span<const struct wally_tx_witness_item> items(const struct wally_tx_witness_stack& stack) {
+    return { stack.items, stack.num_items };
+}
+
+inline span<const struct wally_tx_witness_item> witness(const struct wally_tx_input& input) {
+    return input.witness ? items(*input.witness) : span<const struct wally_tx_witness_item>();
+}
+
+inline byte_span value(const struct wally_tx_witness_item& item) {
+    return { item.witness, item.witness_len };
+}
+
+inline span<const struct wally_map_item> items(const struct wally_map& map_in) {
+    return { map_in.items, map_in.num_items };
+}
+
+/* Returns an empty span for integer keys, whose value is item.key_len */
+inline byte_span key(const struct wally_map_item& item) {
+    return item.key ? byte_span(item.key, item.key_len) : byte_span();
+}
+
+inline byte_span value(const struct wally_map_item& item) {
+    return { item.value, item.value_len };
+}
+
+inline span<const struct wally_psbt_input> inputs(const struct wally_psbt& psbt) {
+    return { psbt.inputs, psbt.num_inputs };
+}
+
+inline span<const struct wally_psbt_output> outputs(const struct wally_psbt& psbt) {
+    return { psbt.outputs, psbt.num_outputs };
+}
+
+inline byte_span script(const struct wally_psbt_output& output) {
+    return { output.script, output.script_len };
+}
+
+namespace detail {
+template <typename T> struct deleter;
+template <> struct deleter<struct wally_tx> {
+    void operator()(struct wally_tx* p) const { ::wally_tx_free(p); }
+};
+template <> struct deleter<struct wally_psbt> {
+    void operator()(struct wally_psbt* p) const { ::wally_psbt_free(p); }
+};
+template <> struct deleter<struct wally_descriptor> {
+    void operator()(struct wally_descriptor* p) const { ::wally_descriptor_free(p); }
+};
+template <> struct deleter<struct wally_map> {
+    void operator()(struct wally_map* p) const { ::wally_map_free(p); }
+};
+} /* namespace detail */
+
+/* Owning, move-only handles that free the wrapped object when destroyed.
+ * Handles can be passed directly to the wrappers above in place of the
+ * raw pointer they own.
+ */
+template <typename T> using handle = std::unique_ptr<T, detail::deleter<T>>;
+using tx = handle<struct wally_tx>;
+using psbt = handle<struct wally_psbt>;
+using descriptor = handle<struct wally_descriptor>;
+using map = handle<struct wally_map>;
+
+namespace detail {
+template <typename T> class out_ptr_t {
+public:
+    explicit out_ptr_t(handle<T>& h) noexcept : m_handle(&h), m_p(nullptr) {}
+    out_ptr_t(out_ptr_t&& rhs) noexcept : m_handle(rhs.m_handle), m_p(rhs.m_p) {
+        rhs.m_handle = nullptr;
+    }
+    out_ptr_t(const out_ptr_t&) = delete;
+    out_ptr_t& operator=(const out_ptr_t&) = delete;
+    ~out_ptr_t() {
+        if (m_handle)
+            m_handle->reset(m_p);
+    }
+    operator T**() noexcept { return &m_p; }
+
+private:
+    handle<T>* m_handle;
+    T* m_p;
+};
+
+template <class C> inline unsigned char* out_bytes(C& c) {
+    return c.empty() ? nullptr : reinterpret_cast<unsigned char*>(&c[0]);
+}
+
+/* Call fn(str_out, len, written) into out, growing it if required and
+ * removing the NUL terminator on success */
+template <class STR_OUT, class FN> inline int str_into(STR_OUT& out, size_t len, FN fn) {
+    size_t written = 0;
+    out.resize(len);
+    int ret = fn(&out[0], len, &written);
+    if (ret == WALLY_OK && written > len) {
+        out.resize(written);
+        ret = fn(&out[0], written, &written);
+    }
+    if (ret == WALLY_OK && written && written <= out.size())
+        out.resize(written - 1);
+    else {
+        out.clear();
+        if (ret == WALLY_OK)
+            ret = WALLY_ERROR;
+    }
+    return ret;
+}
+} /* namespace detail */
+
+/* Adapt a handle for use as an allocated output, e.g:
+ *   wally::tx tx;
+ *   wally::tx_from_hex(hex, 0, wally::out_ptr(tx));
+ * The handle takes ownership of the result when the call completes.
+ */
+template <typename T> inline detail::out_ptr_t<T> out_ptr(handle<T>& h) {
+    return detail::out_ptr_t<T>(h);
+}
+
+/* Overloads writing into resizable caller containers such as std::vector
+ * and std::string. Capacity is reused, so repeated calls into the same
+ * container do not allocate.
+ */
+template <class TX, class BYTES_OUT>
+inline int tx_to_bytes_into(const TX& tx, uint32_t flags, BYTES_OUT& bytes_out) {
+    size_t len = 0, written = 0;
+    int ret = ::wally_tx_get_length(detail::get_p(tx), flags, &len);
+    if (ret == WALLY_OK) {
+        bytes_out.resize(len);
+        ret = ::wally_tx_to_bytes(detail::get_p(tx), flags, detail::out_bytes(bytes_out), len, &written);
+        if (ret == WALLY_OK && written != len)
+            ret = WALLY_ERROR;
+    }
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
+template <class PSBT, class BYTES_OUT>
+inline int psbt_to_bytes_into(const PSBT& psbt, uint32_t flags, BYTES_OUT& bytes_out) {
+    size_t len = 0, written = 0;
+    int ret = ::wally_psbt_get_length(detail::get_p(psbt), flags, &len);
+    if (ret == WALLY_OK) {
+        bytes_out.resize(len);
+        ret = ::wally_psbt_to_bytes(detail::get_p(psbt), flags, detail::out_bytes(bytes_out), len, &written);
+        if (ret == WALLY_OK && written != len)
+            ret = WALLY_ERROR;
+    }
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
+template <class BYTES>
+inline int base58_from_bytes_into(const BYTES& bytes, uint32_t flags, std::string& output) {
+    const size_t len = (bytes.size() + 4) * 138 / 100 + 2; /* Includes checksum and NUL */
+    int ret = detail::str_into(output, len, [&](char* out, size_t out_len, size_t* written) {
+        return ::wally_base58_from_bytes_into(bytes.data(), bytes.size(), flags, out, out_len, written);
+    });
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
+template <class BYTES, class ADDR_FAMILY>
+inline int addr_segwit_from_bytes_into(const BYTES& bytes, const ADDR_FAMILY& addr_family, uint32_t flags, std::string& output) {
+    int ret = detail::str_into(output, WALLY_SEGWIT_ADDRESS_MAX_LEN, [&](char* out, size_t out_len, size_t* written) {
+        return ::wally_addr_segwit_from_bytes_into(bytes.data(), bytes.size(), detail::get_p(addr_family), flags, out, out_len, written);
+    });
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
+template <class SCRIPTPUBKEY>
+inline int scriptpubkey_to_address_into(const SCRIPTPUBKEY& scriptpubkey, uint32_t network, std::string& output) {
+    int ret = detail::str_into(output, WALLY_SEGWIT_ADDRESS_MAX_LEN, [&](char* out, size_t out_len, size_t* written) {
+        return ::wally_scriptpubkey_to_address_into(scriptpubkey.data(), scriptpubkey.size(), network, out, out_len, written);
+    });
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
+template <class HDKEY>
+inline int bip32_key_to_address_into(const HDKEY& hdkey, uint32_t flags, uint32_t version, std::string& output) {
+    int ret = detail::str_into(output, WALLY_SEGWIT_ADDRESS_MAX_LEN, [&](char* out, size_t out_len, size_t* written) {
+        return ::wally_bip32_key_to_address_into(detail::get_p(hdkey), flags, version, out, out_len, written);
+    });
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
+template <class HDKEY, class ADDR_FAMILY>
+inline int bip32_key_to_addr_segwit_into(const HDKEY& hdkey, const ADDR_FAMILY& addr_family, uint32_t flags, std::string& output) {
+    int ret = detail::str_into(output, WALLY_SEGWIT_ADDRESS_MAX_LEN, [&](char* out, size_t out_len, size_t* written) {
+        return ::wally_bip32_key_to_addr_segwit_into(detail::get_p(hdkey), detail::get_p(addr_family), flags, out, out_len, written);
+    });
+    return detail::check_ret(__FUNCTION__, ret);
+}
+
 } /* namespace wally */
 
 #endif /* LIBWALLY_CORE_WALLY_HPP */
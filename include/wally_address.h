@@ -49,6 +49,9 @@ struct ext_key;
 #define WALLY_SEGWIT_V0_ADDRESS_PUBKEY_MAX_LEN 34 /** OP_0 OP_PUSH_{20,32} [20 bytes for wpkh, 32 for wsh] */
 #define WALLY_SEGWIT_V1_ADDRESS_PUBKEY_LEN 34 /** OP_1 OP_PUSH_32 [32-bytes x-only pubkey] */
 
+#define WALLY_SEGWIT_ADDRESS_MAX_LEN 91 /** Maximum segwit address length (90 characters) plus a NUL terminator */
+#define WALLY_SEGWIT_VERSION_INVALID 0xff /** Marks an invalid address in `wally_addr_segwit_verify_batch` */
+
 /**
  * Create a segwit native address from a v0 or later witness program.
  *
@@ -67,6 +70,33 @@ WALLY_CORE_API int wally_addr_segwit_from_bytes(
     uint32_t flags,
     char **output);
 
+#ifndef SWIG
+/**
+ * Create a segwit native address from a witness program, without allocating.
+ *
+ * :param bytes: Witness program bytes, including the version and data push opcode.
+ * :param bytes_len: Length of ``bytes`` in bytes.
+ * :param addr_family: Address family to generate, e.g. "bc" or "tb".
+ * :param flags: For future use. Must be 0.
+ * :param str_out: Destination for the NUL terminated segwit native address.
+ * :param len: The length of ``str_out`` in bytes. Passing
+ *|    `WALLY_SEGWIT_ADDRESS_MAX_LEN` is always sufficient.
+ * :param written: Destination for the number of bytes written to ``str_out``,
+ *|    including the NUL terminator.
+ *
+ * .. note:: This is a non-standard call for low-level use. It follows the
+ *|    conventions of :ref:`variable-length-output-buffers`.
+ */
+WALLY_CORE_API int wally_addr_segwit_from_bytes_into(
+    const unsigned char *bytes,
+    size_t bytes_len,
+    const char *addr_family,
+    uint32_t flags,
+    char *str_out,
+    size_t len,
+    size_t *written);
+#endif /* SWIG */
+
 /**
  * Get a scriptPubKey containing the witness program from a segwit native address.
  *
@@ -129,6 +159,86 @@ WALLY_CORE_API int wally_addr_segwit_n_get_version(
     uint32_t flags,
     size_t *written);
 
+#if !defined(SWIG) || defined(SWIGPYTHON)
+/**
+ * Create segwit native addresses from a batch of witness programs.
+ *
+ * :param bytes: Witness programs to convert, concatenated. Each program must
+ *|    include the version and a direct data push opcode.
+ * :param bytes_len: Length of ``bytes`` in bytes.
+ * :param addr_family: Address family to generate, e.g. "bc" or "tb".
+ * :param flags: For future use. Must be 0.
+ * :param output: Destination for the resulting addresses. The address for
+ *|    the Nth program is written NUL terminated and NUL padded to the slot
+ *|    starting at ``N * WALLY_SEGWIT_ADDRESS_MAX_LEN``.
+ * :param len: The length of ``output`` in bytes.
+ * :param written: Destination for the number of bytes written to ``output``.
+ *
+ * .. note:: This is a non-standard call for low-level use. It follows the
+ *|    conventions of :ref:`variable-length-output-buffers`.
+ */
+WALLY_CORE_API int wally_addr_segwit_from_bytes_batch(
+    const unsigned char *bytes,
+    size_t bytes_len,
+    const char *addr_family,
+    uint32_t flags,
+    char *output,
+    size_t len,
+    size_t *written);
+
+/**
+ * Get the witness program scriptPubKeys for a batch of segwit native addresses.
+ *
+ * :param addrs: Addresses to convert, each NUL terminated in a slot of
+ *|    `WALLY_SEGWIT_ADDRESS_MAX_LEN` bytes, as written by
+ *|    `wally_addr_segwit_from_bytes_batch`.
+ * :param addrs_len: Length of ``addrs`` in bytes. Must be a multiple of
+ *|    `WALLY_SEGWIT_ADDRESS_MAX_LEN`.
+ * :param addr_family: Address family the addresses must belong to, e.g. "bc" or "tb".
+ * :param flags: For future use. Must be 0.
+ * :param bytes_out: Destination for the resulting scriptPubKeys, concatenated
+ *|    in the same order as ``addrs``.
+ * :param len: The length of ``bytes_out`` in bytes.
+ * :param written: Destination for the number of bytes written to ``bytes_out``.
+ *
+ * .. note:: This is a non-standard call for low-level use. It follows the
+ *|    conventions of :ref:`variable-length-output-buffers`. If any
+ *|    address is invalid, WALLY_EINVAL is returned and no output is written.
+ *|    Use `wally_addr_segwit_verify_batch` to find invalid addresses.
+ */
+WALLY_CORE_API int wally_addr_segwit_to_bytes_batch(
+    const char *addrs,
+    size_t addrs_len,
+    const char *addr_family,
+    uint32_t flags,
+    unsigned char *bytes_out,
+    size_t len,
+    size_t *written);
+
+/**
+ * Validate a batch of segwit native addresses.
+ *
+ * :param addrs: Addresses to validate, as per `wally_addr_segwit_to_bytes_batch`.
+ * :param addrs_len: Length of ``addrs`` in bytes. Must be a multiple of
+ *|    `WALLY_SEGWIT_ADDRESS_MAX_LEN`.
+ * :param addr_family: Address family the addresses must belong to, e.g. "bc" or "tb".
+ * :param flags: For future use. Must be 0.
+ * :param bytes_out: Destination for the segwit version of each address,
+ *|    or `WALLY_SEGWIT_VERSION_INVALID` if it is not valid.
+ * :param len: The length of ``bytes_out`` in bytes. Must be the number of
+ *|    addresses in ``addrs``.
+ *
+ * .. note:: This is a non-standard call for low-level use.
+ */
+WALLY_CORE_API int wally_addr_segwit_verify_batch(
+    const char *addrs,
+    size_t addrs_len,
+    const char *addr_family,
+    uint32_t flags,
+    unsigned char *bytes_out,
+    size_t len);
+#endif /* !SWIG || SWIGPYTHON */
+
 /**
  * Infer a scriptPubKey from an address.
  *
@@ -164,6 +274,30 @@ WALLY_CORE_API int wally_scriptpubkey_to_address(
     uint32_t network,
     char **output);
 
+#ifndef SWIG
+/**
+ * Infer an address from a scriptPubKey, without allocating.
+ *
+ * :param scriptpubkey: scriptPubKey bytes.
+ * :param scriptpubkey_len: Length of ``scriptpubkey`` in bytes.
+ * :param network: Network to generate the address for. One of the :ref:`address-networks`.
+ * :param str_out: Destination for the NUL terminated Base58 encoded address.
+ * :param len: The length of ``str_out`` in bytes.
+ * :param written: Destination for the number of bytes written to ``str_out``,
+ *|    including the NUL terminator.
+ *
+ * .. note:: This is a non-standard call for low-level use. It follows the
+ *|    conventions of :ref:`variable-length-output-buffers`.
+ */
+WALLY_CORE_API int wally_scriptpubkey_to_address_into(
+    const unsigned char *scriptpubkey,
+    size_t scriptpubkey_len,
+    uint32_t network,
+    char *str_out,
+    size_t len,
+    size_t *written);
+#endif /* SWIG */
+
 /**
  * Convert a private key to Wallet Import Format.
  *
@@ -244,6 +378,31 @@ WALLY_CORE_API int wally_bip32_key_to_address(
     uint32_t version,
     char **output);
 
+#ifndef SWIG
+/**
+ * Create a legacy or wrapped SegWit address corresponding to a BIP32 key, without allocating.
+ *
+ * :param hdkey: The extended key to use.
+ * :param flags: `WALLY_ADDRESS_TYPE_P2PKH` for a legacy address, `WALLY_ADDRESS_TYPE_P2SH_P2WPKH`
+ *| for P2SH-wrapped SegWit.
+ * :param version: Address version to generate. One of the :ref:`address-versions`.
+ * :param str_out: Destination for the NUL terminated address.
+ * :param len: The length of ``str_out`` in bytes.
+ * :param written: Destination for the number of bytes written to ``str_out``,
+ *|    including the NUL terminator.
+ *
+ * .. note:: This is a non-standard call for low-level use. It follows the
+ *|    conventions of :ref:`variable-length-output-buffers`.
+ */
+WALLY_CORE_API int wally_bip32_key_to_address_into(
+    const struct ext_key *hdkey,
+    uint32_t flags,
+    uint32_t version,
+    char *str_out,
+    size_t len,
+    size_t *written);
+#endif /* SWIG */
+
 /**
  * Create a native SegWit address corresponding to a BIP32 key.
  *
@@ -259,6 +418,30 @@ WALLY_CORE_API int wally_bip32_key_to_addr_segwit(
     uint32_t flags,
     char **output);
 
+#ifndef SWIG
+/**
+ * Create a native SegWit address corresponding to a BIP32 key, without allocating.
+ *
+ * :param hdkey: The extended key to use.
+ * :param addr_family: Address family to generate, e.g. "bc" or "tb".
+ * :param flags: For future use. Must be 0.
+ * :param str_out: Destination for the NUL terminated segwit native address.
+ * :param len: The length of ``str_out`` in bytes.
+ * :param written: Destination for the number of bytes written to ``str_out``,
+ *|    including the NUL terminator.
+ *
+ * .. note:: This is a non-standard call for low-level use. It follows the
+ *|    conventions of :ref:`variable-length-output-buffers`.
+ */
+WALLY_CORE_API int wally_bip32_key_to_addr_segwit_into(
+    const struct ext_key *hdkey,
+    const char *addr_family,
+    uint32_t flags,
+    char *str_out,
+    size_t len,
+    size_t *written);
+#endif /* SWIG */
+
 /**
  * Create a P2PKH address corresponding to a private key in Wallet Import Format.
  *
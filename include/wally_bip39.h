@@ -27,6 +27,12 @@ struct words;
 /** The number of words in a BIP39 compliant wordlist */
 #define BIP39_WORDLIST_LEN 2048
 
+/** The size of each result written by `bip39_mnemonics_validate_batch` */
+#define BIP39_VALIDATE_BATCH_RESULT_LEN 42
+
+/** Language index given by `bip39_mnemonics_validate_batch` for invalid mnemonics */
+#define BIP39_LANGUAGE_INVALID 0xff
+
 /**
  * Get the list of default supported languages for BIP39.
  *
@@ -119,6 +125,32 @@ WALLY_CORE_API int bip39_mnemonic_validate(
     const struct words *w,
     const char *mnemonic);
 
+#ifndef SWIG
+/**
+ * Validate a batch of mnemonic sentences, detecting their languages.
+ *
+ * :param mnemonics: The mnemonics to validate, separated by newlines.
+ * :param flags: For future use. Must be 0.
+ * :param bytes_out: Destination for the results. The result for the Nth
+ *|    mnemonic is written to the `BIP39_VALIDATE_BATCH_RESULT_LEN` bytes
+ *|    starting at ``N * BIP39_VALIDATE_BATCH_RESULT_LEN``. Its first byte is
+ *|    the index of the mnemonic's language in the list returned by
+ *|    `bip39_get_languages`, or `BIP39_LANGUAGE_INVALID` if it is not valid
+ *|    in any language. The second byte is the length of the entropy, which
+ *|    follows it. If a mnemonic is valid in more than one language, the
+ *|    first language in the list is returned.
+ * :param len: The length of ``bytes_out`` in bytes. Must be the number of
+ *|    mnemonics multiplied by `BIP39_VALIDATE_BATCH_RESULT_LEN`.
+ *
+ * .. note:: This is a non-standard call for low-level use.
+ */
+WALLY_CORE_API int bip39_mnemonics_validate_batch(
+    const char *mnemonics,
+    uint32_t flags,
+    unsigned char *bytes_out,
+    size_t len);
+#endif /* SWIG */
+
 /**
  * Convert a mnemonic into a binary seed.
  *
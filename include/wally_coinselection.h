@@ -10,6 +10,58 @@ extern "C" {
 /** The maximum number of asset values that can be returned in a coin selection */
 #define WALLY_CS_MAX_ASSETS 256
 
+/** The maximum number of inputs that can be returned by `wally_coinselect` */
+#define WALLY_CS_MAX_INPUTS 256
+
+/**
+ * Select inputs to fund a payment, taking their spending fees into account.
+ *
+ * :param values: The UTXO values to select from, in any order.
+ * :param num_values: The number of values in ``values``.
+ * :param weights: The weight of the input that spends each UTXO, including
+ *|    its witness.
+ * :param num_weights: The number of weights in ``weights``. Must equal
+ *|    ``num_values``.
+ * :param target: The desired payment value target, including the fee for
+ *|    the non-input parts of the transaction.
+ * :param fee_rate: The fee rate of the transaction in satoshi per 1000 vbytes.
+ * :param long_term_fee_rate: The expected long term fee rate in satoshi per
+ *|    1000 vbytes, used to value spending inputs now versus later.
+ * :param cost_of_change: The fee to create a change output plus the fee to
+ *|    spend it later. A selection exceeding ``target`` by no more than this
+ *|    is used without change.
+ * :param attempts: The maximum number of permutations to check when
+ *|    searching for a changeless solution. Must be non-zero, a good
+ *|    default value is ``100000``.
+ * :param flags: For future use. Must be 0.
+ * :param indices_out: Destination for the zero-based indices into ``values``
+ *|    making up the chosen solution. Must be at least the smaller
+ *|    of ``num_values`` and `WALLY_CS_MAX_INPUTS`.
+ * MAX_SIZED_OUTPUT(indices_out_len, indices_out, WALLY_CS_MAX_INPUTS)
+ * :param written: Destination for the the number of indices written
+ *|    to ``indices_out``.
+ *
+ * UTXOs whose value does not cover the fee to spend them are never selected.
+ * A changeless solution is searched for first. If none is found, a solution
+ * that covers ``target`` plus ``cost_of_change`` is returned, and a change
+ * output will be required. If no solution is possible using at most
+ * `WALLY_CS_MAX_INPUTS` inputs then zero elements will be returned.
+ */
+WALLY_CORE_API int wally_coinselect(
+    const uint64_t *values,
+    size_t num_values,
+    const uint32_t *weights,
+    size_t num_weights,
+    uint64_t target,
+    uint64_t fee_rate,
+    uint64_t long_term_fee_rate,
+    uint64_t cost_of_change,
+    uint64_t attempts,
+    uint32_t flags,
+    uint32_t *indices_out,
+    size_t indices_out_len,
+    size_t *written);
+
 #ifndef WALLY_ABI_NO_ELEMENTS
 
 /**
@@ -47,6 +99,49 @@ WALLY_CORE_API int wally_coinselect_assets(
     size_t indices_out_len,
     size_t *written);
 
+/**
+ * Select input asset values to meet a given payment target, searching
+ * independent parts of the search space separately.
+ *
+ * :param values: The UTXO asset values to select from. Must be ordered from
+ *|    largest to smallest.
+ * :param num_values: The number of asset values in ``values``.
+ * :param target: The desired payment value target.
+ * :param attempts: The maximum number of permutations to check in each
+ *|    part of the search space. Must be at least ``num_values`` + 1.
+ * :param io_ratio: The approximate expected ratio of input to output sizes
+ *|    in the resulting transaction. Larger values will result in more
+ *|    input permutations being searched for exact matches. Must be non-zero,
+ *|    a good default value is ``5``.
+ * :param num_subtrees: The number of parts to split the search space into.
+ *|    Must be non-zero. ``1`` searches the same space as `wally_coinselect_assets`.
+ *|    Values above `WALLY_CS_MAX_ASSETS` are treated as `WALLY_CS_MAX_ASSETS`.
+ * :param indices_out: Destination for the zero-based indices into ``values``
+ *|    making up the chosen solution. Must be at least the smaller
+ *|    of ``num_values`` and `WALLY_CS_MAX_ASSETS`.
+ * MAX_SIZED_OUTPUT(indices_out_len, indices_out, WALLY_CS_MAX_ASSETS)
+ * :param written: Destination for the the number of indices written
+ *|    to ``indices_out``.
+ *
+ * The search space is split by the largest value selected: the first
+ * ``num_subtrees`` - 1 parts each contain the selections starting with
+ * one of the largest values, and the final part contains the remainder.
+ * Each part is searched with its own ``attempts`` budget, so increasing
+ * ``num_subtrees`` searches more of the space for large UTXO sets. The
+ * result depends only on the arguments given. If the given values are
+ * insufficient to reach the target then zero elements will be returned.
+ */
+WALLY_CORE_API int wally_coinselect_assets_split(
+    const uint64_t *values,
+    size_t num_values,
+    uint64_t target,
+    uint64_t attempts,
+    uint32_t io_ratio,
+    uint32_t num_subtrees,
+    uint32_t *indices_out,
+    size_t indices_out_len,
+    size_t *written);
+
 #endif /* WALLY_ABI_NO_ELEMENTS */
 
 #ifdef __cplusplus
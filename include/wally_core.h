@@ -34,18 +34,27 @@ extern "C" {
 #define WALLY_PATCH_VER 0
 #define WALLY_BUILD_VER 0x10400
 
+/** Do not securely clear public data such as transactions, scripts and proofs when freeing it */
+#define WALLY_INIT_FLAG_NO_CLEAR_PUBLIC 0x1
+
 /**
  * Initialize wally.
  *
  * This function must be called once before threads are created by the application.
  *
- * :param flags: Flags controlling what to initialize. Currently must be zero.
+ * :param flags: Flags controlling what to initialize. ``WALLY_INIT_FLAG_NO_CLEAR_PUBLIC``
+ *|    can be given to free public data without zeroing it, which speeds up
+ *|    freeing large transactions and PSBTs. Secret data, such as PSBT
+ *|    preimages, unknown fields and Elements blinding data, is always cleared.
  */
 WALLY_CORE_API int wally_init(uint32_t flags);
 
 /**
  * Free any internally allocated memory.
  *
+ * When wally is built with thread support, this frees the state of the
+ * calling thread only; the state of other threads is freed when they exit.
+ *
  * :param flags: Flags controlling what to clean up. Currently must be zero.
  */
 WALLY_CORE_API int wally_cleanup(uint32_t flags);
@@ -110,9 +119,10 @@ WALLY_CORE_API char *wally_strdup(const char *str);
 /**
  * Fetch the wally internal secp256k1 context object.
  *
- * By default, a single global context is created on demand. This behaviour
- * can be overridden by providing a custom context fetching function when
- * calling `wally_set_operations`.
+ * By default, a context is created on demand for each thread that uses
+ * wally, or a single global context if wally is built without thread
+ * support. This behaviour can be overridden by providing a custom context
+ * fetching function when calling `wally_set_operations`.
  */
 WALLY_CORE_API struct secp256k1_context_struct *wally_get_secp_context(void);
 
@@ -158,18 +168,20 @@ WALLY_CORE_API int wally_free_string(
  * Provide entropy to randomize the libraries internal libsecp256k1 context.
  *
  * Random data is used in libsecp256k1 to blind the data being processed,
- * making side channel attacks more difficult. By default, Wally uses a single
- * internal context for secp functions that is not initially randomized.
+ * making side channel attacks more difficult. By default, Wally uses an
+ * internal context for secp functions in each thread that is not initially
+ * randomized.
  *
  * The caller should call this function before using any functions that rely on
- * libsecp256k1 (i.e. Anything using public/private keys). If the caller
- * has overridden the library's default libsecp context fetching using
- * `wally_set_operations`, then it may be necessary to call this function
- * before calling wally functions in each thread created by the caller.
+ * libsecp256k1 (i.e. Anything using public/private keys). When wally is
+ * built with thread support, the default context of every thread, including
+ * threads created later, is randomized with ``bytes`` before its next use.
+ * A custom context set with `wally_set_operations` is randomized only when
+ * this function is called while it is installed.
  *
- * If wally is used in its default configuration, this function should either
- * be called before threads are created or access to wally functions wrapped
- * in an application level mutex.
+ * If wally is built without thread support, a single global context is
+ * used and this function should either be called before threads are
+ * created or access to wally functions wrapped in an application level mutex.
  *
  * :param bytes: Entropy to use.
  * :param bytes_len: Size of ``bytes`` in bytes. Must be `WALLY_SECP_RANDOMIZE_LEN`.
@@ -256,6 +268,31 @@ WALLY_CORE_API int wally_base58_from_bytes(
     uint32_t flags,
     char **output);
 
+#ifndef SWIG
+/**
+ * Create a base 58 encoded string representing binary data, without allocating.
+ *
+ * :param bytes: Binary data to convert.
+ * :param bytes_len: The length of ``bytes`` in bytes.
+ * :param flags: Pass `BASE58_FLAG_CHECKSUM` if ``bytes`` should have a
+ *|    checksum calculated and appended before converting to base 58.
+ * :param str_out: Destination for the NUL terminated base 58 encoded string.
+ * :param len: The length of ``str_out`` in bytes.
+ * :param written: Destination for the number of bytes written to ``str_out``,
+ *|    including the NUL terminator.
+ *
+ * .. note:: This is a non-standard call for low-level use. It follows the
+ *|    conventions of :ref:`variable-length-output-buffers`.
+ */
+WALLY_CORE_API int wally_base58_from_bytes_into(
+    const unsigned char *bytes,
+    size_t bytes_len,
+    uint32_t flags,
+    char *str_out,
+    size_t len,
+    size_t *written);
+#endif /* SWIG */
+
 /**
  * Decode a base 58 encoded string back into into binary data.
  *
@@ -428,6 +465,28 @@ typedef int (*wally_get_error_t)(void);
 typedef int (*wally_set_error_t)(
     int error_code);
 
+/** The type of a task run by a `wally_executor_t`, called once for each index */
+typedef void (*wally_task_t)(
+    void *ctx,
+    size_t index);
+
+/**
+ * The type of an overridable function to run independent tasks.
+ *
+ * The executor must call ``task(ctx, i)`` exactly once for each ``i``
+ * from 0 to ``num_tasks - 1``, and return only once every call has
+ * completed. Calls may be made in any order and concurrently from
+ * multiple threads. ``executor_ctx`` is the value given in
+ * `wally_operations`. The default executor runs each task in order
+ * on the calling thread. Tasks use the secp context of the thread that
+ * started them, whichever thread they are run on.
+ */
+typedef void (*wally_executor_t)(
+    wally_task_t task,
+    void *ctx,
+    size_t num_tasks,
+    void *executor_ctx);
+
 /** Structure holding function pointers for overridable wally operations */
 struct wally_operations {
     uintptr_t struct_size; /* Must be initialised to sizeof(wally_operations) */
@@ -438,8 +497,8 @@ struct wally_operations {
     secp_context_t secp_context_fn;
     wally_get_error_t get_error_fn;
     wally_set_error_t set_error_fn;
-    void *reserved_3; /* reserved_ pointers are reserved for future use */
-    void *reserved_4;
+    wally_executor_t executor_fn;
+    void *executor_ctx; /* Passed to executor_fn, set along with it */
 };
 
 /**
@@ -456,10 +515,153 @@ WALLY_CORE_API int wally_get_operations(
  * :param ops: The overridable operations to set.
  *
  * .. note:: Any NULL members in the passed structure are ignored.
+ *|    ``executor_ctx`` is only set when ``executor_fn`` is non-NULL, and
+ *|    may be NULL.
  */
 WALLY_CORE_API int wally_set_operations(
     const struct wally_operations *ops);
 
+
+/** Statistics for the calling threads allocation pool */
+struct wally_pool_stats {
+    uint64_t num_allocs; /* Number of allocations made */
+    uint64_t num_hits; /* Number of allocations served from cached blocks */
+    uint64_t num_frees; /* Number of allocations freed */
+    uint64_t num_cached; /* Number of blocks currently cached */
+    uint64_t cached_bytes; /* Size of the blocks currently cached */
+};
+
+/**
+ * Allocate memory using wally's pooled allocator.
+ *
+ * Small allocations are rounded up to one of a set of size classes covering
+ * keys, signatures and small scripts. Freed blocks of these sizes are cached
+ * by each thread for reuse, avoiding system allocator calls. As with the
+ * default allocator, memory is not cleared when freed: wally clears any data
+ * that requires it before freeing, subject to ``WALLY_INIT_FLAG_NO_CLEAR_PUBLIC``.
+ *
+ * To use the pooled allocator, set the ``malloc_fn`` and ``free_fn`` members
+ * of `wally_operations` to `wally_pool_malloc` and `wally_pool_free` and call
+ * `wally_set_operations` before any memory has been allocated by wally.
+ * Cached blocks are returned to the system when each thread exits, or by
+ * calling `wally_cleanup` from the thread.
+ *
+ * :param size: The number of bytes to allocate.
+ */
+WALLY_CORE_API void *wally_pool_malloc(
+    size_t size);
+
+/**
+ * Free memory allocated by `wally_pool_malloc`.
+ *
+ * :param ptr: The memory to free, or NULL.
+ */
+WALLY_CORE_API void wally_pool_free(
+    void *ptr);
+
+/**
+ * Get the calling threads pooled allocator statistics.
+ *
+ * :param output: Destination for the statistics.
+ */
+WALLY_CORE_API int wally_pool_get_stats(
+    struct wally_pool_stats *output);
+
+/**
+ * Create a secure arena for secret data used by the calling thread.
+ *
+ * Once created, temporary buffers holding private keys, seeds and
+ * passphrases are allocated from the arena when performing key derivation,
+ * seed generation and PSBT signing. The arena is locked into memory so it
+ * cannot be swapped, is surrounded by inaccessible guard pages, and is
+ * excluded from core dumps where supported. Memory released to the arena is
+ * not cleared until `wally_secure_arena_reset` is called, which clears it
+ * all at once. Calls made while the arena is full use the stack or heap and
+ * clear their secrets immediately as normal.
+ *
+ * Any existing arena for the calling thread is cleared and replaced. The
+ * arena is freed when the thread exits, or by calling
+ * `wally_secure_arena_free` or `wally_cleanup` from the thread.
+ *
+ * :param len: The size of the arena in bytes. This is rounded up to a
+ *|    multiple of the system page size.
+ * :param flags: Flags controlling arena creation. Must be 0.
+ *
+ * .. note:: Returns ``WALLY_ERROR`` if the platform does not support locked
+ *|    memory, or the arena could not be locked (e.g. because it exceeds
+ *|    ``RLIMIT_MEMLOCK``).
+ */
+WALLY_CORE_API int wally_secure_arena_init(
+    size_t len,
+    uint32_t flags);
+
+/**
+ * Clear all secret data released to the calling threads secure arena.
+ *
+ * :param flags: Flags controlling clearing. Must be 0.
+ * :param written: Destination for the number of bytes cleared, or NULL.
+ *
+ * .. note:: Does nothing if the calling thread has no secure arena.
+ */
+WALLY_CORE_API int wally_secure_arena_reset(
+    uint32_t flags,
+    size_t *written);
+
+/**
+ * Clear and free the calling threads secure arena.
+ *
+ * :param flags: Flags controlling freeing. Must be 0.
+ *
+ * .. note:: Does nothing if the calling thread has no secure arena.
+ */
+WALLY_CORE_API int wally_secure_arena_free(
+    uint32_t flags);
+
+/* Operations instrumented when wally is built with ``--enable-stats`` */
+#define WALLY_STATS_OTHER 0 /* Allocations made outside of any instrumented operation */
+#define WALLY_STATS_TX_PARSE 1 /* `wally_tx_from_bytes` and variants */
+#define WALLY_STATS_TX_SERIALIZE 2 /* `wally_tx_to_bytes` and variants */
+#define WALLY_STATS_PSBT_PARSE 3 /* `wally_psbt_from_bytes` and variants */
+#define WALLY_STATS_PSBT_SERIALIZE 4 /* `wally_psbt_to_bytes` and variants */
+#define WALLY_STATS_SIGHASH 5 /* `wally_tx_get_input_signature_hash` and variants */
+#define WALLY_STATS_BIP32_DERIVE 6 /* `bip32_key_from_parent` and variants */
+#define WALLY_STATS_PSBT_SIGN 7 /* `wally_psbt_sign_bip32` */
+#define WALLY_STATS_PSBT_BLIND 8 /* `wally_psbt_blind` */
+#define WALLY_STATS_DESCRIPTOR_ADDRESSES 9 /* `wally_descriptor_to_addresses` */
+#define WALLY_STATS_RANGEPROOF 10 /* `wally_asset_rangeproof_with_nonce` and variants */
+#define WALLY_STATS_SURJECTIONPROOF 11 /* `wally_asset_surjectionproof` */
+#define WALLY_STATS_NUM 12 /* The number of instrumented operations */
+
+#define WALLY_STATS_FLAG_RESET 0x1 /* Reset statistics after fetching them */
+
+/** Statistics for an instrumented operation */
+struct wally_stats {
+    uint64_t num_calls; /* Number of calls made */
+    uint64_t ticks; /* Cumulative CPU cycles or clock ticks spent in calls */
+    uint64_t num_allocs; /* Number of allocations made during calls */
+    uint64_t alloc_bytes; /* Total bytes allocated during calls */
+    uint64_t num_frees; /* Number of allocations freed during calls */
+};
+
+/**
+ * Get instrumentation statistics for the library's hot paths.
+ *
+ * Statistics are only gathered when wally is built with ``--enable-stats``
+ * (or ``WALLYCORE_ENABLE_STATS`` with CMake), otherwise this function
+ * returns `WALLY_ERROR`. Statistics are process wide. Allocations
+ * are attributed to the innermost instrumented operation in progress on
+ * the calling thread, or to `WALLY_STATS_OTHER` if there is none, while
+ * call counts and ticks include any nested operations.
+ *
+ * :param flags: `WALLY_STATS_FLAG_RESET` to reset the statistics, or 0.
+ * :param output: Destination for the statistics, indexed by operation.
+ * :param num_output: The number of entries in ``output``. Must be `WALLY_STATS_NUM`.
+ */
+WALLY_CORE_API int wally_get_stats(
+    uint32_t flags,
+    struct wally_stats *output,
+    size_t num_output);
+
 #endif /* SWIG */
 
 /**
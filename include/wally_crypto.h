@@ -249,6 +249,24 @@ WALLY_CORE_API int wally_hash160(
     unsigned char *bytes_out,
     size_t len);
 
+/**
+ * RIPEMD-160(SHA-256(m)) for a batch of equal length messages.
+ *
+ * :param bytes: The messages to hash, concatenated.
+ * :param bytes_len: The length of ``bytes`` in bytes. Must be a non-zero
+ *|    multiple of ``item_len``.
+ * :param item_len: The length of each message, e.g. `EC_PUBLIC_KEY_LEN`.
+ * :param bytes_out: Destination for the resulting concatenated hashes.
+ * :param len: The length of ``bytes_out`` in bytes. Must be the number of
+ *|    messages times `HASH160_LEN`.
+ */
+WALLY_CORE_API int wally_hash160_batch(
+    const unsigned char *bytes,
+    size_t bytes_len,
+    size_t item_len,
+    unsigned char *bytes_out,
+    size_t len);
+
 
 /** Output length for `wally_hmac_sha256` */
 #define HMAC_SHA256_LEN 32
@@ -596,6 +614,62 @@ WALLY_CORE_API int wally_ec_sig_from_bytes_aux(
     unsigned char *bytes_out,
     size_t len);
 
+/**
+ * Get the expected length of a batch of signatures in bytes.
+ *
+ * :param priv_key: The private key to sign with.
+ * :param priv_key_len: The length of ``priv_key`` in bytes. Must be `EC_PRIVATE_KEY_LEN`.
+ * :param bytes: The concatenated message hashes to sign.
+ * :param bytes_len: The length of ``bytes`` in bytes. Must be a non-zero
+ *|    multiple of `EC_MESSAGE_HASH_LEN`.
+ * :param aux_rand: Optional concatenated auxiliary data or NULL. See `wally_ec_sig_from_bytes_batch`.
+ * :param aux_rand_len: The length of ``aux_rand`` in bytes. See `wally_ec_sig_from_bytes_batch`.
+ * :param flags: :ref:`ec-flags` indicating desired behavior.
+ * :param written: Destination for the expected length of the signatures.
+ */
+WALLY_CORE_API int wally_ec_sig_from_bytes_batch_len(
+    const unsigned char *priv_key,
+    size_t priv_key_len,
+    const unsigned char *bytes,
+    size_t bytes_len,
+    const unsigned char *aux_rand,
+    size_t aux_rand_len,
+    uint32_t flags,
+    size_t *written);
+
+/**
+ * Sign a batch of message hashes with a single private key.
+ *
+ * The private key is validated (and for BIP340/schnorr signatures, its
+ * keypair computed) once for the whole batch. The resulting signatures are
+ * identical to calling `wally_ec_sig_from_bytes_aux` for each message hash.
+ *
+ * :param priv_key: The private key to sign with.
+ * :param priv_key_len: The length of ``priv_key`` in bytes. Must be `EC_PRIVATE_KEY_LEN`.
+ * :param bytes: The concatenated message hashes to sign.
+ * :param bytes_len: The length of ``bytes`` in bytes. Must be a non-zero
+ *|    multiple of `EC_MESSAGE_HASH_LEN`.
+ * :param aux_rand: Optional concatenated auxiliary data or NULL, 32 bytes
+ *|    for each message hash. See `wally_ec_sig_from_bytes_aux`.
+ * :param aux_rand_len: The length of ``aux_rand`` in bytes. Must be ``32``
+ *|    times the number of message hashes if ``aux_rand`` is non-NULL.
+ * :param flags: :ref:`ec-flags` indicating desired behavior.
+ * :param bytes_out: Destination for the resulting concatenated compact signatures.
+ * :param len: The length of ``bytes_out`` in bytes. Must be the number of
+ *|    message hashes times `EC_SIGNATURE_RECOVERABLE_LEN` if flags includes
+ *|    `EC_FLAG_RECOVERABLE`, otherwise times `EC_SIGNATURE_LEN`.
+ */
+WALLY_CORE_API int wally_ec_sig_from_bytes_batch(
+    const unsigned char *priv_key,
+    size_t priv_key_len,
+    const unsigned char *bytes,
+    size_t bytes_len,
+    const unsigned char *aux_rand,
+    size_t aux_rand_len,
+    uint32_t flags,
+    unsigned char *bytes_out,
+    size_t len);
+
 /**
  * Convert a signature to low-s form.
  *
@@ -838,6 +912,71 @@ WALLY_CORE_API int wally_ecdh(
     unsigned char *bytes_out,
     size_t len);
 
+/** The length of a serialized outpoint: a txid followed by its output index */
+#define WALLY_BIP352_OUTPOINT_LEN 36
+/** The length of a silent payment match returned by `wally_bip352_scan` */
+#define WALLY_BIP352_MATCH_LEN 40
+
+/**
+ * Scan a batch of transactions for BIP352 silent payments.
+ *
+ * :param scan_priv_key: The receivers scan private key.
+ * :param scan_priv_key_len: The length of ``scan_priv_key`` in bytes. Must be `EC_PRIVATE_KEY_LEN`.
+ * :param spend_pub_key: The receivers spend public key.
+ * :param spend_pub_key_len: The length of ``spend_pub_key`` in bytes. Must be `EC_PUBLIC_KEY_LEN`.
+ * :param outpoints: The lexicographically smallest serialized input outpoint
+ *|    of each transaction, concatenated.
+ * :param outpoints_len: The length of ``outpoints`` in bytes. Must be
+ *|    `WALLY_BIP352_OUTPOINT_LEN` * the number of transactions.
+ * :param pub_keys: The public keys of each transactions inputs that are
+ *|    eligible for silent payments, concatenated. X-only keys from taproot
+ *|    inputs must be given with an even (0x02) prefix.
+ * :param pub_keys_len: The length of ``pub_keys`` in bytes. Must be
+ *|    `EC_PUBLIC_KEY_LEN` * the total number of input keys.
+ * :param num_pub_keys: The number of input keys for each transaction.
+ * :param num_pub_keys_len: The number of transactions in the batch.
+ * :param output_keys: The x-only public keys of each transactions taproot
+ *|    outputs, concatenated.
+ * :param output_keys_len: The length of ``output_keys`` in bytes. Must be
+ *|    `EC_XONLY_PUBLIC_KEY_LEN` * the total number of output keys.
+ * :param num_output_keys: The number of output keys for each transaction.
+ * :param num_output_keys_len: The number of transactions in the batch.
+ *|    Must equal ``num_pub_keys_len``.
+ * :param flags: For future use. Must be 0.
+ * :param bytes_out: Destination for the matches found.
+ * :param len: The length of ``bytes_out`` in bytes.
+ * :param written: Destination for the number of bytes written to ``bytes_out``.
+ *
+ * Each match is `WALLY_BIP352_MATCH_LEN` bytes: the index of the transaction
+ * in the batch and the index of the matched output key within it, both
+ * as 4 byte little endian values, followed by the tweak ``t_k``. The
+ * private key for the output is the receivers spend private key plus
+ * the tweak. Matches are returned in transaction order, then in the order
+ * of ``k``. Transactions without eligible inputs are skipped. Labels are
+ * not supported.
+ *
+ * .. note:: This function follows the conventions of :ref:`variable-length-output-buffers`.
+ */
+WALLY_CORE_API int wally_bip352_scan(
+    const unsigned char *scan_priv_key,
+    size_t scan_priv_key_len,
+    const unsigned char *spend_pub_key,
+    size_t spend_pub_key_len,
+    const unsigned char *outpoints,
+    size_t outpoints_len,
+    const unsigned char *pub_keys,
+    size_t pub_keys_len,
+    const uint32_t *num_pub_keys,
+    size_t num_pub_keys_len,
+    const unsigned char *output_keys,
+    size_t output_keys_len,
+    const uint32_t *num_output_keys,
+    size_t num_output_keys_len,
+    uint32_t flags,
+    unsigned char *bytes_out,
+    size_t len,
+    size_t *written);
+
 /** The length of a data committed using sign-to-contract (s2c) */
 #define WALLY_S2C_DATA_LEN 32
 /** The length of a sign-to-contract (s2c) opening */
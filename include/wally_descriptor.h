@@ -395,6 +395,33 @@ WALLY_CORE_API int wally_descriptor_to_addresses(
     char **output,
     size_t num_outputs);
 
+#ifndef SWIG
+/**
+ * Create addresses for the derived range of an output descriptor, without allocating.
+ *
+ * :param descriptor: Parsed output descriptor.
+ * :param variant: The variant of descriptor to generate. See `wally_descriptor_get_num_variants`.
+ * :param multi_index: The multi-path item to generate. See `wally_descriptor_get_num_paths`.
+ * :param child_num: The BIP32 child number to derive, or zero for static descriptors.
+ * :param flags: For future use. Must be 0.
+ * :param output: Destination for the resulting addresses. The address for
+ *|    ``child_num + N`` is written NUL terminated and NUL padded to the slot
+ *|    starting at ``N * WALLY_SEGWIT_ADDRESS_MAX_LEN``.
+ * :param len: The length of ``output`` in bytes. Must be a non-zero
+ *|    multiple of `WALLY_SEGWIT_ADDRESS_MAX_LEN`.
+ *
+ * .. note:: This is a non-standard call for low-level use.
+ */
+WALLY_CORE_API int wally_descriptor_to_addresses_into(
+    const struct wally_descriptor *descriptor,
+    uint32_t variant,
+    uint32_t multi_index,
+    uint32_t child_num,
+    uint32_t flags,
+    char *output,
+    size_t len);
+#endif /* SWIG */
+
 #ifdef __cplusplus
 }
 #endif
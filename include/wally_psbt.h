@@ -145,6 +145,7 @@ struct wally_psbt {
     unsigned char genesis_blockhash[SHA256_LEN]; /* All zeros if not present */
 #endif /* WALLY_ABI_NO_ELEMENTS */
     struct wally_map *signing_cache;
+    struct psbt_outpoint_index *outpoint_index;
 };
 #endif /* SWIG */
 
@@ -193,6 +194,14 @@ WALLY_CORE_API int wally_psbt_input_clear_sequence(
  *
  * :param input: The input to update.
  * :param utxo: The (non witness) utxo for this input if it exists.
+ *
+ * .. note:: The txid of ``utxo`` is computed when it is set, and used to
+ *|    check it against the input's previous txid when signing. Inputs of
+ *|    a PSBT that spend outputs of the same transaction share a single copy
+ *|    of it when parsed, cloned or set with `wally_psbt_set_input_utxo`.
+ *|    The utxo of an input should not be modified in place, and must only
+ *|    be assigned, replaced or freed using this function or
+ *|    `wally_psbt_set_input_utxo`.
  */
 WALLY_CORE_API int wally_psbt_input_set_utxo(
     struct wally_psbt_input *input,
@@ -2178,6 +2187,63 @@ WALLY_CORE_API int wally_psbt_find_input_spending_utxo(
     uint32_t utxo_index,
     size_t *written);
 
+/**
+ * Find the indices of the PSBT inputs that spend a batch of UTXOs.
+ *
+ * :param psbt: The PSBT to find in.
+ * :param txhashes: The transaction hashes of the UTXOs to search for, concatenated.
+ * :param txhashes_len: Size of ``txhashes`` in bytes. Must be ``num_utxo_indices``
+ *|    times `WALLY_TXHASH_LEN`.
+ * :param utxo_indices: The zero-based indices of the transaction outputs in
+ *|    ``txhashes`` to search for.
+ * :param num_utxo_indices: The number of UTXOs to search for. Must be non-zero.
+ * :param indices_out: Destination for the results. For each UTXO, set to zero
+ *|    if no matching input is found, otherwise the index of the matching
+ *|    input plus one, as per `wally_psbt_find_input_spending_utxo`.
+ * :param indices_out_len: The number of elements in ``indices_out``. Must be
+ *|    at least ``num_utxo_indices``.
+ * :param written: Destination for the number of results written to ``indices_out``.
+ */
+WALLY_CORE_API int wally_psbt_find_inputs_spending_utxos(
+    const struct wally_psbt *psbt,
+    const unsigned char *txhashes,
+    size_t txhashes_len,
+    const uint32_t *utxo_indices,
+    size_t num_utxo_indices,
+    uint32_t *indices_out,
+    size_t indices_out_len,
+    size_t *written);
+
+/**
+ * Enable an index of the outpoints spent by a PSBT's inputs.
+ *
+ * When enabled, `wally_psbt_find_input_spending_utxo` and
+ * `wally_psbt_find_inputs_spending_utxos` look up inputs using the index
+ * instead of searching every input. The index is kept up to date when
+ * inputs are added or removed, or when their previous txid or output index
+ * are changed through the ``wally_psbt_`` functions.
+ *
+ * :param psbt: PSBT to enable the outpoint index for. Directly modifies this PSBT.
+ * :param flags: Flags controlling the outpoint index. Must be 0.
+ *
+ * .. note:: The outpoint index is local to the given PSBT and is not
+ *|    serialized or cloned with it. If the inputs of the PSBT are modified
+ *|    directly, this function should be called again to rebuild the index.
+ *|    If memory for the index cannot be allocated while modifying the PSBT,
+ *|    the index is disabled and lookups revert to searching every input.
+ */
+WALLY_CORE_API int wally_psbt_outpoint_index_enable(
+    struct wally_psbt *psbt,
+    uint32_t flags);
+
+/**
+ * Disable the outpoint index of a PSBT.
+ *
+ * :param psbt: PSBT to disable the outpoint index for. Directly modifies this PSBT.
+ */
+WALLY_CORE_API int wally_psbt_outpoint_index_disable(
+    struct wally_psbt *psbt);
+
 /**
  * Add a keypath to a given PSBT input.
  *
@@ -2548,6 +2614,60 @@ WALLY_CORE_API int wally_psbt_combine_ex(
     uint32_t flags,
     const struct wally_psbt *source);
 
+/**
+ * Get the changes between two PSBTs of the same transaction as a patch.
+ *
+ * :param base: the PSBT to compute changes from.
+ * :param psbt: the PSBT to compute changes to.
+ * :param flags: Flags controlling patch creation. Must be 0.
+ * :param bytes_out: Destination for the serialized patch.
+ * :param len: Length of ``bytes_out`` in bytes (use `wally_psbt_get_patch_length`).
+ * :param written: number of bytes written to bytes_out.
+ *
+ * .. note:: The patch contains only the key-value pairs that were added,
+ *|    changed or removed in ``psbt``, and can be applied to ``base``
+ *|    or to any other PSBT of the same transaction with `wally_psbt_apply_patch`.
+ */
+WALLY_CORE_API int wally_psbt_get_patch(
+    const struct wally_psbt *base,
+    const struct wally_psbt *psbt,
+    uint32_t flags,
+    unsigned char *bytes_out,
+    size_t len,
+    size_t *written);
+
+/**
+ * Get the length of the patch between two PSBTs of the same transaction.
+ *
+ * :param base: the PSBT to compute changes from.
+ * :param psbt: the PSBT to compute changes to.
+ * :param flags: Flags controlling patch creation. Must be 0.
+ * :param written: Destination for the length in bytes of the serialized patch.
+ */
+WALLY_CORE_API int wally_psbt_get_patch_length(
+    const struct wally_psbt *base,
+    const struct wally_psbt *psbt,
+    uint32_t flags,
+    size_t *written);
+
+/**
+ * Apply a patch created by `wally_psbt_get_patch` to a PSBT.
+ *
+ * :param psbt: the PSBT to apply the patch to. Directly modifies this PSBT.
+ * :param bytes: The serialized patch to apply.
+ * :param bytes_len: Length of ``bytes`` in bytes.
+ * :param flags: Flags controlling patch application. Must be 0.
+ *
+ * .. note:: Only the inputs and outputs changed by the patch are re-parsed.
+ *|    The PSBT is not modified if the patch is invalid, is for a different
+ *|    transaction, or would change the transaction.
+ */
+WALLY_CORE_API int wally_psbt_apply_patch(
+    struct wally_psbt *psbt,
+    const unsigned char *bytes,
+    size_t bytes_len,
+    uint32_t flags);
+
 /**
  * Clone a PSBT into a newly allocated copy.
  *
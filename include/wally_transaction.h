@@ -701,6 +701,32 @@ WALLY_CORE_API int wally_tx_from_hex(
     uint32_t flags,
     struct wally_tx **output);
 
+/**
+ * Compute the txids of a batch of serialized transactions.
+ *
+ * Transactions are validated as per `wally_tx_from_bytes`, but are not
+ * allocated: each txid is computed directly from ``bytes``.
+ *
+ * :param bytes: The serialized transactions, concatenated.
+ * :param bytes_len: Length of ``bytes`` in bytes.
+ * :param flags: ``WALLY_TX_FLAG_`` Flags controlling serialization options.
+ * :param bytes_out: Destination for the resulting txids, concatenated in
+ *|    the same order as the transactions in ``bytes``.
+ * :param len: Size of ``bytes_out`` in bytes.
+ * :param written: Destination for the number of bytes written to ``bytes_out``.
+ *
+ * .. note:: This is a non-standard call for low-level use. It follows the
+ *|    conventions of :ref:`variable-length-output-buffers`. If any
+ *|    transaction is invalid, WALLY_EINVAL is returned.
+ */
+WALLY_CORE_API int wally_tx_get_txids_batch(
+    const unsigned char *bytes,
+    size_t bytes_len,
+    uint32_t flags,
+    unsigned char *bytes_out,
+    size_t len,
+    size_t *written);
+
 /**
  * Serialize a transaction to bytes.
  *
@@ -937,6 +963,50 @@ WALLY_CORE_API int wally_tx_get_input_signature_hash(
     unsigned char *bytes_out,
     size_t len);
 
+/**
+ * Get the signature hashes for signing every input of a transaction.
+ *
+ * The hashes are identical to calling `wally_tx_get_input_signature_hash`
+ * for each input with no codeseparator or annex, and for taproot, with
+ * key path signing.
+ *
+ * :param tx: The transaction to generate the signature hashes from.
+ * :param scripts: For taproot, the scriptpubkeys of each input in the
+ *|    transaction. Otherwise, the script to sign each input with: the
+ *|    scriptpubkey or redeem script for pre-segwit signing, or the scriptCode
+ *|    for segwit v0 signing, where P2WPKH scriptpubkeys are converted to
+ *|    their scriptCode automatically. Indexed by their 0-based input index.
+ * :param assets: The asset commitments of each input in the transaction,
+ *|    or NULL for non-Elements transactions. Ignored for non-taproot signing.
+ * :param values: The satoshi values(BTC) or value commitments(Elements) of
+ *|    each input in the transaction, as per `wally_tx_get_input_signature_hash`.
+ * :param genesis_blockhash: The genesis blockhash of the chain to sign for,
+ *|    or NULL for non-Elements transactions. Only used for taproot signing.
+ * :param genesis_blockhash_len: Length of ``genesis_blockhash`` in bytes. Must
+ *|    be `SHA256_LEN` or 0.
+ * :param sighash: ``WALLY_SIGHASH_`` flags specifying the sighash flags
+ *|    to sign every input with.
+ * :param flags: :ref:`tx-sighash-type` controlling signature hash generation.
+ * :param cache: An opaque cache for faster generation, or NULL. As per
+ *|    `wally_tx_get_input_signature_hash`. Data common to all inputs is
+ *|    only computed once even if NULL is given.
+ * :param bytes_out: Destination for the resulting concatenated signature hashes.
+ * :param len: The length of ``bytes_out`` in bytes. Must be the number of
+ *|    inputs in ``tx`` times `SHA256_LEN`.
+ */
+WALLY_CORE_API int wally_tx_get_input_signature_hash_batch(
+    const struct wally_tx *tx,
+    const struct wally_map *scripts,
+    const struct wally_map *assets,
+    const struct wally_map *values,
+    const unsigned char *genesis_blockhash,
+    size_t genesis_blockhash_len,
+    uint32_t sighash,
+    uint32_t flags,
+    struct wally_map *cache,
+    unsigned char *bytes_out,
+    size_t len);
+
 /**
  * Determine if a transaction is a coinbase transaction.
  *
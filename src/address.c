@@ -4,16 +4,10 @@
 #include <include/wally_crypto.h>
 #include <include/wally_script.h>
 
-int wally_bip32_key_to_address(const struct ext_key *hdkey, uint32_t flags,
-                               uint32_t version, char **output)
+static int bip32_key_to_address(const struct ext_key *hdkey, uint32_t flags,
+                                uint32_t version, unsigned char *address)
 {
-    unsigned char address[HASH160_LEN + 1];
-    int ret;
-
-    if (output)
-        *output = NULL;
-
-    if (!hdkey || (version & ~0xff) || !output)
+    if (!hdkey || (version & ~0xff))
         return WALLY_EINVAL;
 
     if (flags != WALLY_ADDRESS_TYPE_P2PKH &&
@@ -47,8 +41,46 @@ int wally_bip32_key_to_address(const struct ext_key *hdkey, uint32_t flags,
         if (wally_hash160(redeem_script, sizeof(redeem_script), address + 1, HASH160_LEN) != WALLY_OK)
             return WALLY_EINVAL;
     }
+    return WALLY_OK;
+}
 
-    ret = wally_base58_from_bytes(address, sizeof(address), BASE58_FLAG_CHECKSUM, output);
+int wally_bip32_key_to_address(const struct ext_key *hdkey, uint32_t flags,
+                               uint32_t version, char **output)
+{
+    unsigned char address[HASH160_LEN + 1];
+    int ret;
+
+    if (output)
+        *output = NULL;
+
+    if (!output)
+        return WALLY_EINVAL;
+
+    ret = bip32_key_to_address(hdkey, flags, version, address);
+    if (ret == WALLY_OK)
+        ret = wally_base58_from_bytes(address, sizeof(address), BASE58_FLAG_CHECKSUM, output);
+
+    wally_clear(address, sizeof(address));
+    return ret;
+}
+
+int wally_bip32_key_to_address_into(const struct ext_key *hdkey, uint32_t flags,
+                                    uint32_t version, char *str_out, size_t len,
+                                    size_t *written)
+{
+    unsigned char address[HASH160_LEN + 1];
+    int ret;
+
+    if (written)
+        *written = 0;
+
+    if (!str_out || !len || !written)
+        return WALLY_EINVAL;
+
+    ret = bip32_key_to_address(hdkey, flags, version, address);
+    if (ret == WALLY_OK)
+        ret = wally_base58_from_bytes_into(address, sizeof(address), BASE58_FLAG_CHECKSUM,
+                                           str_out, len, written);
 
     wally_clear(address, sizeof(address));
     return ret;
@@ -73,6 +105,31 @@ int wally_bip32_key_to_addr_segwit(const struct ext_key *hdkey, const char *addr
     return ret;
 }
 
+int wally_bip32_key_to_addr_segwit_into(const struct ext_key *hdkey, const char *addr_family,
+                                        uint32_t flags, char *str_out, size_t len,
+                                        size_t *written)
+{
+    int ret;
+
+    /* Witness program bytes, including the version and data push opcode. */
+    unsigned char witness_program_bytes[HASH160_LEN + 2];
+    witness_program_bytes[0] = OP_0;
+    witness_program_bytes[1] = HASH160_LEN;
+
+    if (written)
+        *written = 0;
+
+    if (!hdkey ||
+        wally_hash160(hdkey->pub_key, sizeof(hdkey->pub_key), witness_program_bytes + 2, HASH160_LEN) != WALLY_OK)
+        return WALLY_EINVAL;
+
+    ret = wally_addr_segwit_from_bytes_into(witness_program_bytes, HASH160_LEN + 2, addr_family,
+                                            flags, str_out, len, written);
+
+    wally_clear(witness_program_bytes, sizeof(witness_program_bytes));
+    return ret;
+}
+
 static bool is_p2pkh(unsigned char version)
 {
     return version == WALLY_ADDRESS_VERSION_P2PKH_MAINNET ||
@@ -152,12 +209,12 @@ int wally_address_to_scriptpubkey(const char *addr, uint32_t network, unsigned c
 
 }
 
-int wally_scriptpubkey_to_address(const unsigned char *scriptpubkey, size_t scriptpubkey_len,
-                                  uint32_t network, char **output)
+/* Get the version prefixed hash for a P2PKH/P2SH scriptpubkey */
+static int scriptpubkey_to_address(const unsigned char *scriptpubkey, size_t scriptpubkey_len,
+                                   uint32_t network, unsigned char *bytes)
 {
     int ret;
     size_t type;
-    unsigned char bytes[1 + HASH160_LEN];
     if ((ret = wally_scriptpubkey_get_type(scriptpubkey, scriptpubkey_len, &type)) != WALLY_OK) {
         return ret;
     }
@@ -211,7 +268,33 @@ int wally_scriptpubkey_to_address(const unsigned char *scriptpubkey, size_t scri
     default:
         return WALLY_EINVAL;
     }
-    ret = wally_base58_from_bytes(bytes, sizeof(bytes), BASE58_FLAG_CHECKSUM, output);
+    return WALLY_OK;
+}
+
+int wally_scriptpubkey_to_address(const unsigned char *scriptpubkey, size_t scriptpubkey_len,
+                                  uint32_t network, char **output)
+{
+    unsigned char bytes[1 + HASH160_LEN];
+    int ret = scriptpubkey_to_address(scriptpubkey, scriptpubkey_len, network, bytes);
+    if (ret == WALLY_OK)
+        ret = wally_base58_from_bytes(bytes, sizeof(bytes), BASE58_FLAG_CHECKSUM, output);
+    wally_clear(bytes, sizeof(bytes));
+    return ret;
+}
+
+int wally_scriptpubkey_to_address_into(const unsigned char *scriptpubkey, size_t scriptpubkey_len,
+                                       uint32_t network, char *str_out, size_t len,
+                                       size_t *written)
+{
+    unsigned char bytes[1 + HASH160_LEN];
+    int ret;
+
+    if (written)
+        *written = 0;
+    ret = scriptpubkey_to_address(scriptpubkey, scriptpubkey_len, network, bytes);
+    if (ret == WALLY_OK)
+        ret = wally_base58_from_bytes_into(bytes, sizeof(bytes), BASE58_FLAG_CHECKSUM,
+                                           str_out, len, written);
     wally_clear(bytes, sizeof(bytes));
     return ret;
 }
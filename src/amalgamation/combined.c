@@ -66,6 +66,7 @@
 #include "src/hex_.c"
 #include "src/hmac.c"
 #include "src/map.c"
+#include "src/miniscript_plan.c"
 #include "src/mnemonic.c"
 #include "src/pbkdf2.c"
 #include "src/pullpush.c"
@@ -2,11 +2,11 @@
 #include "base58.h"
 #include "ccan/ccan/crypto/sha256/sha256.h"
 #include "ccan/ccan/endian/endian.h"
+#include <include/wally_bip32.h>
 #include <include/wally_crypto.h>
 
 /* Temporary stack buffer sizes */
 #define BIGNUM_WORDS 128u
-#define BIGNUM_BYTES (BIGNUM_WORDS * sizeof(uint32_t))
 #define BASE58_ALL_DEFINED_FLAGS (BASE58_FLAG_CHECKSUM)
 
 static const unsigned char base58_to_byte[256] = {
@@ -62,6 +62,17 @@ static const char byte_to_base58[58] = {
     'y','z'
 };
 
+/* Bignum limb radix used when encoding: each 32 bit limb holds 5 base 58
+ * digits, so that converting one 32 bit input word costs a single
+ * multiply/divide per limb instead of one per digit for every input byte.
+ */
+#define B58_LIMB_DIGITS 5u
+#define B58_LIMB 656356768u /* 58^5 */
+
+static const uint32_t b58_pow[B58_LIMB_DIGITS + 1] = {
+    1u, 58u, 3364u, 195112u, 11316496u, B58_LIMB
+};
+
 /* Returns non-zero on error. If 0 is returned then:
  * *len <= input value - OK, bytes_out contains data.
  * *len > input value - Failed and bytes_out untouched.
@@ -71,7 +82,7 @@ static int base58_decode(const char *base58, size_t base58_len,
 {
     uint32_t bn_buf[BIGNUM_WORDS];
     uint32_t *bn = bn_buf, *top_word, *bn_p;
-    size_t bn_words = 0, ones, cp_len, i;
+    size_t bn_words = 0, ones, cp_len, i, j, chunk;
     unsigned char *cp;
     int ret = WALLY_EINVAL;
 
@@ -101,26 +112,35 @@ static int base58_decode(const char *base58, size_t base58_len,
             goto cleanup;
         }
 
-    /* Iterate through the characters adding them to our bignum. We keep
-     * track of the current top word to avoid iterating over words that
-     * we know are zero. */
+    /* Iterate through the characters up to 5 at a time, accumulating them
+     * into a single base 58^5 digit before adding it to our bignum. The
+     * first chunk takes any remainder so that every following chunk is
+     * full. We keep track of the current top word to avoid iterating over
+     * words that we know are zero. */
     top_word = bn + bn_words - 1;
     *top_word = 0;
 
-    for (i = 0; i < base58_len; ++i) {
-        unsigned char byte = base58_to_byte[((unsigned char *)base58)[i]];
-        if (!byte--)
-            goto cleanup; /* Invalid char */
+    for (i = 0; i < base58_len; ) {
+        uint64_t carry = 0;
+
+        chunk = (base58_len - i) % B58_LIMB_DIGITS;
+        if (!chunk)
+            chunk = B58_LIMB_DIGITS;
+
+        for (j = 0; j < chunk; ++j, ++i) {
+            unsigned char byte = base58_to_byte[((unsigned char *)base58)[i]];
+            if (!byte--)
+                goto cleanup; /* Invalid char */
+            carry = carry * 58u + byte;
+        }
 
         for (bn_p = bn + bn_words - 1; bn_p >= top_word; --bn_p) {
-            uint64_t mult = *bn_p * 58ull + byte;
-            *bn_p = mult & 0xffffffff;
-            byte = (mult >> 32) & 0xff;
-            if (byte && bn_p == top_word) {
-                *--top_word = byte; /* Increase bignum size */
-                break;
-            }
+            carry += *bn_p * (uint64_t)b58_pow[chunk];
+            *bn_p = carry & 0xffffffff;
+            carry >>= 32;
         }
+        if (carry)
+            *--top_word = (uint32_t)carry; /* Increase bignum size */
     }
 
     /* We have our bignum stored from top_word to bn + bn_words - 1. Convert
@@ -156,102 +176,178 @@ uint32_t base58_get_checksum(const unsigned char *bytes, size_t bytes_len)
     struct sha256 sha;
     uint32_t checksum;
 
-    wally_sha256d(bytes, bytes_len, (unsigned char *)&sha, sizeof(sha));
+    sha256(&sha, bytes, bytes_len);
+    sha256(&sha, &sha, sizeof(sha));
     checksum = sha.u.u32[0];
     wally_clear(&sha, sizeof(sha));
     return checksum;
 }
 
+/* Convert big-endian bytes, followed by an optional checksum, into
+ * little-endian base 58^5 limbs. Returns the number of limbs written.
+ * This is inline so that callers passing a constant total_len get
+ * specialized loops with fixed trip counts.
+ */
+static inline size_t base58_to_limbs(const unsigned char *bytes,
+                                     size_t bytes_len,
+                                     const unsigned char *checksum,
+                                     size_t total_len, uint32_t *limbs)
+{
+    size_t num_limbs = 0, i = 0, j, chunk;
+
+#define b(n) (n < bytes_len ? bytes[n] : checksum[n - bytes_len])
+    while (i < total_len) {
+        uint64_t carry = 0;
+        unsigned int shift;
+
+        /* Consume up to 4 bytes as a single word; the first chunk takes
+         * any remainder so that every following chunk is a full word */
+        chunk = (total_len - i) % sizeof(uint32_t);
+        if (!chunk)
+            chunk = sizeof(uint32_t);
+        shift = chunk * 8;
+
+        for (j = 0; j < chunk; ++j, ++i)
+            carry = (carry << 8) | b(i);
+
+        for (j = 0; j < num_limbs; ++j) {
+            carry += (uint64_t)limbs[j] << shift;
+            limbs[j] = carry % B58_LIMB;
+            carry /= B58_LIMB;
+        }
+        while (carry) {
+            limbs[num_limbs++] = carry % B58_LIMB;
+            carry /= B58_LIMB;
+        }
+    }
+#undef b
+    return num_limbs;
+}
 
-int wally_base58_from_bytes(const unsigned char *bytes, size_t bytes_len,
-                            uint32_t flags, char **output)
+static int base58_encode(const unsigned char *bytes, size_t bytes_len,
+                         uint32_t flags, char **output,
+                         char *str_out, size_t len, size_t *written)
 {
-    uint32_t checksum, *cs_p = NULL;
-    unsigned char bn_buf[BIGNUM_BYTES];
-    unsigned char *bn = bn_buf, *top_byte, *bn_p;
-    size_t bn_bytes = 0, zeros, i, orig_len = bytes_len;
+    uint32_t checksum, limbs_buf[BIGNUM_WORDS];
+    uint32_t *limbs = limbs_buf, top;
+    const unsigned char *cs_p = (const unsigned char *)&checksum;
+    size_t max_limbs = 0, num_limbs = 0, zeros, top_digits, num_digits;
+    size_t total_len = bytes_len, i, j;
+    char *out;
     int ret = WALLY_EINVAL;
 
-    if (output)
-        *output = NULL;
-
-    if (!bytes || !bytes_len || (flags & ~BASE58_ALL_DEFINED_FLAGS) || !output)
+    if (!bytes || !bytes_len || (flags & ~BASE58_ALL_DEFINED_FLAGS))
         goto cleanup; /* Invalid argument */
 
     if (flags & BASE58_FLAG_CHECKSUM) {
         checksum = base58_get_checksum(bytes, bytes_len);
-        cs_p = &checksum;
-        bytes_len += 4;
+        total_len += BASE58_CHECKSUM_LEN;
     }
 
-#define b(n) (n < orig_len ? bytes[n] : ((unsigned char *)cs_p)[n - orig_len])
-
+#define b(n) (n < bytes_len ? bytes[n] : cs_p[n - bytes_len])
     /* Process leading zeros */
-    for (zeros = 0; zeros < bytes_len && !b(zeros); ++zeros)
+    for (zeros = 0; zeros < total_len && !b(zeros); ++zeros)
         ; /* no-op*/
+#undef b
 
-    if (zeros == bytes_len) {
-        if (!(*output = wally_malloc(zeros + 1))) {
+    /* log(256)/log(58) rounded up gives the digits, plus one partial limb */
+    max_limbs = ((total_len - zeros) * 138 / 100 + 1) / B58_LIMB_DIGITS + 1;
+
+    /* Allocate our limb buffer if it won't fit on the stack */
+    if (max_limbs > BIGNUM_WORDS)
+        if (!(limbs = wally_malloc(max_limbs * sizeof(*limbs)))) {
             ret = WALLY_ENOMEM;
             goto cleanup;
         }
 
-        memset(*output, '1', zeros);
-        (*output)[zeros] = '\0';
-        return WALLY_OK; /* All 0's */
+    /* Leading zeros don't change the limbs, so we convert the whole input.
+     * This allows fast paths for common payloads: P2PKH/P2SH addresses and
+     * BIP32 extended keys, with and without checksums */
+    switch (total_len) {
+    case HASH160_LEN + 1:
+        num_limbs = base58_to_limbs(bytes, bytes_len, cs_p,
+                                    HASH160_LEN + 1, limbs);
+        break;
+    case HASH160_LEN + 1 + BASE58_CHECKSUM_LEN:
+        num_limbs = base58_to_limbs(bytes, bytes_len, cs_p,
+                                    HASH160_LEN + 1 + BASE58_CHECKSUM_LEN, limbs);
+        break;
+    case BIP32_SERIALIZED_LEN:
+        num_limbs = base58_to_limbs(bytes, bytes_len, cs_p,
+                                    BIP32_SERIALIZED_LEN, limbs);
+        break;
+    case BIP32_SERIALIZED_LEN + BASE58_CHECKSUM_LEN:
+        num_limbs = base58_to_limbs(bytes, bytes_len, cs_p,
+                                    BIP32_SERIALIZED_LEN + BASE58_CHECKSUM_LEN, limbs);
+        break;
+    default:
+        num_limbs = base58_to_limbs(bytes, bytes_len, cs_p, total_len, limbs);
+        break;
     }
 
-    bn_bytes = (bytes_len - zeros) * 138 / 100 + 1; /* log(256)/log(58) rounded up */
+    /* Only the top limb may have leading zero digits */
+    top_digits = 0;
+    if (num_limbs)
+        for (top = limbs[num_limbs - 1]; top; top /= 58)
+            ++top_digits;
+    num_digits = num_limbs ? (num_limbs - 1) * B58_LIMB_DIGITS + top_digits : 0;
 
-    /* Allocate our bignum buffer if it won't fit on the stack */
-    if (bn_bytes > BIGNUM_BYTES)
-        if (!(bn = wally_malloc(bn_bytes))) {
+    if (output) {
+        if (!(*output = wally_malloc(zeros + num_digits + 1))) {
             ret = WALLY_ENOMEM;
             goto cleanup;
         }
-
-    top_byte = bn + bn_bytes - 1;
-    *top_byte = 0;
-
-    for (i = zeros; i < bytes_len; ++i) {
-        uint32_t carry = b(i);
-        for (bn_p = bn + bn_bytes - 1; bn_p >= top_byte; --bn_p) {
-            carry = *bn_p * 256 + carry;
-            *bn_p = carry % 58;
-            carry = carry / 58;
-            if (carry && bn_p == top_byte)
-                *--top_byte = 0; /* Increase bignum size */
+        out = *output;
+    } else {
+        *written = zeros + num_digits + 1;
+        if (*written > len) {
+            ret = WALLY_OK; /* Not enough space, return required amount */
+            goto cleanup;
         }
+        out = str_out;
     }
 
-    while (!*top_byte && top_byte < bn + bn_bytes - 1)
-        ++top_byte; /* Skip leading zero bytes in our bignum */
-
-    /* Copy the result */
-    bn_bytes = bn + bn_bytes - top_byte;
-
-    if (!(*output = wally_malloc(zeros + bn_bytes + 1))) {
-        ret = WALLY_ENOMEM;
-        goto cleanup;
+    memset(out, '1', zeros);
+    out += zeros + num_digits;
+    *out = '\0';
+    for (i = 0; i < num_limbs; ++i) {
+        uint32_t limb = limbs[i];
+        const size_t n = i == num_limbs - 1 ? top_digits : B58_LIMB_DIGITS;
+        for (j = 0; j < n; ++j) {
+            *--out = byte_to_base58[limb % 58];
+            limb /= 58;
+        }
     }
-
-    memset(*output, '1', zeros);
-    for (i = 0; i < bn_bytes; ++i)
-        (*output)[zeros + i] = byte_to_base58[top_byte[i]];
-    (*output)[zeros + bn_bytes] = '\0';
-
     ret = WALLY_OK;
 
 cleanup:
-    if (bn) {
-        wally_clear(bn, bn_bytes);
-        if (bn != bn_buf)
-            wally_free(bn);
+    if (flags & BASE58_FLAG_CHECKSUM)
+        wally_clear(&checksum, sizeof(checksum));
+    if (limbs) {
+        wally_clear(limbs, max_limbs * sizeof(*limbs));
+        if (limbs != limbs_buf)
+            wally_free(limbs);
     }
     return ret;
-#undef b
 }
 
+int wally_base58_from_bytes(const unsigned char *bytes, size_t bytes_len,
+                            uint32_t flags, char **output)
+{
+    OUTPUT_CHECK;
+    return base58_encode(bytes, bytes_len, flags, output, NULL, 0, NULL);
+}
+
+int wally_base58_from_bytes_into(const unsigned char *bytes, size_t bytes_len,
+                                 uint32_t flags, char *str_out, size_t len,
+                                 size_t *written)
+{
+    if (written)
+        *written = 0;
+    if (!str_out || !len || !written)
+        return WALLY_EINVAL;
+    return base58_encode(bytes, bytes_len, flags, NULL, str_out, len, written);
+}
 
 int wally_base58_n_get_length(const char *str_in, size_t str_len, size_t *written)
 {
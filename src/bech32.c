@@ -29,14 +29,20 @@
 #define CHECKSUM_BECH32 0x1
 #define CHECKSUM_BECH32M 0x2bc830a3
 
+/* The generator terms XORed in for each value of the top 5 checksum bits */
+static const uint32_t polymod_table[32] = {
+    0x00000000UL, 0x3b6a57b2UL, 0x26508e6dUL, 0x1d3ad9dfUL,
+    0x1ea119faUL, 0x25cb4e48UL, 0x38f19797UL, 0x039bc025UL,
+    0x3d4233ddUL, 0x0628646fUL, 0x1b12bdb0UL, 0x2078ea02UL,
+    0x23e32a27UL, 0x18897d95UL, 0x05b3a44aUL, 0x3ed9f3f8UL,
+    0x2a1462b3UL, 0x117e3501UL, 0x0c44ecdeUL, 0x372ebb6cUL,
+    0x34b57b49UL, 0x0fdf2cfbUL, 0x12e5f524UL, 0x298fa296UL,
+    0x1756516eUL, 0x2c3c06dcUL, 0x3106df03UL, 0x0a6c88b1UL,
+    0x09f74894UL, 0x329d1f26UL, 0x2fa7c6f9UL, 0x14cd914bUL
+};
+
 static uint32_t bech32_polymod_step(uint32_t pre) {
-    uint8_t b = pre >> 25;
-    return ((pre & 0x1FFFFFF) << 5) ^
-           (-((b >> 0) & 1) & 0x3b6a57b2UL) ^
-           (-((b >> 1) & 1) & 0x26508e6dUL) ^
-           (-((b >> 2) & 1) & 0x1ea119faUL) ^
-           (-((b >> 3) & 1) & 0x3d4233ddUL) ^
-           (-((b >> 4) & 1) & 0x2a1462b3UL);
+    return ((pre & 0x1FFFFFF) << 5) ^ polymod_table[pre >> 25];
 }
 
 static const char *charset = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
@@ -52,7 +58,15 @@ static const int8_t charset_rev[128] = {
     1,  0,  3, 16, 11, 28, 12, 14,  6,  4,  2, -1, -1, -1, -1, -1
 };
 
-static int bech32_encode(char *output, const char *hrp, size_t hrp_len, const uint8_t *data, size_t data_len, size_t max_input_len, bool is_bech32m) {
+/* A lower-case human-readable part and its checksum state, computed once
+ * and shared by every address encoded or decoded with it */
+struct bech32_hrp {
+    const char *hrp;
+    size_t hrp_len;
+    uint32_t chk;
+};
+
+static int bech32_hrp_init(struct bech32_hrp *h, const char *hrp, size_t hrp_len) {
     uint32_t chk = 1;
     size_t i;
     for (i = 0; i < hrp_len; ++i) {
@@ -64,12 +78,22 @@ static int bech32_encode(char *output, const char *hrp, size_t hrp_len, const ui
         if (ch >= 'A' && ch <= 'Z') return 0;
         chk = bech32_polymod_step(chk) ^ (ch >> 5);
     }
-    if (i + 7 + data_len > max_input_len) return 0;
     chk = bech32_polymod_step(chk);
     for (i = 0; i < hrp_len; ++i) {
         chk = bech32_polymod_step(chk) ^ (hrp[i] & 0x1f);
-        *(output++) = hrp[i];
     }
+    h->hrp = hrp;
+    h->hrp_len = hrp_len;
+    h->chk = chk;
+    return 1;
+}
+
+static int bech32_encode(char *output, const struct bech32_hrp *h, const uint8_t *data, size_t data_len, size_t max_input_len, bool is_bech32m) {
+    uint32_t chk = h->chk;
+    size_t i;
+    if (h->hrp_len + 7 + data_len > max_input_len) return 0;
+    memcpy(output, h->hrp, h->hrp_len);
+    output += h->hrp_len;
     *(output++) = '1';
     for (i = 0; i < data_len; ++i) {
         if (*data >> 5) return 0;
@@ -87,10 +111,10 @@ static int bech32_encode(char *output, const char *hrp, size_t hrp_len, const ui
     return 1;
 }
 
-static int bech32_decode(char *hrp, uint8_t *data, size_t *data_len, const char *input, size_t input_len, size_t max_input_len, bool *is_bech32m) {
-    uint32_t chk = 1;
+/* Decode an address, which must have the human-readable part in 'h' */
+static int bech32_decode(const struct bech32_hrp *h, uint8_t *data, size_t *data_len, const char *input, size_t input_len, size_t max_input_len, bool *is_bech32m) {
+    uint32_t chk = h->chk;
     size_t i;
-    size_t hrp_len;
     int have_lower = 0, have_upper = 0;
     if (input_len < 8 || input_len > max_input_len) {
         return 0;
@@ -102,26 +126,21 @@ static int bech32_decode(char *hrp, uint8_t *data, size_t *data_len, const char
     if (1 + *data_len >= input_len || *data_len < 6) {
         return 0;
     }
-    hrp_len = input_len - (1 + *data_len);
+    if (input_len - (1 + *data_len) != h->hrp_len) {
+        return 0;
+    }
     *(data_len) -= 6;
-    for (i = 0; i < hrp_len; ++i) {
+    for (i = 0; i < h->hrp_len; ++i) {
         int ch = input[i];
-        if (ch < 33 || ch > 126) {
-            return 0;
-        }
         if (ch >= 'a' && ch <= 'z') {
             have_lower = 1;
         } else if (ch >= 'A' && ch <= 'Z') {
             have_upper = 1;
             ch = (ch - 'A') + 'a';
         }
-        hrp[i] = ch;
-        chk = bech32_polymod_step(chk) ^ (ch >> 5);
-    }
-    hrp[i] = 0;
-    chk = bech32_polymod_step(chk);
-    for (i = 0; i < hrp_len; ++i) {
-        chk = bech32_polymod_step(chk) ^ (input[i] & 0x1f);
+        if (ch != h->hrp[i]) {
+            return 0;
+        }
     }
     ++i;
     while (i < input_len) {
@@ -133,7 +152,7 @@ static int bech32_decode(char *hrp, uint8_t *data, size_t *data_len, const char
         }
         chk = bech32_polymod_step(chk) ^ v;
         if (i + 6 < input_len) {
-            data[i - (1 + hrp_len)] = v;
+            data[i - (1 + h->hrp_len)] = v;
         }
         ++i;
     }
@@ -166,7 +185,7 @@ static int convert_bits(uint8_t *out, size_t *outlen, int outbits, const uint8_t
     return 1;
 }
 
-static int segwit_addr_encode(char *output, const char *hrp, size_t hrp_len, uint8_t witver, const uint8_t *witprog, size_t witprog_len) {
+static int segwit_addr_encode(char *output, const struct bech32_hrp *h, uint8_t witver, const uint8_t *witprog, size_t witprog_len) {
     uint8_t data[65];
     size_t datalen = 0;
     if (witver > 16) goto fail;
@@ -175,21 +194,18 @@ static int segwit_addr_encode(char *output, const char *hrp, size_t hrp_len, uin
     data[0] = witver;
     convert_bits(data + 1, &datalen, 5, witprog, witprog_len, 8, 1);
     ++datalen;
-    return bech32_encode(output, hrp, hrp_len, data, datalen, 90, witver != 0);
+    return bech32_encode(output, h, data, datalen, 90, witver != 0);
 fail:
     wally_clear_2(data, sizeof(data), (void *)witprog, witprog_len);
     return 0;
 }
 
-static int segwit_addr_decode(uint8_t *witver, uint8_t *witdata, size_t *witdata_len, const char *hrp, size_t hrp_len, const char *addr, size_t addr_len) {
+static int segwit_addr_decode(uint8_t *witver, uint8_t *witdata, size_t *witdata_len, const struct bech32_hrp *h, const char *addr, size_t addr_len) {
     uint8_t data[84];
-    char hrp_actual[84];
-    size_t data_len, hrp_actual_len;
+    size_t data_len;
     bool is_bech32m = false;
-    if (!bech32_decode(hrp_actual, data, &data_len, addr, addr_len, 90, &is_bech32m)) goto fail;
+    if (!bech32_decode(h, data, &data_len, addr, addr_len, 90, &is_bech32m)) goto fail;
     if (data_len == 0 || data_len > 65) goto fail;
-    hrp_actual_len = strlen(hrp_actual);
-    if (hrp_actual_len != hrp_len || memcmp(hrp_actual, hrp, hrp_len) != 0) goto fail;
     if (data[0] == 0 && is_bech32m) goto fail;
     if (data[0] != 0 && !is_bech32m) goto fail;
     if (data[0] > 16) goto fail;
@@ -200,44 +216,135 @@ static int segwit_addr_decode(uint8_t *witver, uint8_t *witdata, size_t *witdata
     *witver = data[0];
     return 1;
 fail:
-    wally_clear_2(data, sizeof(data), hrp_actual, sizeof(hrp_actual));
+    wally_clear(data, sizeof(data));
     return 0;
 }
 
+/* Parse a witness program script, returning its version and length.
+ * For batches, the program must be a direct push of the witness data and
+ * may be followed by further programs. Otherwise bytes is the whole script.
+ */
+static int witness_program_parse(const unsigned char *bytes, size_t bytes_len,
+                                 bool is_batch, size_t *witver, size_t *script_len)
+{
+    size_t push_size;
+
+    if (!bytes_len || !script_is_op_n(bytes[0], true, witver))
+        return WALLY_EINVAL;
+
+    if (script_get_push_size_from_bytes(bytes + 1, bytes_len - 1, &push_size) != WALLY_OK)
+        return WALLY_EINVAL;
+    else if (*witver == 0 && push_size != HASH160_LEN && push_size != SHA256_LEN)
+        return WALLY_EINVAL;
+
+    if (!is_batch)
+        *script_len = bytes_len;
+    else if (bytes[1] != push_size || push_size + 2 > bytes_len)
+        return WALLY_EINVAL;
+    else
+        *script_len = push_size + 2;
+    return WALLY_OK;
+}
+
+/* Encode a witness program into result, which must hold
+ * WALLY_SEGWIT_ADDRESS_MAX_LEN bytes */
+static int addr_segwit_from_bytes(const unsigned char *bytes, size_t bytes_len,
+                                  const char *addr_family, uint32_t flags,
+                                  char *result)
+{
+    struct bech32_hrp h;
+    size_t witver, script_len;
+    int ret;
+
+    if (!addr_family || flags || !bytes || !bytes_len)
+        return WALLY_EINVAL;
+
+    ret = witness_program_parse(bytes, bytes_len, false, &witver, &script_len);
+    if (ret != WALLY_OK)
+        return ret;
+
+    result[0] = '\0';
+    if (!bech32_hrp_init(&h, addr_family, strlen(addr_family)) ||
+        !segwit_addr_encode(result, &h, witver & 0xff, bytes + 2, script_len - 2))
+        return WALLY_ERROR;
+    return WALLY_OK;
+}
+
 int wally_addr_segwit_from_bytes(const unsigned char *bytes, size_t bytes_len,
                                  const char *addr_family, uint32_t flags,
                                  char **output)
 {
-    char result[90];
-    size_t push_size;
+    char result[WALLY_SEGWIT_ADDRESS_MAX_LEN];
     int ret;
-    size_t witver;
-    size_t addr_family_len = addr_family ? strlen(addr_family) : 0;
 
     if (output)
         *output = 0;
 
-    if (!addr_family || flags || !bytes || !bytes_len || !output)
+    if (!output)
         return WALLY_EINVAL;
 
-    if (!script_is_op_n(bytes[0], true, &witver))
-        return WALLY_EINVAL;
+    ret = addr_segwit_from_bytes(bytes, bytes_len, addr_family, flags, result);
+    if (ret == WALLY_OK) {
+        *output = wally_strdup(result);
+        if (!*output)
+            ret = WALLY_ENOMEM;
+    }
+    wally_clear(result, sizeof(result));
+    return ret;
+}
 
-    ret = script_get_push_size_from_bytes(bytes + 1, bytes_len - 1, &push_size);
-    if (ret != WALLY_OK)
-        return WALLY_EINVAL;
-    else if (witver == 0 && push_size != HASH160_LEN && push_size != SHA256_LEN)
+int wally_addr_segwit_from_bytes_into(const unsigned char *bytes, size_t bytes_len,
+                                      const char *addr_family, uint32_t flags,
+                                      char *str_out, size_t len, size_t *written)
+{
+    char result[WALLY_SEGWIT_ADDRESS_MAX_LEN];
+    int ret;
+
+    if (written)
+        *written = 0;
+
+    if (!str_out || !len || !written)
         return WALLY_EINVAL;
 
-    result[0] = '\0';
-    if (!segwit_addr_encode(result, addr_family, addr_family_len, witver & 0xff, bytes + 2, bytes_len - 2))
-        return WALLY_ERROR;
+    if (len >= sizeof(result)) {
+        /* The callers buffer can hold any address: encode directly into it */
+        ret = addr_segwit_from_bytes(bytes, bytes_len, addr_family, flags, str_out);
+        if (ret == WALLY_OK)
+            *written = strlen(str_out) + 1;
+        return ret;
+    }
 
-    *output = wally_strdup(result);
+    ret = addr_segwit_from_bytes(bytes, bytes_len, addr_family, flags, result);
+    if (ret == WALLY_OK) {
+        *written = strlen(result) + 1;
+        if (*written <= len)
+            memcpy(str_out, result, *written);
+    }
     wally_clear(result, sizeof(result));
-    return *output ? WALLY_OK : WALLY_ENOMEM;
+    return ret;
 }
 
+/* Decode one address into a witness program script */
+static int addr_segwit_to_bytes(const char *addr, size_t addr_len,
+                                const struct bech32_hrp *h,
+                                unsigned char *bytes_out, size_t len,
+                                size_t *written)
+{
+    unsigned char decoded[40];
+    int ret;
+    uint8_t witver;
+
+    if (!segwit_addr_decode(&witver, decoded, written, h, addr, addr_len)) {
+        *written = 0;
+        ret = WALLY_EINVAL;
+    } else {
+        ret = wally_witness_program_from_bytes_and_version(
+            decoded, *written, witver, 0, bytes_out, len, written);
+    }
+
+    wally_clear(decoded, sizeof(decoded));
+    return ret;
+}
 
 int wally_addr_segwit_n_to_bytes(const char *addr, size_t addr_len,
                                  const char *addr_family, size_t addr_family_len,
@@ -245,9 +352,7 @@ int wally_addr_segwit_n_to_bytes(const char *addr, size_t addr_len,
                                  unsigned char *bytes_out, size_t len,
                                  size_t *written)
 {
-    unsigned char decoded[40];
-    int ret;
-    uint8_t witver;
+    struct bech32_hrp h;
 
     if (written)
         *written = 0;
@@ -255,16 +360,10 @@ int wally_addr_segwit_n_to_bytes(const char *addr, size_t addr_len,
     if (flags || !addr_family || !addr_family_len || !addr || addr_len < 8 || !bytes_out || !len || !written)
         return WALLY_EINVAL;
 
-    if (!segwit_addr_decode(&witver, decoded, written, addr_family, addr_family_len, addr, addr_len)) {
-        *written = 0;
-        ret = WALLY_EINVAL;
-    } else {
-        ret = wally_witness_program_from_bytes_and_version(
-            decoded, *written, witver, flags, bytes_out, len, written);
-    }
+    if (!bech32_hrp_init(&h, addr_family, addr_family_len))
+        return WALLY_EINVAL; /* Can't match any address */
 
-    wally_clear(decoded, sizeof(decoded));
-    return ret;
+    return addr_segwit_to_bytes(addr, addr_len, &h, bytes_out, len, written);
 }
 
 int wally_addr_segwit_to_bytes(const char *addr, const char *addr_family,
@@ -299,3 +398,153 @@ int wally_addr_segwit_get_version(const char *addr, const char *addr_family,
                                            addr_family, addr_family ? strlen(addr_family) : 0,
                                            flags, written);
 }
+
+/* Return the length of the address in a batch slot, or the slot size if
+ * it isn't NUL terminated (which makes it invalid) */
+static size_t addr_slot_len(const char *slot)
+{
+    size_t i;
+    for (i = 0; i < WALLY_SEGWIT_ADDRESS_MAX_LEN && slot[i]; ++i)
+        ; /* no-op */
+    return i;
+}
+
+int wally_addr_segwit_from_bytes_batch(const unsigned char *bytes, size_t bytes_len,
+                                       const char *addr_family, uint32_t flags,
+                                       char *output, size_t len, size_t *written)
+{
+    struct bech32_hrp h;
+    size_t offset, witver, script_len, num_items = 0;
+    int ret;
+
+    if (written)
+        *written = 0;
+
+    if (!bytes || !bytes_len || !addr_family || flags || !output || !len || !written)
+        return WALLY_EINVAL;
+
+    /* Validate and count all programs before writing any output */
+    for (offset = 0; offset < bytes_len; offset += script_len) {
+        ret = witness_program_parse(bytes + offset, bytes_len - offset,
+                                    true, &witver, &script_len);
+        if (ret != WALLY_OK)
+            return ret;
+        ++num_items;
+    }
+
+    if (!bech32_hrp_init(&h, addr_family, strlen(addr_family)))
+        return WALLY_ERROR;
+
+    *written = num_items * WALLY_SEGWIT_ADDRESS_MAX_LEN;
+    if (*written > len)
+        return WALLY_OK; /* Not enough space, return required amount */
+
+    for (offset = 0; offset < bytes_len; offset += script_len) {
+        witness_program_parse(bytes + offset, bytes_len - offset,
+                              true, &witver, &script_len);
+        memset(output, 0, WALLY_SEGWIT_ADDRESS_MAX_LEN);
+        if (!segwit_addr_encode(output, &h, witver & 0xff,
+                                bytes + offset + 2, script_len - 2)) {
+            *written = 0;
+            return WALLY_ERROR;
+        }
+        output += WALLY_SEGWIT_ADDRESS_MAX_LEN;
+    }
+    return WALLY_OK;
+}
+
+int wally_addr_segwit_to_bytes_batch(const char *addrs, size_t addrs_len,
+                                     const char *addr_family, uint32_t flags,
+                                     unsigned char *bytes_out, size_t len,
+                                     size_t *written)
+{
+    struct bech32_hrp h;
+    unsigned char program[WALLY_SEGWIT_ADDRESS_PUBKEY_MAX_LEN];
+    size_t offset, program_len, total = 0;
+    int ret = WALLY_OK;
+
+    if (written)
+        *written = 0;
+
+    if (!addrs || !addrs_len || addrs_len % WALLY_SEGWIT_ADDRESS_MAX_LEN ||
+        !addr_family || flags || !bytes_out || !len || !written)
+        return WALLY_EINVAL;
+
+    if (!bech32_hrp_init(&h, addr_family, strlen(addr_family)))
+        return WALLY_EINVAL; /* Can't match any address */
+
+    for (offset = 0; offset < addrs_len; offset += WALLY_SEGWIT_ADDRESS_MAX_LEN) {
+        const char *addr = addrs + offset;
+        ret = addr_segwit_to_bytes(addr, addr_slot_len(addr), &h,
+                                   program, sizeof(program), &program_len);
+        if (ret != WALLY_OK)
+            break;
+        if (total + program_len <= len)
+            memcpy(bytes_out + total, program, program_len);
+        total += program_len;
+    }
+
+    wally_clear(program, sizeof(program));
+    if (ret != WALLY_OK)
+        wally_clear(bytes_out, len);
+    else
+        *written = total;
+    return ret;
+}
+
+/* The number of addresses verified by each batch verification task */
+#define VERIFY_BATCH_CHUNK 64
+
+struct verify_batch {
+    const char *addrs;
+    const struct bech32_hrp *h;
+    unsigned char *bytes_out;
+    size_t len;
+};
+
+static void verify_batch_task(void *ctx, size_t chunk)
+{
+    const struct verify_batch *b = (const struct verify_batch *)ctx;
+    unsigned char program[WALLY_SEGWIT_ADDRESS_PUBKEY_MAX_LEN];
+    size_t i = chunk * VERIFY_BATCH_CHUNK, end = i + VERIFY_BATCH_CHUNK;
+    size_t program_len, witver;
+
+    if (end > b->len)
+        end = b->len;
+    for (; i < end; ++i) {
+        const char *addr = b->addrs + i * WALLY_SEGWIT_ADDRESS_MAX_LEN;
+        b->bytes_out[i] = WALLY_SEGWIT_VERSION_INVALID;
+        if (addr_segwit_to_bytes(addr, addr_slot_len(addr), b->h,
+                                 program, sizeof(program),
+                                 &program_len) == WALLY_OK &&
+            script_is_op_n(program[0], true, &witver))
+            b->bytes_out[i] = witver;
+    }
+    wally_clear(program, sizeof(program));
+}
+
+int wally_addr_segwit_verify_batch(const char *addrs, size_t addrs_len,
+                                   const char *addr_family, uint32_t flags,
+                                   unsigned char *bytes_out, size_t len)
+{
+    struct bech32_hrp h;
+    struct verify_batch b;
+
+    if (!addrs || !addrs_len || addrs_len % WALLY_SEGWIT_ADDRESS_MAX_LEN ||
+        !addr_family || flags || !bytes_out ||
+        len != addrs_len / WALLY_SEGWIT_ADDRESS_MAX_LEN)
+        return WALLY_EINVAL;
+
+    if (!bech32_hrp_init(&h, addr_family, strlen(addr_family))) {
+        /* Can't match any address */
+        memset(bytes_out, WALLY_SEGWIT_VERSION_INVALID, len);
+        return WALLY_OK;
+    }
+
+    b.addrs = addrs;
+    b.h = &h;
+    b.bytes_out = bytes_out;
+    b.len = len;
+    run_tasks(verify_batch_task, &b, (len + VERIFY_BATCH_CHUNK - 1) / VERIFY_BATCH_CHUNK);
+    return WALLY_OK;
+}
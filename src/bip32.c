@@ -378,7 +378,7 @@ int bip32_key_from_seed_custom(const unsigned char *bytes, size_t bytes_len,
                                const unsigned char *hmac_key, size_t hmac_key_len,
                                uint32_t flags, struct ext_key *key_out)
 {
-    struct sha512 sha;
+    struct sha512 sha_buf, *sha;
     int ret;
 
     if (key_out)
@@ -395,18 +395,19 @@ int bip32_key_from_seed_custom(const unsigned char *bytes, size_t bytes_len,
     }
 
     /* Generate private key and chain code */
-    hmac_sha512_impl(&sha, hmac_key, hmac_key_len, bytes, bytes_len);
+    sha = secure_alloc(&sha_buf, sizeof(sha_buf));
+    hmac_sha512_impl(sha, hmac_key, hmac_key_len, bytes, bytes_len);
 
-    ret = bip32_key_from_private_key(version, sha.u.u8, EC_PRIVATE_KEY_LEN, key_out);
+    ret = bip32_key_from_private_key(version, sha->u.u8, EC_PRIVATE_KEY_LEN, key_out);
     if (ret == WALLY_OK) {
         /* Copy the chain code and set other members */
-        memcpy(key_out->chain_code, sha.u.u8 + sizeof(sha) / 2, sizeof(sha) / 2);
+        memcpy(key_out->chain_code, sha->u.u8 + sizeof(*sha) / 2, sizeof(*sha) / 2);
         key_out->depth = 0; /* Master key, depth 0 */
         key_out->child_num = 0;
         if (!(flags & BIP32_FLAG_SKIP_HASH))
             key_compute_hash160(key_out);
     }
-    wally_clear(&sha, sizeof(sha));
+    secure_free(sha, &sha_buf, sizeof(sha_buf));
     return ret;
 }
 
@@ -635,10 +636,10 @@ static int bip32_seckey_tweak_add(const unsigned char *tweak, size_t tweak_len,
  * no test vectors or paths describing these values to validate against.
  * Further, there are no public-public vectors in the BIP32 spec either.
  */
-int bip32_key_from_parent(const struct ext_key *hdkey, uint32_t child_num,
-                          uint32_t flags, struct ext_key *key_out)
+static int key_from_parent(const struct ext_key *hdkey, uint32_t child_num,
+                           uint32_t flags, struct ext_key *key_out)
 {
-    struct sha512 sha;
+    struct sha512 sha_buf, *sha;
     const secp256k1_context *ctx;
     const bool we_are_private = hdkey && key_is_private(hdkey);
     const bool derive_private = !(flags & BIP32_FLAG_KEY_PUBLIC);
@@ -688,14 +689,15 @@ int bip32_key_from_parent(const struct ext_key *hdkey, uint32_t child_num,
     key_out->child_num = cpu_to_be32(child_num);
 
     /* I = HMAC-SHA512(Key = cpar, Data) */
-    hmac_sha512_impl(&sha, hdkey->chain_code, sizeof(hdkey->chain_code),
+    sha = secure_alloc(&sha_buf, sizeof(sha_buf));
+    hmac_sha512_impl(sha, hdkey->chain_code, sizeof(hdkey->chain_code),
                      key_out->priv_key,
                      sizeof(key_out->priv_key) + sizeof(key_out->child_num));
 
     /* Split I into two 32-byte sequences, IL and IR
      * The returned chain code ci is IR (i.e. the 2nd half of our hmac sha512)
      */
-    memcpy(key_out->chain_code, sha.u.u8 + sizeof(sha) / 2,
+    memcpy(key_out->chain_code, sha->u.u8 + sizeof(*sha) / 2,
            sizeof(key_out->chain_code));
 
     if (we_are_private) {
@@ -704,7 +706,7 @@ int bip32_key_from_parent(const struct ext_key *hdkey, uint32_t child_num,
          * (NOTE: seckey_tweak_add checks both conditions)
          */
         memcpy(key_out->priv_key, hdkey->priv_key, sizeof(hdkey->priv_key));
-        if (!seckey_tweak_add(key_out->priv_key + 1, sha.u.u8) ||
+        if (!seckey_tweak_add(key_out->priv_key + 1, sha->u.u8) ||
             key_compute_pub_key(key_out) != WALLY_OK)
             goto fail;
     } else {
@@ -718,7 +720,7 @@ int bip32_key_from_parent(const struct ext_key *hdkey, uint32_t child_num,
 
         /* FIXME: Out of bounds on pubkey_tweak_add */
         if (!pubkey_parse(&pub_key, hdkey->pub_key, sizeof(hdkey->pub_key)) ||
-            !pubkey_tweak_add(ctx, &pub_key, sha.u.u8) ||
+            !pubkey_tweak_add(ctx, &pub_key, sha->u.u8) ||
             !pubkey_serialize(key_out->pub_key, &len, &pub_key,
                               PUBKEY_COMPRESSED) ||
             len != sizeof(key_out->pub_key)) {
@@ -733,7 +735,7 @@ int bip32_key_from_parent(const struct ext_key *hdkey, uint32_t child_num,
     if (flags & BIP32_FLAG_KEY_TWEAK_SUM) {
         memcpy(key_out->pub_key_tweak_sum,
                hdkey->pub_key_tweak_sum, sizeof(hdkey->pub_key_tweak_sum));
-        if (bip32_seckey_tweak_add(sha.u.u8, SHA256_LEN, key_out) != WALLY_OK)
+        if (bip32_seckey_tweak_add(sha->u.u8, SHA256_LEN, key_out) != WALLY_OK)
             goto fail;
     }
 #endif /* BUILD_ELEMENTS */
@@ -762,13 +764,23 @@ int bip32_key_from_parent(const struct ext_key *hdkey, uint32_t child_num,
         memcpy(key_out->parent160, hdkey->hash160, sizeof(hdkey->hash160));
         key_compute_hash160(key_out);
     }
-    wally_clear(&sha, sizeof(sha));
+    secure_free(sha, &sha_buf, sizeof(sha_buf));
     return WALLY_OK;
 fail:
-    wally_clear(&sha, sizeof(sha));
+    secure_free(sha, &sha_buf, sizeof(sha_buf));
     return wipe_key_fail(key_out);
 }
 
+int bip32_key_from_parent(const struct ext_key *hdkey, uint32_t child_num,
+                          uint32_t flags, struct ext_key *key_out)
+{
+    int ret;
+    STATS_BEGIN(WALLY_STATS_BIP32_DERIVE);
+    ret = key_from_parent(hdkey, child_num, flags, key_out);
+    STATS_END();
+    return ret;
+}
+
 int bip32_key_from_parent_alloc(const struct ext_key *hdkey,
                                 uint32_t child_num, uint32_t flags,
                                 struct ext_key **output)
@@ -788,7 +800,7 @@ int bip32_key_from_parent_path(const struct ext_key *hdkey,
                                const uint32_t *child_path, size_t child_path_len,
                                uint32_t flags, struct ext_key *key_out)
 {
-    struct ext_key tmp[2];
+    struct ext_key tmp_buf[2], *tmp;
     size_t i, tmp_idx = 0, private_until = 0;
     int ret = WALLY_OK;
 
@@ -808,6 +820,7 @@ int bip32_key_from_parent_path(const struct ext_key *hdkey,
             return WALLY_EINVAL; /* Unsupported derivation */
     }
 
+    tmp = secure_alloc(tmp_buf, sizeof(tmp_buf));
     for (i = 0; i < child_path_len; ++i) {
         struct ext_key *derived = &tmp[tmp_idx];
         uint32_t derivation_flags = flags;
@@ -831,7 +844,7 @@ int bip32_key_from_parent_path(const struct ext_key *hdkey,
     if (ret == WALLY_OK)
         memcpy(key_out, hdkey, sizeof(*key_out));
 
-    wally_clear(tmp, sizeof(tmp));
+    secure_free(tmp, tmp_buf, sizeof(tmp_buf));
     return ret;
 }
 
@@ -210,6 +210,128 @@ int bip39_mnemonic_validate(const struct words *w, const char *mnemonic)
     return ret;
 }
 
+/* The maximum number of words in a mnemonic: 320 bits of entropy
+ * plus a 10 bit checksum at 11 bits per word */
+#define BIP39_MAX_WORDS 30u
+
+/* Pack 11 bit word indices into bytes */
+static void indices_to_bytes(const uint16_t *indices, size_t num_words,
+                             unsigned char *bytes_out)
+{
+    uint32_t acc = 0;
+    size_t i, bits = 0;
+
+    for (i = 0; i < num_words; ++i) {
+        acc = (acc << 11u) | indices[i];
+        bits += 11u;
+        while (bits >= 8u) {
+            bits -= 8u;
+            *bytes_out++ = (acc >> bits) & 0xff;
+        }
+        acc &= (1u << bits) - 1u;
+    }
+    if (bits)
+        *bytes_out = (acc << (8u - bits)) & 0xff;
+}
+
+/* Validate one mnemonic against every language, writing its result */
+static void mnemonic_validate_all(const struct words *const *lists,
+                                  const char *mnemonic, const char *end,
+                                  unsigned char *result)
+{
+    uint16_t indices[NUM_ELEMS(lookup)][BIP39_MAX_WORDS];
+    unsigned char tmp_bytes[BIP39_ENTROPY_MAX_LEN];
+    size_t found[NUM_ELEMS(lookup)], num_words = 0, entropy_len, mask, i;
+    uint32_t candidates = (1u << NUM_ELEMS(lookup)) - 1u;
+    const char *p = mnemonic;
+
+    result[0] = BIP39_LANGUAGE_INVALID;
+
+    /* Tokenize the mnemonic once, looking each word up in all languages */
+    while (candidates) {
+        const char *word_end = p;
+        while (word_end < end && *word_end != ' ') /* FIXME: utf-8 sep */
+            ++word_end;
+        if (num_words == BIP39_MAX_WORDS)
+            goto cleanup; /* Too many words */
+        candidates &= wordlist_lookup_word_multi(lists, NUM_ELEMS(lookup),
+                                                 p, word_end - p, found);
+        for (i = 0; i < NUM_ELEMS(lookup); ++i)
+            indices[i][num_words] = (found[i] - 1u) & 0xffff;
+        ++num_words;
+        if (word_end == end)
+            break;
+        p = word_end + 1;
+    }
+
+    entropy_len = num_words * 4u / 3u;
+    if (!candidates || num_words % 3u || !(mask = len_to_mask(entropy_len)))
+        goto cleanup;
+
+    /* Check the checksum of each language the words were all found in.
+     * If more than one language matches, the first in order wins */
+    for (i = 0; i < NUM_ELEMS(lookup); ++i) {
+        if (candidates & (1u << i)) {
+            indices_to_bytes(indices[i], num_words, tmp_bytes);
+            if (checksum_ok(tmp_bytes, entropy_len, mask)) {
+                result[0] = i;
+                result[1] = entropy_len;
+                memcpy(result + 2, tmp_bytes, entropy_len);
+                break;
+            }
+        }
+    }
+
+cleanup:
+    wally_clear_2(indices, sizeof(indices), tmp_bytes, sizeof(tmp_bytes));
+}
+
+struct validate_batch {
+    const struct words *lists[NUM_ELEMS(lookup)];
+    const char **mnemonics; /* Start of each mnemonic, plus the end */
+    unsigned char *bytes_out;
+};
+
+static void validate_batch_task(void *ctx, size_t i)
+{
+    const struct validate_batch *b = (const struct validate_batch *)ctx;
+    mnemonic_validate_all(b->lists, b->mnemonics[i], b->mnemonics[i + 1] - 1,
+                          b->bytes_out + i * BIP39_VALIDATE_BATCH_RESULT_LEN);
+}
+
+int bip39_mnemonics_validate_batch(const char *mnemonics, uint32_t flags,
+                                   unsigned char *bytes_out, size_t len)
+{
+    struct validate_batch b;
+    const char *p;
+    size_t i, num_mnemonics = 1u; /* Always 1 less separator than mnemonics */
+
+    if (!mnemonics || flags || !bytes_out || !len)
+        return WALLY_EINVAL;
+
+    for (p = mnemonics; *p; ++p)
+        num_mnemonics += *p == '\n';
+    if (len != num_mnemonics * BIP39_VALIDATE_BATCH_RESULT_LEN)
+        return WALLY_EINVAL;
+
+    b.mnemonics = wally_malloc((num_mnemonics + 1) * sizeof(const char *));
+    if (!b.mnemonics)
+        return WALLY_ENOMEM;
+    for (i = 0; i < NUM_ELEMS(lookup); ++i)
+        b.lists[i] = lookup[i].words;
+    b.mnemonics[0] = mnemonics;
+    for (i = 1, p = mnemonics; *p; ++p)
+        if (*p == '\n')
+            b.mnemonics[i++] = p + 1;
+    b.mnemonics[num_mnemonics] = p + 1; /* One past the terminating NUL */
+    b.bytes_out = bytes_out;
+
+    wally_clear(bytes_out, len);
+    run_tasks(validate_batch_task, &b, num_mnemonics);
+    wally_free(b.mnemonics);
+    return WALLY_OK;
+}
+
 int bip39_mnemonic_to_seed(const char *mnemonic, const char *passphrase,
                             unsigned char *bytes_out, size_t len,
                             size_t *written)
@@ -228,7 +350,7 @@ int bip39_mnemonic_to_seed(const char *mnemonic, const char *passphrase,
     if (!mnemonic || !bytes_out || len != BIP39_SEED_LEN_512)
         return WALLY_EINVAL;
 
-    salt = wally_malloc(salt_len);
+    salt = secure_alloc(NULL, salt_len);
     if (!salt)
         return WALLY_ENOMEM;
 
@@ -243,7 +365,7 @@ int bip39_mnemonic_to_seed(const char *mnemonic, const char *passphrase,
     if (!ret && written)
         *written = BIP39_SEED_LEN_512; /* Succeeded */
 
-    clear_and_free(salt, salt_len);
+    secure_free(salt, NULL, salt_len);
 
     return ret;
 }
@@ -1,12 +1,163 @@
 #include "internal.h"
 
 #include <include/wally_coinselection.h>
+#include <stdlib.h>
 
 typedef struct value_remaining {
     uint64_t remaining;
     uint64_t value;
 } value_remaining_t;
 
+/* A UTXO available for effective value coin selection */
+typedef struct cs_utxo {
+    uint64_t value;    /* Effective value: the value less the fee to spend it */
+    uint64_t remaining; /* Sum of effective values from this UTXO onwards */
+    int64_t waste;     /* Spending fee at fee_rate less at long_term_fee_rate */
+    uint32_t index;    /* Index into the callers values */
+} cs_utxo_t;
+
+/* The best asset selection found by a search */
+typedef struct asset_selection {
+    uint64_t score;
+    uint64_t sum;
+    size_t num_indices;
+    uint32_t indices[WALLY_CS_MAX_ASSETS];
+} asset_selection_t;
+
+/* Returns true if a selection with the given score and sum is better than best */
+static bool asset_selection_is_better(const asset_selection_t *best,
+                                      uint64_t score, uint64_t sum,
+                                      uint64_t target)
+{
+    return score < best->score ||
+           (score == best->score &&
+            (sum > best->sum || (sum == target && best->sum != target)));
+}
+
+/* Search for the best selection of values from vr[first] onwards. If
+ * fixed_first is true, only selections including vr[first] are searched */
+static void assets_search(const value_remaining_t *vr, uint64_t target,
+                          uint64_t attempts, uint32_t io_ratio,
+                          uint32_t first, bool fixed_first,
+                          asset_selection_t *best)
+{
+    uint64_t sum = 0;
+    uint32_t v = first, ii = 0, base = 0;
+    size_t i, attempt;
+    uint32_t indices[WALLY_CS_MAX_ASSETS];
+
+    if (fixed_first) {
+        indices[ii++] = v;
+        sum = vr[v++].value;
+        base = 1;
+    }
+
+    for (attempt = 0; attempt < attempts; ++attempt) {
+        bool backtrack = false;
+
+        if (sum + vr[v].remaining < target) {
+            /* Current selection plus remaining amount can not reach target */
+            backtrack = true;
+        } else if (sum >= target) {
+            /* Current selection reaches or exceeds the target */
+            const uint64_t score = ii + (sum == target ? 0 : io_ratio);
+
+            if (asset_selection_is_better(best, score, sum, target)) {
+                /* This selection is 'better' by our criteria, use it */
+                best->score = score;
+                best->sum = sum;
+                best->num_indices = ii;
+                for (i = 0; i < ii; ++i)
+                    best->indices[i] = indices[i];
+                if (sum == target && ii == 1)
+                    break; /* Perfect selection: don't try for better */
+            }
+            backtrack = true;
+        } else if (ii >= best->score || ii >= WALLY_CS_MAX_ASSETS) {
+            /* We cannot beat the best score by adding more inputs */
+            backtrack = true;
+        }
+
+        if (backtrack) {
+            if (ii-- == base)
+                break; /* All viable selections have been searched */
+
+            while (--v > indices[ii])
+                /* Loop adding omitted UTXO values to the available selection */;
+
+            sum -= vr[v].value; /* Remove last included UTXO value from the selection */
+        } else if (ii == 0 ||                        /* First UTXO value, or */
+                   v - 1 == indices[ii - 1] ||       /* Previous index is included, or */
+                   vr[v].value != vr[v - 1].value) { /* UTXO value is different */
+            /* Add this UTXOs value to the selection */
+            indices[ii++] = v;
+            sum += vr[v].value;
+        }
+
+        ++v;
+    }
+}
+
+/* Create the value/remaining array for a search. Returns NULL if the values
+ * cannot reach target (with *ret set to WALLY_OK), if their total overflows
+ * or on allocation failure */
+static value_remaining_t *assets_prepare(const uint64_t *values, size_t num_values,
+                                         uint64_t target, int *ret)
+{
+    uint64_t remaining;
+    value_remaining_t *vr;
+    size_t i;
+
+    /* Compute the remaining sum of all values from a given index */
+    for (i = 0, remaining = 0; i < num_values; ++i) {
+        if (values[i] > UINT64_MAX - remaining) {
+            *ret = WALLY_EINVAL; /* Total value overflows */
+            return NULL;
+        }
+        remaining += values[i];
+    }
+    *ret = WALLY_OK;
+    if (remaining < target)
+        return NULL; /* Insufficient total funds to hit target */
+
+    vr = wally_malloc((num_values + 1) * sizeof(value_remaining_t));
+    if (!vr) {
+        *ret = WALLY_ENOMEM;
+        return NULL;
+    }
+
+    for (i = 0; i < num_values; ++i) {
+        vr[i].remaining = remaining;
+        vr[i].value = values[i];
+        remaining -= values[i];
+    }
+    vr[i].remaining = 0;
+    vr[i].value = 0;
+    return vr;
+}
+
+static bool assets_args_valid(const uint64_t *values, size_t num_values,
+                              uint64_t target, uint64_t attempts, uint32_t io_ratio,
+                              const uint32_t *indices_out, size_t indices_out_len,
+                              size_t *written)
+{
+    if (written)
+        *written = 0;
+    return values && num_values && target &&
+           attempts >= num_values + 1 && io_ratio && indices_out &&
+           (indices_out_len >= num_values || indices_out_len >= WALLY_CS_MAX_ASSETS) &&
+           written;
+}
+
+static void assets_output(const asset_selection_t *best,
+                          uint32_t *indices_out, size_t *written)
+{
+    size_t i;
+    for (i = 0; i < best->num_indices; ++i)
+        indices_out[i] = best->indices[i];
+    *written = best->num_indices;
+}
+
 /*
  * Coin selection for assets is much simpler than the policy asset L-BTC.
  *
@@ -84,63 +235,251 @@ int wally_coinselect_assets(const uint64_t *values, size_t num_values,
                             uint32_t *indices_out, size_t indices_out_len,
                             size_t *written)
 {
-    uint64_t remaining, sum = 0, best_sum = 0;
-    uint32_t best_score = 0xffffffff, v = 0, ii = 0;
-    size_t i, attempt;
+    asset_selection_t best;
     value_remaining_t *vr;
-    uint32_t indices[WALLY_CS_MAX_ASSETS];
+    int ret;
 
-    if (written)
-        *written = 0;
-    if (!values || !num_values || !target ||
-        attempts < num_values + 1 || !io_ratio || !indices_out ||
-        (indices_out_len < num_values && indices_out_len < WALLY_CS_MAX_ASSETS) ||
-        !written)
+    if (!assets_args_valid(values, num_values, target, attempts, io_ratio,
+                           indices_out, indices_out_len, written))
         return WALLY_EINVAL;
 
-    /* Compute the remaining sum of all values from a given index */
-    for (i = 0, remaining = 0; i < num_values; ++i)
-        remaining += values[i];
-    if (remaining < target)
-        return WALLY_OK; /* Insufficient total funds to hit target */
+    if (!(vr = assets_prepare(values, num_values, target, &ret)))
+        return ret;
 
-    vr = wally_malloc((num_values + 1) * sizeof(value_remaining_t));
-    if (!vr)
+    best.score = 0xffffffff;
+    best.sum = 0;
+    best.num_indices = 0;
+    assets_search(vr, target, attempts, io_ratio, 0, false, &best);
+    assets_output(&best, indices_out, written);
+    wally_free(vr);
+    return WALLY_OK;
+}
+
+/*
+ * Split search for assets.
+ *
+ * The search tree is split at the top level into independent subtrees:
+ * subtree k (for k < num_subtrees - 1) contains the selections whose first
+ * (i.e. largest) value is at index k, and the final subtree contains all
+ * selections starting at or after that. Subtrees whose first value equals
+ * that of the previous subtree are skipped as equivalent. Each subtree is
+ * searched depth first with the full attempt budget, applying the same
+ * pruning rules as wally_coinselect_assets.
+ *
+ * Before searching, a bound shared by all subtrees is computed by taking
+ * values largest first until the target is reached. This is the first
+ * solution the serial search finds, and gives every subtree the pruning
+ * benefit of a known solution from its first attempt. The bound is not
+ * updated as subtrees find better solutions: doing so would make the
+ * pruning, and therefore the result, depend on the order subtrees are run
+ * in. Instead, the subtree results are merged in subtree order using the
+ * same criteria as the serial search, so the result depends only on the
+ * inputs and the number of subtrees.
+ */
+struct assets_split {
+    const value_remaining_t *vr;
+    uint64_t target;
+    uint64_t attempts;
+    uint32_t io_ratio;
+    size_t num_subtrees;
+    asset_selection_t *results;
+};
+
+static void assets_split_task(void *ctx, size_t i)
+{
+    struct assets_split *s = (struct assets_split *)ctx;
+    const bool is_last = i == s->num_subtrees - 1;
+
+    if (!is_last && i && s->vr[i].value == s->vr[i - 1].value)
+        return; /* Equivalent to the previous subtree */
+    assets_search(s->vr, s->target, s->attempts, s->io_ratio,
+                  (uint32_t)i, !is_last, &s->results[i]);
+}
+
+int wally_coinselect_assets_split(const uint64_t *values, size_t num_values,
+                                  uint64_t target, uint64_t attempts,
+                                  uint32_t io_ratio, uint32_t num_subtrees,
+                                  uint32_t *indices_out, size_t indices_out_len,
+                                  size_t *written)
+{
+    struct assets_split s;
+    asset_selection_t bound, best;
+    value_remaining_t *vr;
+    uint64_t sum = 0;
+    size_t i;
+    int ret;
+
+    if (!assets_args_valid(values, num_values, target, attempts, io_ratio,
+                           indices_out, indices_out_len, written) ||
+        !num_subtrees)
+        return WALLY_EINVAL;
+
+    if (!(vr = assets_prepare(values, num_values, target, &ret)))
+        return ret;
+
+    /* Compute the shared bound from the largest-first selection */
+    bound.score = 0xffffffff;
+    bound.sum = 0;
+    bound.num_indices = 0;
+    for (i = 0; i < num_values && i < WALLY_CS_MAX_ASSETS && sum < target; ++i) {
+        bound.indices[i] = (uint32_t)i;
+        sum += values[i];
+    }
+    if (sum >= target) {
+        bound.score = i + (sum == target ? 0 : io_ratio);
+        bound.sum = sum;
+        bound.num_indices = i;
+    }
+
+    s.vr = vr;
+    s.target = target;
+    s.attempts = attempts;
+    s.io_ratio = io_ratio;
+    s.num_subtrees = num_subtrees < num_values ? num_subtrees : num_values;
+    if (s.num_subtrees > WALLY_CS_MAX_ASSETS)
+        s.num_subtrees = WALLY_CS_MAX_ASSETS;
+    s.results = wally_malloc(s.num_subtrees * sizeof(asset_selection_t));
+    if (!s.results) {
+        wally_free(vr);
         return WALLY_ENOMEM;
+    }
+    for (i = 0; i < s.num_subtrees; ++i)
+        memcpy(&s.results[i], &bound, sizeof(bound));
 
-    for (i = 0; i < num_values; ++i) {
-        vr[i].remaining = remaining;
-        vr[i].value = values[i];
-        remaining -= values[i];
+    run_tasks(assets_split_task, &s, s.num_subtrees);
+
+    /* Merge the subtree results in order. Subtrees only replace the bound
+     * with a better selection, which therefore differs in score or sum */
+    memcpy(&best, &bound, sizeof(bound));
+    for (i = 0; i < s.num_subtrees; ++i) {
+        const asset_selection_t *r = &s.results[i];
+        if ((r->score != bound.score || r->sum != bound.sum) &&
+            asset_selection_is_better(&best, r->score, r->sum, target))
+            memcpy(&best, r, sizeof(best));
     }
-    vr[i].remaining = 0;
-    vr[i].value = 0;
+    assets_output(&best, indices_out, written);
+    wally_free(s.results);
+    wally_free(vr);
+    return WALLY_OK;
+}
+
+/* Fee in satoshi to spend an input of the given weight at fee_rate sat/kvB */
+static int cs_input_fee(uint32_t weight, uint64_t fee_rate, uint64_t *fee_out)
+{
+    const uint64_t vsize = ((uint64_t)weight + 3) / 4;
+    if (fee_rate && vsize > (UINT64_MAX - 999) / fee_rate)
+        return WALLY_EINVAL; /* Fee overflows */
+    *fee_out = (vsize * fee_rate + 999) / 1000;
+    return WALLY_OK;
+}
+
+/* Sort by effective value descending, then by index for determinism */
+static int cs_utxo_compare(const void *lhs, const void *rhs)
+{
+    const cs_utxo_t *l = lhs, *r = rhs;
+    if (l->value != r->value)
+        return l->value > r->value ? -1 : 1;
+    return l->index < r->index ? -1 : 1;
+}
+
+/* Find the first UTXO in [lo, hi) with an effective value below value */
+static size_t cs_first_below(const cs_utxo_t *u, size_t lo, size_t hi,
+                             uint64_t value)
+{
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        if (u[mid].value >= value)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/*
+ * Effective value coin selection for BTC and the policy asset L-BTC.
+ *
+ * Each UTXO's effective value is its value less the fee to spend it at
+ * fee_rate. UTXOs whose effective value is zero or less cost more to spend
+ * than they are worth and are ignored. Solutions are scored by their waste:
+ * the sum over the selected inputs of their fee at fee_rate less their fee
+ * at long_term_fee_rate, plus either the excess over target for changeless
+ * solutions, or cost_of_change for solutions that require change. When fees
+ * are higher than the long term fee rate, using fewer inputs is preferred;
+ * when they are lower, consolidating more inputs is preferred.
+ *
+ * We first search for a changeless solution using branch and bound, as
+ * described in "An Evaluation of Coin Selection Strategies" by Erhardt and
+ * as implemented in Bitcoin Core. UTXOs are sorted by effective value from
+ * largest to smallest and searched depth first in the same manner as
+ * wally_coinselect_assets above, sharing its core optimizations:
+ * - Cut the search branch when it cannot reach the target
+ * - Cut the search branch when it exceeds the target by more than
+ *   cost_of_change (after scoring it if it is in range)
+ * - Cut the search branch when its waste exceeds the best solution and
+ *   adding inputs can only increase waste further
+ * - Do not test equivalent combinations
+ *
+ * We add one additional optimization: when including a UTXO would overshoot,
+ * we binary search past every UTXO at least as large instead of trying them
+ * one at a time. Large UTXO sets are often dominated by values far above the
+ * target, and this keeps them from exhausting the attempt budget.
+ *
+ * If no changeless solution is found within the attempt budget, we fall
+ * back to a deterministic knapsack style selection that creates change,
+ * choosing the solution with the least waste from:
+ * - The single smallest UTXO that covers target + cost_of_change, and
+ * - The largest UTXOs smaller than target + cost_of_change, accumulated
+ *   until the next would cover it, completed with the smallest remaining
+ *   UTXO that covers it.
+ *
+ * As with wally_coinselect_assets, the results are deterministic: we do not
+ * randomize the search, so callers wanting privacy from UTXO ordering
+ * should shuffle the inputs of the resulting transaction.
+ *
+ * Sorting dominates the cost of building the search, so selection from
+ * large UTXO sets (100k or more) is bounded by the attempt budget rather
+ * than the number of UTXOs.
+ */
+static size_t cs_bnb(const cs_utxo_t *u, size_t n, uint64_t target,
+                     uint64_t cost_of_change, uint64_t attempts,
+                     bool waste_increases, uint32_t *selection, uint32_t *best)
+{
+    const uint64_t upper = target + cost_of_change;
+    uint64_t sum = 0;
+    int64_t waste = 0, best_waste = INT64_MAX;
+    uint32_t v = 0, ii = 0;
+    size_t i, attempt, best_len = 0;
 
     for (attempt = 0; attempt < attempts; ++attempt) {
         bool backtrack = false;
 
-        if (sum + vr[v].remaining < target) {
+        if (sum + u[v].remaining < target) {
             /* Current selection plus remaining amount can not reach target */
             backtrack = true;
+        } else if (sum > upper) {
+            /* Current selection overshoots: any solution would need change */
+            backtrack = true;
+        } else if (waste_increases && waste > best_waste) {
+            /* Adding more inputs can only make the waste worse */
+            backtrack = true;
         } else if (sum >= target) {
-            /* Current selection reaches or exceeds the target */
-            const uint64_t score = ii + (sum == target ? 0 : io_ratio);
-
-            if (score < best_score ||
-                (score == best_score &&
-                (sum > best_sum || (sum == target && best_sum != target)))) {
+            /* Current selection is in range: score it. Input fees are at
+             * most UINT64_MAX / 1000, so the waste of WALLY_CS_MAX_INPUTS
+             * inputs fits in an int64_t, but adding the excess may not */
+            const uint64_t excess = sum - target; /* <= cost_of_change */
+            const int64_t total_waste = waste > 0 && excess > (uint64_t)(INT64_MAX - waste) ?
+                                        INT64_MAX : waste + (int64_t)excess;
+            if (total_waste <= best_waste) {
                 /* This selection is 'better' by our criteria, use it */
-                best_score = score;
-                best_sum = sum;
-                *written = ii;
+                best_waste = total_waste;
+                best_len = ii;
                 for (i = 0; i < ii; ++i)
-                    indices_out[i] = indices[i];
-                if (sum == target && ii == 1)
-                    break; /* Perfect selection: don't try for better */
+                    best[i] = selection[i];
             }
             backtrack = true;
-        } else if (ii >= best_score || ii >= WALLY_CS_MAX_ASSETS) {
-            /* We cannot beat the best score by adding more inputs */
+        } else if (ii >= WALLY_CS_MAX_INPUTS) {
+            /* We cannot add any more inputs */
             backtrack = true;
         }
 
@@ -148,20 +487,134 @@ int wally_coinselect_assets(const uint64_t *values, size_t num_values,
             if (ii-- == 0)
                 break; /* All viable selections have been searched */
 
-            while (--v > indices[ii])
-                /* Loop adding omitted UTXO values to the available selection */;
-
-            sum -= vr[v].value; /* Remove last included UTXO value from the selection */
-        } else if (ii == 0 ||                        /* First UTXO value, or */
-                   v - 1 == indices[ii - 1] ||       /* Previous index is included, or */
-                   vr[v].value != vr[v - 1].value) { /* UTXO value is different */
-            /* Add this UTXOs value to the selection */
-            indices[ii++] = v;
-            sum += vr[v].value;
+            v = selection[ii]; /* Remove the last included UTXO */
+            sum -= u[v].value;
+            waste -= u[v].waste;
+        } else if (sum + u[v].value > upper) {
+            /* Including this UTXO would overshoot, as would any larger
+             * UTXO: skip directly to the first that fits */
+            v = cs_first_below(u, v, n, upper - sum + 1);
+            continue;
+        } else if (ii == 0 ||                      /* First UTXO, or */
+                   v - 1 == selection[ii - 1] ||   /* Previous UTXO is included, or */
+                   u[v].value != u[v - 1].value || /* UTXO value is different, or */
+                   u[v].waste != u[v - 1].waste) { /* UTXO waste is different */
+            /* Add this UTXO to the selection */
+            selection[ii++] = v;
+            sum += u[v].value;
+            waste += u[v].waste;
         }
 
         ++v;
     }
-    wally_free(vr);
-    return WALLY_OK;
+    return best_len;
+}
+
+/* Deterministic fallback selection creating change. Returns the number of
+ * inputs selected into best, or 0 if the target cannot be reached */
+static size_t cs_fallback(const cs_utxo_t *u, size_t n, uint64_t target,
+                          uint64_t cost_of_change,
+                          uint32_t *selection, uint32_t *best)
+{
+    const uint64_t min_target = target + cost_of_change;
+    uint64_t sum = 0;
+    int64_t waste = 0, best_waste = INT64_MAX;
+    size_t i, first_smaller, ii = 0, best_len = 0;
+
+    first_smaller = cs_first_below(u, 0, n, min_target);
+
+    if (first_smaller) {
+        /* The smallest single UTXO that covers the target */
+        best[0] = first_smaller - 1;
+        best_waste = u[best[0]].waste;
+        best_len = 1;
+    }
+
+    /* Accumulate the largest smaller UTXOs until they cover the target */
+    for (i = first_smaller; i < n && ii < WALLY_CS_MAX_INPUTS; ++i) {
+        if (sum + u[i].value >= min_target) {
+            /* Complete the selection using the smallest UTXO that covers
+             * the remainder, to minimize the change created */
+            const size_t j = cs_first_below(u, i, n, min_target - sum) - 1;
+            selection[ii++] = j;
+            sum += u[j].value;
+            break;
+        }
+        selection[ii++] = i;
+        sum += u[i].value;
+    }
+    if (sum >= min_target) {
+        for (i = 0; i < ii; ++i)
+            waste += u[selection[i]].waste;
+        if (waste < best_waste || (waste == best_waste && ii < best_len)) {
+            for (i = 0; i < ii; ++i)
+                best[i] = selection[i];
+            best_len = ii;
+        }
+    }
+    return best_len;
+}
+
+int wally_coinselect(const uint64_t *values, size_t num_values,
+                     const uint32_t *weights, size_t num_weights,
+                     uint64_t target, uint64_t fee_rate,
+                     uint64_t long_term_fee_rate, uint64_t cost_of_change,
+                     uint64_t attempts, uint32_t flags,
+                     uint32_t *indices_out, size_t indices_out_len,
+                     size_t *written)
+{
+    uint32_t selection[WALLY_CS_MAX_INPUTS], best[WALLY_CS_MAX_INPUTS];
+    cs_utxo_t *u;
+    uint64_t remaining = 0, fee, long_term_fee;
+    size_t i, n = 0, best_len;
+    int ret = WALLY_OK;
+
+    if (written)
+        *written = 0;
+    if (!values || !num_values || num_values > UINT32_MAX ||
+        !weights || num_weights != num_values || !target ||
+        target > UINT64_MAX / 2 || cost_of_change > UINT64_MAX / 2 ||
+        !attempts || flags || !indices_out ||
+        (indices_out_len < num_values && indices_out_len < WALLY_CS_MAX_INPUTS) ||
+        !written)
+        return WALLY_EINVAL;
+
+    /* Allocate an extra zero-valued sentinel to mark the end of the UTXOs */
+    if (!(u = wally_malloc((num_values + 1) * sizeof(cs_utxo_t))))
+        return WALLY_ENOMEM;
+
+    /* Compute effective values, ignoring uneconomical UTXOs */
+    for (i = 0; i < num_values && ret == WALLY_OK; ++i) {
+        ret = cs_input_fee(weights[i], fee_rate, &fee);
+        if (ret == WALLY_OK)
+            ret = cs_input_fee(weights[i], long_term_fee_rate, &long_term_fee);
+        if (ret == WALLY_OK && values[i] > fee) {
+            u[n].value = values[i] - fee;
+            u[n].waste = (int64_t)fee - (int64_t)long_term_fee;
+            u[n].index = i;
+            if (u[n].value > UINT64_MAX - remaining)
+                ret = WALLY_EINVAL; /* Total effective value overflows */
+            remaining += u[n].value;
+            ++n;
+        }
+    }
+
+    if (ret == WALLY_OK && remaining >= target) {
+        qsort(u, n, sizeof(cs_utxo_t), cs_utxo_compare);
+        for (i = 0; i < n; ++i) {
+            u[i].remaining = remaining;
+            remaining -= u[i].value;
+        }
+        wally_clear(u + n, sizeof(cs_utxo_t));
+        best_len = cs_bnb(u, n, target, cost_of_change, attempts,
+                          fee_rate > long_term_fee_rate, selection, best);
+        if (!best_len)
+            best_len = cs_fallback(u, n, target, cost_of_change, selection, best);
+        for (i = 0; i < best_len; ++i)
+            indices_out[i] = u[best[i]].index;
+        *written = best_len;
+    }
+
+    clear_and_free(u, (num_values + 1) * sizeof(cs_utxo_t));
+    return ret;
 }
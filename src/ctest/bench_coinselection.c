@@ -0,0 +1,284 @@
+#include "config.h"
+
+#include <wally_coinselection.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+/*
+ * Coin selection benchmark.
+ *
+ * Generates reproducible synthetic UTXO sets and runs each coin selector
+ * against them, printing one CSV line per selection:
+ *
+ *   selector,distribution,num_utxos,target,usec,attempts,inputs,change,waste
+ *
+ * - usec: The fastest of BENCH_RUNS selections, in microseconds of CPU time.
+ * - attempts: The smallest attempt budget that returns the same selection.
+ * - inputs: The number of inputs selected, or 0 if no solution was found.
+ * - change: The amount selected in excess of the target that requires a
+ *   change output, or 0 for changeless selections.
+ * - waste: For wally_coinselect, the waste score as described in coins.c.
+ *   For asset selection, the selection score (inputs plus io_ratio if
+ *   change is required).
+ *
+ * Usage: bench_coinselection [max_num_utxos]
+ *
+ * Sizes from 10 up to max_num_utxos (default 1000000) are benchmarked. Pass
+ * a smaller maximum for quicker runs.
+ */
+
+#define NUM_ELEMS(a) (sizeof(a) / sizeof(a[0]))
+#define BENCH_RUNS 3
+#define BENCH_ATTEMPTS 100000
+
+/* A P2WPKH input, fee rates in satoshi per 1000 vbytes */
+#define P2WPKH_WEIGHT 272
+#define FEE_RATE 5000
+#define LONG_TERM_FEE_RATE 2000
+/* Creating a 31 vbyte P2WPKH output now, and spending it later */
+#define COST_OF_CHANGE ((31 * FEE_RATE + 999) / 1000 + (68 * LONG_TERM_FEE_RATE + 999) / 1000)
+#define IO_RATIO 5
+#define NUM_SUBTREES 8
+
+/* splitmix64: a small, fast PRNG giving identical sequences everywhere */
+static uint64_t rng_next(uint64_t *state)
+{
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+static uint64_t rng_range(uint64_t *state, uint64_t lo, uint64_t hi)
+{
+    return lo + rng_next(state) % (hi - lo + 1);
+}
+
+/* Values uniformly distributed between 0.00001 and 1 BTC */
+static uint64_t gen_uniform(uint64_t *state)
+{
+    return rng_range(state, 1000, 100000000);
+}
+
+/* Values with a power law distribution: each doubling is half as likely */
+static uint64_t gen_power_law(uint64_t *state)
+{
+    uint64_t bits = rng_next(state);
+    uint32_t shift = 0;
+    while ((bits & 1) && shift < 30) {
+        bits >>= 1;
+        ++shift;
+    }
+    return rng_range(state, 1000, 1999) << shift;
+}
+
+/* 90% of values are dust that costs more to spend than it is worth */
+static uint64_t gen_dust_heavy(uint64_t *state)
+{
+    if (rng_next(state) % 10)
+        return rng_range(state, 1, 1000);
+    return gen_uniform(state);
+}
+
+/* A consolidated wallet: a few large values and many identical ones */
+static uint64_t gen_consolidated(uint64_t *state)
+{
+    if (rng_next(state) % 100 == 0)
+        return rng_range(state, 100000000, 1000000000);
+    return 50000;
+}
+
+static const struct distribution {
+    const char *name;
+    uint64_t (*gen)(uint64_t *state);
+} g_distributions[] = {
+    { "uniform", gen_uniform },
+    { "power_law", gen_power_law },
+    { "dust_heavy", gen_dust_heavy },
+    { "consolidated", gen_consolidated },
+};
+
+static const size_t g_sizes[] = { 10, 100, 1000, 10000, 100000, 1000000 };
+
+/* Selection parameters and results */
+struct bench {
+    const uint64_t *values;
+    const uint64_t *sorted;
+    const uint32_t *weights;
+    size_t num_values;
+    uint64_t target;
+    uint32_t out[WALLY_CS_MAX_ASSETS];
+    size_t written;
+};
+
+typedef int (*selector_fn)(struct bench *b, uint64_t attempts);
+
+static int select_utxos(struct bench *b, uint64_t attempts)
+{
+    return wally_coinselect(b->values, b->num_values, b->weights, b->num_values,
+                            b->target, FEE_RATE, LONG_TERM_FEE_RATE,
+                            COST_OF_CHANGE, attempts, 0,
+                            b->out, NUM_ELEMS(b->out), &b->written);
+}
+
+#ifdef BUILD_ELEMENTS
+static int select_assets(struct bench *b, uint64_t attempts)
+{
+    return wally_coinselect_assets(b->sorted, b->num_values, b->target,
+                                   b->num_values + attempts, IO_RATIO,
+                                   b->out, NUM_ELEMS(b->out), &b->written);
+}
+
+static int select_assets_split(struct bench *b, uint64_t attempts)
+{
+    return wally_coinselect_assets_split(b->sorted, b->num_values, b->target,
+                                         b->num_values + attempts, IO_RATIO,
+                                         NUM_SUBTREES, b->out,
+                                         NUM_ELEMS(b->out), &b->written);
+}
+#endif /* BUILD_ELEMENTS */
+
+static const struct selector {
+    const char *name;
+    selector_fn fn;
+    bool is_assets;
+} g_selectors[] = {
+    { "coinselect", select_utxos, false },
+#ifdef BUILD_ELEMENTS
+    { "coinselect_assets", select_assets, true },
+    { "coinselect_assets_split", select_assets_split, true },
+#endif
+};
+
+static uint64_t input_fee(uint64_t fee_rate)
+{
+    return ((P2WPKH_WEIGHT + 3) / 4 * fee_rate + 999) / 1000;
+}
+
+static void get_change_and_waste(const struct selector *sel, const struct bench *b,
+                                 uint64_t *change, int64_t *waste)
+{
+    const uint64_t fee = input_fee(FEE_RATE);
+    const uint64_t *values = sel->is_assets ? b->sorted : b->values;
+    uint64_t sum = 0, excess;
+    size_t i;
+
+    for (i = 0; i < b->written; ++i)
+        sum += values[b->out[i]] - (sel->is_assets ? 0 : fee);
+    *change = 0;
+    *waste = 0;
+    if (!b->written)
+        return;
+    excess = sum - b->target;
+    if (sel->is_assets) {
+        *change = excess;
+        *waste = (int64_t)b->written + (excess ? IO_RATIO : 0);
+        return;
+    }
+    *waste = (int64_t)b->written * ((int64_t)fee - (int64_t)input_fee(LONG_TERM_FEE_RATE));
+    if (excess > COST_OF_CHANGE) {
+        *change = excess;
+        *waste += COST_OF_CHANGE;
+    } else
+        *waste += (int64_t)excess;
+}
+
+static bool bench_selector(const struct selector *sel, const char *dist_name,
+                           struct bench *b)
+{
+    uint32_t expected[WALLY_CS_MAX_ASSETS];
+    size_t expected_len, run;
+    uint64_t lo = 1, hi = BENCH_ATTEMPTS, change;
+    int64_t waste;
+    clock_t best = 0;
+
+    for (run = 0; run < BENCH_RUNS; ++run) {
+        const clock_t start = clock();
+        if (sel->fn(b, BENCH_ATTEMPTS) != WALLY_OK) {
+            fprintf(stderr, "%s/%s/%d selection failed!\n",
+                    sel->name, dist_name, (int)b->num_values);
+            return false;
+        }
+        if (!run || clock() - start < best)
+            best = clock() - start;
+    }
+    expected_len = b->written;
+    memcpy(expected, b->out, expected_len * sizeof(expected[0]));
+    get_change_and_waste(sel, b, &change, &waste);
+
+    /* Find the smallest attempt budget that returns the same selection */
+    while (lo < hi) {
+        const uint64_t mid = lo + (hi - lo) / 2;
+        if (sel->fn(b, mid) == WALLY_OK && b->written == expected_len &&
+            !memcmp(b->out, expected, expected_len * sizeof(expected[0])))
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+
+    printf("%s,%s,%d,%llu,%llu,%llu,%d,%llu,%lld\n",
+           sel->name, dist_name, (int)b->num_values,
+           (unsigned long long)b->target,
+           (unsigned long long)((uint64_t)best * 1000000u / CLOCKS_PER_SEC),
+           (unsigned long long)(sel->is_assets ? b->num_values + lo : lo),
+           (int)expected_len, (unsigned long long)change, (long long)waste);
+    return true;
+}
+
+static int compare_desc(const void *lhs, const void *rhs)
+{
+    const uint64_t l = *(const uint64_t *)lhs, r = *(const uint64_t *)rhs;
+    return l == r ? 0 : (l > r ? -1 : 1);
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t max_size = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+    const size_t max_alloc = g_sizes[NUM_ELEMS(g_sizes) - 1];
+    uint64_t *values = malloc(max_alloc * sizeof(uint64_t));
+    uint64_t *sorted = malloc(max_alloc * sizeof(uint64_t));
+    uint32_t *weights = malloc(max_alloc * sizeof(uint32_t));
+    struct bench b;
+    size_t d, s, i, t;
+    bool ok = values && sorted && weights;
+
+    for (i = 0; ok && i < max_alloc; ++i)
+        weights[i] = P2WPKH_WEIGHT;
+
+    if (ok)
+        printf("selector,distribution,num_utxos,target,usec,attempts,inputs,change,waste\n");
+
+    for (d = 0; ok && d < NUM_ELEMS(g_distributions); ++d) {
+        const struct distribution *dist = g_distributions + d;
+
+        for (s = 0; ok && s < NUM_ELEMS(g_sizes) && g_sizes[s] <= max_size; ++s) {
+            uint64_t state = d * 1000003u + s, total = 0;
+
+            for (i = 0; i < g_sizes[s]; ++i) {
+                values[i] = dist->gen(&state);
+                total += values[i];
+            }
+            memcpy(sorted, values, g_sizes[s] * sizeof(uint64_t));
+            qsort(sorted, g_sizes[s], sizeof(uint64_t), compare_desc);
+
+            b.values = values;
+            b.sorted = sorted;
+            b.weights = weights;
+            b.num_values = g_sizes[s];
+
+            /* Targets needing a few inputs, and many inputs */
+            for (t = 0; ok && t < 2; ++t) {
+                b.target = total / g_sizes[s] * (t ? 20 : 3) + 777;
+                for (i = 0; ok && i < NUM_ELEMS(g_selectors); ++i)
+                    ok = bench_selector(g_selectors + i, dist->name, &b);
+            }
+        }
+    }
+    free(values);
+    free(sorted);
+    free(weights);
+    return ok ? 0 : 1;
+}
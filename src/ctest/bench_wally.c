@@ -0,0 +1,730 @@
+#include "config.h"
+
+#include <wally_address.h>
+#include <wally_bip32.h>
+#include <wally_crypto.h>
+#include <wally_descriptor.h>
+#include <wally_map.h>
+#include <wally_psbt.h>
+#include <wally_script.h>
+#include <wally_transaction.h>
+#ifdef BUILD_ELEMENTS
+#include <wally_elements.h>
+#endif
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+/*
+ * Hot path benchmark.
+ *
+ * Builds reproducible fixtures (keys, transactions, PSBTs and descriptors)
+ * from fixed seeds and times each operation against them, printing one CSV
+ * line per benchmark:
+ *
+ *   benchmark,iterations,usec,ns_per_op
+ *
+ * - iterations: The number of operations timed, doubled until a run takes
+ *   at least min_msec of CPU time.
+ * - usec: The fastest of BENCH_RUNS runs of iterations operations, in
+ *   microseconds of CPU time.
+ * - ns_per_op: usec converted to nanoseconds per operation.
+ *
+ * Benchmarks that modify a PSBT (psbt_sign, psbt_finalize, psbt_combine)
+ * operate on a fresh clone each time; psbt_clone is reported separately so
+ * its cost can be subtracted.
+ *
+ * Usage: bench_wally [name_prefix] [min_msec]
+ *
+ * Only benchmarks whose names start with name_prefix (default: all) are run.
+ * min_msec (default 100) trades run time for accuracy.
+ */
+
+#define NUM_ELEMS(a) (sizeof(a) / sizeof(a[0]))
+#define BENCH_RUNS 3
+#define BUFF_LEN 1024
+#define NUM_INPUTS 8
+#define NUM_ADDRESSES 10
+#define INPUT_SATOSHI 100000
+
+/* Sighash benchmark arguments: the signature type and sighash flags */
+#define SIGHASH_ARG(sigtype, sighash) (((sigtype) << 8) | (sighash))
+#define SIGHASH_ACP WALLY_SIGHASH_ANYONECANPAY
+
+static struct fixtures {
+    unsigned char buff[BUFF_LEN];
+    char *hex;
+    char *base64;
+    struct ext_key master, child, child_pub;
+    unsigned char serialized[BIP32_SERIALIZED_LEN];
+    char *base58;
+    unsigned char p2pkh[WALLY_SCRIPTPUBKEY_P2PKH_LEN];
+    unsigned char p2wpkh[WALLY_SCRIPTPUBKEY_P2WPKH_LEN];
+    unsigned char p2tr[WALLY_SCRIPTPUBKEY_P2TR_LEN];
+    char *segwit_addr, *taproot_addr;
+    struct wally_map taproot_scripts;
+    uint64_t values[NUM_INPUTS];
+    struct wally_tx *tx, *signed_tx;
+    unsigned char *tx_bytes;
+    size_t tx_bytes_len;
+    struct wally_psbt *psbt, *signed_psbt;
+    unsigned char *psbt_bytes;
+    size_t psbt_bytes_len;
+    struct wally_descriptor *descriptor;
+    char *descriptor_str;
+#ifdef BUILD_ELEMENTS
+    unsigned char assets[ASSET_TAG_LEN * 3];
+    unsigned char abfs[BLINDING_FACTOR_LEN * 3];
+    unsigned char generators[ASSET_GENERATOR_LEN * 3];
+    unsigned char vbf[BLINDING_FACTOR_LEN];
+    unsigned char commitment[ASSET_COMMITMENT_LEN];
+    unsigned char rangeproof[ASSET_RANGEPROOF_MAX_LEN];
+    size_t rangeproof_len;
+#endif
+} g_f;
+
+static const uint32_t g_path[] = {
+    BIP32_INITIAL_HARDENED_CHILD | 84, BIP32_INITIAL_HARDENED_CHILD,
+    BIP32_INITIAL_HARDENED_CHILD, 0, 0
+};
+
+typedef int (*bench_fn)(struct fixtures *f, uint32_t arg);
+
+/*
+ * Hashing and key stretching
+ */
+static int bench_sha256(struct fixtures *f, uint32_t arg)
+{
+    unsigned char out[SHA256_LEN];
+    return wally_sha256(f->buff, arg, out, sizeof(out));
+}
+
+static int bench_sha512(struct fixtures *f, uint32_t arg)
+{
+    unsigned char out[SHA512_LEN];
+    return wally_sha512(f->buff, arg, out, sizeof(out));
+}
+
+static int bench_hmac_sha256(struct fixtures *f, uint32_t arg)
+{
+    unsigned char out[HMAC_SHA256_LEN];
+    return wally_hmac_sha256(f->buff, 32, f->buff, arg, out, sizeof(out));
+}
+
+static int bench_hmac_sha512(struct fixtures *f, uint32_t arg)
+{
+    unsigned char out[HMAC_SHA512_LEN];
+    return wally_hmac_sha512(f->buff, 32, f->buff, arg, out, sizeof(out));
+}
+
+static int bench_pbkdf2(struct fixtures *f, uint32_t arg)
+{
+    unsigned char out[PBKDF2_HMAC_SHA512_LEN];
+    return wally_pbkdf2_hmac_sha512(f->buff, 64, f->buff + 64, 16, 0, arg,
+                                    out, sizeof(out));
+}
+
+static int bench_scrypt(struct fixtures *f, uint32_t arg)
+{
+    unsigned char out[64];
+    return wally_scrypt(f->buff, 32, f->buff + 32, 8, arg, 8, 8, out, sizeof(out));
+}
+
+/*
+ * Encodings
+ */
+static int bench_base58_from_bytes(struct fixtures *f, uint32_t arg)
+{
+    char *str;
+    int ret = wally_base58_from_bytes(f->serialized, sizeof(f->serialized), arg, &str);
+    wally_free_string(str);
+    return ret;
+}
+
+static int bench_base58_to_bytes(struct fixtures *f, uint32_t arg)
+{
+    unsigned char out[BIP32_SERIALIZED_LEN + BASE58_CHECKSUM_LEN];
+    size_t written;
+    return wally_base58_to_bytes(f->base58, arg, out, sizeof(out), &written);
+}
+
+static int bench_bech32_from_bytes(struct fixtures *f, uint32_t arg)
+{
+    const unsigned char *program = arg == WALLY_SCRIPTPUBKEY_P2TR_LEN ? f->p2tr : f->p2wpkh;
+    char *str;
+    int ret = wally_addr_segwit_from_bytes(program, arg, "bc", 0, &str);
+    wally_free_string(str);
+    return ret;
+}
+
+static int bench_bech32_to_bytes(struct fixtures *f, uint32_t arg)
+{
+    unsigned char out[WALLY_SCRIPTPUBKEY_P2TR_LEN];
+    size_t written;
+    const char *addr = arg == WALLY_SCRIPTPUBKEY_P2TR_LEN ? f->taproot_addr : f->segwit_addr;
+    return wally_addr_segwit_to_bytes(addr, "bc", 0, out, sizeof(out), &written);
+}
+
+static int bench_hex_from_bytes(struct fixtures *f, uint32_t arg)
+{
+    char *str;
+    int ret = wally_hex_from_bytes(f->buff, arg, &str);
+    wally_free_string(str);
+    return ret;
+}
+
+static int bench_hex_to_bytes(struct fixtures *f, uint32_t arg)
+{
+    unsigned char out[BUFF_LEN];
+    size_t written;
+    int ret = wally_hex_to_bytes(f->hex, out, sizeof(out), &written);
+    (void)arg;
+    return ret == WALLY_OK && written > sizeof(out) ? WALLY_ERROR : ret;
+}
+
+static int bench_base64_from_bytes(struct fixtures *f, uint32_t arg)
+{
+    char *str;
+    int ret = wally_base64_from_bytes(f->buff, arg, 0, &str);
+    wally_free_string(str);
+    return ret;
+}
+
+static int bench_base64_to_bytes(struct fixtures *f, uint32_t arg)
+{
+    unsigned char out[BUFF_LEN + 4];
+    size_t written;
+    int ret = wally_base64_to_bytes(f->base64, 0, out, sizeof(out), &written);
+    (void)arg;
+    return ret == WALLY_OK && written > sizeof(out) ? WALLY_ERROR : ret;
+}
+
+/*
+ * Transactions
+ */
+static int bench_tx_from_bytes(struct fixtures *f, uint32_t arg)
+{
+    struct wally_tx *tx;
+    int ret = wally_tx_from_bytes(f->tx_bytes, f->tx_bytes_len, arg, &tx);
+    wally_tx_free(tx);
+    return ret;
+}
+
+static int bench_tx_to_bytes(struct fixtures *f, uint32_t arg)
+{
+    unsigned char out[BUFF_LEN * 2];
+    size_t written;
+    int ret = wally_tx_to_bytes(f->signed_tx, arg, out, sizeof(out), &written);
+    return ret == WALLY_OK && written > sizeof(out) ? WALLY_ERROR : ret;
+}
+
+static int bench_txid(struct fixtures *f, uint32_t arg)
+{
+    unsigned char out[WALLY_TXHASH_LEN];
+    (void)arg;
+    return wally_tx_get_txid(f->signed_tx, out, sizeof(out));
+}
+
+static int bench_sighash(struct fixtures *f, uint32_t arg)
+{
+    const uint32_t sigtype = arg >> 8, sighash = arg & 0xff;
+    const size_t index = 1; /* Has a matching output for SIGHASH_SINGLE */
+    unsigned char out[SHA256_LEN];
+
+    if (sigtype == WALLY_SIGTYPE_SW_V1)
+        return wally_tx_get_btc_taproot_signature_hash(f->tx, index, &f->taproot_scripts,
+                                                       f->values, NUM_INPUTS,
+                                                       NULL, 0, 0x00, WALLY_NO_CODESEPARATOR,
+                                                       NULL, 0, sighash, 0,
+                                                       out, sizeof(out));
+    return wally_tx_get_btc_signature_hash(f->tx, index, f->p2pkh, sizeof(f->p2pkh),
+                                           INPUT_SATOSHI, sighash,
+                                           sigtype == WALLY_SIGTYPE_SW_V0 ? WALLY_TX_FLAG_USE_WITNESS : 0,
+                                           out, sizeof(out));
+}
+
+/*
+ * BIP32
+ */
+static int bench_bip32_from_seed(struct fixtures *f, uint32_t arg)
+{
+    struct ext_key key;
+    (void)arg;
+    return bip32_key_from_seed(f->buff, BIP32_ENTROPY_LEN_256,
+                               BIP32_VER_MAIN_PRIVATE, 0, &key);
+}
+
+static int bench_bip32_derive(struct fixtures *f, uint32_t arg)
+{
+    const struct ext_key *parent = arg & BIP32_FLAG_KEY_PUBLIC ? &f->child_pub : &f->child;
+    const uint32_t child_num = arg & 0x100 ? BIP32_INITIAL_HARDENED_CHILD : 1;
+    struct ext_key key;
+    return bip32_key_from_parent(parent, child_num, arg & 0xff, &key);
+}
+
+static int bench_bip32_derive_path(struct fixtures *f, uint32_t arg)
+{
+    struct ext_key key;
+    return bip32_key_from_parent_path(&f->master, g_path, NUM_ELEMS(g_path),
+                                      arg, &key);
+}
+
+/*
+ * Descriptors
+ */
+static int bench_descriptor_parse(struct fixtures *f, uint32_t arg)
+{
+    struct wally_descriptor *descriptor;
+    int ret = wally_descriptor_parse(f->descriptor_str, NULL,
+                                     WALLY_NETWORK_BITCOIN_MAINNET, arg, &descriptor);
+    wally_descriptor_free(descriptor);
+    return ret;
+}
+
+static int bench_descriptor_addresses(struct fixtures *f, uint32_t arg)
+{
+    char *addresses[NUM_ADDRESSES];
+    size_t i;
+    int ret = wally_descriptor_to_addresses(f->descriptor, 0, 0, arg, 0,
+                                            addresses, NUM_ADDRESSES);
+    for (i = 0; ret == WALLY_OK && i < NUM_ADDRESSES; ++i)
+        wally_free_string(addresses[i]);
+    return ret;
+}
+
+/*
+ * PSBTs
+ */
+static int bench_psbt_from_bytes(struct fixtures *f, uint32_t arg)
+{
+    struct wally_psbt *psbt;
+    int ret = wally_psbt_from_bytes(f->psbt_bytes, f->psbt_bytes_len, arg, &psbt);
+    wally_psbt_free(psbt);
+    return ret;
+}
+
+static int bench_psbt_to_bytes(struct fixtures *f, uint32_t arg)
+{
+    unsigned char out[BUFF_LEN * 4];
+    size_t written;
+    int ret = wally_psbt_to_bytes(f->signed_psbt, arg, out, sizeof(out), &written);
+    return ret == WALLY_OK && written > sizeof(out) ? WALLY_ERROR : ret;
+}
+
+static int bench_psbt_clone(struct fixtures *f, uint32_t arg)
+{
+    struct wally_psbt *psbt;
+    int ret = wally_psbt_clone_alloc(f->psbt, arg, &psbt);
+    wally_psbt_free(psbt);
+    return ret;
+}
+
+static int bench_psbt_sign(struct fixtures *f, uint32_t arg)
+{
+    struct wally_psbt *psbt;
+    int ret = wally_psbt_clone_alloc(f->psbt, 0, &psbt);
+    if (ret == WALLY_OK)
+        ret = wally_psbt_sign(psbt, f->child.priv_key + 1, EC_PRIVATE_KEY_LEN, arg);
+    wally_psbt_free(psbt);
+    return ret;
+}
+
+static int bench_psbt_finalize(struct fixtures *f, uint32_t arg)
+{
+    struct wally_psbt *psbt;
+    int ret = wally_psbt_clone_alloc(f->signed_psbt, 0, &psbt);
+    if (ret == WALLY_OK)
+        ret = wally_psbt_finalize(psbt, arg);
+    wally_psbt_free(psbt);
+    return ret;
+}
+
+static int bench_psbt_combine(struct fixtures *f, uint32_t arg)
+{
+    struct wally_psbt *psbt;
+    int ret = wally_psbt_clone_alloc(f->psbt, 0, &psbt);
+    (void)arg;
+    if (ret == WALLY_OK)
+        ret = wally_psbt_combine(psbt, f->signed_psbt);
+    wally_psbt_free(psbt);
+    return ret;
+}
+
+#ifdef BUILD_ELEMENTS
+/*
+ * Elements blinding and unblinding
+ */
+static int bench_asset_generator(struct fixtures *f, uint32_t arg)
+{
+    unsigned char out[ASSET_GENERATOR_LEN];
+    (void)arg;
+    return wally_asset_generator_from_bytes(f->assets, ASSET_TAG_LEN,
+                                            f->abfs, BLINDING_FACTOR_LEN,
+                                            out, sizeof(out));
+}
+
+static int bench_asset_value_commitment(struct fixtures *f, uint32_t arg)
+{
+    unsigned char out[ASSET_COMMITMENT_LEN];
+    return wally_asset_value_commitment(arg, f->vbf, sizeof(f->vbf),
+                                        f->generators, ASSET_GENERATOR_LEN,
+                                        out, sizeof(out));
+}
+
+static int bench_asset_rangeproof(struct fixtures *f, uint32_t arg)
+{
+    unsigned char out[ASSET_RANGEPROOF_MAX_LEN];
+    size_t written;
+    return wally_asset_rangeproof_with_nonce(arg, f->buff, SHA256_LEN,
+                                             f->assets, ASSET_TAG_LEN,
+                                             f->abfs, BLINDING_FACTOR_LEN,
+                                             f->vbf, sizeof(f->vbf),
+                                             f->commitment, sizeof(f->commitment),
+                                             f->p2pkh, sizeof(f->p2pkh),
+                                             f->generators, ASSET_GENERATOR_LEN,
+                                             1, 0, 52, out, sizeof(out), &written);
+}
+
+static int bench_asset_surjectionproof(struct fixtures *f, uint32_t arg)
+{
+    unsigned char out[ASSET_SURJECTIONPROOF_MAX_LEN];
+    size_t written;
+    (void)arg;
+    return wally_asset_surjectionproof(f->assets, ASSET_TAG_LEN,
+                                       f->abfs, BLINDING_FACTOR_LEN,
+                                       f->generators, ASSET_GENERATOR_LEN,
+                                       f->buff, 32,
+                                       f->assets, sizeof(f->assets),
+                                       f->abfs, sizeof(f->abfs),
+                                       f->generators, sizeof(f->generators),
+                                       out, sizeof(out), &written);
+}
+
+static int bench_asset_unblind(struct fixtures *f, uint32_t arg)
+{
+    unsigned char asset[ASSET_TAG_LEN], abf[BLINDING_FACTOR_LEN], vbf[BLINDING_FACTOR_LEN];
+    uint64_t value;
+    int ret = wally_asset_unblind_with_nonce(f->buff, SHA256_LEN,
+                                             f->rangeproof, f->rangeproof_len,
+                                             f->commitment, sizeof(f->commitment),
+                                             f->p2pkh, sizeof(f->p2pkh),
+                                             f->generators, ASSET_GENERATOR_LEN,
+                                             asset, sizeof(asset), abf, sizeof(abf),
+                                             vbf, sizeof(vbf), &value);
+    return ret == WALLY_OK && value != arg ? WALLY_ERROR : ret;
+}
+#endif /* BUILD_ELEMENTS */
+
+static const struct benchmark {
+    const char *name;
+    bench_fn fn;
+    uint32_t arg;
+} g_benchmarks[] = {
+    { "sha256_64", bench_sha256, 64 },
+    { "sha256_1k", bench_sha256, BUFF_LEN },
+    { "sha512_64", bench_sha512, 64 },
+    { "sha512_1k", bench_sha512, BUFF_LEN },
+    { "hmac_sha256_1k", bench_hmac_sha256, BUFF_LEN },
+    { "hmac_sha512_1k", bench_hmac_sha512, BUFF_LEN },
+    { "pbkdf2_hmac_sha512_2048", bench_pbkdf2, 2048 },
+    { "scrypt_16384_8_8", bench_scrypt, 16384 },
+    { "base58_from_bytes", bench_base58_from_bytes, 0 },
+    { "base58_from_bytes_check", bench_base58_from_bytes, BASE58_FLAG_CHECKSUM },
+    { "base58_to_bytes", bench_base58_to_bytes, 0 },
+    { "base58_to_bytes_check", bench_base58_to_bytes, BASE58_FLAG_CHECKSUM },
+    { "bech32_from_bytes", bench_bech32_from_bytes, WALLY_SCRIPTPUBKEY_P2WPKH_LEN },
+    { "bech32m_from_bytes", bench_bech32_from_bytes, WALLY_SCRIPTPUBKEY_P2TR_LEN },
+    { "bech32_to_bytes", bench_bech32_to_bytes, WALLY_SCRIPTPUBKEY_P2WPKH_LEN },
+    { "bech32m_to_bytes", bench_bech32_to_bytes, WALLY_SCRIPTPUBKEY_P2TR_LEN },
+    { "hex_from_bytes_1k", bench_hex_from_bytes, BUFF_LEN },
+    { "hex_to_bytes_1k", bench_hex_to_bytes, 0 },
+    { "base64_from_bytes_1k", bench_base64_from_bytes, BUFF_LEN },
+    { "base64_to_bytes_1k", bench_base64_to_bytes, 0 },
+    { "tx_from_bytes", bench_tx_from_bytes, 0 },
+    { "tx_to_bytes", bench_tx_to_bytes, 0 },
+    { "tx_to_bytes_witness", bench_tx_to_bytes, WALLY_TX_FLAG_USE_WITNESS },
+    { "tx_txid", bench_txid, 0 },
+    { "sighash_pre_sw_all", bench_sighash, SIGHASH_ARG(WALLY_SIGTYPE_PRE_SW, WALLY_SIGHASH_ALL) },
+    { "sighash_pre_sw_none", bench_sighash, SIGHASH_ARG(WALLY_SIGTYPE_PRE_SW, WALLY_SIGHASH_NONE) },
+    { "sighash_pre_sw_single", bench_sighash, SIGHASH_ARG(WALLY_SIGTYPE_PRE_SW, WALLY_SIGHASH_SINGLE) },
+    { "sighash_pre_sw_all_acp", bench_sighash, SIGHASH_ARG(WALLY_SIGTYPE_PRE_SW, WALLY_SIGHASH_ALL | SIGHASH_ACP) },
+    { "sighash_pre_sw_none_acp", bench_sighash, SIGHASH_ARG(WALLY_SIGTYPE_PRE_SW, WALLY_SIGHASH_NONE | SIGHASH_ACP) },
+    { "sighash_pre_sw_single_acp", bench_sighash, SIGHASH_ARG(WALLY_SIGTYPE_PRE_SW, WALLY_SIGHASH_SINGLE | SIGHASH_ACP) },
+    { "sighash_sw_v0_all", bench_sighash, SIGHASH_ARG(WALLY_SIGTYPE_SW_V0, WALLY_SIGHASH_ALL) },
+    { "sighash_sw_v0_none", bench_sighash, SIGHASH_ARG(WALLY_SIGTYPE_SW_V0, WALLY_SIGHASH_NONE) },
+    { "sighash_sw_v0_single", bench_sighash, SIGHASH_ARG(WALLY_SIGTYPE_SW_V0, WALLY_SIGHASH_SINGLE) },
+    { "sighash_sw_v0_all_acp", bench_sighash, SIGHASH_ARG(WALLY_SIGTYPE_SW_V0, WALLY_SIGHASH_ALL | SIGHASH_ACP) },
+    { "sighash_sw_v0_none_acp", bench_sighash, SIGHASH_ARG(WALLY_SIGTYPE_SW_V0, WALLY_SIGHASH_NONE | SIGHASH_ACP) },
+    { "sighash_sw_v0_single_acp", bench_sighash, SIGHASH_ARG(WALLY_SIGTYPE_SW_V0, WALLY_SIGHASH_SINGLE | SIGHASH_ACP) },
+    { "sighash_sw_v1_default", bench_sighash, SIGHASH_ARG(WALLY_SIGTYPE_SW_V1, WALLY_SIGHASH_DEFAULT) },
+    { "sighash_sw_v1_all", bench_sighash, SIGHASH_ARG(WALLY_SIGTYPE_SW_V1, WALLY_SIGHASH_ALL) },
+    { "sighash_sw_v1_none", bench_sighash, SIGHASH_ARG(WALLY_SIGTYPE_SW_V1, WALLY_SIGHASH_NONE) },
+    { "sighash_sw_v1_single", bench_sighash, SIGHASH_ARG(WALLY_SIGTYPE_SW_V1, WALLY_SIGHASH_SINGLE) },
+    { "sighash_sw_v1_all_acp", bench_sighash, SIGHASH_ARG(WALLY_SIGTYPE_SW_V1, WALLY_SIGHASH_ALL | SIGHASH_ACP) },
+    { "sighash_sw_v1_none_acp", bench_sighash, SIGHASH_ARG(WALLY_SIGTYPE_SW_V1, WALLY_SIGHASH_NONE | SIGHASH_ACP) },
+    { "sighash_sw_v1_single_acp", bench_sighash, SIGHASH_ARG(WALLY_SIGTYPE_SW_V1, WALLY_SIGHASH_SINGLE | SIGHASH_ACP) },
+    { "bip32_from_seed", bench_bip32_from_seed, 0 },
+    { "bip32_derive_private", bench_bip32_derive, BIP32_FLAG_KEY_PRIVATE },
+    { "bip32_derive_private_hardened", bench_bip32_derive, 0x100 | BIP32_FLAG_KEY_PRIVATE },
+    { "bip32_derive_public", bench_bip32_derive, BIP32_FLAG_KEY_PUBLIC },
+    { "bip32_derive_path", bench_bip32_derive_path, BIP32_FLAG_KEY_PRIVATE },
+    { "bip32_derive_path_skip_hash", bench_bip32_derive_path, BIP32_FLAG_KEY_PRIVATE | BIP32_FLAG_SKIP_HASH },
+    { "descriptor_parse", bench_descriptor_parse, 0 },
+    { "descriptor_to_addresses_10", bench_descriptor_addresses, 0 },
+    { "psbt_from_bytes", bench_psbt_from_bytes, 0 },
+    { "psbt_to_bytes", bench_psbt_to_bytes, 0 },
+    { "psbt_clone", bench_psbt_clone, 0 },
+    { "psbt_sign", bench_psbt_sign, 0 },
+    { "psbt_sign_grind_r", bench_psbt_sign, EC_FLAG_GRIND_R },
+    { "psbt_finalize", bench_psbt_finalize, 0 },
+    { "psbt_combine", bench_psbt_combine, 0 },
+#ifdef BUILD_ELEMENTS
+    { "asset_generator", bench_asset_generator, 0 },
+    { "asset_value_commitment", bench_asset_value_commitment, INPUT_SATOSHI },
+    { "asset_rangeproof", bench_asset_rangeproof, INPUT_SATOSHI },
+    { "asset_surjectionproof_3", bench_asset_surjectionproof, 0 },
+    { "asset_unblind", bench_asset_unblind, INPUT_SATOSHI },
+#endif
+};
+
+#define check_ret(r) if ((r) != WALLY_OK) return false
+
+static bool make_tx(struct fixtures *f)
+{
+    unsigned char txhash[WALLY_TXHASH_LEN];
+    size_t i;
+
+    check_ret(wally_tx_init_alloc(2, 0, NUM_INPUTS, 2, &f->tx));
+    for (i = 0; i < NUM_INPUTS; ++i) {
+        memset(txhash, (int)i + 1, sizeof(txhash));
+        check_ret(wally_tx_add_raw_input(f->tx, txhash, sizeof(txhash), (uint32_t)i,
+                                         0xfffffffd, NULL, 0, NULL, 0));
+    }
+    for (i = 0; i < 2; ++i)
+        check_ret(wally_tx_add_raw_output(f->tx, INPUT_SATOSHI * NUM_INPUTS / 2 - 1000,
+                                          f->p2wpkh, sizeof(f->p2wpkh), 0));
+    return true;
+}
+
+static bool make_psbt(struct fixtures *f)
+{
+    unsigned char fingerprint[BIP32_KEY_FINGERPRINT_LEN];
+    struct wally_tx_output utxo;
+    uint32_t i;
+
+    check_ret(bip32_key_get_fingerprint(&f->master, fingerprint, sizeof(fingerprint)));
+    check_ret(wally_psbt_init_alloc(WALLY_PSBT_VERSION_0, 0, 0, 0, 0, &f->psbt));
+    check_ret(wally_psbt_set_global_tx(f->psbt, f->tx));
+    check_ret(wally_tx_output_init(INPUT_SATOSHI, f->p2wpkh,
+                                   sizeof(f->p2wpkh), &utxo));
+    for (i = 0; i < NUM_INPUTS; ++i) {
+        struct wally_psbt_input *input = f->psbt->inputs + i;
+        check_ret(wally_psbt_input_set_witness_utxo(input, &utxo));
+        check_ret(wally_psbt_input_keypath_add(input, f->child.pub_key,
+                                               EC_PUBLIC_KEY_LEN,
+                                               fingerprint, sizeof(fingerprint),
+                                               g_path, NUM_ELEMS(g_path)));
+    }
+    check_ret(wally_psbt_clone_alloc(f->psbt, 0, &f->signed_psbt));
+    check_ret(wally_psbt_sign(f->signed_psbt, f->child.priv_key + 1,
+                              EC_PRIVATE_KEY_LEN, 0));
+    check_ret(wally_psbt_get_length(f->signed_psbt, 0, &f->psbt_bytes_len));
+    if (!(f->psbt_bytes = malloc(f->psbt_bytes_len)))
+        return false;
+    check_ret(wally_psbt_to_bytes(f->signed_psbt, 0, f->psbt_bytes,
+                                  f->psbt_bytes_len, &f->psbt_bytes_len));
+    {
+        /* Finalize and extract the signed transaction for tx benchmarks */
+        struct wally_psbt *finalized;
+        int ret = wally_psbt_clone_alloc(f->signed_psbt, 0, &finalized);
+        if (ret == WALLY_OK)
+            ret = wally_psbt_finalize(finalized, 0);
+        if (ret == WALLY_OK)
+            ret = wally_psbt_extract(finalized, 0, &f->signed_tx);
+        wally_psbt_free(finalized);
+        check_ret(ret);
+    }
+    check_ret(wally_tx_get_length(f->signed_tx, WALLY_TX_FLAG_USE_WITNESS,
+                                  &f->tx_bytes_len));
+    if (!(f->tx_bytes = malloc(f->tx_bytes_len)))
+        return false;
+    check_ret(wally_tx_to_bytes(f->signed_tx, WALLY_TX_FLAG_USE_WITNESS,
+                                f->tx_bytes, f->tx_bytes_len, &f->tx_bytes_len));
+    return true;
+}
+
+#ifdef BUILD_ELEMENTS
+static bool make_elements(struct fixtures *f)
+{
+    size_t i;
+
+    for (i = 0; i < 3; ++i) {
+        memset(f->assets + i * ASSET_TAG_LEN, 0x11 * ((int)i + 1), ASSET_TAG_LEN);
+        memset(f->abfs + i * BLINDING_FACTOR_LEN, 0x21 + (int)i, BLINDING_FACTOR_LEN);
+        check_ret(wally_asset_generator_from_bytes(f->assets + i * ASSET_TAG_LEN, ASSET_TAG_LEN,
+                                                   f->abfs + i * BLINDING_FACTOR_LEN,
+                                                   BLINDING_FACTOR_LEN,
+                                                   f->generators + i * ASSET_GENERATOR_LEN,
+                                                   ASSET_GENERATOR_LEN));
+    }
+    memset(f->vbf, 0x31, sizeof(f->vbf));
+    check_ret(wally_asset_value_commitment(INPUT_SATOSHI, f->vbf, sizeof(f->vbf),
+                                           f->generators, ASSET_GENERATOR_LEN,
+                                           f->commitment, sizeof(f->commitment)));
+    check_ret(wally_asset_rangeproof_with_nonce(INPUT_SATOSHI, f->buff, SHA256_LEN,
+                                                f->assets, ASSET_TAG_LEN,
+                                                f->abfs, BLINDING_FACTOR_LEN,
+                                                f->vbf, sizeof(f->vbf),
+                                                f->commitment, sizeof(f->commitment),
+                                                f->p2pkh, sizeof(f->p2pkh),
+                                                f->generators, ASSET_GENERATOR_LEN,
+                                                1, 0, 52, f->rangeproof,
+                                                sizeof(f->rangeproof),
+                                                &f->rangeproof_len));
+    return f->rangeproof_len <= sizeof(f->rangeproof);
+}
+#endif /* BUILD_ELEMENTS */
+
+static bool make_fixtures(struct fixtures *f)
+{
+    char *xpub, buff[256];
+    size_t i, written;
+
+    for (i = 0; i < BUFF_LEN; ++i)
+        f->buff[i] = (unsigned char)(i * 7 + 3);
+    check_ret(wally_hex_from_bytes(f->buff, BUFF_LEN, &f->hex));
+    check_ret(wally_base64_from_bytes(f->buff, BUFF_LEN, 0, &f->base64));
+
+    check_ret(bip32_key_from_seed(f->buff, BIP32_ENTROPY_LEN_256,
+                                  BIP32_VER_MAIN_PRIVATE, 0, &f->master));
+    check_ret(bip32_key_from_parent_path(&f->master, g_path, NUM_ELEMS(g_path),
+                                         BIP32_FLAG_KEY_PRIVATE, &f->child));
+    check_ret(bip32_key_from_parent_path(&f->master, g_path, NUM_ELEMS(g_path),
+                                         BIP32_FLAG_KEY_PUBLIC, &f->child_pub));
+    check_ret(bip32_key_serialize(&f->master, BIP32_FLAG_KEY_PUBLIC,
+                                  f->serialized, sizeof(f->serialized)));
+    check_ret(wally_base58_from_bytes(f->serialized, sizeof(f->serialized),
+                                      BASE58_FLAG_CHECKSUM, &f->base58));
+
+    check_ret(wally_witness_program_from_bytes(f->child.pub_key, EC_PUBLIC_KEY_LEN,
+                                               WALLY_SCRIPT_HASH160, f->p2wpkh,
+                                               sizeof(f->p2wpkh), &written));
+    check_ret(wally_addr_segwit_from_bytes(f->p2wpkh, sizeof(f->p2wpkh), "bc", 0,
+                                           &f->segwit_addr));
+    check_ret(wally_scriptpubkey_p2pkh_from_bytes(f->child.pub_key, EC_PUBLIC_KEY_LEN,
+                                                  WALLY_SCRIPT_HASH160, f->p2pkh,
+                                                  sizeof(f->p2pkh), &written));
+    check_ret(wally_scriptpubkey_p2tr_from_bytes(f->child.pub_key, EC_PUBLIC_KEY_LEN,
+                                                 0, f->p2tr, sizeof(f->p2tr), &written));
+    check_ret(wally_addr_segwit_from_bytes(f->p2tr, sizeof(f->p2tr), "bc", 0,
+                                           &f->taproot_addr));
+    check_ret(wally_map_init(NUM_INPUTS, NULL, &f->taproot_scripts));
+    for (i = 0; i < NUM_INPUTS; ++i) {
+        f->values[i] = INPUT_SATOSHI;
+        check_ret(wally_map_add_integer(&f->taproot_scripts, (uint32_t)i,
+                                        f->p2tr, sizeof(f->p2tr)));
+    }
+    if (!make_tx(f) || !make_psbt(f))
+        return false;
+
+    check_ret(bip32_key_to_base58(&f->master, BIP32_FLAG_KEY_PUBLIC, &xpub));
+    snprintf(buff, sizeof(buff), "wpkh(%s/0/*)", xpub);
+    wally_free_string(xpub);
+    if (!(f->descriptor_str = strdup(buff)))
+        return false;
+    check_ret(wally_descriptor_parse(f->descriptor_str, NULL,
+                                     WALLY_NETWORK_BITCOIN_MAINNET, 0,
+                                     &f->descriptor));
+#ifdef BUILD_ELEMENTS
+    if (!make_elements(f))
+        return false;
+#endif
+    return true;
+}
+
+static void free_fixtures(struct fixtures *f)
+{
+    wally_free_string(f->hex);
+    wally_free_string(f->base64);
+    wally_free_string(f->base58);
+    wally_free_string(f->segwit_addr);
+    wally_free_string(f->taproot_addr);
+    wally_map_clear(&f->taproot_scripts);
+    wally_tx_free(f->tx);
+    wally_tx_free(f->signed_tx);
+    free(f->tx_bytes);
+    wally_psbt_free(f->psbt);
+    wally_psbt_free(f->signed_psbt);
+    free(f->psbt_bytes);
+    wally_descriptor_free(f->descriptor);
+    free(f->descriptor_str);
+}
+
+/* Time iterations calls, returning false on failure */
+static bool time_runs(const struct benchmark *b, uint64_t iterations, clock_t *elapsed)
+{
+    const clock_t start = clock();
+    uint64_t i;
+
+    for (i = 0; i < iterations; ++i) {
+        if (b->fn(&g_f, b->arg) != WALLY_OK) {
+            fprintf(stderr, "%s failed!\n", b->name);
+            return false;
+        }
+    }
+    *elapsed = clock() - start;
+    return true;
+}
+
+static bool run_benchmark(const struct benchmark *b, clock_t min_clocks)
+{
+    uint64_t iterations = 1;
+    clock_t elapsed, best;
+    size_t run;
+
+    /* Find the iteration count that runs for at least min_clocks */
+    do {
+        if (!time_runs(b, iterations, &elapsed))
+            return false;
+        if (elapsed < min_clocks)
+            iterations *= 2;
+    } while (elapsed < min_clocks);
+
+    best = elapsed;
+    for (run = 1; run < BENCH_RUNS; ++run) {
+        if (!time_runs(b, iterations, &elapsed))
+            return false;
+        if (elapsed < best)
+            best = elapsed;
+    }
+
+    printf("%s,%llu,%llu,%llu\n", b->name, (unsigned long long)iterations,
+           (unsigned long long)((uint64_t)best * 1000000u / CLOCKS_PER_SEC),
+           (unsigned long long)((uint64_t)best * 1000000000u / CLOCKS_PER_SEC / iterations));
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *prefix = argc > 1 ? argv[1] : "";
+    const unsigned long min_msec = argc > 2 ? strtoul(argv[2], NULL, 10) : 100;
+    const clock_t min_clocks = (clock_t)(min_msec * CLOCKS_PER_SEC / 1000);
+    size_t i;
+    bool ok;
+
+    ok = wally_init(0) == WALLY_OK && make_fixtures(&g_f);
+    if (!ok)
+        fprintf(stderr, "failed to create benchmark fixtures!\n");
+    else
+        printf("benchmark,iterations,usec,ns_per_op\n");
+
+    for (i = 0; ok && i < NUM_ELEMS(g_benchmarks); ++i)
+        if (!strncmp(g_benchmarks[i].name, prefix, strlen(prefix)))
+            ok = run_benchmark(g_benchmarks + i, min_clocks ? min_clocks : 1);
+
+    free_fixtures(&g_f);
+    wally_cleanup(0);
+    return ok ? 0 : 1;
+}
@@ -100,8 +100,156 @@ static bool test_coinselection_assets(void)
     }
     return true;
 }
+
+static bool test_coinselection_assets_split(void)
+{
+    const uint32_t subtrees[] = { 1, 2, 3, 5, MAX_TEST_UTXOS, 0xffffffff };
+    size_t i, j, n, written;
+    uint32_t out[WALLY_CS_MAX_ASSETS];
+    int ret;
+
+    /* Each test searches the full space, so the result must be
+     * identical to the serial search however the search is split */
+    for (i = 0; i < NUM_ELEMS(g_asset_tests); ++i) {
+        const struct asset_test *test = g_asset_tests + i;
+        for (j = 0; j < NUM_ELEMS(subtrees); ++j) {
+            ret = wally_coinselect_assets_split(test->values, test->num_values,
+                                                test->target, test->attempts,
+                                                test->io_ratio, subtrees[j],
+                                                out, NUM_ELEMS(out), &written);
+            if (ret != WALLY_OK) {
+                printf("[%s/%u] test failed!\n", test->name, subtrees[j]);
+                return false;
+            }
+            if (written != test->num_expected) {
+                printf("[%s/%u] test unexpected result size!\n",
+                       test->name, subtrees[j]);
+                return false;
+            }
+            for (n = 0; n < test->num_expected; ++n) {
+                if (out[n] != test->expected[n]) {
+                    printf("[%s/%u] test unexpected result %d(%d != %d)!\n",
+                           test->name, subtrees[j], (int)n, out[n],
+                           test->expected[n]);
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
 #endif /* BUILD_ELEMENTS */
 
+/* A P2WPKH input is 68 vbytes: 68 sats at 1 sat/vB, 680 at 10 sat/vB */
+#define P2WPKH_WEIGHT 272
+#define FEE_1 1000
+#define FEE_10 10000
+
+static const struct utxo_test {
+    const char *name;
+    uint64_t values[MAX_TEST_UTXOS];
+    size_t num_values;
+    uint64_t target;
+    uint64_t fee_rate;
+    uint64_t long_term_fee_rate;
+    uint64_t cost_of_change;
+    uint32_t expected[MAX_TEST_UTXOS];
+    size_t num_expected;
+} g_utxo_tests[] = {
+    {
+        "Insufficient",
+        { 1068 }, 1,
+        5000, FEE_1, FEE_1, 0,
+        { 0 }, 0 /* 0 length = no solution found */
+    }, {
+        "Insufficient after fees",
+        { 25068, 25068 }, 2,
+        50001, FEE_1, FEE_1, 1000,
+        { 0 }, 0
+    }, {
+        "Changeless: exact match",
+        { 100068, 50068, 30068 }, 3,
+        80000, FEE_1, FEE_1, 0,
+        { 1, 2 }, 2
+    }, {
+        "Changeless: within cost of change",
+        { 100068, 50068 }, 2,
+        49990, FEE_1, FEE_1, 100,
+        { 1 }, 1
+    }, {
+        "Uneconomical UTXOs are ignored",
+        { 60, 50068 }, 2,
+        50000, FEE_1, FEE_1, 0,
+        { 1 }, 1
+    }, {
+        "Unsorted values",
+        { 30068, 100068, 50068 }, 3,
+        80000, FEE_1, FEE_1, 0,
+        { 2, 0 }, 2 /* Returned in descending effective value order */
+    }, {
+        "High fees prefer fewer inputs",
+        { 25680, 50680, 25680 }, 3,
+        50000, FEE_10, FEE_1, 0,
+        { 1 }, 1
+    }, {
+        "Low fees prefer consolidation",
+        { 25068, 50068, 25068 }, 3,
+        50000, FEE_1, FEE_10, 0,
+        { 0, 2 }, 2
+    }, {
+        "Fallback: smallest larger UTXO",
+        { 1000068, 500068, 1068 }, 3,
+        200000, FEE_1, FEE_1, 1000,
+        { 1 }, 1
+    }, {
+        "Fallback: accumulate smaller UTXOs",
+        { 30068, 30068, 30068, 5068 }, 4,
+        55000, FEE_1, FEE_1, 1000,
+        { 0, 2 }, 2 /* The last of the equal smallest covering UTXOs */
+    }, {
+        "Fallback: complete with the smallest covering UTXO",
+        { 50068, 30068, 12068, 8068 }, 4,
+        61000, FEE_1, FEE_1, 500,
+        { 0, 2 }, 2 /* Rather than 50000 + 30000 */
+    },
+};
+
+static bool test_coinselection_utxos(void)
+{
+    uint32_t weights[MAX_TEST_UTXOS];
+    size_t i, n, written;
+    uint32_t out[WALLY_CS_MAX_INPUTS];
+    int ret;
+
+    for (i = 0; i < MAX_TEST_UTXOS; ++i)
+        weights[i] = P2WPKH_WEIGHT;
+
+    for (i = 0; i < NUM_ELEMS(g_utxo_tests); ++i) {
+        const struct utxo_test *test = g_utxo_tests + i;
+        ret = wally_coinselect(test->values, test->num_values,
+                               weights, test->num_values, test->target,
+                               test->fee_rate, test->long_term_fee_rate,
+                               test->cost_of_change, 100000, 0,
+                               out, NUM_ELEMS(out), &written);
+        if (ret != WALLY_OK) {
+            printf("[%s] test failed!\n", test->name);
+            return false;
+        }
+        if (written != test->num_expected) {
+            printf("[%s] test unexpected result size!\n", test->name);
+            return false;
+        }
+        for (n = 0; n < test->num_expected; ++n) {
+            if (out[n] != test->expected[n]) {
+                printf("[%s] test unexpected result %d(%d != %d)!\n",
+                        test->name, (int)n, out[n], test->expected[n]);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 int main(void)
 {
     bool tests_ok = true;
@@ -110,7 +258,9 @@ int main(void)
 
 #ifdef BUILD_ELEMENTS
     RUN(test_coinselection_assets);
+    RUN(test_coinselection_assets_split);
 #endif
+    RUN(test_coinselection_utxos);
 
     return tests_ok ? 0 : 1;
 }
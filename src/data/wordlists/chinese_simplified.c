@@ -2398,11 +2398,360 @@ static const char *zhs_i[] = {
    };
 #undef zhs
 
+static const int16_t zhs_g[] = {
+    1,1,-1684,0,0,0,-1199,-860,0,1,-1908,0,
+    1,0,0,0,-1467,0,-220,0,0,-559,0,0,
+    0,-1608,-962,0,-1173,6,2,-1740,4,0,3,2,
+    -35,0,0,-131,-615,-557,-998,0,0,0,0,1,
+    0,-70,1,-1499,0,0,0,-31,0,1,0,4,
+    -1352,-1603,-1413,0,1,-583,-1192,0,0,0,1,-1820,
+    0,0,1,0,-338,2,0,-349,-912,0,0,-196,
+    0,-1480,-925,0,1,-1750,0,0,-1649,2,0,-160,
+    1,-1121,-168,-451,0,-154,0,1,1,-1839,1,0,
+    2,-1067,1,0,1,0,-478,0,-153,0,-195,-683,
+    -444,0,0,0,-1408,2,1,0,-1332,-1923,-1288,0,
+    0,0,-863,0,-965,-1174,0,1,-644,-1393,2,-1516,
+    0,1,1,0,1,-1310,0,0,0,1,0,0,
+    1,-1741,-719,-1972,2,0,-1867,-441,-1051,0,0,0,
+    0,1,0,0,0,0,1,-1686,-438,0,-1816,0,
+    0,-640,0,0,-1035,-1327,1,0,1,-927,-785,1,
+    -352,-1829,0,-1657,-1524,1,0,0,1,3,-1733,1,
+    2,1,1,-614,1,0,-1541,1,0,0,1,0,
+    0,-241,-1164,1,-96,-285,1,0,0,-1309,-1815,3,
+    -547,-885,0,-957,-1612,0,0,0,0,1,-240,1,
+    0,1,-738,0,-371,-864,0,0,0,1,1,1,
+    -699,-326,-126,1,0,0,0,0,-191,2,0,-711,
+    -720,0,0,-1007,0,0,4,-1605,-855,0,-1331,-1835,
+    -231,0,1,0,2,1,0,-99,1,-11,-1518,0,
+    1,-831,2,-335,0,1,1,0,2,-1286,1,2,
+    -794,-897,-1973,0,0,1,-1411,4,1,0,0,3,
+    2,3,2,0,3,2,-1669,2,3,2,-1827,-1494,
+    0,-1969,1,-1418,-1732,1,0,0,-1944,0,-943,0,
+    -1710,-1450,0,-1965,-1531,4,-782,-974,-1037,0,-1297,-1656,
+    -463,-396,0,-1781,1,-1511,2,0,1,3,0,-177,
+    1,0,0,-1221,1,-1172,-1760,0,-372,-295,-420,-754,
+    4,-1110,0,2,-432,-1543,3,0,-1650,-1761,-1343,-922,
+    0,0,-1030,0,-1416,0,1,2,-1517,0,-1065,3,
+    -14,-411,0,-1402,0,-603,-991,1,1,-851,0,-847,
+    2,0,-857,-1877,1,0,-176,1,-1277,0,-740,0,
+    5,1,1,1,-1163,1,-1754,-348,-50,0,1,0,
+    -1430,1,0,0,0,0,-390,1,-1496,-700,1,0,
+    1,0,0,0,1,4,0,3,3,1,0,1,
+    -815,4,5,-1806,2,-1663,0,0,0,0,0,-1328,
+    3,0,-1622,0,2,0,0,1,0,-210,3,1,
+    0,-333,1,-1233,0,-1120,0,-1187,-1459,4,0,2,
+    -1573,0,1,4,0,-357,0,0,-1978,-1941,0,0,
+    3,-529,1,2,1,0,5,0,1,-178,-1858,-1724,
+    0,-225,-275,1,-350,0,-1983,-524,-876,1,2,0,
+    0,-1421,1,-763,-1725,1,-1887,-944,2,-1367,1,0,
+    -1375,0,1,0,1,1,-101,5,2,-1903,-1527,0,
+    1,0,0,0,0,0,-270,0,2,0,-509,-1484,
+    -868,0,-849,0,0,-856,-648,0,1,0,1,-162,
+    0,0,-2030,0,0,-1836,2,0,0,1,1,0,
+    -988,-955,1,-334,0,-832,-71,-1778,0,0,1,0,
+    -647,-1963,0,0,-895,1,-1216,0,0,-356,1,-254,
+    -308,-340,4,1,0,6,0,-221,1,1,-2014,-880,
+    0,-315,0,-1072,-915,1,0,0,0,0,1,-137,
+    2,0,2,1,1,2,4,2,1,0,-2004,3,
+    -945,0,0,-646,-248,4,-442,-297,-2007,7,-1084,0,
+    1,-933,3,-456,0,1,2,5,0,-1643,2,0,
+    0,-1427,6,0,-676,-1751,0,0,-517,-1500,1,-1214,
+    0,-1456,2,-405,-1326,-1664,-963,2,2,1,-649,3,
+    4,1,1,3,0,-304,0,-1196,-989,-1932,0,-467,
+    0,8,2,0,-1292,-66,0,0,0,-172,-896,0,
+    -745,-1577,-108,2,2,0,1,-859,0,1,0,-1747,
+    1,-417,0,-713,-1721,0,-1744,0,-24,0,-1024,0,
+    0,-1105,0,-151,0,-257,1,0,6,0,0,1,
+    -2020,-1718,0,1,1,0,0,-1742,0,-393,-130,-1143,
+    0,-1532,0,2,0,0,-948,-1075,0,-1545,-144,0,
+    0,0,0,-323,1,0,-1712,-95,2,-1100,3,1,
+    -1086,0,-656,0,-1547,2,-1128,0,-1616,0,-1130,2,
+    -488,-77,0,0,0,-88,-1443,1,-1662,0,1,6,
+    -237,0,2,-938,-567,0,0,-866,-5,-1907,-1325,-1388,
+    -1866,0,0,0,1,0,0,2,0,-819,1,1,
+    1,2,0,4,-1428,0,2,-1592,0,2,0,-1294,
+    2,-106,-229,-1546,-1358,0,0,5,2,4,1,-1420,
+    -1116,4,1,0,0,1,-1111,-609,-1670,0,3,0,
+    0,2,0,0,1,0,9,-1232,2,0,2,-21,
+    1,-389,3,1,0,-462,2,0,0,0,-1898,-635,
+    0,0,1,0,7,1,0,0,1,-492,0,2,
+    4,0,4,0,-1333,0,-1307,-659,0,-1525,-1966,-1274,
+    -730,0,-606,1,0,0,-1810,1,-729,0,1,-1762,
+    0,0,-1350,2,4,0,0,-141,-1068,1,3,0,
+    -446,0,-565,0,3,-473,-1347,0,2,0,0,6,
+    0,4,-940,0,-443,-1422,-787,5,0,1,5,0,
+    -1016,0,0,-806,0,-1479,1,2,-762,-105,3,-421,
+    1,0,-1679,-1320,-601,-1212,-1256,-45,-1671,0,-1991,0,
+    1,-2042,-660,-228,0,0,0,0,-209,-741,0,-2001,
+    -1559,0,-1340,-1529,1,1,0,-958,-274,-1739,-1589,-1311,
+    3,-314,-495,1,4,2,0,-892,0,0,1,0,
+    1,0,0,0,0,-1607,0,2,3,-1893,-104,-628,
+    -224,-1504,-1218,0,0,0,-1776,-530,1,-72,4,0,
+    -817,0,1,-377,-242,2,0,0,0,2,8,1,
+    0,0,0,4,3,0,-993,-932,0,-1953,0,-1119,
+    0,-2022,0,-1646,0,0,0,0,0,0,-1535,-1756,
+    1,5,0,0,0,-361,2,0,-1957,0,-967,-12,
+    1,0,-2003,-1822,-1050,2,-928,-985,0,-1381,0,2,
+    0,-1149,0,-1534,0,0,0,1,-1431,0,1,2,
+    4,0,4,-1960,3,-997,2,0,1,-545,0,1,
+    0,0,1,0,3,-1675,0,-1855,0,2,0,-1444,
+    -158,0,1,0,3,6,-75,-621,0,7,-1926,0,
+    -508,0,0,-1593,-1373,0,0,-288,-1112,0,2,-1748,
+    -258,1,0,3,0,0,1,1,0,0,-1824,0,
+    0,0,0,0,-923,0,-120,0,-904,0,-1178,-562,
+    1,2,0,0,0,-1857,-1448,5,-1493,0,-226,-637,
+    -605,0,-1250,-416,1,-1182,-1726,-1345,-721,1,0,0,
+    0,2,0,-663,0,4,0,1,0,4,-1070,-1812,
+    -1206,5,3,2,0,-135,2,1,-577,0,0,4,
+    0,0,0,3,0,0,0,1,0,0,0,6,
+    -8,-736,7,-244,0,0,-412,4,0,-400,2,0,
+    -489,-515,0,0,-150,2,-1253,1,-68,11,0,-136,
+    1,0,13,-499,4,-579,0,1,0,9,-3,5,
+    1,1,-812,6,0,-458,0,-76,2,-1728,0,0,
+    -1533,4,0,0,0,1,8,0,0,0,0,0,
+    -325,0,2,-2002,1,-537,-206,-397,0,0,0,4,
+    -1142,0,2,5,0,0,0,-486,4,-1109,-1695,0,
+    0,-310,2,-429,0,0,0,0,0,0,1,-1258,
+    1,2,2,-2,-1391,0,-1368,0,0,-34,-170,0,
+    5,-1404,-1052,1,-1698,0,2,-1974,3,-512,0,6,
+    0,0,-1572,3,0,0,0,3,0,3,2,1,
+    5,-1700,-80,-1080,0,0,-1207,4,-1985,0,2,-79,
+    -1465,1,9,0,-2000,-1865,-1162,0,2,2,-617,0,
+    0,0,0,-749,3,-1020,-81,-1576,-538,0,0,5,
+    0,0,0,0,0,-166,1,-1398,-1057,6,-1185,-2005,
+    2,-134,-850,2,1,-1144,2,2,0,10,0,0,
+    0,-1779,2,0,19,0,-1357,-552,0,0,0,-1225,
+    1,5,0,-1032,-691,0,0,8,0,0,0,-1648,
+    -1437,6,0,0,-1564,0,16,2,0,-654,0,-1278,
+    -755,-594,0,-1860,2,7,-1265,-1115,1,-403,-820,0,
+    -813,-1594,1,-1014,0,0,0,-1651,0,1,0,-1457,
+    -1356,-89,0,1,1,0,2,0,-115,0,-1264,-1244,
+    0,-717,0,-1449,-368,0,5,0,1,-1769,0,0,
+    1,1,-1569,2,0,-1481,0,-192,0,-84,0,1,
+    0,-843,0,0,-1782,-1335,-1354,3,-715,2,-1615,-1248,
+    0,-733,1,0,1,-227,2,-1002,1,0,0,6,
+    -127,5,4,0,1,3,-2045,4,-576,8,-319,-662,
+    -1323,0,0,-17,0,-1631,3,-139,7,6,-353,7,
+    -2016,0,-1038,4,-874,0,-322,0,0,0,0,0,
+    -1445,-1429,1,-661,2,11,0,1,0,-249,0,-4,
+    2,-1934,-839,-311,0,0,0,-1107,0,0,0,0,
+    5,0,0,0,-48,-836,2,0,-341,-1702,3,-1982,
+    3,-1222,-312,-94,3,0,-1693,-1625,0,2,-1666,-1305,
+    1,-1146,0,0,-118,-1912,0,5,0,0,0,6,
+    -1425,0,5,1,0,0,0,4,11,9,0,-1027,
+    -689,2,-1240,-1901,5,0,-1371,-788,0,-1505,-477,7,
+    2,0,-1636,-1869,-216,2,1,-723,-1117,0,-1349,0,
+    0,-217,1,0,-97,-1083,0,-1514,-516,-1635,-187,0,
+    -169,0,-870,0,2,-1073,-475,0,4,-1980,0,0,
+    8,3,-1234,-354,0,-1372,0,-1854,-1945,0,-156,0,
+    0,-1268,2,2,0,-712,-1237,-803,-1101,-873,0,0,
+    0,-250,3,1,0,-1231,0,0,0,-1950,-324,-1468,
+    0,-1378,0,-1937,0,0,2,0,2,-1419,-239,0,
+    0,-1763,-1936,2,2,-501,4,2,0,2,-36,1,
+    0,-1859,-1454,2,0,-1639,10,-2043,-1508,-695,-59,-1279,
+    -1637,2,-1927,0,16,1,0,-146,0,-1801,0,0,
+    1,0,-865,-148,8,0,1,0,-1920,2,8,0,
+    -2046,6,4,0,-1567,1,0,0,0,-1800,0,5,
+    -875,-919,0,-1260,0,0,-316,-259,-1176,0,6,7,
+    -1585,-1247,10,0,-618,5,-1814,0,-142,-1252,0,2,
+    0,7,-1565,5,0,2,0,0,-1975,-1746,1,0,
+    0,-1749,1,-2021,0,6,0,0,-272,0,-426,-1581,
+    0,1,4,1,1,1,-42,-1628,1,-992,-1410,0,
+    13,4,-520,0,0,-1554,1,0,0,-1798,-921,1,
+    1,0,-251,10,1,-1602,0,-1400,0,3,5,-321,
+    -1834,-1735,0,4,-1018,-1918,0,0,-1768,0,0,0,
+    -63,0,0,0,-802,0,17,-436,-408,-465,0,0,
+    -1743,11,-1590,0,3,0,0,-16,2,-1177,-1281,-845,
+    -941,-1213,11,19,0,24,1,-1512,-232,0,-1699,-1243,
+    -1989,4,-1961,-1956,-1799,-1189,0,0,2,1,0,-1904,
+    -560,0,0,2,4,-1090,0,-404,-1970,-1005,0,0,
+    -1017,4,-750,-708,-652,-1041,0,-589,0,0,2,-490,
+    0,0,2,-1280,-1392,9,-1690,0,0,0,-1487,0,
+    -1844,0,0,-364,0,1,-1713,-760,0,-714,0,-1952,
+    0,-345,2,-1033,-44,0,13,0,-1346,0,-1600,-1169,
+    1,0,-704,0,0,-183,0,19,
+};
+static const uint16_t zhs_v[] = {
+    1383,1226,0,820,950,2025,0,1832,1671,0,789,1791,
+    929,1010,785,900,0,0,1460,0,2039,1577,774,0,
+    791,0,804,1808,456,0,0,1945,0,946,589,692,
+    0,282,2036,1620,127,526,479,1363,0,0,945,0,
+    1581,1041,0,705,0,1730,280,1052,0,0,0,0,
+    405,0,1197,1783,0,0,0,0,0,0,1301,0,
+    1890,1136,1140,668,0,0,0,1610,1388,292,693,1018,
+    0,968,1382,806,1555,1522,0,632,1676,563,0,0,
+    1875,1117,0,701,1262,0,277,1871,0,0,0,0,
+    0,1706,1033,1091,0,0,1488,1796,0,1070,1785,1536,
+    0,118,0,391,0,1406,952,0,52,1159,0,1702,
+    723,948,1710,0,0,212,497,0,201,549,0,0,
+    828,1789,524,0,0,666,0,0,467,0,0,0,
+    1967,1105,0,795,0,0,0,1882,1295,0,1150,1061,
+    0,958,1209,0,652,0,1048,0,218,1547,657,1786,
+    1942,2031,1585,1837,591,72,0,449,0,1950,1076,1476,
+    0,1941,1904,1686,109,642,565,1989,0,0,758,39,
+    0,810,580,890,1439,0,0,1303,0,0,427,1201,
+    0,0,1411,382,0,0,1113,599,0,0,486,0,
+    0,612,951,0,1432,366,465,626,0,299,930,512,
+    0,0,0,53,691,1381,708,237,0,0,0,0,
+    1003,0,0,0,1688,0,1764,1690,1658,444,1763,414,
+    0,1271,1378,1045,0,1995,1874,0,0,1096,1818,448,
+    913,1978,0,1514,815,1484,0,562,1744,656,1682,0,
+    0,978,1112,2005,1927,0,0,470,684,1548,545,2043,
+    1481,1286,342,0,1039,0,1827,0,0,242,1098,885,
+    112,377,1929,490,1477,1204,1157,1605,359,633,1335,1307,
+    0,1772,0,1489,0,555,0,0,841,28,622,0,
+    788,0,1364,965,0,424,0,1841,0,1283,1237,0,
+    0,752,1261,1538,0,1094,0,0,1135,1155,0,1520,
+    1095,979,1147,0,1400,0,0,1245,63,0,598,1889,
+    0,1468,1311,1948,0,548,857,1640,235,0,0,151,
+    0,0,1210,0,0,124,697,0,1612,1596,587,1752,
+    210,0,0,1873,2046,0,1340,579,0,26,1565,0,
+    985,1046,982,0,1788,1824,200,0,780,0,796,1097,
+    172,0,115,1997,1164,878,1653,2034,1123,0,0,1131,
+    852,276,763,217,610,1431,1234,0,0,1302,0,386,
+    0,0,669,328,1475,695,430,0,148,635,272,91,
+    0,1769,853,0,0,0,0,1445,0,0,68,663,
+    1810,1086,0,32,1323,747,0,1042,0,316,0,37,
+    1957,0,794,0,1075,681,1321,270,0,0,1005,0,
+    1644,434,777,0,1651,870,1473,0,1158,883,1180,1831,
+    683,0,0,1469,1987,285,1508,1020,0,0,955,0,
+    0,1318,1719,0,0,1369,290,1368,22,1557,1229,1825,
+    0,0,0,12,678,1189,234,0,0,0,1011,0,
+    0,0,882,0,0,0,0,0,0,1185,0,0,
+    1870,2037,1852,0,374,672,553,0,1396,741,1314,0,
+    1570,0,0,1664,0,0,583,0,0,0,1519,1872,
+    206,887,0,1616,0,288,1299,0,1735,0,1680,1501,
+    90,1393,0,0,0,181,0,1270,0,751,0,704,
+    0,1139,330,142,1395,0,0,573,1165,1525,2016,398,
+    193,527,89,743,1375,0,170,1386,1652,0,1329,0,
+    25,1490,0,0,803,0,1152,180,1839,960,1921,139,
+    0,1054,1970,0,0,1433,1333,0,0,0,0,0,
+    0,84,0,572,1801,341,262,106,202,1597,0,121,
+    0,1700,0,0,1497,0,0,0,0,637,1603,0,
+    1721,0,1901,0,0,0,676,1609,1618,832,0,1930,
+    1696,1512,1284,0,0,1594,0,1062,0,281,755,1718,
+    902,0,0,0,983,0,0,198,0,1265,0,1461,
+    0,59,1219,1639,0,1169,0,629,1582,0,1389,417,
+    0,0,0,0,1288,998,0,1679,1225,0,0,1587,
+    1550,0,1359,905,1338,0,1190,0,1081,0,907,1179,
+    0,1030,0,232,554,312,0,1305,1385,0,0,48,
+    385,1737,1268,244,0,1440,0,0,132,0,0,0,
+    0,375,0,1867,0,0,0,1848,97,0,541,776,
+    0,861,2022,1521,1073,2047,1192,518,0,0,350,0,
+    1182,0,1254,1934,0,970,0,1896,530,641,0,680,
+    0,0,908,513,557,503,1337,1804,1877,963,0,1913,
+    2027,0,254,0,1590,1863,27,184,378,0,0,570,
+    0,1881,574,0,1687,1452,268,0,0,866,1673,734,
+    745,1928,110,959,64,1227,0,1586,1985,644,0,496,
+    439,0,305,2012,308,1002,826,263,1435,1862,823,1631,
+    0,0,246,436,1908,1893,0,31,0,1569,827,1771,
+    0,245,1736,1537,0,0,0,1840,1659,0,0,1474,
+    393,1883,0,624,0,0,0,0,1434,0,0,0,
+    0,446,0,1240,0,897,1058,860,1598,571,1360,700,
+    504,1518,267,0,550,1361,775,2018,471,0,451,0,
+    0,1423,757,1758,0,1167,597,1705,888,0,916,383,
+    146,0,54,1716,279,1993,619,0,638,1539,981,1704,
+    0,0,767,1126,1966,0,834,0,1462,0,0,0,
+    919,0,0,892,0,278,1068,21,1535,400,261,1994,
+    0,1491,0,606,1920,0,621,1803,0,0,0,1320,
+    736,925,1121,0,408,1807,468,0,0,0,1408,92,
+    1560,0,0,406,0,1027,0,123,120,0,665,934,
+    368,1425,0,0,0,0,1681,0,994,0,0,0,
+    1128,0,0,0,1405,1891,770,0,1646,1980,233,0,
+    409,881,1038,1196,1573,158,0,0,0,1556,1316,0,
+    0,1043,886,0,1133,1776,0,101,1561,0,836,422,
+    1527,1757,1055,0,993,0,0,1289,0,0,917,540,
+    1244,0,1450,1691,843,525,2030,0,1313,0,1816,413,
+    1156,2040,0,0,1009,0,1160,1666,0,0,2009,909,
+    116,0,0,679,0,1961,397,1146,1149,0,1844,1132,
+    906,365,1060,483,821,1208,649,1899,0,0,0,552,
+    1932,1269,0,0,1101,1008,746,1025,769,1963,1272,40,
+    977,822,1300,0,154,603,0,631,0,0,144,0,
+    0,592,0,1282,0,0,197,1137,0,1975,66,0,
+    1463,601,0,0,60,1849,1792,317,585,1675,1708,0,
+    0,0,0,1672,0,0,595,423,1317,1924,0,1021,
+    0,650,618,1125,1916,0,0,1258,0,0,38,0,
+    1915,0,1551,401,0,0,0,1622,0,1657,2017,1774,
+    0,2011,1214,82,1053,0,0,2026,1379,335,265,1703,
+    1733,0,0,1851,0,304,77,938,560,0,1623,207,
+    910,1895,936,0,0,1365,2028,568,1869,1787,0,0,
+    128,1012,839,0,1092,0,354,17,1509,86,609,0,
+    1992,1170,0,1183,0,0,0,1541,166,0,1567,715,
+    0,779,0,113,0,1044,0,0,1693,0,0,0,
+    0,1465,0,447,1625,0,0,1822,463,0,108,0,
+    327,1454,953,670,0,0,9,1782,0,1626,0,0,
+    293,1784,55,0,0,0,1817,163,1166,1472,361,0,
+    766,0,0,1829,0,0,0,345,0,0,0,0,
+    357,974,0,1376,899,898,0,475,0,0,792,179,
+    61,1250,381,0,297,387,0,0,192,625,0,1063,
+    0,0,111,173,1793,673,0,187,0,928,0,0,
+    0,0,1914,1888,726,1860,160,0,326,0,0,0,
+    1414,0,458,0,840,0,251,1151,1549,0,756,1713,
+    0,1451,829,1617,1633,255,0,260,0,1613,459,0,
+    0,1923,14,0,1845,0,782,0,1437,1983,851,0,
+    702,0,1107,8,1494,1394,0,506,0,0,0,1794,
+    0,211,0,1485,1583,1554,0,1122,1315,221,1728,0,
+    0,685,0,725,1884,0,164,768,533,817,0,2033,
+    1910,0,986,0,1766,935,1502,0,0,798,1487,454,
+    1459,1885,0,379,0,0,0,1200,505,259,1996,1632,
+    0,1312,0,1578,0,0,980,291,727,0,1193,904,
+    492,1174,0,1887,346,871,0,1543,1946,933,0,1898,
+    969,0,178,229,623,664,0,809,0,0,1422,1341,
+    971,0,517,577,358,1937,1077,0,0,0,0,1894,
+    495,1715,183,1637,0,640,42,1619,1416,1654,0,0,
+    1047,364,2024,213,412,1297,0,36,1714,1446,0,2007,
+    0,57,1643,0,1218,1641,199,1373,0,0,0,0,
+    0,0,778,295,0,538,0,989,0,0,484,594,
+    73,0,1506,438,0,1093,1471,2038,0,1954,2008,19,
+    0,535,336,275,1820,0,0,893,1608,0,0,473,
+    569,0,0,0,453,0,0,1779,306,1203,1438,0,
+    0,0,0,615,0,0,1770,596,384,1754,1500,432,
+    1765,298,995,1861,0,687,0,773,0,0,0,0,
+    889,1559,0,0,0,2014,941,0,0,1153,0,611,
+    433,0,0,18,0,1496,510,266,1235,0,1939,1014,
+    1057,742,1579,0,1773,122,0,880,0,0,0,0,
+    1090,1103,0,0,1684,721,674,0,0,1350,607,0,
+    975,0,0,1976,1088,0,1222,797,0,0,0,1667,
+    999,460,800,1404,0,976,0,1065,1343,0,1729,0,
+    1529,46,0,1187,783,0,1595,264,493,1199,1138,0,
+    586,547,1855,0,0,2035,1998,1124,1953,501,1292,1842,
+    394,584,1751,29,667,520,790,81,0,0,0,1879,
+    0,717,480,509,137,1248,1847,0,1144,531,730,0,
+    0,1629,0,56,0,0,0,369,51,0,0,0,
+    0,0,0,654,1398,1947,1080,185,539,567,1880,0,
+    1830,1084,6,0,0,0,1238,949,1470,0,0,1281,
+    813,1986,338,452,0,772,0,750,1846,502,1354,733,
+    1298,0,0,0,1482,0,0,329,824,1991,286,0,
+    0,1202,1154,0,1441,482,131,1102,0,1790,0,0,
+    1695,0,418,0,0,1722,0,833,0,799,0,0,
+    901,738,1328,0,1505,0,343,0,0,0,0,0,
+    0,0,1938,1726,204,50,1958,0,0,0,0,671,
+    696,0,0,876,1216,0,1274,0,1134,331,0,0,
+    1223,1836,0,0,5,0,0,283,628,24,1347,590,
+    0,0,1256,469,0,0,1628,0,0,807,0,1707,
+    0,426,0,0,0,581,0,0,0,0,0,1562,
+    45,677,0,0,912,521,1812,0,1756,1677,1078,967,
+    0,0,1802,390,689,0,1552,0,731,0,1130,319,
+    1918,837,1178,1022,1266,2032,0,808,542,0,1352,0,
+    1574,0,765,156,706,1294,0,0,1909,0,0,0,
+    0,0,543,0,0,1228,102,1457,203,301,532,1806,
+    0,162,0,915,421,373,0,1059,686,1290,877,868,
+    0,499,85,478,196,214,0,764,0,1000,0,0,
+    1660,0,99,1028,2010,0,1024,0,709,1384,1336,771,
+    1358,1253,534,1194,724,847,2023,481,1241,1275,522,1600,
+    1035,760,1402,429,188,300,0,1795,0,1087,289,189,
+    362,0,1850,1007,0,1905,630,0,0,372,0,0,
+    0,222,1912,0,252,1413,0,923,0,1362,845,825,
+    972,1260,302,174,1207,0,1878,380,
+};
+
 static const struct words zhs_words = {
     2048,
     11,
     false,
     (const char *)zhs_,
     0, /* Constant string */
-    zhs_i
+    zhs_i,
+    zhs_g,
+    zhs_v
 };
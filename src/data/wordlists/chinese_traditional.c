@@ -2398,11 +2398,360 @@ static const char *zht_i[] = {
    };
 #undef zht
 
+static const int16_t zht_g[] = {
+    1,2,-1684,0,0,0,1,-1414,-2006,-1794,0,0,
+    -1256,0,0,-425,-1467,0,-220,0,-153,1,0,0,
+    -262,-1608,0,0,-1173,2,-52,0,1,0,-185,1,
+    -1920,0,-1806,-1668,0,1,-94,-350,-1020,0,-615,5,
+    -1028,2,1,1,0,-784,0,-31,0,1,0,1,
+    -1352,0,0,0,4,0,0,-1594,0,0,6,-1820,
+    0,-539,2,-1166,0,8,0,2,-912,0,0,5,
+    -1342,-1480,1,0,-376,-1750,-1735,1,0,3,-1046,0,
+    2,-1121,2,-451,0,1,0,-37,1,0,2,0,
+    4,-1067,2,-1231,0,0,0,0,0,-1880,-195,0,
+    0,0,-863,0,0,1,1,2,-1332,-1923,1,-1429,
+    2,0,-1191,0,-965,-1317,-583,-1819,-644,-1063,1,-1516,
+    0,-1832,1,0,1,-1310,0,-2040,0,-1351,0,0,
+    1,-1741,0,0,1,0,1,0,-1051,0,0,0,
+    1,1,0,-1930,0,0,-1283,-1686,0,0,-1816,0,
+    -2024,-640,0,5,-1035,1,1,0,0,1,-1745,3,
+    0,-166,0,-1657,-1524,5,-130,-891,0,0,-1733,1,
+    2,-1676,-1208,-614,-1167,0,1,1,0,0,4,0,
+    0,-686,-279,1,2,-285,1,-567,0,1,0,1,
+    1,1,-706,-957,-1612,2,0,0,0,1,1,-1415,
+    1,1,-738,0,-371,0,0,0,0,1,1,1,
+    3,-326,3,-155,0,-1698,1,0,3,1,0,0,
+    -720,-1814,0,2,-2028,1,1,2,-855,0,-1331,-1835,
+    0,-464,1,0,1,1,0,0,1,-11,-1037,0,
+    -2041,-831,1,0,0,-728,1,0,0,-1286,-295,0,
+    -1574,-1589,-402,0,0,1,0,3,0,0,-1747,1,
+    1,-1009,1,-1552,3,0,1,1,-1246,5,-1827,1,
+    0,-1969,1,-1418,-1732,2,0,-507,-1944,-1998,0,0,
+    -246,0,3,-1965,-1531,-510,-829,-906,0,-333,-1544,-258,
+    2,-396,0,-1781,1,2,1,-867,-844,2,0,-177,
+    -822,-944,0,-1898,1,0,-1760,0,-372,0,-420,1,
+    1,-1110,0,1,-432,0,2,1,1,3,-1343,-922,
+    -1391,-515,-1030,0,0,0,6,-1883,-1517,0,5,3,
+    -14,-411,-542,0,0,-603,0,1,4,2,0,-847,
+    -1426,0,1,-1877,1,0,-176,2,-1277,0,-740,-940,
+    1,1,5,1,1,1,5,0,-850,-1555,2,0,
+    -1430,2,0,-978,0,0,-390,-56,0,1,3,0,
+    1,0,0,0,2,1,0,3,2,0,0,-823,
+    0,3,5,0,-1656,-1663,0,0,0,-593,0,0,
+    2,-2025,2,0,1,-573,-1661,1,0,0,-188,1,
+    0,0,2,1,0,-667,0,-1187,-1459,-1996,0,1,
+    -1573,0,1,1,0,0,0,0,-1978,0,-803,0,
+    1,0,1,5,-430,0,1,0,-1772,3,-1858,0,
+    0,-225,2,5,-1599,-1297,0,-524,-876,1,-1241,-1673,
+    -1146,0,1,-763,0,1,-1887,0,4,-1367,1,0,
+    0,0,1,0,1,1,-101,1,1,-1903,0,0,
+    1,0,0,0,0,0,-270,0,2,0,0,-1484,
+    -1522,0,-849,0,-827,-856,-648,0,2,-446,1,1,
+    0,-1973,-1027,-1485,-1014,9,-129,-986,1,-909,-1506,0,
+    -988,0,-1074,-334,0,0,-71,-1778,0,-1464,2,0,
+    -647,0,0,0,-895,-1979,-1216,0,0,-356,1,1,
+    0,0,-1383,1,0,0,-689,0,1,9,-1456,-880,
+    0,2,0,0,-2011,2,0,0,0,2,-911,0,
+    -87,-1432,3,1,1,2,1,3,1,-703,1,0,
+    0,5,0,7,1,-498,4,0,0,-636,-1084,0,
+    2,-933,5,-456,0,-1717,-1058,-528,0,0,-253,0,
+    0,0,-1647,0,0,1,0,1,-517,-1314,1,4,
+    0,-1644,2,-405,2,2,-963,-1777,2,1,0,1,
+    1,-1688,-1440,-682,-659,-304,0,-1196,0,-994,0,6,
+    0,1,-157,0,0,-66,0,0,0,-172,1,0,
+    -745,5,-108,-1912,-1894,0,-1359,2,0,2,-1451,0,
+    -1243,-1404,0,0,-1721,0,-1744,0,0,0,-1024,0,
+    0,-1105,0,-151,0,1,1,0,0,0,0,2,
+    -2020,-1718,0,-1048,1,0,0,2,-676,2,-1797,2,
+    0,6,0,2,-302,2,0,0,-1683,1,-144,0,
+    0,1,-675,-323,1,0,-621,0,3,-1100,5,3,
+    -1086,0,-656,0,0,1,0,0,2,0,3,-452,
+    -488,7,0,0,0,-88,1,1,1,-337,5,4,
+    0,0,2,4,-1811,0,0,-1267,-5,-1907,-1325,0,
+    0,0,-1885,1,1,-1532,0,3,0,9,3,-833,
+    0,3,-709,-1579,-1428,0,0,0,0,2,-1174,1,
+    1,0,-1593,-1546,9,-1943,0,1,1,-918,1,0,
+    0,-1964,4,0,0,-971,0,1,0,0,-1011,-1860,
+    0,-785,0,0,1,0,-969,-1232,2,-1013,1,0,
+    1,0,1,1,0,-462,2,-361,-1512,0,0,0,
+    -2038,-338,-1584,0,1,-1680,5,0,2,-492,0,2,
+    2,0,0,0,0,0,-1307,0,0,2,2,0,
+    -730,0,1,7,5,-1320,-1810,-1147,1,0,1,-1762,
+    0,0,1,-1095,1,0,0,1,-1068,-651,-320,0,
+    -363,0,2,3,1,0,-382,-608,-203,2,0,-204,
+    1,1,0,0,3,-1422,-787,-586,0,-1108,3,-219,
+    -1016,-1236,1,-806,-1977,-917,1,-455,1,0,3,4,
+    1,-731,0,0,0,-1212,0,-45,1,0,-38,0,
+    -771,-2042,-660,6,0,0,0,0,-209,-741,0,-2001,
+    -1559,0,-1340,-1529,7,-173,0,3,0,3,-527,1,
+    7,-314,-1285,3,2,5,0,-892,0,0,0,0,
+    -1441,0,0,-485,0,0,0,1,1,-1893,-104,0,
+    -224,0,-1218,0,0,0,-1776,-530,2,-72,1,0,
+    -817,0,-293,-377,-242,-725,-953,-915,0,3,-1580,1,
+    0,0,0,2,1,0,-993,-932,0,2,0,2,
+    -1737,0,4,-1646,0,0,0,0,0,0,0,-1756,
+    -558,2,0,0,-471,-49,-1168,0,0,5,0,2,
+    2,0,-2003,0,-1050,2,3,0,-936,0,0,-752,
+    0,0,-1162,0,0,-1949,-2033,5,-1431,0,0,4,
+    9,-1631,-208,-1960,-1491,-472,1,0,-107,9,1,1,
+    0,0,0,4,3,-1675,-1740,-1822,-574,-1902,0,-1444,
+    1,0,3,0,2,-268,0,0,0,-1862,-1926,0,
+    -508,0,0,0,0,0,0,0,-1112,-1941,-536,-1748,
+    -229,2,0,5,0,0,1,1,0,0,0,0,
+    0,0,-1558,0,-923,0,-120,-46,-904,0,-1178,-562,
+    1,-1399,-340,0,0,0,-1448,-1521,0,2,0,-637,
+    -602,0,0,0,2,-1182,-1726,-1788,1,2,0,-1279,
+    0,3,0,0,0,-1578,0,2,3,-1911,-1070,4,
+    -1206,1,-23,-658,0,-135,-469,8,-577,0,0,9,
+    0,0,0,-1355,0,0,0,0,0,0,-1172,2,
+    -8,-736,-1397,0,0,3,0,2,-1047,0,3,0,
+    0,0,1,-497,-150,-807,2,0,0,1,2,-136,
+    1,-1439,-575,-499,3,-579,0,1,0,-1540,-3,-29,
+    0,6,-812,1,-782,-458,-33,-76,3,-1728,-719,0,
+    0,1,-388,0,0,-454,4,0,-864,0,0,0,
+    0,0,4,-2002,-1678,-537,-206,2,-1592,0,0,-908,
+    -1142,1,-747,-1179,0,0,0,0,-685,-1109,3,0,
+    0,0,4,-429,0,0,-489,0,0,-1180,4,5,
+    1,-1694,-41,-2,0,1,5,0,0,-34,18,0,
+    -2034,-2013,-1052,3,-24,-1479,-460,-1974,1,-509,0,0,
+    0,0,0,2,0,-2032,0,0,0,-1910,4,1,
+    2,-1700,-80,0,0,4,-832,0,-1985,0,13,1,
+    -1465,1,1,0,-1731,-1865,-646,0,1,0,0,0,
+    0,0,2,-749,2,0,-81,-1576,-538,0,-841,3,
+    -1240,0,0,0,0,0,3,2,-1057,1,1,3,
+    10,1,-572,1,12,10,2,-1273,1,-1393,0,0,
+    0,-1779,-1947,0,1,0,0,0,4,-514,0,-1641,
+    6,-848,0,-1032,0,0,0,-307,0,0,0,0,
+    0,7,0,0,6,-1021,-821,6,-825,-1207,-468,2,
+    -755,-594,0,0,1,2,-1265,-1115,2,-403,0,0,
+    2,0,4,-898,0,-1292,0,-1651,0,2,-1583,0,
+    9,-89,0,1,1,0,3,0,-115,0,0,1,
+    0,-717,0,-1449,0,0,-578,0,1,-1769,4,0,
+    0,-1396,-1054,-1469,0,-1666,3,-192,-1790,4,0,23,
+    -297,1,0,0,2,5,-1354,-778,0,2,-1615,-1248,
+    0,-733,-587,0,6,0,-664,-1002,1,0,-1796,2,
+    -127,-1890,-25,-839,1,0,0,1,1,1,-319,-662,
+    -1323,0,-713,-17,0,0,3,0,13,1,-353,4,
+    2,0,-1038,4,-874,-1200,0,0,0,0,0,-617,
+    3,0,1,0,1,-419,0,1,-1710,0,0,-4,
+    1,-249,0,0,2,-1866,0,-1107,0,0,0,0,
+    8,0,0,0,0,0,0,0,-341,0,-339,0,
+    1,8,-312,-1081,2,-50,-1693,-1625,0,-555,0,2,
+    3,0,26,2,9,0,-710,5,-773,1,-210,6,
+    2,0,0,3,-63,-711,0,2,-1158,-1649,0,0,
+    0,-409,0,-1901,6,-1504,-1587,8,-1159,1,0,1,
+    3,0,-1636,1,0,-370,3,-723,-1117,0,7,0,
+    0,2,-30,-1386,0,-1083,0,0,-516,0,-1101,0,
+    -169,-1492,-870,0,1,2,0,0,2,0,0,-1556,
+    -65,-384,0,5,0,-1372,0,0,-1945,-1681,-156,1,
+    0,-1268,8,0,0,10,-1237,0,2,0,-1427,-1793,
+    0,-250,5,1,-546,0,5,-871,0,1,3,5,
+    0,-1378,-187,0,0,0,2,0,-792,-1419,0,0,
+    -1846,1,1,9,2,-501,0,2,0,0,-36,11,
+    0,0,8,2,-2022,-1639,10,4,-1508,-695,-59,0,
+    -1637,-616,-1927,0,-535,-1716,0,-146,0,-1801,-1276,0,
+    3,-2030,-1630,-1879,6,0,-111,0,-1967,7,2,0,
+    6,-1935,3,0,-1567,2,-1201,0,0,0,-607,-167,
+    -875,-919,0,-1260,0,0,1,0,-1176,-654,17,-1784,
+    -1585,0,1,0,1,2,0,-1759,-142,-1252,0,7,
+    0,-553,0,-1900,0,4,0,0,-1975,2,2,0,
+    0,1,9,0,0,-1341,-1041,-914,0,0,8,-1581,
+    0,12,4,4,6,1,-42,-1628,-47,0,-1410,0,
+    1,5,-520,0,0,-1554,4,0,0,0,0,8,
+    2,0,-251,12,-202,8,0,-1400,0,2,2,2,
+    -1834,0,-633,-984,-1018,-1918,-160,0,-1768,0,0,0,
+    0,0,0,0,11,-529,3,0,-408,-465,0,0,
+    9,1,-1590,-2008,-842,0,0,0,3,0,0,-845,
+    -941,10,-1575,5,-1643,5,3,0,-232,0,-1699,0,
+    4,11,-97,1,-1983,0,0,-1164,10,18,0,0,
+    -560,0,0,6,5,-1090,0,0,0,-92,-1635,-331,
+    -1017,9,-750,-1955,-652,0,-1514,0,0,-1056,1,0,
+    0,-1948,2,8,0,16,-1690,0,0,0,15,0,
+    0,0,0,-364,0,1,-1713,-760,0,-714,0,-913,
+    0,4,2,0,-44,0,3,0,0,0,2,6,
+    2,2,12,0,0,1,0,-180,
+};
+static const uint16_t zht_v[] = {
+    1383,1514,662,839,0,2025,1042,0,1937,297,0,1883,
+    0,0,489,320,785,0,0,1470,512,485,1950,1933,
+    0,1365,1757,1781,456,0,1571,1945,627,0,589,595,
+    671,1238,1625,1064,1628,1874,243,683,0,160,1907,858,
+    1095,1838,0,0,0,0,1949,1576,0,0,414,1347,
+    304,0,0,1407,0,1676,0,1256,0,2013,0,425,
+    1890,0,0,819,0,1695,0,399,1388,1054,693,622,
+    0,818,1979,400,0,0,1661,0,575,563,1148,1481,
+    0,1504,1688,196,1825,1748,906,1091,0,0,0,0,
+    1258,253,0,1386,412,548,0,1549,501,0,1785,276,
+    1198,0,796,0,0,1187,1850,637,0,1159,0,1702,
+    0,725,0,0,882,0,0,1632,1700,1962,164,1594,
+    232,0,1532,0,0,0,1452,555,449,714,1657,900,
+    673,0,0,0,0,1024,0,0,1797,1989,1971,1061,
+    1059,285,6,0,652,0,0,0,334,1547,1760,0,
+    111,664,438,1837,591,21,544,0,0,242,771,1476,
+    0,0,348,1686,109,642,565,0,525,1891,570,1321,
+    0,0,1880,0,0,0,315,1303,1346,326,0,458,
+    1872,0,1411,382,299,0,1113,0,0,1394,486,0,
+    0,2008,951,0,0,366,0,678,0,465,140,0,
+    984,0,1153,1007,0,0,1132,2047,1678,0,0,0,
+    1003,0,0,1595,0,0,1336,0,1769,0,1763,1485,
+    433,1271,0,1233,0,0,728,0,0,0,0,0,
+    1465,0,384,466,877,0,0,562,546,359,579,0,
+    0,978,1839,421,1927,0,0,0,1202,1548,0,2043,
+    0,1286,0,965,927,0,0,0,308,867,0,1261,
+    0,377,1663,880,1477,0,1224,0,1540,1524,1335,0,
+    0,0,1509,997,0,0,0,2015,0,835,1136,1287,
+    788,1445,1364,0,0,1536,1671,0,1253,391,0,0,
+    0,717,603,0,604,0,0,1862,57,0,0,1323,
+    112,447,1232,1836,1400,1863,790,0,0,212,0,550,
+    1257,656,1975,782,0,945,0,1786,235,1713,1327,151,
+    0,1140,0,0,0,124,0,0,1723,1596,1885,1345,
+    1332,1359,0,1873,0,502,947,812,0,26,0,1180,
+    0,648,982,0,0,1824,600,1965,210,795,0,1097,
+    0,0,483,494,1164,878,0,2034,307,0,1223,1194,
+    1494,211,0,217,0,0,1234,884,558,0,273,280,
+    1858,1866,669,0,1475,695,430,1002,148,0,610,567,
+    1462,1669,0,477,221,0,1905,1613,0,0,0,0,
+    2003,0,0,955,1128,747,39,385,0,316,270,1651,
+    1684,317,837,0,1075,833,125,1480,0,1969,1005,0,
+    0,1229,0,1290,618,623,2038,0,108,883,95,0,
+    1903,524,0,1469,1961,980,122,1467,178,1896,0,888,
+    569,1318,0,200,511,0,2036,926,0,1916,1735,1189,
+    0,758,1446,0,0,398,234,0,597,1631,0,677,
+    0,1741,1721,1011,1460,0,0,0,0,0,687,0,
+    1958,14,271,1772,354,1436,553,0,0,0,1848,950,
+    1570,0,0,0,1060,1334,0,197,1188,0,0,0,
+    0,937,0,1616,0,288,1299,442,1706,1357,0,1501,
+    0,0,153,1294,634,181,1279,1270,763,1710,0,0,
+    0,753,682,142,0,0,0,1093,1562,531,2016,206,
+    0,0,1035,0,1375,0,1647,990,0,0,1329,0,
+    704,0,0,0,1526,887,1376,347,686,1154,517,139,
+    0,0,779,344,988,0,225,0,0,290,499,1871,
+    185,84,0,871,2046,1832,794,1542,295,388,0,18,
+    755,0,216,1855,1497,0,0,462,0,236,380,0,
+    0,0,1869,1601,1779,1248,0,437,259,893,0,1486,
+    85,1092,0,715,1887,1227,0,1756,0,1071,0,177,
+    0,0,539,1367,1185,264,0,262,814,1265,0,1461,
+    1052,0,1292,1639,0,668,0,629,0,1370,396,0,
+    251,0,0,0,0,0,895,736,478,293,1633,2017,
+    1941,1125,0,0,1338,0,0,0,1828,0,1420,0,
+    1568,0,226,0,1156,312,0,1618,0,0,0,1471,
+    743,247,0,598,0,105,0,0,1160,0,1790,0,
+    240,277,0,0,0,0,0,274,365,1851,1193,0,
+    1990,0,1301,667,98,1004,1192,518,0,314,0,0,
+    1998,1597,1254,0,0,761,1355,275,530,0,0,787,
+    631,0,0,612,289,503,0,1804,1877,588,1090,0,
+    0,0,1690,0,1590,836,27,328,1454,1058,853,1147,
+    672,1881,0,1307,872,1325,0,0,0,0,1673,551,
+    0,0,0,490,644,1745,0,441,1985,1356,1117,1986,
+    0,0,66,1453,0,1498,857,0,1363,0,823,204,
+    0,416,0,436,1908,0,1527,31,1048,1569,827,959,
+    0,0,986,0,765,0,1835,1840,1659,324,1273,0,
+    1201,929,1533,1150,1814,1670,590,1226,1664,1529,0,1280,
+    131,99,1806,0,0,1434,1605,0,25,654,446,700,
+    115,1518,0,56,0,1361,775,1419,291,998,1610,0,
+    960,0,0,1967,0,0,190,1705,0,996,372,0,
+    146,481,54,0,279,1041,619,0,1807,1875,953,605,
+    1137,94,0,1126,0,0,1652,0,1459,0,0,0,
+    1038,0,258,892,0,2035,1068,792,1535,0,1088,0,
+    961,1352,2042,0,1920,608,621,1803,742,1283,0,1492,
+    1374,925,660,0,0,624,556,0,0,0,1408,1799,
+    403,967,0,406,0,0,1333,1615,1220,933,1437,1406,
+    568,1827,0,726,1295,973,0,0,720,1151,0,229,
+    0,0,797,1337,1203,0,542,476,127,1644,233,0,
+    0,881,1489,1196,1770,1847,1751,0,0,1556,2022,83,
+    975,1424,886,356,0,1992,1742,0,411,1868,0,1708,
+    2044,859,0,0,417,254,0,1718,0,0,121,540,
+    0,0,0,0,0,0,2030,1841,0,1921,0,413,
+    0,0,0,0,1935,0,640,701,1162,1701,2009,435,
+    116,0,1308,679,0,0,1970,20,0,0,1522,198,
+    633,803,323,0,0,1139,766,0,689,0,1360,617,
+    2006,1269,944,0,707,0,335,0,0,1599,63,0,
+    0,0,1032,244,272,0,1802,137,901,1604,144,0,
+    1243,1300,0,587,0,2018,0,0,1609,0,1842,0,
+    0,1473,0,0,0,193,97,801,1953,345,0,0,
+    220,0,1402,0,1096,0,0,1155,1170,1197,1072,1021,
+    167,157,0,0,263,1070,1184,73,286,1704,38,942,
+    1844,1372,0,1143,1174,0,0,0,768,1221,130,1765,
+    0,237,1214,82,169,1658,0,1918,1014,1416,265,1703,
+    0,0,427,0,1112,625,77,938,560,1622,810,0,
+    829,1895,19,0,0,1043,2028,133,0,0,1587,180,
+    899,842,1544,1025,1302,0,0,17,547,0,0,807,
+    0,321,0,641,919,1681,0,1541,0,0,1724,1843,
+    1277,0,0,113,1039,1142,1348,282,0,0,0,182,
+    0,0,0,0,440,1028,1707,120,0,0,378,0,
+    327,0,1849,227,0,123,757,1782,0,0,174,767,
+    0,0,346,281,0,0,1495,1315,0,1472,0,0,
+    0,2045,1115,305,924,0,1537,1936,1076,0,0,0,
+    357,974,0,138,0,898,1289,0,331,0,1811,0,
+    61,0,1728,0,1612,0,885,1737,192,368,1393,1063,
+    1956,972,0,173,994,69,789,581,15,928,0,136,
+    0,1129,0,342,1668,1860,0,9,0,118,0,0,
+    800,0,0,963,0,68,0,432,1823,0,756,0,
+    1994,74,0,1939,409,255,0,260,0,971,0,711,
+    1044,1923,0,170,0,0,0,0,2020,0,0,1317,
+    1817,0,0,8,0,638,42,268,117,0,1456,1794,
+    1846,1152,0,189,505,0,0,1122,0,1263,439,0,
+    1991,1249,1079,1762,1380,474,1999,0,533,1752,1103,256,
+    1867,0,1412,0,1766,1121,0,1312,1581,798,361,1208,
+    902,734,0,930,934,0,1297,0,0,1281,1996,0,
+    1894,0,904,1123,1738,1213,1379,215,0,1343,0,0,
+    2004,1955,1135,0,1924,0,0,0,1246,0,1564,1252,
+    969,1493,341,0,0,0,1228,809,703,0,1422,162,
+    2011,1888,0,0,358,0,760,0,599,580,0,1606,
+    596,752,183,1620,0,0,1641,1619,1774,0,397,89,
+    0,364,0,989,813,443,0,0,188,0,1176,1960,
+    0,0,0,1987,1218,564,697,1373,1988,1981,1952,1904,
+    0,0,769,0,1168,0,386,1508,0,1397,0,101,
+    1210,78,1506,0,690,0,1546,861,0,1444,0,698,
+    0,1534,1930,776,1820,0,72,0,0,1405,543,473,
+    422,351,5,1691,1729,1957,0,1225,0,1144,1519,0,
+    0,0,222,1119,0,852,958,1550,723,1791,1369,1510,
+    283,1326,995,850,0,1441,0,0,676,626,448,1931,
+    0,1018,1433,0,0,0,2026,915,1442,804,1585,0,
+    948,1237,0,0,0,1496,510,266,214,1502,721,0,
+    611,780,773,480,1101,298,475,0,0,1033,0,52,
+    936,1714,0,1914,1829,583,1435,856,0,1451,1212,0,
+    0,0,0,0,1653,0,1222,0,1711,0,0,691,
+    999,460,1912,1404,309,976,0,1065,0,1474,0,0,
+    147,1500,0,1626,0,1449,0,1368,0,532,1138,492,
+    0,0,0,1852,0,0,1788,1124,0,860,1310,946,
+    0,584,0,1649,238,1719,1559,81,0,0,1753,1603,
+    1654,373,0,0,1812,1993,0,0,979,1870,1349,1694,
+    0,0,367,90,1320,1750,1030,0,392,1077,699,158,
+    692,0,1311,0,0,0,0,865,0,1764,415,1381,
+    1830,1084,1086,59,520,1391,12,949,0,0,0,0,
+    504,0,649,1853,47,132,1499,750,1169,1854,1074,733,
+    1298,0,0,0,1482,1696,1102,329,0,1098,472,0,
+    1754,0,0,0,1487,482,1081,469,0,195,0,1816,
+    1822,34,1432,1209,845,1722,0,778,0,1525,1387,1288,
+    420,434,1328,0,0,909,343,1561,1932,0,0,0,
+    957,0,1938,1726,60,50,1980,1784,0,0,0,0,
+    1983,0,0,0,1617,0,1274,665,1134,493,394,1415,
+    1808,379,1637,1105,738,0,549,1305,628,741,0,0,
+    774,0,1898,495,696,1608,393,1488,0,1915,350,1389,
+    0,426,609,0,1560,1216,0,1344,0,0,287,0,
+    423,1602,0,0,1250,521,1118,1131,76,889,1078,199,
+    0,1856,0,161,0,1262,991,374,731,452,1130,1110,
+    864,981,0,1022,0,1293,390,67,0,1538,1241,1798,
+    1512,0,1006,594,0,0,0,0,834,680,0,0,
+    1314,444,0,1951,0,0,102,1457,1182,246,0,0,
+    11,302,310,0,0,876,1623,0,1801,1552,799,868,
+    0,1423,104,851,1268,1563,1244,920,0,1000,1517,163,
+    213,1565,0,815,1304,0,1928,230,0,1384,353,896,
+    0,0,1191,479,1913,405,1204,1133,239,966,522,1600,
+    1401,1773,92,1219,0,300,1378,670,0,1087,0,793,
+    0,0,817,0,745,0,630,2014,0,0,1183,954,
+    0,1733,1410,706,1009,1621,1127,923,53,1362,0,825,
+    1149,1260,808,941,1567,764,0,1666,
+};
+
 static const struct words zht_words = {
     2048,
     11,
     false,
     (const char *)zht_,
     0, /* Constant string */
-    zht_i
+    zht_i,
+    zht_g,
+    zht_v
 };
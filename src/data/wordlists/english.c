@@ -2398,11 +2398,360 @@ static const char *en_i[] = {
    };
 #undef en
 
+static const int16_t en_g[] = {
+    0,1,0,-1899,-394,0,0,4,-816,-2048,0,0,
+    0,1,-1259,0,0,-1251,1,0,-1134,0,-1834,-614,
+    -556,0,0,0,0,0,-1972,0,-67,0,-1211,1,
+    0,-1888,0,-923,0,-443,1,1,0,3,1,0,
+    0,0,0,4,1,1,0,0,0,7,2,0,
+    1,0,1,0,-1587,-478,-940,0,-1147,0,1,1,
+    0,0,-112,-250,0,0,0,-1751,-1286,1,0,0,
+    -1851,5,0,2,-1206,-1797,0,-939,0,0,4,0,
+    -331,0,3,1,-261,-881,0,1,1,2,1,1,
+    0,0,-249,0,1,0,0,-1795,0,0,1,0,
+    0,2,-143,0,-215,0,0,-71,0,-1771,0,1,
+    0,1,3,0,1,0,-1659,-853,-2047,1,-796,0,
+    2,0,4,-1547,0,-1432,0,-1525,0,-1264,-876,-594,
+    0,-287,1,-100,-1721,-797,-938,-715,0,1,-1765,0,
+    -156,-1502,0,0,3,1,-985,1,-1299,-1268,-1695,-665,
+    -911,0,2,1,2,2,3,-674,-1612,-27,0,-73,
+    -1988,0,-1220,-177,4,0,0,-1139,1,0,-424,2,
+    0,-1901,2,-1415,0,-248,1,2,3,-388,3,-1253,
+    1,0,-522,1,0,0,1,0,0,0,-431,0,
+    1,0,0,-1952,0,1,1,-2008,0,0,0,2,
+    -1453,3,-1756,1,0,1,0,-844,-758,1,3,0,
+    3,0,0,3,-1927,0,-1807,0,0,1,-688,0,
+    -1565,0,0,-1942,-1214,0,0,0,-1370,-1219,1,0,
+    -1949,-434,0,0,-450,0,0,-1939,1,-1389,0,0,
+    0,10,0,0,0,1,-942,-64,-1566,1,0,0,
+    0,0,-1023,0,-1442,0,0,-1548,-933,2,0,0,
+    -1207,0,1,0,2,0,1,0,-1594,-44,0,-446,
+    -767,-579,1,-76,-1482,0,-846,8,1,0,1,0,
+    1,0,1,0,1,-1685,0,1,0,1,1,1,
+    -1614,1,0,0,-1333,1,-16,3,12,0,-1967,0,
+    1,0,-885,0,-362,0,5,1,3,-2022,-1283,7,
+    0,-1606,0,2,1,1,-37,0,0,0,-345,0,
+    -1304,4,1,-848,-822,-936,0,-1484,0,0,0,0,
+    1,0,0,-1124,0,-503,0,-208,1,1,0,-1511,
+    4,-350,-296,0,-783,4,1,9,0,0,-132,-197,
+    -1054,-1117,0,0,0,-1476,0,-1125,-75,0,0,0,
+    -1934,-1314,0,0,6,0,0,-1699,0,-1897,-1397,0,
+    -896,-1977,2,0,0,-676,-1849,0,0,-1047,-1168,-1202,
+    0,-757,0,0,0,0,0,0,-1957,0,-66,-1144,
+    -1817,0,0,-877,0,-818,-1407,-490,-780,2,-805,-1613,
+    3,0,0,-656,0,2,-1393,2,0,0,0,0,
+    1,0,0,-483,2,-334,-1683,2,-1913,0,0,0,
+    1,1,-1600,2,-1672,0,-1306,1,0,0,-1735,-628,
+    0,2,-1627,0,-1181,-617,0,-941,0,9,-948,-1231,
+    1,-521,0,0,0,0,0,-795,0,-1761,0,-1926,
+    -1976,2,2,0,0,7,-1461,0,-1057,9,-986,-1532,
+    -749,1,0,-1346,0,-974,-1256,3,0,0,-373,0,
+    -469,0,-1506,2,1,2,-926,-1232,-2014,0,-1070,0,
+    0,-136,-820,0,0,0,-995,7,1,0,0,-32,
+    0,0,-52,0,-694,1,-13,-1101,0,0,-1175,0,
+    -294,2,1,-872,-42,1,0,-2033,-420,3,-1458,0,
+    0,-802,0,1,-1250,-1616,3,0,0,5,6,1,
+    -768,0,-227,3,0,2,-1323,0,0,3,-815,3,
+    0,-1828,0,0,2,-1717,0,0,1,-1179,-1530,-251,
+    0,0,2,-1050,0,0,0,-1261,2,0,3,-327,
+    1,1,0,-794,-2026,0,0,-210,0,3,0,-116,
+    0,1,0,-686,-1271,0,0,1,1,-1580,1,0,
+    -329,3,0,1,9,0,0,5,0,-481,-239,0,
+    0,1,0,-1026,1,1,-826,0,-516,0,0,-445,
+    -216,0,-908,0,0,0,-402,-61,-871,-762,2,-1637,
+    0,0,-141,-1686,0,0,0,-1309,-1386,3,0,-1916,
+    0,0,8,0,0,4,0,1,0,0,0,0,
+    -149,1,4,0,1,5,-558,0,0,-140,0,0,
+    5,1,5,0,-1131,3,-1126,-1818,-1885,-2005,0,0,
+    0,-1573,0,-1301,0,8,2,1,0,-1678,0,0,
+    -663,-1223,5,0,0,-937,1,0,1,-1731,-24,-653,
+    -1464,-416,-704,-1427,-212,-1971,-1169,0,0,0,0,0,
+    -1737,0,0,2,-1914,9,0,5,-1159,0,-1463,-1418,
+    -1787,1,0,0,-505,-1933,0,-701,-1520,-22,-720,0,
+    2,-585,-1258,7,0,0,0,-788,0,-1224,-997,0,
+    -858,0,-1412,-1929,-1527,-1227,-1279,-564,1,1,-1352,-852,
+    1,1,1,0,0,0,0,1,0,0,0,5,
+    7,1,0,3,0,0,-370,2,0,-1438,5,-565,
+    0,-2003,0,0,-967,-1105,-776,0,0,-17,0,-502,
+    0,0,1,-860,3,-1991,0,-647,1,0,-408,-945,
+    2,-348,1,-496,-1173,-1434,2,0,-905,5,-451,-413,
+    0,-1188,-883,0,1,0,-1384,-1254,0,-1243,-840,0,
+    8,-1489,-1029,-991,0,0,-525,-1396,0,0,-1919,0,
+    0,4,1,0,0,0,3,0,-398,3,-1212,-1322,
+    3,0,-1911,2,2,-983,4,3,-1073,-2017,-527,3,
+    0,10,0,1,3,-1135,-1024,-1465,-1454,0,1,-721,
+    0,0,3,-1305,0,2,-830,0,0,0,2,0,
+    0,-1270,-1973,1,0,3,0,-358,3,-88,1,0,
+    2,1,0,1,1,-1983,1,0,0,4,1,-915,
+    2,2,1,0,0,-1598,-1981,1,-405,1,0,1,
+    4,0,1,1,-1228,2,-1292,0,0,1,0,0,
+    7,0,0,0,-1162,-590,0,0,0,1,-1667,-2004,
+    -309,0,0,2,10,-1567,0,0,1,3,0,-241,
+    2,3,0,0,1,0,0,1,0,4,0,1,
+    -785,-1064,0,-300,1,2,0,5,0,3,3,0,
+    -307,-1381,-207,1,0,0,0,12,0,1,0,-1728,
+    0,-281,0,-1962,-15,0,7,0,0,-821,-205,-1542,
+    1,0,0,0,0,-1654,3,0,-1065,1,0,1,
+    -82,-1039,-351,-1855,-150,1,1,-1603,0,4,1,-620,
+    2,1,-1801,-1581,2,1,0,-1479,0,4,-1142,0,
+    -173,1,6,0,0,0,8,13,0,0,2,-26,
+    3,-807,7,-928,1,0,11,-512,1,1,-97,0,
+    -1925,0,0,0,0,0,0,1,-575,0,-392,-583,
+    -1563,4,-1375,0,0,0,-1486,2,0,2,4,-550,
+    -702,0,0,0,0,0,-1291,-83,1,0,0,1,
+    -198,0,1,0,2,0,1,0,-700,-1903,0,1,
+    0,0,1,-155,1,0,-710,5,1,0,-987,-1909,
+    -880,0,0,0,0,0,-1666,-1905,0,3,4,0,
+    -323,1,0,0,2,0,0,1,0,2,-1879,0,
+    1,1,-1084,-1174,-1586,0,0,0,-266,0,0,0,
+    -1236,-1650,0,-380,2,0,-93,-1513,-1858,1,0,-1008,
+    -372,2,0,-1744,-1189,0,5,1,5,0,3,-23,
+    0,-268,-1910,0,0,-920,12,-1998,-2038,0,-335,0,
+    -421,0,-1357,0,0,-1402,1,0,-731,0,-1836,3,
+    0,-1331,-1541,-1873,0,-847,6,2,7,0,0,3,
+    0,0,0,0,-1350,-1111,-1141,0,-183,0,11,1,
+    -1673,2,0,1,2,-1092,1,1,0,4,-1061,0,
+    -265,0,0,0,-670,0,0,2,0,3,0,0,
+    0,-79,0,0,5,-759,0,-1113,0,0,0,0,
+    1,-1692,0,-1152,0,-1110,0,-1953,-1241,-111,1,-1121,
+    0,1,4,0,2,-1540,-1997,-1343,3,5,0,-1703,
+    1,1,-1640,-1072,0,0,-2035,-1515,0,0,-456,-845,
+    1,2,-878,0,0,1,0,0,3,0,-1510,-597,
+    3,-879,-1802,0,0,0,-1217,-1497,0,1,-242,0,
+    -1854,-1814,-517,-753,0,0,5,0,0,-1846,-756,0,
+    0,-791,1,-1711,-465,-1546,0,0,1,0,12,0,
+    2,0,-1850,0,0,-866,-901,0,0,2,0,-1471,
+    -454,-1285,4,-1237,-1414,13,2,-1727,0,-507,7,2,
+    0,-160,-1651,3,0,-1624,6,0,0,2,0,0,
+    0,-54,0,-1618,0,-1512,-591,0,-1437,2,-19,-1276,
+    0,-1773,-1289,0,4,0,-47,-1327,2,-984,0,-1753,
+    0,-168,0,-477,4,3,0,1,0,-577,-475,-1657,
+    -1288,-887,-609,11,6,0,1,6,0,-608,-1160,0,
+    0,-326,0,2,0,0,0,-921,4,-291,0,-1623,
+    -1985,6,0,0,-1406,0,-1103,-123,-1041,3,-1521,8,
+    -1844,-1698,-206,-963,-192,-80,-646,-369,0,0,0,-1468,
+    0,-1433,7,15,-603,0,0,0,-1106,2,-1856,0,
+    -510,2,3,0,0,3,0,0,8,0,-1568,-798,
+    10,-1373,-572,-1145,-684,3,-681,5,0,-671,-1172,0,
+    -1239,3,1,0,2,0,19,1,0,0,-306,8,
+    8,-1358,0,0,0,0,-1713,0,1,0,0,-2025,
+    0,22,2,-1963,-1222,-1494,-371,0,-2040,-359,1,4,
+    -1081,1,0,0,-385,3,-1827,0,0,3,0,0,
+    -994,-2043,0,-1733,-1561,4,-870,0,0,2,0,0,
+    -252,1,0,4,0,0,-1234,-176,1,0,-51,0,
+    1,0,2,-779,0,0,0,0,1,-1974,-219,7,
+    -493,-1740,6,0,0,-1199,0,0,0,0,7,2,
+    4,-302,0,0,-1209,-1608,-1825,-1344,-640,0,3,-314,
+    -1584,2,0,1,-1499,0,-1053,0,-1284,3,0,2,
+    1,0,2,0,-1359,-1421,-833,-246,-1119,-1793,13,0,
+    0,7,-639,-1961,-96,-595,4,0,-1760,5,2,1,
+    0,0,2,0,1,0,-1559,0,1,-1436,4,1,
+    1,1,0,8,-1319,0,0,1,6,4,0,-1140,
+    0,2,5,0,-1638,0,3,19,4,0,0,2,
+    -185,0,0,1,0,0,0,-2027,8,1,-1605,0,
+    2,0,-1826,13,0,0,0,0,-1372,3,0,0,
+    0,2,0,4,-342,2,-62,0,3,3,-667,4,
+    -1668,2,0,2,6,1,0,-812,2,0,-433,0,
+    -1975,5,16,5,0,0,0,0,-1847,0,0,-1004,
+    0,3,0,0,-468,29,3,0,-1474,-1796,11,4,
+    -272,1,0,-962,4,2,0,-724,3,-1556,-492,-221,
+    4,0,1,-244,-1025,1,-655,3,3,-90,-1774,3,
+    -677,0,0,2,-1167,0,17,-1123,-269,-837,1,17,
+    0,-894,5,0,1,0,2,2,0,1,0,3,
+    -148,-1535,0,0,0,-393,-43,9,0,-1184,-1368,0,
+    3,0,0,-635,2,-360,4,2,-508,4,-2015,-333,
+    -1225,0,-1688,-341,0,0,1,-1730,-464,0,0,-1794,
+    0,0,-1741,5,10,0,0,5,0,-973,0,11,
+    0,-1691,-1809,-1324,8,-1398,0,0,0,0,-1583,0,
+    0,-336,2,-1747,-1882,0,-1192,-1589,4,12,0,0,
+    28,-308,20,0,-1995,2,-1898,-1158,0,-1006,0,13,
+    1,0,-1403,-774,1,-347,-581,-199,-127,-463,-1248,-1267,
+    0,17,-1979,-1011,0,-1574,5,0,4,-1829,-1205,-1507,
+    0,8,4,-1518,16,0,-1951,-87,-2021,0,4,0,
+    0,13,-616,-256,4,0,0,-996,2,3,-629,0,
+    2,0,0,2,-1715,5,-1564,0,
+};
+static const uint16_t en_v[] = {
+    629,0,0,763,0,105,816,0,375,0,0,565,
+    54,1468,0,737,1768,1643,0,0,0,152,1616,1779,
+    385,637,1081,0,0,1861,0,659,2000,0,544,102,
+    1142,1822,1017,642,0,1256,0,1340,1136,762,746,517,
+    856,120,0,0,0,1114,541,0,743,1699,0,1228,
+    0,789,1700,1121,222,236,192,33,0,1919,1362,860,
+    1316,0,0,0,753,1969,230,1930,1920,0,0,134,
+    0,394,0,201,1002,356,1587,1754,1474,692,0,380,
+    0,1001,490,1784,315,952,1459,417,1888,0,1504,1439,
+    1127,1234,0,0,0,917,2044,485,1434,0,929,0,
+    931,2038,1327,532,224,569,0,1386,575,0,0,1147,
+    0,0,0,908,0,1335,769,80,1254,1086,1047,441,
+    83,740,595,1903,0,1832,0,0,1099,1603,45,0,
+    296,0,0,376,1738,101,0,0,1859,759,0,0,
+    883,1559,37,1035,459,1678,493,969,1067,0,11,528,
+    0,0,0,1706,188,1113,696,1039,0,0,1160,367,
+    838,1423,1309,1584,200,389,981,598,0,924,0,1554,
+    1834,1657,1445,1155,0,1983,915,0,974,0,1425,0,
+    0,1373,0,0,62,24,0,416,1631,0,0,0,
+    0,881,0,0,0,0,1499,1880,1391,0,424,0,
+    1634,0,560,0,1044,0,1156,999,0,800,0,456,
+    728,988,0,0,896,831,0,1341,0,583,425,661,
+    0,1893,0,605,640,0,890,0,1061,0,0,1440,
+    282,106,1296,1277,132,1416,726,0,337,365,285,0,
+    1094,1851,0,1936,1422,0,0,1004,864,1680,0,0,
+    0,1153,0,1384,0,284,56,950,118,1297,527,0,
+    177,0,0,1012,0,1370,403,0,873,1620,0,1268,
+    314,1299,651,1430,0,0,0,1883,624,0,1977,0,
+    0,1831,0,0,0,0,1998,0,547,119,0,610,
+    194,718,724,0,1609,1375,648,0,0,289,0,707,
+    274,34,948,1873,229,311,0,1029,848,0,409,1418,
+    0,1943,0,1601,0,0,1135,0,0,1325,0,849,
+    681,1421,1059,0,0,0,0,1728,0,0,7,0,
+    1363,0,1241,181,0,1088,1376,259,283,573,1733,0,
+    0,67,0,682,1202,1876,1989,0,0,1703,1652,0,
+    0,1066,76,0,252,1307,975,0,863,1683,954,1033,
+    168,887,262,588,121,157,688,505,667,1521,1901,1571,
+    0,964,276,2030,1856,1944,530,0,601,395,1923,1030,
+    741,1346,1847,117,13,1991,69,898,0,768,781,0,
+    960,0,1494,0,0,0,0,989,0,0,912,1126,
+    19,0,0,411,0,1705,48,1718,0,0,599,0,
+    0,1937,1614,0,378,956,0,174,0,690,373,124,
+    0,0,1428,1107,1471,1465,496,0,1906,1679,861,717,
+    1981,0,1749,1098,553,0,679,0,1271,0,1790,537,
+    1662,901,253,0,297,1089,1466,1802,1882,1312,309,1992,
+    160,1713,1394,1798,239,1645,1469,1633,0,0,94,0,
+    487,704,0,336,1407,0,457,1875,777,824,221,0,
+    558,1711,0,772,0,0,1841,0,734,1128,272,949,
+    967,1939,187,1078,2036,0,1108,0,1149,0,0,841,
+    0,1836,862,1400,0,715,1869,1837,1095,0,150,1262,
+    0,143,1447,310,712,0,352,0,686,1946,0,577,
+    195,0,1379,1295,1867,1805,1429,0,27,1399,570,0,
+    440,1410,1556,421,0,1019,0,0,1259,1170,0,382,
+    641,466,287,469,0,0,0,711,1408,674,0,1068,
+    0,257,1955,0,1225,899,0,1045,606,510,668,1820,
+    1744,855,0,539,733,1353,0,874,503,1265,0,0,
+    396,443,991,1034,331,0,1765,0,1664,0,170,1632,
+    183,2045,1775,0,1929,0,1812,1879,1870,0,0,1957,
+    808,0,0,0,0,17,745,1175,1006,0,1442,0,
+    1776,1769,1688,169,1347,1232,1398,0,1594,906,2031,0,
+    0,663,266,1707,0,0,0,0,210,1129,1921,0,
+    263,202,0,1451,1589,0,1742,858,0,0,165,1311,
+    0,0,708,0,1927,0,736,0,1863,512,1965,1194,
+    513,1907,1543,1209,447,133,0,273,1815,0,398,279,
+    1212,235,888,1360,0,0,1424,0,1009,1314,0,362,
+    1591,928,0,0,0,1535,0,1756,1500,203,0,1042,
+    1184,623,770,0,237,0,481,406,785,2029,0,0,
+    1523,1751,1911,1036,0,1695,0,304,0,228,1624,1528,
+    1574,2028,1774,2017,754,1811,0,1111,998,1525,151,1862,
+    1569,0,1013,0,979,1014,452,1619,0,1115,254,0,
+    116,0,0,0,0,0,0,0,1959,0,193,1169,
+    0,0,6,1031,1185,0,1886,635,1065,942,0,100,
+    0,1246,316,921,649,429,242,0,1829,1368,749,0,
+    108,1329,611,0,1635,269,0,672,0,1390,833,0,
+    1654,212,0,835,0,0,0,1885,0,29,1953,0,
+    30,0,400,713,0,0,621,902,0,451,319,0,
+    0,1200,0,1103,0,109,231,0,98,650,439,0,
+    1532,97,657,343,1917,1008,1048,2022,127,1797,0,2027,
+    1522,0,612,0,837,597,0,166,946,523,1916,410,
+    0,1663,0,918,822,0,0,0,556,0,0,600,
+    1568,0,776,853,1942,0,0,0,1954,0,227,0,
+    399,278,494,1150,163,0,1899,0,1301,0,1032,0,
+    1364,0,0,164,0,9,0,138,1,710,1592,0,
+    1629,1766,0,1842,735,1074,1964,40,216,1513,0,1448,
+    302,1763,1725,1292,0,0,0,0,716,1557,0,475,
+    1753,0,0,0,0,543,1914,0,647,360,1026,44,
+    0,0,90,1450,850,0,1940,987,943,0,0,1627,
+    413,1427,834,0,0,0,0,1021,1502,518,0,1722,
+    0,1492,123,1844,0,0,1482,88,180,0,2009,0,
+    0,1193,1638,405,0,0,0,85,1606,0,1935,1454,
+    1791,1387,684,0,1533,933,0,0,1334,0,1491,0,
+    0,992,0,144,0,0,0,1015,1708,0,1458,1058,
+    0,0,1803,2023,697,1244,905,1220,0,1704,0,1348,
+    1600,828,59,35,0,911,1162,1561,1642,0,0,1995,
+    323,1681,0,1804,270,0,1595,318,0,0,0,1889,
+    1229,636,0,0,0,1780,0,0,0,1757,0,479,
+    1668,1461,603,0,585,1778,522,383,618,2006,0,1860,
+    0,1289,128,1771,514,1484,1516,1337,658,1294,93,153,
+    0,1336,288,0,1177,1090,0,225,1542,386,0,113,
+    0,321,1507,1328,0,656,0,0,535,1530,1781,2019,
+    1548,0,338,422,0,0,1894,418,0,292,0,0,
+    0,508,727,0,0,0,1536,0,0,363,0,0,
+    1381,52,885,1495,0,1486,32,894,0,0,1382,0,
+    0,609,317,0,963,0,2015,364,0,232,486,1489,
+    0,1361,0,1272,1455,1119,1762,0,1093,0,742,0,
+    1075,1315,561,0,2012,542,997,534,320,0,1630,0,
+    691,0,217,1011,0,631,189,64,620,660,1248,1415,
+    1306,0,1355,10,1273,0,0,0,185,104,971,643,
+    1814,223,0,0,0,0,0,1097,0,1477,1644,0,
+    0,0,1575,1286,28,0,0,0,0,0,0,0,
+    0,125,437,57,497,0,219,923,478,73,1676,0,
+    538,0,0,1731,567,1767,0,355,926,1715,0,246,
+    0,970,1317,1789,0,472,1967,891,0,303,0,0,
+    1503,0,137,826,1179,2043,0,1544,0,1723,484,1338,
+    0,1968,0,0,0,0,622,0,1890,0,1333,141,
+    0,823,1986,0,1412,568,764,381,1444,760,1670,1261,
+    4,1354,803,0,0,0,1553,2033,0,630,0,0,
+    0,0,0,1748,1868,0,2008,0,702,0,300,976,
+    0,0,0,1810,1037,0,1866,1192,951,471,0,0,
+    783,1741,959,498,0,0,1646,1480,0,488,1016,0,
+    1084,0,0,1655,889,171,428,1625,0,1709,1891,1195,
+    572,0,0,0,5,0,0,0,0,1549,0,366,
+    1057,1476,540,930,1237,2005,0,0,348,1985,1552,1830,
+    807,0,1874,0,146,426,0,1858,454,1947,0,0,
+    529,1239,1186,903,0,840,388,353,0,427,1207,525,
+    0,1101,0,208,0,0,0,586,0,566,298,738,
+    173,1852,0,0,1518,1137,291,0,0,1366,1092,0,
+    842,872,0,0,1823,678,671,0,653,0,913,0,
+    1999,0,1339,1661,614,788,1389,1020,909,58,2041,1274,
+    0,0,2,0,546,1018,1217,1865,1062,470,0,2010,
+    1537,1840,408,1877,867,732,579,0,0,1050,536,0,
+    0,244,1578,0,792,0,1215,0,0,1331,0,0,
+    1350,1724,1117,1745,2011,1310,129,0,0,179,892,1154,
+    0,0,1490,339,809,0,1352,0,0,1692,747,0,
+    0,1674,0,854,483,0,39,1393,0,0,0,55,
+    965,977,1131,0,1164,0,77,0,0,0,20,721,
+    0,1799,0,136,771,312,1839,633,0,0,0,1446,
+    0,0,1809,0,0,0,0,1864,438,354,0,587,
+    112,1993,275,377,1264,1838,958,1648,1782,1152,0,0,
+    1324,1693,1659,744,1196,545,550,0,1148,818,1076,0,
+    0,186,0,0,591,0,626,765,0,158,0,0,
+    1660,1515,2040,0,0,0,329,1551,0,1409,1647,436,
+    694,103,968,750,0,431,1319,465,722,665,1403,1610,
+    2035,791,1344,199,617,1590,0,0,0,0,91,345,
+    0,1787,0,519,581,0,729,1788,0,0,0,1696,
+    0,0,0,281,1717,1251,71,0,916,0,0,1377,
+    0,1359,0,1934,1365,156,0,0,1807,705,0,68,
+    342,533,1079,0,499,0,1581,161,1550,0,1737,1479,
+    0,0,1821,446,706,1621,1190,0,256,0,0,0,
+    1669,0,548,1819,644,0,1214,1538,0,810,0,0,
+    554,1404,1497,0,725,1472,1438,0,0,0,1640,562,
+    434,0,294,802,0,0,324,0,0,1276,0,1747,
+    145,1892,1651,805,0,0,0,2018,448,1577,698,1527,
+    0,551,1673,0,0,0,978,277,786,213,1281,1777,
+    0,0,261,830,1176,0,374,84,0,1949,0,0,
+    934,0,1719,0,957,1922,0,0,592,49,955,162,
+    1302,780,945,1689,1199,1508,1293,1145,500,1963,1181,390,
+    0,1182,731,1280,1931,0,0,327,0,1027,3,1785,
+    1073,0,559,460,0,0,190,2001,0,1905,1096,0,
+    1051,1618,0,0,1132,0,604,0,0,1735,1106,0,
+    114,866,1721,632,0,1055,0,458,1608,1378,1576,0,
+    751,0,1000,0,774,0,0,0,980,0,1783,0,
+    0,1701,1419,798,1085,38,1628,0,435,0,351,130,
+    0,812,0,1641,0,0,552,0,0,1279,0,1449,
+    0,1203,0,0,1043,47,0,1487,1054,0,0,0,
+    0,1087,0,258,0,1163,0,233,1818,1082,799,461,
+    1456,0,897,0,695,1077,1958,827,953,1871,473,0,
+    0,0,677,178,1895,0,1189,0,0,813,8,1570,
+    1988,414,1598,234,1979,1070,0,689,0,1443,1945,107,
+    1041,0,1686,739,1243,0,1320,0,625,1245,868,1596,
+    402,1758,531,0,1761,1675,1165,1197,
+};
+
 static const struct words en_words = {
     2048,
     11,
     true,
     (const char *)en_,
     0, /* Constant string */
-    en_i
+    en_i,
+    en_g,
+    en_v
 };
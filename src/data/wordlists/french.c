@@ -2398,11 +2398,360 @@ static const char *fr_i[] = {
    };
 #undef fr
 
+static const int16_t fr_g[] = {
+    0,0,-2010,-369,-1880,-1574,0,-804,3,-569,1,0,
+    0,-221,0,0,-1779,-1836,0,1,2,0,-838,0,
+    0,0,-1815,0,0,-1615,0,0,2,-1165,0,0,
+    0,3,2,1,0,-235,-1789,1,0,1,-1418,-1842,
+    1,-206,-11,8,-171,-1673,-1055,-527,0,-1048,0,1,
+    1,-455,1,0,-1529,1,0,0,1,0,-1371,-1323,
+    -1746,-411,2,-733,0,-1961,-1938,1,0,1,1,-912,
+    0,1,-443,5,2,0,-88,1,-148,0,-1095,-1684,
+    1,0,0,2,-647,-1290,1,0,0,-1759,1,0,
+    -1034,0,-866,-1992,0,1,0,0,1,1,1,0,
+    1,-1308,0,0,0,-841,-312,-108,0,-1794,2,-1680,
+    0,-525,1,0,-1985,-1439,-1307,0,0,-1562,-1037,1,
+    -2013,0,0,0,0,0,2,3,-1192,2,0,0,
+    2,0,0,1,0,0,-897,0,1,-1513,-27,2,
+    1,0,-693,0,-1,1,-713,-980,-1148,0,4,0,
+    2,0,-1915,0,0,-252,0,2,1,0,-1163,1,
+    0,2,0,0,2,0,1,0,-1188,1,1,0,
+    -246,1,-1030,0,0,0,0,0,-1269,0,1,0,
+    0,1,-1753,3,0,-1978,0,0,0,-730,0,-1431,
+    0,-882,1,-1455,1,-1660,-520,-116,0,3,1,2,
+    0,1,-305,1,-1420,1,0,-1339,2,0,-1366,-1733,
+    2,0,0,0,0,0,-386,0,-371,-1336,0,0,
+    4,0,0,1,0,-36,-417,-952,2,4,-1569,0,
+    0,0,0,0,-1645,2,-614,2,-551,0,1,0,
+    0,1,2,1,-469,0,-338,0,5,0,1,0,
+    0,-470,-1305,0,0,2,3,-1956,-1044,-889,0,0,
+    3,0,-1182,0,-818,0,0,-975,8,-1138,-1595,0,
+    0,2,3,1,1,-1739,-892,-241,-1559,0,-429,0,
+    -7,1,0,-532,0,0,-138,-331,-450,0,-1963,1,
+    -121,-969,-706,-658,2,0,-1135,1,1,-1423,1,-752,
+    -1076,2,3,0,-914,0,0,0,1,0,0,0,
+    -1536,0,-1224,-683,-755,1,-1891,-365,-809,0,1,-953,
+    0,5,3,-707,2,1,2,0,-1951,-1311,2,1,
+    2,2,-1638,-1496,0,0,-748,-1573,-233,0,0,-1507,
+    -849,-1826,-519,4,-43,1,-1937,0,0,2,1,0,
+    1,0,0,0,-293,5,0,1,-1857,-182,-1674,-772,
+    -300,-387,0,-557,-1207,0,2,0,0,-874,-1212,0,
+    3,-427,4,1,0,-844,2,7,-1244,-983,0,3,
+    -1437,2,0,3,-1722,1,0,0,-2015,-1041,-1547,3,
+    0,0,-778,-141,0,0,-798,-1408,-1029,0,-1036,-1468,
+    0,-806,-35,0,0,1,-1790,0,-1594,2,0,0,
+    -1593,0,-107,-131,1,2,2,-1466,3,-558,-834,1,
+    3,2,-488,1,-1228,1,0,1,1,2,1,0,
+    0,0,-940,0,-682,-775,0,-1054,0,0,2,0,
+    0,0,0,0,0,0,0,1,0,3,0,3,
+    -396,2,-1114,2,0,3,0,0,-1565,0,-351,-407,
+    1,-1617,-1384,2,2,-1467,5,0,-203,0,1,0,
+    0,0,0,3,1,2,-1998,1,2,0,2,0,
+    2,0,0,3,0,0,-185,0,1,-281,-9,-1501,
+    -550,-1193,0,0,0,0,-856,-994,0,6,0,-1996,
+    3,-1929,-676,-1532,-1453,2,-663,-181,5,1,0,0,
+    -1369,3,0,1,-1696,1,1,2,0,-1982,3,0,
+    0,1,0,0,2,0,-299,5,-616,2,0,0,
+    -1232,2,0,1,-879,0,2,1,-814,-1302,0,0,
+    -1809,6,0,2,1,0,0,1,0,-720,-1585,3,
+    0,1,0,5,4,-987,-200,4,0,3,1,0,
+    0,10,-1313,3,0,4,1,-578,1,-1993,-491,0,
+    -1147,2,-1852,-1497,0,-1735,-1051,-625,0,-2033,0,-883,
+    0,-162,3,3,0,0,2,-524,0,-1119,-638,-1676,
+    0,0,-1564,0,1,0,-143,0,1,-1321,5,-650,
+    0,2,-55,-985,0,5,-465,0,0,0,-1648,1,
+    0,0,0,0,-1868,0,0,2,0,1,3,-169,
+    0,-1874,0,0,-216,6,1,0,-344,1,-535,0,
+    1,4,0,-1952,-1255,-1203,3,0,-909,1,-1796,-1107,
+    -1000,0,0,1,-1774,0,3,1,-1363,-1447,1,-376,
+    0,-869,0,0,0,-123,1,4,0,-522,0,-1122,
+    -829,0,0,0,0,1,-5,-1531,2,2,0,0,
+    0,-1316,0,1,5,-1465,0,-1800,-1597,-964,-1918,0,
+    -759,0,0,0,2,-244,-1544,-704,0,-1859,-1394,0,
+    -1728,0,-301,0,1,-163,0,0,0,11,0,2,
+    0,0,1,1,1,-890,0,1,-268,1,-947,2,
+    -962,13,0,-159,1,0,0,1,0,-1540,-1599,-924,
+    0,2,0,0,0,0,0,-1450,0,0,0,1,
+    0,0,0,-135,1,0,0,-972,-85,0,0,-1017,
+    -424,-1239,-1215,-1856,-1263,1,2,2,-399,-1734,0,0,
+    0,-802,0,-563,-1367,-533,1,0,-1251,0,-117,3,
+    0,3,-1694,-977,0,2,0,-916,-1705,1,0,7,
+    -1662,-1248,-537,0,0,-113,-1539,2,0,2,0,-1610,
+    -1322,-345,0,0,0,-530,1,2,-462,-1064,0,-626,
+    1,-1740,-787,1,0,0,0,3,3,3,-1588,0,
+    0,0,0,0,0,-1154,0,-1604,2,-1231,0,0,
+    3,0,2,-1038,-555,3,0,1,2,-1428,-315,-442,
+    0,-1186,-444,-144,-1832,-1729,-322,-587,7,1,3,4,
+    1,0,-685,-1379,-2040,0,0,0,1,-291,0,2,
+    -1609,0,-598,1,2,2,0,-197,0,-666,1,0,
+    3,-1427,1,3,3,-821,-1973,0,7,1,-289,0,
+    1,-1817,7,-356,0,0,0,1,0,4,0,-136,
+    0,0,2,-811,-1449,1,0,-1348,0,-1105,-959,0,
+    3,0,-1897,-859,-632,0,-271,0,0,-1072,0,-321,
+    -1108,-1325,1,2,-944,0,0,3,-416,-1824,1,-1788,
+    0,2,-1209,-63,-1864,-164,-744,-770,-539,0,0,13,
+    0,-32,0,-1023,0,1,-314,-1494,2,-130,0,0,
+    0,0,-1310,0,-1407,0,0,0,-1343,-1070,-137,7,
+    -1254,1,1,0,1,3,0,1,0,2,0,-846,
+    -1770,0,0,-1196,2,-1776,-388,-237,0,-410,0,3,
+    0,2,-501,-1903,-115,1,0,0,-2048,1,3,-1725,
+    0,0,1,6,1,2,0,-284,-1551,0,2,0,
+    1,10,0,5,0,0,-1612,-765,0,0,-25,0,
+    11,0,-1697,0,0,-988,0,0,0,1,0,0,
+    0,-1980,0,1,0,-827,-1827,-580,0,1,-868,0,
+    -75,1,-1858,0,0,-1943,1,0,1,0,0,0,
+    5,1,1,0,1,2,-1281,5,-1435,0,-446,-280,
+    -1761,-1442,1,0,2,0,-1721,-139,0,1,4,6,
+    -1941,0,2,3,0,-1849,0,0,3,-1490,-1914,-1383,
+    -750,0,6,0,2,3,1,2,-1197,-1304,0,-1942,
+    1,0,-1867,-618,1,6,-1170,0,-95,2,-2041,-211,
+    0,1,-414,0,0,-1689,-1650,0,1,0,0,0,
+    -724,2,-397,1,0,1,1,0,3,-357,-1871,0,
+    -480,-1542,-54,1,0,-1600,-1758,-840,1,0,-1401,-1670,
+    -1717,0,-1444,0,3,-401,0,0,-594,-602,0,2,
+    0,0,0,-421,-1608,5,-1026,-1014,-564,0,-1222,-205,
+    1,3,-943,0,0,0,8,0,0,-1451,-1166,-1875,
+    2,1,-1016,-1157,-1293,0,-512,0,-1760,-1768,-715,0,
+    -1682,0,-1198,0,2,0,-1351,-1008,-911,0,6,0,
+    0,0,-1264,-577,-298,0,3,-2009,2,-1131,0,-1150,
+    0,-562,-1174,-581,0,-991,-689,0,-786,-553,0,0,
+    0,1,6,2,0,0,0,0,-905,0,0,-1123,
+    -767,-751,0,0,3,-634,-1315,-1219,0,0,-1387,-603,
+    0,2,0,-1140,-601,1,0,1,3,3,0,5,
+    -812,0,1,-1056,-1630,-83,2,-970,0,1,-46,0,
+    0,1,0,1,2,-292,-1156,2,0,1,-323,-716,
+    0,0,-309,13,0,-633,-1981,0,-1464,0,-342,0,
+    -566,-1974,8,0,-1920,-122,1,0,-359,-474,-1935,0,
+    -1328,2,0,-2022,0,-1032,0,0,0,0,-1191,2,
+    -1040,0,-1149,1,-1204,2,-589,-1235,0,0,-1489,-1417,
+    3,0,-1843,0,5,2,1,1,-1895,2,10,0,
+    0,0,5,2,-1847,-1512,1,2,-686,-261,0,0,
+    -441,0,-1873,-266,-1841,0,0,-440,-1575,0,-887,0,
+    0,2,1,-848,0,-2020,-1331,0,2,-836,0,0,
+    0,-1863,0,-872,-1432,0,-773,-1669,-1109,1,0,-1667,
+    1,-779,-1280,2,0,2,0,2,3,0,0,2,
+    0,0,0,-1462,-1458,-272,1,0,0,0,3,0,
+    -574,0,-405,0,4,-72,2,-1346,-1069,1,9,0,
+    0,0,0,0,-1931,2,3,1,0,-797,0,0,
+    0,1,6,0,6,0,0,0,0,0,0,0,
+    0,0,0,0,-607,0,0,-1671,2,-1653,0,3,
+    0,4,0,0,4,1,-18,0,7,0,1,-1376,
+    0,0,0,10,0,0,0,-91,-125,-1947,-1352,0,
+    1,0,1,-90,-696,3,-1755,-851,-1771,-2008,-1883,0,
+    0,-192,-631,1,0,1,0,9,3,0,0,0,
+    9,-903,-722,1,0,-1027,-1392,2,1,-184,-278,0,
+    -372,0,1,0,-310,-255,-276,-1853,4,0,4,0,
+    -1275,13,0,0,-1592,1,0,-1719,0,0,1,0,
+    0,0,-433,0,5,0,-1282,-290,-1579,0,4,0,
+    -536,0,5,0,-366,-1902,7,0,1,-1233,8,8,
+    9,3,-1633,-2021,-214,-1063,0,2,0,-1042,0,-239,
+    -1744,0,2,0,-437,-308,0,3,4,-73,-1499,0,
+    0,-1057,0,-1386,0,0,-1602,-608,0,-457,1,3,
+    1,0,0,0,-1399,12,0,-70,-428,0,0,-240,
+    -2018,-210,1,0,-1284,-1522,-1436,0,4,1,5,0,
+    -202,0,2,-1527,9,0,19,0,0,0,0,1,
+    0,0,16,6,-147,-1907,-89,-1296,0,3,-891,0,
+    0,1,-695,0,-132,0,38,0,-118,0,-17,0,
+    0,0,0,-1723,5,-1819,-475,-93,0,6,2,0,
+    0,-352,14,-1732,5,0,-489,-826,0,14,0,0,
+    2,3,0,4,0,-816,-349,-120,0,23,0,0,
+    -1525,-302,-1463,0,0,0,15,-831,0,-743,-273,-2043,
+    -476,0,0,12,0,0,5,-422,-1265,6,0,-1917,
+    3,-596,6,0,1,-2039,0,-703,-540,0,0,1,
+    -961,0,-931,-992,3,-1185,0,1,-1846,-1807,-1724,2,
+    0,-503,-1118,0,-523,-1816,2,0,-146,0,-1944,18,
+    -850,-1777,-835,-1840,0,-190,0,-861,-1327,0,3,0,
+    6,0,1,7,0,-106,0,0,3,-482,0,0,
+    -1261,-1797,0,1,0,-196,0,0,0,1,0,6,
+    0,-1500,0,0,-669,10,-175,0,0,20,0,1,
+    22,3,-515,0,-1748,0,-1334,-1286,3,0,9,0,
+    0,0,0,1,1,2,3,-783,1,6,3,9,
+    0,0,-2030,0,-94,0,-389,-1060,2,5,1,0,
+    6,6,-1820,0,-639,3,0,-1266,-612,11,0,-1906,
+    4,-1556,0,0,-982,-367,0,0,-165,-679,0,11,
+    -2004,-1892,-487,-1798,2,0,0,0,
+};
+static const uint16_t fr_v[] = {
+    0,1067,570,1766,1248,1635,0,1474,1073,1328,0,0,
+    992,266,1619,222,225,61,1750,0,1640,0,1702,1179,
+    544,879,626,0,926,0,0,0,718,0,525,1932,
+    1235,0,0,0,433,0,0,1151,1774,1974,33,0,
+    0,0,1048,0,1886,985,0,0,0,1705,1099,1939,
+    0,0,0,91,1103,0,1765,1088,126,0,393,1421,
+    1246,787,760,0,0,0,1676,0,973,447,1889,0,
+    0,773,720,68,691,0,0,296,489,312,857,831,
+    1708,1042,19,862,466,38,0,0,405,27,1271,0,
+    212,935,0,1459,480,63,1011,78,1293,781,725,414,
+    1394,0,1060,190,664,1953,2016,1323,1961,1684,28,1369,
+    934,1516,1877,1494,0,0,1141,0,287,0,1667,1893,
+    1726,0,59,0,1057,0,1915,2004,0,1626,0,1259,
+    700,1567,0,0,512,0,1170,286,0,1487,452,1074,
+    1968,0,673,1837,1180,1844,0,0,0,104,259,590,
+    0,0,0,0,0,1925,916,0,437,596,1161,0,
+    1076,1536,1046,0,0,698,0,0,319,0,0,0,
+    418,1371,1920,0,85,1133,0,253,0,816,9,178,
+    0,0,0,0,0,0,0,0,0,0,1275,0,
+    733,1318,0,484,0,1898,0,0,0,1413,2045,1110,
+    1319,861,0,0,1405,1477,1926,1020,1878,689,0,1478,
+    0,317,1160,1565,0,998,530,0,0,0,1871,819,
+    621,376,0,0,0,1010,1096,0,0,710,1390,0,
+    250,0,1080,0,814,0,0,659,0,380,1967,1167,
+    1451,0,0,70,920,0,0,0,0,235,47,0,
+    1763,642,0,0,382,1537,0,0,504,1034,0,159,
+    852,1958,471,0,959,0,0,0,989,667,0,515,
+    1178,0,0,1081,1194,701,1895,0,1095,931,1911,0,
+    0,0,510,372,938,1642,0,0,0,2013,424,0,
+    798,476,818,0,1024,20,709,636,1236,0,589,2023,
+    1697,1460,1798,1415,1639,0,1933,165,1686,0,282,0,
+    1486,478,0,1341,0,0,0,18,1112,65,0,0,
+    940,1582,941,228,295,1424,0,263,0,1044,641,0,
+    258,527,1820,1869,1305,0,2035,699,0,0,0,1092,
+    127,0,799,207,11,1045,0,0,1188,0,0,2037,
+    885,0,1070,1244,0,1655,1828,381,0,1949,1585,0,
+    1252,829,1975,0,0,303,744,182,249,802,1090,1354,
+    1482,0,1706,629,1821,581,399,770,1817,1570,1971,546,
+    1964,690,293,0,0,0,0,0,804,342,507,1627,
+    1719,587,0,1116,851,1225,1751,2000,0,687,716,1504,
+    0,0,0,2041,0,1560,0,0,1938,0,0,0,
+    1410,276,340,1251,0,157,821,1613,1618,1859,0,0,
+    1503,1885,237,323,0,0,824,1566,0,0,1331,0,
+    0,335,1313,658,0,1023,0,1698,21,324,2033,1089,
+    1685,1501,0,0,1114,1978,800,707,0,403,0,0,
+    0,1638,66,0,1908,0,1736,520,1490,0,1429,1922,
+    1483,1519,305,0,492,141,0,1491,1222,3,0,0,
+    1,0,0,0,1699,0,1367,46,0,1581,875,1994,
+    1755,1086,1853,0,2015,1403,0,1899,0,0,977,402,
+    0,1929,83,0,172,2036,980,680,1761,1142,869,686,
+    2018,0,419,1098,1418,1884,1172,1811,316,185,741,0,
+    435,1109,0,670,455,179,0,273,1027,1576,944,0,
+    0,792,485,0,1220,1189,1662,0,0,1969,56,1325,
+    0,1009,650,1687,0,737,96,0,0,0,0,1880,
+    1373,1812,763,0,0,0,864,0,0,0,937,0,
+    0,0,103,0,0,1907,0,1987,160,0,0,1492,
+    1479,498,0,779,36,0,854,0,0,1569,0,0,
+    1515,0,1509,345,1004,1631,446,0,0,0,0,1709,
+    0,697,0,1749,274,0,693,0,918,1768,1166,0,
+    1737,0,0,1710,0,412,392,0,995,1813,0,603,
+    422,1996,460,224,634,0,0,0,0,0,394,255,
+    1484,0,560,264,0,0,1115,0,192,2011,1986,516,
+    1433,0,887,1469,1266,1317,0,0,23,203,332,1615,
+    0,1785,0,1597,1209,1910,1249,0,0,0,0,584,
+    0,0,0,0,0,0,1782,0,0,0,0,1802,
+    0,0,0,0,99,0,0,0,1674,262,0,836,
+    0,752,1656,1575,0,547,640,0,0,434,0,623,
+    1786,1753,0,0,0,1359,1101,610,0,0,22,1864,
+    0,1868,0,0,0,651,0,1284,328,0,302,0,
+    0,0,1562,0,1425,0,0,0,0,722,1294,1927,
+    1038,503,0,0,0,0,50,227,0,639,0,0,
+    788,1725,0,0,37,0,169,1298,0,1794,0,429,
+    1650,1387,728,1102,543,1228,0,0,1651,1548,583,0,
+    1988,1998,0,564,0,569,310,1273,0,285,1412,0,
+    1832,76,0,1432,0,704,1144,0,970,246,334,1518,
+    513,0,0,893,0,0,1210,1807,1138,599,0,1182,
+    0,0,0,1193,1470,391,542,755,679,0,1087,0,
+    844,517,491,29,0,1744,0,1583,735,1534,0,208,
+    325,1485,1514,1544,2030,2,1746,496,1329,1633,1954,0,
+    0,14,326,1715,0,1120,1577,152,859,1349,768,1239,
+    1957,1714,2044,214,838,1547,0,717,909,0,1520,1414,
+    545,1217,1707,0,1701,1833,533,0,780,0,0,361,
+    0,0,1353,0,0,0,477,0,1361,1332,218,0,
+    1589,0,390,0,1245,1334,1003,914,713,643,1376,0,
+    1343,759,0,505,0,1423,0,1358,932,1523,244,897,
+    0,0,467,206,1897,0,448,0,1017,153,933,1909,
+    1021,0,0,1475,1389,571,2010,144,401,0,1052,0,
+    0,0,1553,1456,1082,776,1692,2005,156,0,1729,1944,
+    438,1124,0,7,0,0,1554,0,0,953,0,1713,
+    0,537,0,0,0,1645,917,842,0,377,1372,972,
+    197,954,0,928,0,1513,0,0,1445,0,1344,0,
+    1336,0,1000,605,827,128,1384,1918,895,0,0,1401,
+    0,1396,0,1207,528,0,257,1447,217,465,1183,1779,
+    1242,1404,0,767,30,1963,0,1356,0,211,0,0,
+    0,0,0,0,0,1159,983,0,0,988,994,0,
+    1612,77,81,1240,346,0,0,1780,0,0,0,1237,
+    1805,0,809,567,740,1810,1157,925,1453,0,458,0,
+    0,1507,1892,0,1970,1983,1703,648,1126,604,2006,1072,
+    0,483,996,149,582,0,0,0,0,86,0,0,
+    1308,167,1136,2027,0,1580,0,338,501,1881,1002,1921,
+    1360,997,0,0,1395,52,551,0,40,0,1551,1822,
+    0,0,1590,1717,0,672,1966,333,1952,0,57,0,
+    0,0,876,0,444,1771,0,1605,470,1664,306,0,
+    1990,775,508,1935,0,110,1623,745,1261,0,0,1471,
+    1502,0,1533,506,0,0,0,2022,1129,379,0,964,
+    0,0,1428,1532,553,1854,229,154,0,0,363,1355,
+    1061,0,1549,453,905,922,0,0,1559,0,0,0,
+    44,1001,0,0,499,0,877,0,1084,0,219,0,
+    1602,0,0,555,0,339,0,1352,1066,133,1340,0,
+    1058,1735,793,1297,1286,956,357,0,1154,1510,647,628,
+    1272,746,566,0,1982,1200,957,1522,1976,0,1740,627,
+    1792,572,0,51,0,1860,1176,0,2046,0,373,1876,
+    0,1689,1288,150,0,384,284,0,0,0,0,0,
+    73,79,1473,671,1145,0,2001,0,39,812,901,0,
+    1140,1444,1049,1545,0,1989,1097,125,1079,1078,898,231,
+    1643,0,0,0,0,0,1665,13,0,1628,1152,261,
+    1316,0,0,1100,0,352,0,0,0,0,1163,0,
+    853,1481,1399,609,0,0,0,0,0,0,1677,652,
+    683,0,0,823,1762,0,962,0,0,198,0,1861,
+    0,1216,2043,912,494,1579,0,75,0,0,0,765,
+    756,0,591,97,1658,0,1517,1215,241,0,0,856,
+    0,1671,924,708,0,359,1476,329,0,726,1945,0,
+    1135,0,1255,1790,0,1409,0,0,0,863,95,294,
+    1065,1296,1843,0,0,1875,109,0,0,1956,1439,734,
+    1241,906,1008,0,0,921,451,1311,1829,1542,1123,594,
+    175,1947,1646,0,618,1764,0,880,1682,0,0,945,
+    0,0,870,1617,1959,784,0,111,907,278,315,1690,
+    0,0,0,1620,0,0,1085,1468,256,0,0,171,
+    0,64,1018,0,1219,966,0,0,1012,1408,955,0,
+    0,585,417,1999,548,233,0,1801,1748,0,753,1267,
+    176,0,0,113,661,0,0,1357,216,762,1883,1224,
+    118,0,362,0,978,0,1077,949,1198,0,1624,616,
+    1595,0,1680,1830,1694,1865,0,0,1258,0,655,736,
+    318,0,0,0,0,1903,0,1527,1337,0,1691,0,
+    0,0,0,1257,0,0,0,0,0,967,247,0,
+    936,1660,0,645,230,0,0,0,0,450,1127,0,
+    894,0,0,1540,187,0,1948,1282,2002,1648,43,608,
+    0,884,12,48,1730,0,0,0,0,635,186,2024,
+    1064,1256,248,155,49,0,336,0,950,1276,0,0,
+    1552,55,108,1411,1158,0,0,1442,200,0,738,1634,
+    822,1420,0,0,0,0,757,1437,0,656,806,0,
+    1111,730,1497,677,1588,1091,0,0,1150,1379,1777,1213,
+    1824,892,0,1348,1472,1300,1985,0,100,1931,0,0,
+    578,0,411,541,1177,0,0,0,1006,389,123,619,
+    1525,1621,194,1175,0,0,0,0,1923,0,574,459,
+    0,0,0,1784,0,268,1887,654,0,0,1849,0,
+    0,281,0,463,0,383,1270,1772,0,1277,1657,0,
+    0,462,0,0,223,899,761,0,331,883,0,1204,
+    1455,832,0,1636,1299,1557,790,1119,269,353,369,5,
+    0,1212,1508,0,0,622,0,1388,1630,0,0,666,
+    1742,0,1781,0,1586,1791,0,1397,349,1132,1346,221,
+    457,1205,669,1827,226,0,0,929,0,727,1005,841,
+    0,975,15,0,1641,354,151,0,1030,397,367,1381,
+    872,1083,98,0,32,0,711,731,1993,1625,67,60,
+    1402,0,0,493,1888,80,0,2025,1125,0,102,101,
+    0,1201,0,592,540,0,1168,0,1287,430,58,1380,
+    0,0,374,0,1186,1093,612,1700,846,614,676,1803,
+    724,0,1229,0,0,696,0,347,1458,0,1741,1143,
+    1171,173,903,0,0,0,431,0,1377,148,1128,0,
+    1278,783,1440,1600,0,1105,1392,660,0,25,927,0,
+    1014,0,1174,1199,748,1783,1838,1051,360,1363,497,598,
+    1364,874,1653,0,0,0,0,0,0,0,1712,1233,
+    0,948,193,0,1604,378,1847,0,674,807,1622,0,
+    1556,0,1226,0,0,41,1804,558,425,509,0,2034,
+    408,1269,866,1302,0,2028,0,0,1606,188,0,559,
+    791,965,1850,919,1924,495,620,2031,1900,789,407,177,
+    653,0,0,0,663,0,1131,1571,1610,132,139,166,
+    1756,794,252,947,1834,0,739,0,327,1032,644,0,
+    1654,472,0,242,1291,1505,1374,2026,0,1965,1290,482,
+    1339,1663,1836,0,1019,1800,1529,575,0,795,1809,1912,
+    0,1480,900,0,1711,0,1904,1678,
+};
+
 static const struct words fr_words = {
     2048,
     11,
     false,
     (const char *)fr_,
     0, /* Constant string */
-    fr_i
+    fr_i,
+    fr_g,
+    fr_v
 };
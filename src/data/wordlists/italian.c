@@ -2398,11 +2398,360 @@ static const char *it_i[] = {
    };
 #undef it
 
+static const int16_t it_g[] = {
+    -1019,1,-1851,0,1,0,1,2,-1087,0,5,1,
+    0,0,0,-2044,1,0,-1996,0,1,-1362,-1902,-1112,
+    1,-1152,0,-1526,0,0,2,-617,0,0,0,1,
+    1,0,0,-1970,0,-1515,-1715,3,0,1,1,1,
+    0,1,0,1,0,-824,-137,1,2,-270,2,-116,
+    1,-1743,0,-557,1,2,3,0,0,-400,0,-1486,
+    1,-746,-458,-1500,0,-1595,2,0,0,0,-1771,-48,
+    -187,0,-1108,-1228,0,0,-1895,1,0,-1557,-1034,0,
+    -628,0,0,2,0,-1938,1,-814,-1272,-10,0,-1079,
+    -1701,0,-34,1,-1610,1,-290,3,0,-770,1,-1275,
+    -655,-661,-1088,0,1,-1424,2,-712,-1729,1,-337,-14,
+    0,-1249,0,-1971,-409,0,3,0,1,-794,-26,0,
+    -807,0,1,-586,-1453,-246,0,1,-562,-1028,-418,0,
+    1,3,0,1,0,0,0,2,3,-725,0,1,
+    0,0,-716,1,1,-1422,-915,0,1,-480,-774,1,
+    -1261,-1593,-1263,-1425,-1644,-894,2,1,2,0,-800,1,
+    2,0,1,2,-15,-622,-1524,0,-687,6,1,-982,
+    1,0,0,4,0,-1322,1,0,1,-1530,0,0,
+    -1143,-369,0,0,0,0,2,1,0,-592,0,-639,
+    0,-1835,-336,0,0,-1194,0,-504,0,0,-1769,0,
+    2,-101,1,-1878,0,0,-515,-1352,2,2,0,1,
+    1,0,1,0,-307,-1283,0,-1544,0,0,0,1,
+    1,0,1,-319,2,-1458,-1725,0,-702,-902,-1411,1,
+    0,0,-209,7,-89,-124,0,0,0,-934,-1056,-962,
+    0,1,0,1,-1017,1,1,-1707,0,-688,-437,2,
+    -1670,1,0,0,0,0,1,0,-425,0,0,1,
+    -1756,0,0,-836,-298,0,-787,0,-1106,0,-927,5,
+    1,-693,-450,-694,0,1,0,3,-1508,0,3,0,
+    0,-1575,0,-1122,-449,-1252,1,-1220,-1184,-1061,0,0,
+    -1713,-1348,-905,-1117,1,0,-793,0,-1188,0,-1958,-1667,
+    1,-121,-844,0,-857,0,0,-390,0,-1349,0,-1573,
+    0,1,0,3,-57,0,0,2,2,-1899,7,-1299,
+    -1341,-656,2,-268,0,1,-2007,0,0,0,1,-627,
+    -985,1,-1587,0,0,0,1,-12,0,-1521,0,0,
+    0,0,1,1,0,-397,0,-1177,-541,-1293,0,0,
+    -791,-1342,0,0,-1856,-889,0,0,-572,1,4,0,
+    -199,-1113,0,1,0,0,-507,0,-1894,-1011,0,-1479,
+    4,-864,-178,-682,-1755,0,1,0,2,1,-357,-719,
+    -1100,-1561,-862,-457,0,3,1,-1652,-1240,-459,0,-1690,
+    0,0,0,1,1,-1979,-338,-1887,-1579,3,0,-1555,
+    -1711,-1772,0,0,1,0,0,4,-1611,0,-900,5,
+    -1614,2,0,0,-153,-1090,-1496,0,0,0,-1931,6,
+    -1353,1,-334,3,0,0,-58,0,-838,0,-1740,0,
+    -1111,1,-1071,0,0,-632,0,1,0,-149,-1840,0,
+    -1800,0,1,-1946,0,0,0,2,1,0,1,-264,
+    -1029,0,-1358,0,-1978,-1969,-1855,0,1,7,1,0,
+    -426,0,-1371,0,-1734,-29,-2039,-620,0,0,-1320,2,
+    1,0,1,1,2,-1543,0,2,-1828,-776,1,0,
+    -5,-960,0,3,0,-1460,-363,2,1,1,0,-873,
+    -296,0,0,2,-666,0,3,5,-560,1,0,1,
+    9,1,0,-1187,0,0,-1307,3,0,0,-689,-988,
+    0,2,-313,-1994,1,1,0,0,-629,-727,-1637,0,
+    0,0,0,0,0,1,2,1,1,2,0,0,
+    4,5,-585,-1764,-1014,-273,0,1,-640,0,-1361,8,
+    -314,-762,0,0,0,0,0,1,1,1,0,2,
+    0,-92,2,-233,-708,1,4,2,2,0,-549,0,
+    1,11,2,5,0,-146,0,3,-1101,-778,4,-861,
+    2,0,-431,0,-829,0,0,0,0,-1089,2,-1847,
+    0,-1737,-1933,1,4,0,-387,0,-1797,1,2,-868,
+    0,0,-1501,-750,-2035,-136,4,-1699,0,0,1,-1140,
+    0,-331,1,1,2,1,-1883,0,-27,-1181,0,-148,
+    1,-1372,0,0,0,-906,0,-1635,0,-275,1,0,
+    0,1,-267,0,-590,-1556,-718,1,-1934,-523,-1939,0,
+    0,-1172,-1854,1,1,-952,1,-276,0,-254,2,-460,
+    -1147,0,0,-1806,2,1,-526,6,3,-874,-1758,0,
+    2,0,-1048,-1159,1,2,0,0,1,1,-1785,1,
+    -601,0,7,0,0,0,0,0,1,0,1,5,
+    0,-278,5,1,-744,-676,0,0,0,3,-1985,0,
+    1,-1465,0,-1642,-1533,-547,0,0,-1469,-618,-1794,-630,
+    0,2,-605,0,-584,0,2,-1442,-85,-2026,-174,-1601,
+    2,-1514,0,-212,-439,0,3,-1145,-380,-1574,0,-2009,
+    -1602,0,0,0,-1700,1,5,1,-106,10,0,0,
+    -1627,1,0,-117,-983,1,-505,0,2,-1632,-1812,-917,
+    2,3,2,0,0,-1369,0,1,0,1,0,0,
+    0,0,1,0,-1005,-2011,2,1,0,0,3,1,
+    0,-516,-837,0,0,1,0,1,-1313,0,1,1,
+    0,-675,0,1,1,0,1,-203,2,-582,-395,0,
+    0,-196,5,-181,0,1,6,0,-595,2,0,0,
+    -1929,-364,1,3,-575,0,1,0,2,-1103,-1621,7,
+    0,0,5,1,-958,0,0,0,0,-147,-1414,0,
+    0,-1385,4,0,3,-1891,0,1,0,0,1,0,
+    0,-2036,-341,-99,4,-1210,-583,0,0,-81,1,-771,
+    1,0,-1588,0,0,-1456,-365,0,0,-31,4,-1988,
+    -386,0,1,-1493,6,6,1,0,-2012,-295,1,-976,
+    0,0,0,0,0,0,-1945,-970,-154,0,-882,0,
+    2,3,2,2,-522,1,2,-162,0,-1262,0,-432,
+    -588,-612,0,7,0,0,0,-659,0,0,-2013,-39,
+    -1815,2,0,-252,5,-1698,-133,2,0,6,0,-607,
+    -573,-184,0,0,-223,0,0,0,0,-1481,1,7,
+    -1078,0,-535,0,-1431,0,1,2,-1956,-1646,0,0,
+    -1404,-30,4,0,-424,-757,0,0,1,-997,-194,-1675,
+    0,-1123,0,-151,-105,0,-975,0,-1589,-351,0,2,
+    0,5,0,6,-1919,2,-379,0,-253,3,5,0,
+    1,0,2,2,0,0,-1944,1,0,0,-1603,0,
+    3,5,-690,3,0,0,6,-22,-736,-1998,1,-1478,
+    1,0,-1903,-1563,-1218,0,0,0,-536,-1360,-1568,0,
+    -534,0,0,0,-1301,1,-403,2,0,2,5,0,
+    1,2,-368,-752,-1509,2,-2024,-1421,0,0,0,-804,
+    0,3,0,0,0,1,0,-1880,-812,0,1,1,
+    6,0,1,3,0,1,-1723,7,-1459,-1613,0,-1328,
+    -1451,0,2,1,7,-43,1,7,0,0,-366,-1786,
+    0,6,0,-1120,0,-965,-810,-1211,1,-1901,-1035,-1510,
+    -1684,0,-1038,0,-840,-886,-1594,-260,-2000,3,-1289,0,
+    -243,0,2,13,12,9,0,3,0,0,0,0,
+    -1052,-703,2,1,0,1,6,0,0,-1279,-1164,4,
+    0,-1016,3,2,-1254,5,-971,-2031,3,-1829,1,0,
+    0,-213,-1002,0,0,0,-1656,-1183,0,2,0,0,
+    -513,-227,-1344,0,-1397,0,0,-1363,0,-54,-1045,-1091,
+    -1967,0,1,-1407,-821,-686,-1792,0,-1380,2,9,-1879,
+    0,-1223,0,-1116,0,0,-684,2,-2022,12,0,0,
+    -1778,0,0,0,4,0,-533,0,-107,-717,0,-1669,
+    -1105,0,0,-1311,1,6,0,-473,1,0,10,0,
+    5,1,2,-2020,0,0,0,0,-472,0,0,3,
+    1,3,1,0,-1843,1,3,0,-753,0,5,1,
+    0,-1216,0,1,0,1,-581,-635,0,2,-1709,0,
+    0,0,-1297,4,0,0,-911,-1180,-529,-1980,2,0,
+    1,-150,0,1,0,0,0,2,3,-899,-1560,0,
+    1,5,-1202,2,3,0,0,0,-1225,-1657,1,-1935,
+    -1335,-1542,0,0,4,-996,0,0,0,-1648,0,-145,
+    9,5,-1925,-1366,0,0,4,2,10,5,0,0,
+    0,1,-1051,0,-1316,1,3,0,0,-1539,0,-538,
+    3,0,0,0,-1195,-1696,-653,-972,0,0,3,1,
+    6,-668,8,0,0,0,11,3,0,10,-391,0,
+    1,-2023,10,-1626,3,1,0,0,0,0,16,1,
+    0,0,2,0,-1647,8,-1452,0,-1866,3,0,-1892,
+    -381,-321,10,-19,0,-743,3,0,-1826,-2032,0,-2034,
+    -1021,0,1,-775,0,-2014,-1248,0,-1650,-1267,0,3,
+    7,4,1,12,0,-1346,0,6,1,2,-494,0,
+    -1607,1,-32,-878,1,-1565,0,0,-1245,-1681,-1697,0,
+    3,5,-362,0,1,-648,-1520,0,1,-942,0,0,
+    0,2,0,0,0,4,3,-1438,0,1,0,0,
+    -759,0,0,0,0,-2015,0,-1170,0,0,0,0,
+    0,0,6,-932,12,0,0,0,4,0,-405,0,
+    1,-1763,0,0,0,5,0,0,14,-1706,5,-244,
+    0,-28,-1383,0,0,-1368,0,-444,1,-2,1,0,
+    0,-80,0,1,-980,0,0,1,0,-1779,-342,0,
+    -1235,0,0,0,4,9,1,-353,0,1,-1885,-883,
+    -165,-1444,0,1,0,-1186,0,-1576,5,0,-872,0,
+    -1449,-1704,-1050,-1312,0,0,11,-1491,-1504,0,-171,0,
+    0,0,-114,0,6,0,-644,-1032,1,0,-1410,1,
+    0,1,-1156,10,2,0,1,0,0,2,0,-1912,
+    0,0,0,0,-1274,11,-990,0,-1999,-476,1,-382,
+    0,0,-1185,0,-1838,-1099,-79,-1483,0,0,-1072,-354,
+    1,-442,1,0,0,0,-1474,0,-214,0,8,-1782,
+    -159,11,16,7,2,1,6,0,2,1,-501,0,
+    0,0,2,-1869,-2047,-707,0,0,0,-1499,1,0,
+    2,0,-1166,-370,-1957,1,0,-1738,-649,0,0,0,
+    -1910,0,-692,0,0,5,4,-1801,0,0,0,4,
+    -798,-1018,10,-161,0,0,0,0,0,-802,-129,12,
+    -1955,3,0,-211,0,0,0,3,3,1,3,-1580,
+    -1094,0,-1537,6,12,8,-928,3,1,0,-1398,-945,
+    0,-1064,1,2,11,-461,-3,0,-1175,0,0,-1639,
+    0,1,-1104,11,-1246,-108,0,0,-1977,-1947,1,-1473,
+    17,0,0,0,-1735,-197,0,-330,0,-316,-69,0,
+    -1070,9,-1559,-127,-550,0,0,0,-1864,1,2,-283,
+    0,-650,0,7,0,1,-1073,0,-292,-1149,0,-1523,
+    0,0,0,0,-372,-168,-1150,2,0,4,-1265,0,
+    0,0,0,0,-497,3,-999,0,4,0,5,-91,
+    0,0,0,0,-441,-41,-433,-681,0,0,3,-957,
+    -893,-169,4,0,0,-506,0,0,0,0,-1242,-1888,
+    0,11,1,-1522,0,0,0,-483,0,2,-558,0,
+    -44,0,3,1,1,-1548,0,2,8,13,5,3,
+    0,0,-242,4,0,0,8,-555,0,0,-875,5,
+    -104,-1798,0,2,-1748,0,-973,2,0,-1427,-1571,0,
+    0,4,0,-1226,0,0,-1654,0,0,10,-344,-670,
+    0,0,-167,-215,-815,0,1,0,4,-389,-1827,5,
+    0,0,-1416,-509,2,0,-859,1,-1330,0,0,-646,
+    0,0,-164,1,0,3,2,0,-1233,0,4,-858,
+    2,-748,1,0,0,8,0,4,0,6,-1551,-156,
+    -1251,-141,0,17,0,0,-488,0,-1774,-308,-36,1,
+    -1415,-969,2,-17,0,-1942,-163,0,
+};
+static const uint16_t it_v[] = {
+    1657,229,428,0,0,0,205,0,0,538,1068,0,
+    592,1275,0,1996,1769,1024,1043,410,0,1789,0,1211,
+    0,1779,884,1439,569,1870,844,1677,908,0,0,24,
+    1766,0,0,429,0,0,0,1140,1617,488,946,940,
+    22,800,862,1608,0,673,0,1741,0,0,1470,0,
+    0,1673,0,0,0,1992,1848,217,0,426,246,383,
+    20,0,1817,1038,0,157,1630,0,976,986,286,187,
+    0,1353,1598,0,1548,937,0,0,0,50,778,0,
+    111,1819,1114,328,1563,220,1094,659,0,0,0,1295,
+    401,1776,0,1285,678,1337,0,165,1019,0,1798,82,
+    0,1002,464,0,727,1079,311,0,1972,292,1611,1080,
+    316,1676,372,918,1206,0,0,846,796,1816,1691,1694,
+    1249,0,0,0,0,0,1398,1637,1265,416,0,1463,
+    0,206,0,679,451,0,0,1792,1483,1599,999,544,
+    478,963,495,0,0,1168,1693,184,1084,0,480,0,
+    0,1229,0,3,0,721,661,1810,0,695,354,0,
+    1744,2044,1892,0,1466,1109,359,1931,0,1709,1782,435,
+    0,1400,0,2024,118,0,0,414,958,523,1551,1795,
+    0,841,0,92,1354,319,445,620,0,1435,1138,0,
+    0,1727,1323,0,0,1861,317,0,1301,377,690,560,
+    1005,1299,1783,0,0,0,1973,1888,1820,1569,1813,287,
+    434,0,1527,699,0,0,1923,1858,0,0,1404,0,
+    0,444,0,1335,0,0,0,637,0,1108,0,1081,
+    0,0,0,1685,0,0,0,1845,578,1380,0,1134,
+    10,1756,1156,632,0,0,1958,452,0,782,228,0,
+    0,0,1062,0,1713,0,1325,87,694,1526,1383,1387,
+    1067,280,657,942,0,722,664,668,384,1259,1376,0,
+    0,71,0,1857,1635,121,0,112,1750,256,568,1216,
+    624,278,513,565,1981,750,2039,0,1765,2037,0,0,
+    0,0,1633,1716,0,812,0,0,524,622,1684,0,
+    290,0,517,273,985,625,0,0,0,1036,442,0,
+    0,0,0,1106,0,1903,0,0,0,1748,0,1959,
+    0,0,0,0,37,305,0,409,0,725,1528,0,
+    0,1235,422,670,0,955,326,1576,0,0,0,1407,
+    2002,1533,0,1718,74,36,1920,698,780,199,810,1393,
+    2007,108,0,1929,0,1411,0,225,0,615,0,0,
+    59,0,720,119,785,1373,0,0,744,1880,0,789,
+    0,1518,0,0,0,712,566,151,0,1873,0,223,
+    0,0,216,0,1730,0,0,1618,1369,1605,0,207,
+    0,0,1640,0,453,834,0,1589,0,0,635,1192,
+    0,0,325,0,124,1881,0,1897,0,1764,94,0,
+    490,0,1029,0,0,1726,798,1671,0,0,304,175,
+    0,1836,1616,907,0,1659,0,0,0,1665,938,0,
+    2000,0,1207,0,0,174,0,2032,1123,1257,0,0,
+    552,1664,651,0,818,17,477,34,0,709,406,382,
+    62,1808,529,0,1883,0,520,0,411,1252,1476,1732,
+    0,1242,0,0,0,703,2045,1866,1395,1240,1293,1580,
+    0,1494,81,0,0,0,1281,630,1427,0,1431,0,
+    1092,1356,0,0,0,1237,579,0,1856,1276,1161,1571,
+    0,1774,0,0,766,466,349,0,1950,1539,1582,0,
+    1772,1419,746,891,2009,1422,1432,682,527,463,896,1738,
+    231,1534,0,1642,1670,1308,0,1661,0,1355,731,1154,
+    0,965,0,398,0,0,1127,1021,829,0,0,646,
+    0,730,0,0,1546,1083,1445,805,0,0,1632,129,
+    1392,1307,0,418,1030,826,1304,1130,156,1405,903,1143,
+    1189,0,0,935,1652,728,224,45,948,1488,1008,254,
+    0,0,1986,0,0,0,864,0,0,1255,1775,400,
+    1358,0,0,886,1256,347,598,768,433,663,502,1905,
+    0,0,0,1948,1287,0,733,1467,719,185,564,0,
+    1491,1469,1604,1859,281,49,595,0,376,830,0,0,
+    1875,0,767,244,0,141,58,915,0,1729,67,0,
+    250,332,656,0,608,848,0,1915,1662,192,977,0,
+    1627,0,0,0,1851,866,909,1190,1322,0,0,66,
+    1914,1214,0,1660,932,1126,1160,0,1804,1614,666,46,
+    0,0,1096,0,0,0,154,0,0,553,1720,0,
+    0,757,0,1824,518,0,550,1802,558,288,0,0,
+    990,0,1302,0,0,1926,713,854,197,1363,0,1553,
+    802,1428,1263,200,0,1226,1964,0,1895,776,447,0,
+    1832,1927,0,0,1117,0,279,2005,1511,1596,0,0,
+    1338,0,1682,308,636,138,0,1447,1297,346,0,0,
+    921,1849,0,0,0,102,73,0,323,2026,0,1333,
+    0,0,1906,0,1372,0,0,0,1952,614,1231,590,
+    962,1537,1279,1843,109,0,0,322,0,0,0,0,
+    0,0,0,697,1715,0,1960,1688,815,0,209,470,
+    0,917,1283,1191,0,188,0,833,235,1871,0,0,
+    0,1701,1456,169,1012,1316,2027,1745,0,868,0,573,
+    539,0,577,1402,0,0,0,334,0,0,77,0,
+    1073,0,0,1399,0,988,1681,0,0,0,0,1650,
+    0,859,1394,1922,345,0,0,2047,1860,642,0,570,
+    994,357,83,0,816,0,134,0,1515,0,0,181,
+    1717,0,299,808,825,499,0,0,1125,0,807,593,
+    0,302,0,0,1332,0,0,1230,1496,0,0,0,
+    474,1053,0,1386,1852,0,75,1838,0,1678,1780,0,
+    191,159,1374,462,1867,894,0,0,890,0,301,1006,
+    676,1173,0,1752,740,0,0,0,1401,0,983,1869,
+    0,0,70,0,1675,391,0,0,1040,1011,473,973,
+    547,1872,1208,0,1951,729,1220,0,0,1433,0,0,
+    1786,1095,1788,945,1731,1965,0,0,1129,0,0,0,
+    0,1506,1131,125,1212,0,842,0,545,0,0,1692,
+    0,0,0,1904,489,0,0,0,0,1648,943,0,
+    93,0,0,0,1544,0,1408,0,44,1425,849,949,
+    0,0,0,257,1166,1328,1516,1246,0,285,0,12,
+    293,0,0,96,497,1474,847,960,1936,1980,0,450,
+    0,309,1026,609,310,0,1823,0,0,0,2018,551,
+    0,0,99,0,0,0,0,1896,0,913,0,644,
+    850,1233,86,1128,714,1444,1429,991,1344,72,831,0,
+    764,0,54,1314,1535,0,0,911,732,233,194,0,
+    853,1759,1807,542,0,0,1150,0,0,0,1809,852,
+    237,0,427,0,0,1847,576,1270,530,1303,1899,1947,
+    1615,0,1704,0,373,1679,1290,142,618,276,1412,1254,
+    393,0,0,536,0,1137,0,0,0,1983,610,1568,
+    1195,1830,360,1844,1042,0,0,1442,133,0,934,348,
+    1889,1913,331,1170,603,0,1501,1760,258,2017,1597,300,
+    0,562,1991,887,130,498,101,374,179,1048,314,0,
+    366,0,1821,1118,1840,662,1199,0,0,1919,588,15,
+    596,0,0,1349,178,0,0,0,0,953,1417,0,
+    0,1939,759,97,492,922,0,0,468,1623,0,0,
+    0,0,0,1953,139,876,1794,0,1268,110,2041,1280,
+    966,1540,0,265,0,0,501,0,0,0,1318,0,
+    781,260,0,704,221,0,0,2015,0,650,0,0,
+    531,1159,2040,1294,1812,0,737,1350,1009,271,182,0,
+    1907,0,902,0,0,794,296,0,403,1908,261,1331,
+    0,883,1440,420,1619,0,64,1465,0,0,736,268,
+    0,929,0,879,0,0,612,283,1221,0,1481,0,
+    264,1074,234,1566,0,0,1039,1790,1912,1994,0,324,
+    510,0,0,0,567,0,0,370,1925,298,446,0,
+    1075,1052,0,437,0,784,748,0,0,0,0,936,
+    239,1135,171,1672,0,0,0,755,1313,1326,494,0,
+    0,1607,1339,218,563,1725,1076,1097,1497,0,1167,838,
+    23,0,1378,1375,0,684,0,1967,0,889,249,613,
+    0,0,738,0,0,1806,0,240,1461,419,0,0,
+    1552,1971,0,1202,0,788,5,344,1056,599,51,1178,
+    763,0,1091,0,1822,0,0,1085,1418,980,1961,817,
+    0,0,89,0,2036,0,1874,1059,519,255,0,623,
+    1584,1065,1438,0,930,0,1962,0,0,0,0,0,
+    0,0,1591,484,0,640,190,1145,0,928,978,771,
+    827,0,407,1622,0,0,677,1317,1735,1690,0,0,
+    1453,0,0,1267,0,219,0,1197,753,0,2016,1391,
+    1309,338,1291,1489,172,1510,0,1921,597,0,0,586,
+    0,0,1803,1057,1436,1581,412,1502,1007,0,1721,0,
+    0,880,0,0,0,1989,1218,0,762,201,238,1841,
+    1916,0,1545,1305,39,0,0,2029,950,1835,0,601,
+    897,0,0,765,0,351,0,215,0,0,1330,1530,
+    1561,607,395,0,710,0,1531,1023,0,1416,1366,1801,
+    0,0,851,900,1831,700,0,840,1066,0,32,869,
+    696,0,0,1460,0,1385,2042,0,855,0,526,1639,
+    284,1719,1213,0,633,804,1829,0,0,0,1629,1910,
+    1876,605,455,865,1124,1985,0,0,0,0,734,203,
+    0,705,1035,0,906,0,227,60,0,0,0,0,
+    1046,0,485,0,0,1277,1557,1200,0,461,7,0,
+    672,0,0,1336,0,1136,65,392,397,1258,641,1054,
+    779,0,2020,723,0,1583,0,0,0,0,1577,1585,
+    0,870,415,952,236,0,0,1479,824,0,230,0,
+    1524,1753,1624,0,1833,1284,2003,122,0,997,0,0,
+    0,1487,0,0,1687,1628,0,1141,0,1862,61,439,
+    483,127,137,1935,0,507,1449,0,1223,1147,821,1342,
+    0,1177,0,925,0,1289,1454,2001,0,0,1041,1917,
+    1045,1272,0,69,454,0,0,0,413,0,1058,0,
+    0,772,1565,131,0,0,1181,481,0,6,0,0,
+    1132,1162,0,0,0,0,0,2028,0,947,0,405,
+    878,1761,954,1815,1082,0,1238,0,0,787,671,176,
+    1595,375,1942,0,1025,0,1982,0,1654,1667,48,0,
+    1484,1022,0,783,1885,1324,0,1113,1434,919,0,52,
+    0,114,653,0,421,0,0,0,0,270,1172,1346,
+    602,1818,0,0,0,575,791,0,0,0,1746,0,
+    1975,832,1493,1388,1205,0,1188,0,1228,0,0,0,
+    1603,303,1153,1749,327,1686,1974,1064,0,0,143,1157,
+    0,1198,1740,0,708,0,1003,1133,0,795,1204,1389,
+    1963,0,0,1517,1990,1061,0,1707,822,342,1864,1164,
+    1236,0,739,1446,491,0,1787,0,8,321,0,0,
+    516,0,204,0,992,1702,1512,1644,247,0,0,845,
+    511,189,1390,0,0,0,465,895,1723,0,467,0,
+    387,875,1743,1462,1658,939,117,1988,1949,0,0,0,
+    0,1101,1243,476,0,543,1621,754,0,0,1320,541,
+    1549,920,819,1381,486,0,2004,1751,1504,339,0,0,
+    509,0,469,0,19,1286,0,1767,0,1940,355,0,
+    760,0,1663,95,63,0,358,55,0,0,0,0,
+    993,1203,0,0,0,0,262,1364,1471,0,1196,924,
+    555,0,1505,1000,1269,0,1032,0,1486,76,1590,1152,
+    0,41,1120,248,1475,923,0,0,912,1175,967,0,
+    85,0,1014,0,741,1758,1377,1711,
+};
+
 static const struct words it_words = {
     2048,
     11,
     true,
     (const char *)it_,
     0, /* Constant string */
-    it_i
+    it_i,
+    it_g,
+    it_v
 };
@@ -2398,11 +2398,360 @@ static const char *jp_i[] = {
    };
 #undef jp
 
+static const int16_t jp_g[] = {
+    1,0,1,1,0,-718,1,-1676,1,1,-837,-444,
+    2,0,-877,0,-1920,-1264,0,-568,1,0,-335,-301,
+    -949,0,-576,-1526,-1168,1,-1959,1,-890,1,-1825,0,
+    0,0,0,0,-1390,-1346,-1805,0,2,0,-195,2,
+    0,0,0,-118,-1886,1,0,-1478,1,0,0,-415,
+    1,0,1,2,-405,1,0,0,4,1,1,0,
+    2,-302,-814,-1604,0,0,0,-1196,0,0,-1797,1,
+    -137,0,0,-437,0,2,-1780,0,0,-693,1,0,
+    0,-1336,-958,-694,-433,0,0,-108,0,-1120,-1466,3,
+    -1268,1,0,-778,0,-1859,-215,0,-425,-1840,1,-126,
+    -1816,0,1,-1741,0,0,2,1,0,-1930,1,0,
+    0,0,-1047,-647,-161,1,-773,0,0,-482,0,1,
+    1,-271,1,-1646,-1145,1,1,-843,2,0,0,1,
+    -752,1,-1794,-494,-1645,0,0,0,-1223,0,0,0,
+    -1277,-842,1,0,4,0,0,7,0,-2016,1,0,
+    0,1,3,0,-1311,-306,0,0,-1296,5,0,0,
+    -83,-1876,0,2,0,0,-563,2,-810,0,1,-501,
+    0,-612,1,-478,0,0,1,0,-340,-611,1,1,
+    -107,0,0,-1583,2,-1320,1,0,0,-156,-1323,0,
+    -852,-267,2,0,0,9,0,1,-1667,3,0,2,
+    2,-59,-363,0,0,-1872,-853,0,0,0,4,0,
+    1,0,-211,-1281,3,-1208,0,0,1,1,2,0,
+    0,-866,1,1,0,0,-247,0,-169,1,0,0,
+    0,0,0,0,-1284,-1242,1,1,-96,0,-602,-1162,
+    -1626,-1586,1,3,-2034,1,4,0,2,0,0,1,
+    1,-1704,0,-1943,0,-1707,0,1,3,-900,0,0,
+    -1154,-1306,-962,4,0,0,-1733,-1851,-697,0,-1749,4,
+    2,-607,-1651,0,-861,-975,0,-1924,1,-571,-166,0,
+    0,0,1,-1428,-626,0,1,-1459,0,-941,0,3,
+    1,-1362,-942,2,0,-1368,0,-1157,1,-50,0,1,
+    -449,3,0,2,0,0,0,0,-180,-910,1,-255,
+    0,0,1,2,0,0,0,1,2,-1426,-779,0,
+    0,-1289,0,-579,-549,-1326,0,1,-1177,3,0,-279,
+    0,-761,-540,5,0,4,0,-1787,1,-1662,3,-1775,
+    -669,-726,-1290,0,-1062,5,0,0,2,-491,0,-1088,
+    4,-1036,0,-277,0,-885,-1544,0,1,1,-140,0,
+    -2035,-1156,2,-1159,1,1,0,0,-489,-1972,2,0,
+    -640,-1325,-365,0,1,5,3,-86,-1708,1,-418,4,
+    0,3,-1025,1,-542,0,-370,-1789,0,0,0,-305,
+    1,2,0,3,0,0,2,1,-871,-2030,0,1,
+    -1879,-1629,0,-1245,-181,-1986,1,1,0,2,-1997,-162,
+    -868,-1164,-1945,1,0,1,-1678,2,1,-315,-1167,0,
+    -902,0,0,-822,-1796,0,0,-1333,0,3,-1006,-1665,
+    0,0,3,0,0,0,-1558,0,0,-1812,3,-1015,
+    0,0,0,2,-684,-1045,0,0,1,0,0,-227,
+    -1888,1,-863,-1224,1,-888,0,0,-1675,4,1,3,
+    2,0,2,-618,-486,0,1,2,0,0,0,1,
+    0,0,2,0,-201,2,-1695,0,-459,-1573,0,4,
+    -1095,1,-116,0,1,0,0,1,0,0,0,0,
+    0,0,-1688,-914,1,-788,-929,0,1,0,1,-1422,
+    0,-1293,5,0,1,2,2,-299,2,1,0,-1835,
+    10,-936,3,-1710,-2033,0,-476,-1910,-1977,-1670,0,0,
+    -703,0,1,-310,0,0,-1427,-1171,-1082,0,-1596,-245,
+    1,0,1,0,-2048,0,0,2,-1768,1,1,0,
+    2,-981,1,1,0,-749,0,0,0,-1702,-659,3,
+    0,0,-1396,2,0,0,2,0,-499,0,0,0,
+    1,2,0,-806,0,4,1,-1553,-516,-1365,-817,-2037,
+    0,1,-1511,0,1,0,1,3,0,2,0,-524,
+    1,0,2,0,5,0,-51,4,-937,0,3,-755,
+    -920,0,0,-716,1,0,-403,0,-1951,-1137,0,0,
+    13,0,0,-1126,1,0,-1735,0,1,1,3,-1058,
+    1,-38,-99,1,1,1,-1450,-1916,1,1,1,-1788,
+    0,-1854,-374,0,0,5,0,0,1,0,5,0,
+    0,-1614,0,-1279,-281,0,0,6,0,-448,0,-1456,
+    4,1,0,3,-1618,-784,1,1,-1900,0,-1968,0,
+    10,-1080,0,1,0,-230,1,0,-158,-1166,0,0,
+    -445,-475,0,9,0,0,-785,-72,0,0,0,0,
+    0,0,0,-1136,2,-517,0,-1639,0,0,0,-287,
+    -804,0,-1297,1,-1423,-893,0,-1479,0,1,1,0,
+    0,0,2,2,1,1,-26,1,-275,-1010,0,-671,
+    3,0,-1217,-1896,2,-1617,0,-1499,0,-1782,-530,1,
+    0,0,1,0,12,-1111,2,-898,0,-597,6,1,
+    0,2,4,2,-724,-472,0,-764,-1798,-1512,-1063,1,
+    -1711,2,0,2,0,-1295,1,-547,-1830,1,0,-392,
+    0,0,-649,-635,-121,0,0,0,1,-1818,4,0,
+    3,0,0,0,0,0,0,-971,10,0,0,0,
+    -273,-202,2,0,-2040,-881,3,0,-2005,0,2,2,
+    -1751,0,0,0,0,-1163,-396,0,-1070,2,0,6,
+    6,0,1,-481,-1631,1,1,0,0,-1991,1,-1884,
+    0,0,2,0,-1176,0,2,0,0,-944,1,0,
+    -625,2,0,4,1,0,6,0,-55,0,-352,3,
+    -1668,0,0,-1699,0,0,-531,1,-359,-1230,2,-1549,
+    1,0,0,-290,0,-1372,0,0,-1664,0,0,0,
+    1,1,-250,0,0,10,4,-103,8,-1288,7,-884,
+    -68,0,1,-242,-573,0,1,-1534,0,0,2,-654,
+    4,4,-1863,0,2,-455,-813,-1847,-986,0,0,-556,
+    -1031,-31,1,0,0,1,-1987,-114,-1322,2,1,1,
+    3,0,0,-2020,-346,1,-2000,0,0,-175,3,-1313,
+    1,-465,0,0,0,-918,1,-1980,0,-1152,-1255,-940,
+    1,0,1,-1263,4,0,-1551,-604,0,10,-497,0,
+    -930,0,-1414,0,0,3,0,2,-1778,-733,0,1,
+    -638,-345,3,0,0,1,3,0,-730,0,2,2,
+    0,0,-61,0,0,2,0,-1531,0,0,-1846,-1032,
+    1,0,3,0,-21,15,0,0,-1823,2,-1974,-369,
+    5,0,0,0,1,0,-1555,-147,0,0,-1915,-1225,
+    -1275,0,-1539,7,0,3,-1829,-1051,0,-1799,0,1,
+    2,0,-74,1,0,-1358,-168,5,-735,3,-1193,0,
+    -172,0,-1574,-1351,5,-1969,-328,0,2,-54,-2023,-1105,
+    0,-682,2,-742,2,-1850,3,1,-534,0,0,0,
+    2,0,1,-1238,0,1,5,3,0,1,0,0,
+    -637,-1516,3,-1367,0,-303,11,0,1,2,-234,5,
+    -747,-646,-1494,0,0,4,2,1,0,-2004,0,-702,
+    1,-1490,1,5,4,-288,-217,0,-1867,0,3,0,
+    3,0,0,-1331,1,-644,0,0,2,-1808,0,0,
+    -711,0,-427,-1545,-44,1,0,-1020,-216,-708,-1849,13,
+    -1411,-1506,0,0,15,0,0,1,-1417,0,2,0,
+    -1834,0,0,-205,1,10,1,-469,0,0,0,-1845,
+    -22,-823,2,1,1,-562,0,0,0,0,-349,-120,
+    -939,-64,0,-1556,5,0,0,-1121,1,3,-2026,-1870,
+    0,0,-667,0,-1858,-1398,0,-197,17,2,4,8,
+    0,3,0,-1251,0,0,0,-689,8,0,6,1,
+    0,0,0,-261,0,-1034,0,2,-1273,4,0,-508,
+    -1793,2,-203,0,1,-131,0,0,-683,0,0,-705,
+    0,-1765,-1811,0,-1091,0,6,-894,-1237,-663,7,0,
+    0,0,-1940,-391,0,-1567,-265,0,3,-196,1,10,
+    0,0,1,-235,0,3,0,0,0,0,-1185,2,
+    0,0,-1269,1,0,1,0,-268,-1209,-791,-17,0,
+    0,0,0,0,-1175,-662,0,0,0,-1682,4,0,
+    -882,12,1,1,3,0,0,0,6,1,-996,0,
+    -535,0,2,1,0,0,0,0,2,-1955,8,3,
+    -1641,-406,0,-493,0,-1761,3,0,0,0,0,0,
+    3,0,-1998,-1842,0,0,-1740,5,-5,7,2,3,
+    0,0,0,5,0,0,0,0,20,-719,0,3,
+    -409,2,0,-35,-1483,0,1,-1222,0,-447,6,5,
+    0,-1770,0,-502,2,0,0,4,13,0,2,1,
+    0,0,-1052,-1124,0,6,-1314,0,0,-1239,0,0,
+    -360,-190,0,-1203,-1040,-46,0,-1155,0,5,0,-1684,
+    0,-772,0,0,-1202,-1272,2,-331,2,0,1,5,
+    2,-333,0,2,0,-2,-498,0,1,15,-1613,-1636,
+    1,1,-248,0,0,0,1,-1497,3,0,1,-911,
+    0,1,0,0,-1575,0,0,-25,2,0,-385,0,
+    0,0,0,0,-570,0,0,0,3,0,-33,0,
+    -1680,0,-891,-1393,-743,-1037,-1723,4,19,0,-1958,4,
+    0,-456,0,1,0,0,-454,-1965,3,-1661,-461,-1114,
+    -1444,-13,0,-849,3,-1496,-737,0,2,-1514,-1169,0,
+    0,-1246,0,-1572,5,7,-599,-341,-1800,3,0,1,
+    1,0,1,6,2,0,1,-1170,2,-1431,-655,-1285,
+    -1432,-1016,-1865,-1210,0,0,-495,-39,1,0,-1374,0,
+    -1963,-851,0,0,-1810,-189,0,0,7,0,0,-1104,
+    0,3,1,0,-608,1,0,0,0,19,-191,-1504,
+    -915,2,1,0,-1564,0,2,0,1,1,-1576,-1753,
+    -1686,11,2,-81,-974,-652,-593,-1067,-994,-795,-723,0,
+    0,0,0,0,0,-1568,6,11,0,-818,0,2,
+    0,-429,0,21,8,-728,0,0,2,-1445,0,-492,
+    -1139,-182,0,-657,0,0,4,0,3,1,-850,0,
+    0,0,10,4,0,-1484,0,0,-1474,6,1,0,
+    0,0,-407,4,-1524,0,7,1,0,0,-423,-586,
+    0,1,-805,-1416,0,0,11,1,-1606,5,4,-1844,
+    7,-1318,2,0,-692,-1565,0,-1814,-1722,-1960,0,2,
+    1,-609,-368,0,0,-1779,-934,0,-1600,4,-1011,2,
+    -1640,1,1,-77,-1214,4,1,-1964,0,0,4,-142,
+    2,0,0,0,-1455,8,-1615,2,0,-731,-148,0,
+    10,3,0,-278,-1791,0,19,0,-23,0,-1304,2,
+    3,7,2,8,1,-1607,-1898,-151,0,-1418,-1,0,
+    0,0,-1328,-119,0,0,2,-1942,0,4,-1453,-219,
+    0,8,-770,0,6,-1213,0,-2009,0,0,7,-1730,
+    0,0,-1056,-204,-94,3,0,-361,-525,-1649,1,0,
+    1,0,-879,-1446,12,0,2,0,-1216,0,0,-1194,
+    7,0,0,0,0,0,2,0,-1233,0,0,0,
+    0,0,1,-1559,-753,0,0,0,0,0,0,-1881,
+    0,-438,-529,13,0,0,11,-316,0,-777,-825,2,
+    0,1,0,2,-789,0,-1265,0,-862,0,0,0,
+    -1509,9,-1611,-1009,-1361,0,0,0,0,0,-505,0,
+    0,0,0,0,0,-47,7,-1071,1,1,-1291,-771,
+    1,0,0,0,-1890,-1023,-1457,0,0,-357,0,0,
+    15,0,8,0,-439,0,-1739,2,3,-889,9,-1403,
+    -1697,-431,0,0,7,2,-490,1,-1415,0,0,0,
+    -1517,22,1,0,0,7,-1734,0,1,0,-1234,-284,
+    0,1,-960,3,-1625,0,-1843,-1267,-1294,-128,-701,1,
+    0,-1026,0,0,0,-417,13,-1307,-56,-1644,-2043,0,
+    0,3,3,0,-600,0,0,0,
+};
+static const uint16_t jp_v[] = {
+    0,0,1341,0,1684,550,1331,39,259,0,990,0,
+    149,0,0,0,312,0,10,0,1977,0,1921,0,
+    0,583,1171,1637,0,677,944,0,57,1468,250,1634,
+    829,1980,882,0,143,0,409,0,140,317,0,78,
+    1622,1718,354,0,228,412,0,859,0,0,0,1146,
+    413,191,352,1299,0,1713,0,553,1234,0,0,0,
+    1027,520,630,1743,1688,459,0,0,1737,1927,1424,0,
+    186,1000,0,0,0,0,1111,802,83,0,0,811,
+    1888,0,1459,225,1766,0,825,1724,1865,0,1676,0,
+    353,0,0,1562,0,0,1149,0,1545,0,145,0,
+    1347,508,0,1898,543,1868,1578,0,0,960,380,0,
+    0,1343,998,1540,0,0,0,1507,0,699,26,410,
+    1932,0,166,59,466,924,1026,36,1302,135,268,1052,
+    0,0,0,1886,0,930,0,137,1657,0,1689,108,
+    1200,1141,0,1012,1053,1226,313,0,0,1122,0,1821,
+    109,1598,1714,0,329,0,478,1501,1592,0,2031,713,
+    0,134,1032,1541,0,1870,1742,103,0,499,0,0,
+    1391,138,796,1905,184,1400,2021,0,0,950,580,0,
+    0,1901,0,0,831,331,1854,96,0,1476,1029,0,
+    0,0,0,1975,0,0,1931,0,159,554,1096,0,
+    588,0,1088,0,799,0,0,0,28,0,903,1442,
+    0,1773,0,1542,374,0,1013,74,1080,558,0,0,
+    112,1970,971,0,542,0,559,0,513,275,0,156,
+    0,0,1620,0,0,0,0,621,0,1428,0,502,
+    1460,1002,0,1763,239,1747,0,1517,0,0,0,1589,
+    1735,0,1257,781,183,325,0,1239,5,1851,1004,0,
+    0,694,0,0,1484,626,1860,0,0,230,999,1497,
+    0,0,1873,206,0,815,1678,724,0,1320,0,205,
+    1432,0,14,649,820,0,52,2023,0,1940,891,0,
+    0,84,0,0,61,0,2011,792,1394,1300,0,0,
+    0,1691,0,347,0,685,261,1006,290,708,0,814,
+    1913,2027,242,469,1086,1439,1124,486,398,1374,1960,0,
+    855,0,1067,873,1333,0,0,2018,0,579,509,785,
+    1152,1756,1608,0,0,2043,547,1974,1450,1418,1682,1532,
+    773,122,628,169,1702,56,0,0,1906,0,840,224,
+    1127,1741,1876,1137,720,1059,0,0,310,1164,1286,386,
+    1826,338,0,279,719,1784,0,744,0,0,1708,306,
+    1590,0,0,86,0,1560,737,532,0,0,1475,1626,
+    0,605,1351,0,0,879,1077,1196,589,11,1762,0,
+    664,652,433,819,977,1384,0,245,365,0,70,1692,
+    0,912,1652,0,236,0,0,0,1830,1203,387,679,
+    1937,0,77,1908,1411,0,0,0,0,407,1728,759,
+    1994,739,0,1248,565,1398,256,1761,0,1075,0,923,
+    23,1471,0,1539,0,2,343,0,1665,1549,0,0,
+    199,1526,0,0,1877,0,0,0,1243,0,517,1068,
+    158,1219,1770,0,0,0,0,0,0,303,90,1838,
+    0,0,1536,689,1972,672,0,0,833,1307,0,1789,
+    1040,506,355,0,0,0,716,1142,767,361,1354,1487,
+    1441,232,0,512,955,0,0,87,574,342,942,0,
+    0,0,1188,0,657,0,1128,0,1587,0,198,975,
+    0,602,1297,869,0,1003,1275,133,609,1074,846,0,
+    0,0,0,1902,207,0,1451,0,945,1448,1856,19,
+    1983,262,0,551,1407,1619,1529,1230,311,1855,0,0,
+    1279,0,449,1467,1736,0,0,0,1704,1273,1519,911,
+    0,378,0,1084,177,0,0,564,0,1492,1835,0,
+    0,1100,1133,0,0,552,1251,0,1375,27,798,0,
+    0,1965,595,0,68,366,0,830,1247,1943,1231,0,
+    1408,1989,1453,1177,219,0,0,0,1353,885,0,173,
+    1690,400,1609,1189,986,0,521,0,0,1808,775,0,
+    0,321,1173,0,0,0,0,594,0,461,1577,0,
+    0,1436,1107,0,922,0,976,94,0,1758,1917,0,
+    0,0,0,142,1049,1586,1780,981,1925,1535,441,0,
+    389,476,397,1314,1951,1308,629,1912,566,0,978,0,
+    1198,0,1056,1794,0,337,1399,1882,1819,1054,1671,0,
+    1984,269,1277,1506,832,0,0,175,0,946,0,1114,
+    1385,162,0,0,1469,1017,1106,0,2001,750,0,1988,
+    1429,0,1365,676,675,1607,0,0,1755,0,467,1042,
+    0,451,1486,0,1894,1112,0,0,0,0,0,0,
+    0,1403,104,1160,346,864,0,0,826,1593,0,0,
+    0,537,1726,284,0,1179,0,926,545,1818,0,1892,
+    1547,1520,0,0,2020,1370,745,1534,0,1601,964,1749,
+    0,1406,0,1627,1992,1309,0,1847,1172,128,1561,1594,
+    0,0,1783,1485,1890,31,1922,0,780,0,1717,0,
+    0,540,1903,1298,1362,0,0,956,2045,1359,462,1488,
+    0,898,0,834,1891,0,1433,0,1352,1524,1269,1969,
+    1405,1911,0,0,452,1446,0,0,341,1435,1301,322,
+    0,563,0,0,1382,9,1583,0,0,0,211,0,
+    0,0,227,0,0,0,151,616,1757,0,0,1982,
+    706,793,1695,0,222,0,650,874,0,0,900,795,
+    0,0,1021,0,0,1874,0,525,335,663,731,0,
+    0,0,738,1633,1584,1580,0,839,1579,684,0,1121,
+    0,0,0,2013,1991,791,1518,1655,0,1390,81,872,
+    0,1680,531,0,0,844,0,0,1591,1771,420,0,
+    918,0,375,0,0,0,0,642,1553,623,586,619,
+    0,0,0,1388,1751,1981,1935,2037,29,421,1504,925,
+    0,1816,1048,519,295,2006,0,1490,1058,0,0,0,
+    1812,0,1686,1782,0,510,0,0,711,1631,0,1719,
+    0,573,0,251,0,868,0,1852,536,0,0,495,
+    1569,0,712,423,697,472,1863,612,1197,1041,1823,0,
+    740,0,271,1884,72,427,907,1916,1259,238,0,0,
+    1076,0,2016,0,192,65,1393,1565,0,1131,0,1191,
+    698,1730,1218,164,1879,253,1946,439,994,1071,308,0,
+    0,2035,2009,0,285,1948,0,0,0,0,989,1381,
+    187,1134,905,1531,0,0,8,0,388,0,1514,450,
+    1157,0,1765,538,1654,0,1463,111,810,1785,0,0,
+    0,1145,1933,1522,0,1037,0,1697,0,0,1978,0,
+    800,1258,100,1699,0,193,231,1712,0,163,0,1396,
+    0,442,0,622,1527,323,2014,0,1260,774,671,0,
+    640,644,0,1007,2046,680,863,0,0,0,0,0,
+    376,1481,0,0,949,0,0,0,1270,1130,518,97,
+    0,1920,0,1668,756,0,514,0,1537,806,1078,549,
+    1102,0,0,0,0,1437,1304,0,0,951,1097,1368,
+    0,1001,0,1363,0,761,0,1570,1662,0,0,965,
+    265,0,1893,0,1095,0,1470,15,1867,6,0,1987,
+    0,0,1910,0,257,1065,0,1727,0,0,1178,1814,
+    357,431,18,0,1744,221,440,415,0,0,0,590,
+    987,0,966,0,0,0,1464,320,556,952,818,695,
+    1723,307,0,0,1148,0,0,0,0,0,0,0,
+    1187,445,316,0,758,129,0,1934,350,0,99,856,
+    0,0,0,0,0,953,1261,1872,1246,126,0,1020,
+    0,1576,457,0,0,0,0,0,1746,1358,0,1129,
+    728,0,435,0,0,1016,1623,997,1323,0,1182,255,
+    0,0,182,963,0,392,0,1653,582,0,0,0,
+    581,0,632,669,418,0,0,835,273,17,0,0,
+    1806,2044,363,35,382,0,1642,0,0,1926,1772,1466,
+    0,1181,483,762,79,1715,1339,1115,0,1938,209,0,
+    0,827,1214,1930,979,1282,0,0,1118,0,0,1109,
+    1995,1754,0,237,0,1775,1568,620,1083,370,0,131,
+    0,0,110,0,1588,0,1936,0,1802,0,1047,1998,
+    726,0,655,1346,0,0,1180,0,0,1099,1126,527,
+    1028,743,0,1904,895,786,0,947,0,0,0,1150,
+    753,2030,434,0,0,0,2026,1340,1315,641,1801,429,
+    766,1629,0,0,0,597,1641,823,845,0,1900,0,
+    1369,0,705,48,584,0,1647,0,0,968,1412,1768,
+    1349,1092,1649,1420,1803,0,0,1281,0,988,0,0,
+    0,0,765,1711,66,687,1318,1253,2028,0,0,982,
+    383,505,252,0,299,240,593,124,297,908,1348,0,
+    0,1139,1316,522,0,0,749,1376,667,1089,1759,627,
+    1147,600,0,847,1955,0,1753,1832,0,779,1378,197,
+    105,954,1101,591,535,0,1211,0,0,920,0,1945,
+    399,1500,463,1108,0,170,0,1255,0,1716,0,843,
+    0,614,0,0,0,1551,1658,1494,858,1440,0,1509,
+    64,1311,217,114,1256,857,0,152,931,1220,0,0,
+    571,635,372,123,604,0,2012,248,0,0,42,1344,
+    0,576,0,1447,1285,557,0,1581,934,0,1596,1225,
+    1611,984,0,1227,1836,470,0,2007,1249,401,757,1438,
+    326,0,0,673,0,0,808,1670,0,1831,1961,0,
+    0,1011,0,0,1377,1700,972,1597,0,75,2005,154,
+    0,0,1342,3,153,0,1072,0,1401,62,0,0,
+    0,0,0,2040,235,1186,1337,223,875,1512,0,1105,
+    1372,747,0,0,587,0,1228,0,1705,0,1409,1018,
+    282,0,1462,1896,0,0,0,0,755,0,906,1240,
+    1928,0,853,148,1291,0,1383,1419,2002,1825,1034,33,
+    0,1199,0,916,1064,638,1651,0,403,176,0,172,
+    0,425,208,678,2024,969,1073,1326,0,1659,932,0,
+    1063,185,1791,0,0,1993,212,1672,807,0,1502,1185,
+    0,1093,393,0,2038,797,2017,1242,396,0,7,258,
+    1646,0,1045,1693,1082,213,0,0,394,1386,714,674,
+    377,0,0,379,1183,1355,0,577,0,886,1918,1615,
+    0,1356,921,0,0,0,1085,0,0,0,789,0,
+    0,1434,1479,1745,1328,0,801,665,733,371,132,479,
+    1820,1953,0,484,983,0,1132,1859,0,1140,116,381,
+    0,1636,0,465,0,0,1043,871,828,1461,703,1329,
+    1499,482,633,0,1379,419,996,487,0,631,0,2041,
+    0,0,686,336,47,1528,1837,1336,0,927,0,0,
+    0,243,0,1720,1472,41,1621,560,0,0,220,613,
+    1805,0,0,0,764,121,615,1952,0,0,0,13,
+    0,1210,1338,281,1966,88,101,1217,618,1556,937,768,
+    0,1334,0,1632,0,0,1159,1907,89,1673,1098,1204,
+    0,1190,838,866,0,333,411,904,526,92,293,0,
+    958,0,1038,1800,0,0,0,1423,288,0,962,647,
+    1956,854,721,568,902,659,0,0,0,0,915,1143,
+    0,0,0,1600,0,0,0,0,1827,0,690,1116,
+    0,0,40,1656,709,0,1559,735,144,1491,503,0,
+    456,0,1731,1949,1235,0,544,0,292,896,0,1602,
+    324,1206,1480,0,0,291,0,2010,1725,473,91,1091,
+    1947,0,1776,0,967,1881,0,1457,1840,318,1387,0,
+    1265,1924,1618,51,1404,894,1474,1060,1604,178,991,328,
+    263,349,511,1521,0,0,992,0,2000,837,0,1023,
+    319,660,1252,0,0,1205,1861,1117,0,296,1546,385,
+    877,782,0,294,69,1194,1380,44,
+};
+
 static const struct words jp_words = {
     2048,
     11,
     false,
     (const char *)jp_,
     0, /* Constant string */
-    jp_i
+    jp_i,
+    jp_g,
+    jp_v
 };
@@ -2398,11 +2398,360 @@ static const char *es_i[] = {
    };
 #undef es
 
+static const int16_t es_g[] = {
+    0,-1582,0,-4,0,0,0,3,-1315,0,0,-578,
+    -1662,-523,-1453,0,-121,0,-1256,0,2,-1948,0,0,
+    1,1,0,0,0,-1502,0,-449,-422,-583,0,0,
+    0,-1261,0,-1585,3,2,-1014,1,0,-812,-188,-1189,
+    -1739,0,-1053,0,0,0,1,1,0,-1285,-1047,2,
+    2,0,1,-1901,-442,-692,0,-383,0,-97,1,-110,
+    0,-908,-491,-409,0,0,0,1,-1937,0,-1865,1,
+    1,0,0,-651,-1204,3,-1081,1,-370,0,1,0,
+    4,0,0,-939,0,0,-1027,-1401,0,-624,-186,-1667,
+    2,0,-753,-1483,0,2,2,1,-485,0,-935,-821,
+    -476,0,0,2,5,1,-1931,0,0,4,-1236,-343,
+    1,-2009,-886,0,-1668,-1178,0,3,0,-960,-334,-1539,
+    1,0,0,-1116,-340,0,0,1,0,1,-213,2,
+    3,0,0,0,-1221,2,0,0,-89,0,0,-531,
+    -1438,1,-839,-1316,1,0,0,0,0,-1768,-1882,3,
+    -1032,-1126,0,-78,0,-199,1,0,0,3,-455,0,
+    2,-1200,1,-845,-454,1,0,1,-94,-1343,-1196,0,
+    -26,0,1,1,-1783,-919,2,1,-1514,-372,-893,-1623,
+    -361,3,0,-403,-1375,-1503,0,-549,0,-848,0,2,
+    0,2,-1807,1,0,0,-1926,0,0,0,0,-125,
+    -353,0,0,-1070,-195,-873,-1663,3,0,0,-1654,0,
+    -1283,0,-1307,0,0,-957,2,-901,-1405,0,3,0,
+    -14,2,0,-1462,-1149,1,-544,-1874,3,0,-148,3,
+    0,0,0,3,4,0,1,-1578,0,1,1,0,
+    1,0,1,1,0,0,0,-51,1,-373,0,-975,
+    1,2,0,0,2,0,1,0,-1688,2,1,0,
+    0,4,0,3,-671,5,0,0,1,-614,0,-1058,
+    0,0,-1121,-543,-592,-227,0,0,-365,4,2,0,
+    1,1,-265,1,-926,0,-1147,0,0,1,0,0,
+    5,0,0,0,1,-83,0,0,0,-899,-380,-1107,
+    -1775,-216,1,1,-1414,-670,0,0,0,0,0,-768,
+    1,-1920,-253,0,0,0,1,-1299,1,-649,-179,0,
+    -1182,4,0,-395,-1407,0,0,-965,-1174,6,4,0,
+    0,0,0,0,5,0,-1176,4,-815,4,-726,0,
+    0,-1403,-1043,-622,0,-1887,2,-666,0,-988,0,0,
+    0,-201,-1985,1,-1823,0,1,-1745,-475,8,-1402,0,
+    -1691,0,1,-205,0,0,-1796,0,-299,0,-724,3,
+    0,-2033,1,0,2,2,2,-761,2,1,-440,-1772,
+    0,1,2,-966,1,0,3,0,1,-401,-1290,0,
+    0,0,-826,-2042,0,-1766,0,1,-1347,0,3,0,
+    -1259,-1071,0,-98,2,-1367,-1555,-608,1,6,0,1,
+    -251,-1611,1,0,1,1,0,0,-2037,0,0,1,
+    0,-700,-1778,3,0,0,1,0,0,-1198,-119,-1864,
+    -2025,-1377,4,-239,1,1,0,-757,-1592,1,1,0,
+    1,1,1,-1912,-1159,0,-615,-1640,0,-143,1,1,
+    1,-338,5,0,1,-52,0,0,0,0,0,0,
+    -1382,-1428,-1613,0,1,-522,0,-1378,0,0,3,0,
+    1,7,-392,1,0,0,0,2,-1087,-393,-1706,2,
+    0,0,-1879,3,1,0,-323,-1010,-971,0,0,2,
+    0,-1793,0,0,1,-301,0,0,-1288,2,1,2,
+    0,0,0,-996,-27,0,-1219,0,-1144,-1762,1,-1529,
+    0,-277,0,0,0,-443,0,0,-521,-1427,5,2,
+    5,0,-174,0,0,-135,7,-40,3,0,0,0,
+    -1322,-1608,2,-1418,0,-1038,-1163,-1861,-38,0,-1851,0,
+    2,1,1,-400,0,-464,-96,0,0,1,1,0,
+    -830,0,1,0,0,0,-67,-146,3,2,-1036,-347,
+    0,-1821,0,0,1,1,0,0,0,-19,0,0,
+    -1304,0,0,0,-567,0,1,0,0,-1729,2,-984,
+    2,0,0,0,-1042,1,0,-1922,1,0,-953,0,
+    -858,0,0,1,0,0,-630,0,1,1,0,-856,
+    -1265,-1142,-1161,0,0,-1934,-1829,-306,-712,2,0,1,
+    0,-734,0,0,0,0,-1909,-1252,-170,0,-906,-116,
+    -1008,0,-512,-332,0,0,4,1,0,-182,0,0,
+    1,-144,2,-1553,-1735,0,-413,-628,0,-1239,-715,6,
+    -1136,-1526,2,-1616,-415,-1460,0,0,-1138,0,4,-1915,
+    0,-1808,1,-305,-1063,0,0,-289,-1534,1,0,-1728,
+    -1444,2,1,0,-1835,0,0,0,0,2,0,0,
+    5,0,-699,0,-993,-1442,-1331,1,-1652,-1424,0,-1522,
+    0,4,1,-1072,0,-568,2,0,0,1,-569,-1301,
+    -437,0,-152,2,0,-562,0,-1548,-1725,0,3,-1576,
+    2,1,-1975,-1637,3,-1844,-66,0,0,0,0,0,
+    2,0,11,0,-502,0,0,-1650,0,-1208,0,3,
+    0,1,-309,2,-248,-504,-355,-1183,1,6,-581,-1051,
+    8,-1770,-1595,2,-1293,5,0,0,-461,0,0,0,
+    1,0,1,0,-446,-1465,0,0,-1281,0,0,-1240,
+    1,-274,1,0,1,0,-124,-150,0,-573,3,-1505,
+    -1478,-750,5,0,3,-580,0,2,-2024,-872,5,0,
+    2,1,4,1,2,-1962,1,-160,0,0,0,0,
+    -167,-55,-572,2,-847,1,-2047,-1498,-574,0,-819,0,
+    -713,-1328,-1968,0,-222,0,0,-158,-1672,2,2,-1294,
+    -1253,0,0,1,2,-786,1,0,5,-831,3,1,
+    0,0,-766,0,3,0,-8,0,0,-1954,-363,0,
+    -1139,-1492,-842,-1003,0,-1443,-1143,0,0,-510,-1243,0,
+    0,0,0,-1185,0,0,4,-28,0,-1276,0,0,
+    0,2,-1955,0,-312,-1303,4,4,2,-907,0,2,
+    -93,0,0,5,0,0,0,1,-136,2,0,1,
+    3,-366,1,-46,0,0,4,-1309,4,3,1,-1466,
+    -17,-739,1,-172,0,-1928,-900,2,0,5,-1060,2,
+    0,-1910,2,2,0,-1112,-680,0,-530,0,0,4,
+    -563,0,0,1,6,0,1,0,0,0,-1907,0,
+    0,2,0,-1779,0,0,-1837,-107,-743,1,-921,0,
+    6,-1362,1,-394,0,0,1,10,-1137,3,2,0,
+    4,0,8,2,-762,0,0,1,2,-879,-307,-391,
+    2,-44,0,0,0,-1676,0,0,-874,-200,8,-524,
+    0,0,1,-1600,1,3,1,3,0,0,0,-1798,
+    0,0,4,-1073,7,4,-1724,1,0,0,-1267,4,
+    -719,1,13,6,0,0,0,-2044,0,0,0,3,
+    0,-1364,0,-963,0,-439,0,0,0,-1181,0,3,
+    2,-1390,1,1,0,-1905,5,0,0,0,-1737,0,
+    2,0,-1978,2,-1819,0,4,0,-1016,4,3,-1687,
+    -169,0,2,0,1,-1952,4,0,0,0,-68,-1398,
+    -694,-111,0,0,-1880,-1091,-1964,2,0,3,-1507,0,
+    -22,-706,1,-271,4,1,0,1,-1712,0,-697,1,
+    -1228,4,-92,-351,-381,1,3,-941,0,-737,-375,3,
+    1,-793,-285,0,4,5,0,4,5,1,0,1,
+    0,-103,0,0,0,0,0,0,0,-219,0,2,
+    -118,-1374,0,0,1,3,0,0,1,3,0,0,
+    0,-1918,0,-145,-1255,1,-1659,2,0,0,0,14,
+    1,0,3,2,-1886,2,0,0,0,-972,-1332,-2028,
+    -358,-931,0,-1406,0,0,0,0,5,-497,0,0,
+    -129,0,17,0,0,-91,1,-1781,0,-676,0,-811,
+    0,-82,-432,0,0,-1777,-1950,0,0,0,-751,-741,
+    1,0,1,-1095,-1591,0,-1214,-1289,1,-159,0,-968,
+    0,-81,0,-342,-1685,-1939,6,-142,-315,-1801,0,-1913,
+    0,2,-987,4,3,3,0,0,0,0,-1573,-451,
+    4,13,-1644,0,-1972,2,-535,0,0,3,0,1,
+    3,0,0,12,-433,0,0,-621,0,2,0,10,
+    0,0,3,0,-435,-218,0,1,-1895,0,0,0,
+    0,-1980,0,-1703,0,0,-7,0,0,-1969,-282,5,
+    1,0,3,0,-1626,0,0,0,0,-1392,0,3,
+    9,0,0,4,0,0,0,4,0,-1041,0,-922,
+    0,0,-570,0,0,2,0,0,0,-1805,1,0,
+    1,12,2,20,0,2,-1860,8,-843,-280,-1945,4,
+    -998,0,2,0,0,2,-1468,5,-1765,1,-1898,0,
+    -1046,1,0,0,-2026,0,0,0,-1079,-2023,2,-202,
+    0,-233,-870,-1009,2,0,1,-891,-331,2,-731,-486,
+    -137,0,0,2,4,-558,6,-1111,4,0,0,0,
+    23,0,10,0,-1225,10,0,-1506,0,4,0,1,
+    -104,0,0,0,0,-9,0,-1583,-1447,-1655,-1237,0,
+    7,6,0,0,0,0,-1463,14,0,-1859,-450,0,
+    -902,10,2,0,-1802,3,0,-1439,-1510,2,0,0,
+    -1251,4,-565,9,-411,0,0,0,-467,1,0,-263,
+    -58,0,0,2,5,0,4,0,-240,-672,26,3,
+    -1119,-311,0,0,3,0,0,1,0,0,-936,0,
+    0,4,4,-2,0,-132,4,0,-1078,-2022,-319,-1188,
+    -1135,1,0,1,-1669,1,10,0,0,-1187,0,-1242,
+    -371,0,0,-1625,-1388,0,6,1,0,5,12,0,
+    0,1,-710,-967,-1317,0,0,4,-1550,-829,-1993,-469,
+    -244,6,3,3,-759,0,4,0,2,-607,0,1,
+    3,4,-1684,0,0,2,-617,1,0,-1544,-979,-243,
+    -1634,0,9,5,1,2,0,0,0,-2002,0,-594,
+    -633,1,1,3,-1148,-917,-981,0,0,-1533,0,-430,
+    0,-16,-1707,1,-190,1,-294,5,-1577,1,0,-604,
+    4,5,0,0,-1226,-1758,2,0,-49,2,-203,-1542,
+    0,-204,-246,-1683,0,0,0,-729,1,-1921,0,2,
+    3,0,-661,0,0,6,11,9,0,-1024,-686,0,
+    3,0,0,-1345,-1956,0,-386,0,0,-1031,12,0,
+    0,1,-990,1,-659,-1470,1,2,0,2,-914,4,
+    14,2,0,0,-775,0,2,0,0,13,3,1,
+    0,0,0,0,2,3,7,-1944,-1,1,-64,-1436,
+    1,-1866,-197,-653,0,2,0,0,0,0,-534,1,
+    2,0,0,0,1,0,0,-1528,0,0,-663,-675,
+    -2045,2,-1044,0,0,-1245,8,0,0,0,0,-1431,
+    -1870,0,2,0,3,-1897,-1211,1,-95,-1935,3,0,
+    0,-35,2,0,2,0,-1323,0,-1889,-752,0,1,
+    -1344,-412,23,3,-773,0,0,10,-635,0,0,-1976,
+    -1520,-1989,15,-1433,6,-571,0,2,0,-105,-665,2,
+    0,-749,-269,0,0,0,0,-1674,2,-1217,0,-1701,
+    -1066,-1425,-1412,-1319,0,0,-354,1,-479,0,-1557,2,
+    -897,0,0,0,-1560,-2048,-2008,-722,-816,0,-1120,-1203,
+    1,1,1,-526,5,2,-1695,4,-796,2,-1434,-1359,
+    0,-314,0,0,-519,2,0,0,0,-1115,0,1,
+    4,-1596,-1619,0,3,0,-533,-368,0,0,6,1,
+    10,3,-1868,-404,0,0,0,-1186,0,-744,0,7,
+    0,0,-1996,13,21,0,5,0,-655,0,0,0,
+    -1847,0,1,3,6,-536,-695,0,0,7,0,0,
+    -1938,6,8,-138,8,-1310,0,2,-718,-1730,0,-716,
+    -1614,-1153,-1751,-705,0,0,18,0,-1365,-1648,-1899,0,
+    0,9,1,0,2,1,0,-1165,-1469,4,2,-509,
+    1,0,-513,-445,0,2,4,3,0,0,0,2,
+    -1599,1,0,-1039,2,0,0,4,
+};
+static const uint16_t es_v[] = {
+    0,1821,1149,0,1854,954,0,1470,195,477,1166,0,
+    282,0,0,1815,0,1228,78,0,1993,464,0,831,
+    1269,1074,990,0,1717,1918,0,0,210,1484,633,1893,
+    755,348,1485,2039,319,0,1763,545,0,0,680,0,
+    1514,1005,1259,1987,945,0,0,555,1826,625,0,592,
+    1941,0,332,0,0,0,1172,0,1204,1712,876,1578,
+    0,0,1737,0,0,0,868,0,1261,0,1226,0,
+    0,1267,1133,1540,565,639,1360,329,72,0,1494,0,
+    0,0,0,251,0,1332,1614,867,845,0,0,1206,
+    753,826,2028,1730,256,590,1619,768,0,121,1483,1616,
+    1890,0,69,1281,1028,0,407,1701,0,1139,1097,1324,
+    1935,806,0,1036,1829,0,1562,972,985,678,0,249,
+    259,0,0,0,910,0,0,1126,1113,0,854,0,
+    646,833,0,493,1450,745,0,0,1515,28,861,0,
+    184,1503,981,0,0,0,1511,1190,297,1150,961,1084,
+    1903,349,0,1301,1872,0,1809,1205,335,0,757,1263,
+    389,597,59,0,0,206,489,0,0,1022,0,0,
+    880,447,0,0,301,790,1853,1471,0,0,0,0,
+    0,472,0,507,0,0,516,1542,1573,1003,0,1862,
+    1445,544,0,1779,2016,708,1457,968,0,265,1044,0,
+    0,1530,0,1670,0,695,0,514,0,0,1032,0,
+    1766,345,1627,759,1677,957,605,1602,673,1019,1754,0,
+    1695,0,0,589,401,1580,0,1698,1916,192,536,1027,
+    796,1939,1359,209,506,0,2010,0,2030,1553,1783,471,
+    0,0,0,1436,1098,0,0,1964,651,0,0,864,
+    1276,1283,191,24,1759,160,0,2011,720,1537,0,0,
+    1429,643,1421,0,1385,1605,1883,1526,119,0,1856,0,
+    1456,0,1733,791,0,64,0,1720,0,1409,1380,1466,
+    1548,240,780,1952,0,0,0,0,1170,894,0,1601,
+    2026,0,1814,836,969,0,1493,75,1325,1092,0,798,
+    60,129,1087,0,789,156,626,1565,0,0,0,0,
+    1029,0,1272,737,1915,0,1367,0,0,0,0,146,
+    0,0,1233,1507,1229,1194,0,1755,0,0,1270,775,
+    0,1127,595,1212,86,0,0,1474,0,0,139,0,
+    0,1499,0,0,0,0,368,0,0,0,0,0,
+    0,1655,31,0,1823,0,944,0,0,0,0,0,
+    0,1837,0,2009,0,0,1959,0,0,280,0,219,
+    291,619,1055,2013,138,1082,1121,0,1830,0,0,1053,
+    1796,0,0,0,0,802,99,0,1159,1557,1874,0,
+    1716,1479,663,423,1171,312,1335,321,0,2002,0,973,
+    0,0,107,1178,0,0,1932,479,0,0,804,0,
+    0,0,0,230,706,788,0,0,0,0,827,0,
+    0,0,0,0,1524,769,0,0,1650,0,0,0,
+    1747,1824,0,1545,1323,0,283,690,754,116,231,1674,
+    0,473,0,928,819,2037,0,0,1217,600,1107,0,
+    1775,0,0,0,1153,863,0,0,1161,1629,0,1641,
+    0,1355,114,0,0,0,0,183,10,615,56,1051,
+    0,1079,154,1240,0,0,1855,1555,0,1982,1608,0,
+    175,0,630,2018,1965,377,0,0,1586,0,0,0,
+    1741,0,0,0,1451,0,0,647,0,294,1731,2029,
+    719,1739,0,1279,0,0,0,672,1768,0,0,602,
+    140,1486,1840,1039,505,0,975,1539,0,0,295,689,
+    0,549,0,1123,0,1101,0,1718,222,0,1704,1999,
+    0,1725,0,1845,0,0,0,0,334,0,0,22,
+    1685,1871,0,0,731,1058,397,491,1709,943,1781,0,
+    1095,0,227,667,1568,908,0,0,0,1460,1296,0,
+    487,126,0,1679,1634,1014,0,0,0,610,668,958,
+    0,996,0,172,44,858,1962,805,47,734,0,1000,
+    1784,0,0,1891,927,344,840,1337,0,0,0,1940,
+    53,0,0,1523,1882,0,1105,359,813,739,1348,451,
+    0,0,0,1168,0,0,420,0,2042,1770,638,0,
+    0,1372,0,1024,1563,1831,0,0,0,1034,190,274,
+    1350,1319,0,0,46,1805,133,0,71,0,1340,919,
+    0,661,559,1390,676,0,1632,2014,1536,275,0,0,
+    0,229,735,2031,1434,612,1868,208,1099,0,1913,1699,
+    1132,1317,870,1628,799,914,0,36,340,246,1870,822,
+    0,0,1812,1004,211,49,1958,773,649,0,0,33,
+    0,707,517,0,0,1799,1688,1922,0,1073,0,786,
+    0,1395,55,1341,1789,430,1798,1230,1876,0,1645,0,
+    358,1495,1081,255,865,0,1500,666,455,801,0,0,
+    286,0,1262,1463,1566,656,0,1960,20,384,1596,1813,
+    0,179,0,0,0,879,1191,1458,1972,1352,1966,0,
+    261,0,912,1349,0,1518,457,0,0,1371,32,1945,
+    0,0,1895,1648,29,1193,0,729,0,437,285,553,
+    0,686,0,0,1531,950,0,1219,0,793,0,1991,
+    0,1167,1652,641,0,540,1646,0,424,0,1093,0,
+    1362,0,1696,1448,440,513,0,998,601,0,1189,1604,
+    0,0,0,0,636,0,1623,635,0,0,164,0,
+    0,1338,1742,581,98,0,387,309,1011,1140,0,999,
+    0,182,0,381,1333,823,0,1841,2003,214,105,1006,
+    1179,0,1408,0,0,0,0,481,1067,0,1414,0,
+    526,1249,0,1544,1892,0,0,0,1811,1151,681,1969,
+    4,0,1926,537,1294,1703,383,1122,188,483,418,326,
+    0,0,0,0,2004,0,902,1827,1808,1631,1145,653,
+    0,849,497,0,657,0,1131,0,1550,1791,323,0,
+    0,0,193,35,0,162,1835,1368,0,0,361,0,
+    1339,1681,0,1656,112,1866,355,839,0,1905,1025,302,
+    1657,0,462,1994,409,111,76,398,558,0,0,373,
+    0,0,0,1816,363,1347,688,0,375,0,0,0,
+    617,0,0,1104,0,1439,1957,1056,0,469,0,1847,
+    766,0,984,1455,682,0,0,2033,0,1676,0,228,
+    108,1534,1253,0,0,904,1476,0,465,510,152,1144,
+    611,234,0,1976,456,0,926,884,644,979,771,770,
+    763,0,0,0,0,2019,0,0,1570,1378,0,0,
+    1129,1567,1621,1609,2034,0,1310,0,0,1454,1929,87,
+    0,0,599,1620,746,1237,0,0,0,0,1419,0,
+    1089,0,0,458,1498,0,0,0,0,1788,877,0,
+    413,875,1076,604,1054,0,0,628,697,0,343,1047,
+    1617,2012,1328,0,816,0,993,494,586,0,0,205,
+    588,713,1488,79,0,794,233,1357,2020,1048,1672,1635,
+    1535,1295,1803,495,502,1487,1587,951,1689,594,0,0,
+    0,17,0,1183,470,550,150,0,618,1265,0,937,
+    406,2005,1353,0,0,1209,2006,1416,0,287,0,1516,
+    1096,1231,0,1901,40,0,236,253,0,1440,1312,0,
+    1978,1825,2045,1091,1508,1480,289,832,0,946,176,476,
+    1642,931,936,0,0,241,776,0,834,1273,1496,587,
+    0,101,0,1585,272,1644,12,1345,1063,803,452,0,
+    0,125,127,1060,0,0,1478,893,388,68,787,0,
+    0,1946,1075,0,726,0,1049,1990,0,1382,356,0,
+    0,1356,0,0,1839,58,0,186,1425,1973,0,0,
+    404,422,0,153,1268,982,824,1369,1597,683,1354,578,
+    1010,1200,1394,1453,808,0,498,1753,0,1529,0,882,
+    0,1492,1980,1033,0,0,23,0,1085,1787,0,0,
+    248,1842,0,528,1852,1762,1721,0,0,0,428,1512,
+    0,0,61,889,1112,0,1109,923,1693,960,0,30,
+    1793,0,0,296,0,1589,1163,1169,84,2015,74,0,
+    237,953,467,853,347,216,1431,1100,165,0,1379,11,
+    70,0,531,426,316,1748,1304,677,0,1773,551,1520,
+    624,0,1215,14,0,991,1810,1176,1020,963,764,1593,
+    290,0,0,0,0,1756,538,207,817,554,224,777,
+    1571,0,1910,949,42,0,180,1707,0,0,0,0,
+    0,1680,947,0,1844,1222,315,1899,0,1986,0,0,
+    0,1697,1740,1884,257,546,883,1299,585,1291,0,917,
+    0,366,1664,0,1174,0,583,1637,1794,499,1449,324,
+    0,1221,1546,1248,866,1021,0,821,541,1088,862,1418,
+    0,687,1124,1192,0,631,1103,0,1996,1017,684,1849,
+    1772,433,1522,0,0,0,435,1817,0,895,1998,0,
+    1232,338,0,1365,0,0,1956,939,0,1128,1428,856,
+    1393,0,563,0,1751,0,0,732,1489,655,527,427,
+    0,1790,0,19,886,0,0,0,1384,0,0,1603,
+    417,608,0,891,0,1156,1064,0,1833,1290,0,637,
+    89,1155,0,0,0,1558,0,0,0,1630,500,0,
+    0,0,325,0,0,0,659,1880,933,1713,874,100,
+    1848,0,277,0,1851,0,113,0,459,1196,0,1257,
+    0,0,0,0,781,405,0,0,130,1447,1732,0,
+    1931,155,0,560,0,0,0,0,942,741,556,797,
+    1583,0,547,1758,263,1678,1510,320,0,0,576,0,
+    278,0,395,724,0,0,167,0,909,859,0,0,
+    1061,0,0,948,161,1902,2038,122,800,0,0,0,
+    701,1638,0,903,744,1475,0,1130,1386,835,443,1561,
+    1942,0,1660,584,1286,0,782,0,0,0,539,419,
+    9,41,1924,1626,163,1983,0,1410,1760,0,1399,1018,
+    0,609,1588,1208,922,747,0,837,0,0,0,1832,
+    396,0,1326,0,977,0,266,0,0,1735,0,0,
+    0,1877,1278,1001,0,848,0,911,0,0,0,887,
+    0,0,0,692,1948,0,0,292,1351,1574,1997,0,
+    0,0,1923,1907,83,1256,1201,1285,645,1802,0,244,
+    132,1715,0,0,0,0,425,642,299,0,1392,0,
+    702,1691,727,62,1819,0,1719,0,0,0,843,2035,
+    1313,0,807,1412,888,0,0,1334,0,2000,1422,1311,
+    1752,929,0,0,596,0,0,260,1277,1981,1383,0,
+    1569,1786,1481,269,1307,5,0,0,1396,0,0,1722,
+    148,1861,1336,0,0,0,0,446,492,0,703,52,
+    303,1246,177,0,0,0,1970,1669,0,1117,376,1710,
+    213,1102,1517,524,1551,0,1223,1243,73,1985,575,1234,
+    0,0,1375,0,852,0,0,1749,1271,932,328,223,
+    1857,416,1116,480,1157,0,0,461,574,0,0,486,
+    0,0,1473,994,0,1211,1245,0,1320,0,860,1950,
+    0,0,0,1665,327,254,1889,955,415,267,779,0,
+    1708,0,317,0,1403,1989,1370,1875,1329,881,1564,0,
+    0,778,0,170,850,722,515,0,1692,1444,0,0,
+    0,941,2040,809,519,258,1714,0,1012,1388,1606,1560,
+    1407,0,622,1600,1165,1274,0,0,1083,482,1420,0,
+    0,1305,197,640,0,271,2017,0,1016,1198,0,1887,
+    988,1579,235,1068,976,1297,1154,1659,1785,307,1398,0,
+    386,488,174,851,0,598,924,0,0,700,0,38,
+    0,783,85,1838,1746,0,1472,0,0,784,0,1415,
+    716,1663,0,0,0,1490,0,1743,0,1928,762,1108,
+    0,915,897,1592,1745,1214,710,0,1066,0,2,1726,
+    0,552,0,336,220,0,0,0,351,0,0,1640,
+    504,1247,0,378,225,812,0,1611,
+};
+
 static const struct words es_words = {
     2048,
     11,
     false,
     (const char *)es_,
     0, /* Constant string */
-    es_i
+    es_i,
+    es_g,
+    es_v
 };
@@ -2858,14 +2858,93 @@ int wally_descriptor_to_script_get_maximum_length(
     return WALLY_OK;
 }
 
-int wally_descriptor_to_addresses(const struct wally_descriptor *descriptor,
-                                  uint32_t variant, uint32_t multi_index,
-                                  uint32_t child_num, uint32_t flags,
-                                  char **addresses, size_t num_addresses)
+/* Number of addresses generated by each task */
+#define ADDRESSES_CHUNK 32
+
+struct addresses_batch {
+    const struct wally_descriptor *descriptor;
+    uint32_t variant;
+    uint32_t multi_index;
+    uint32_t child_num;
+    char **addresses;
+    char *str_out;
+    size_t num_addresses;
+    int *rets; /* Result of each task */
+};
+
+/* Generate a chunk of addresses. Each task uses its own copy of the
+ * descriptors context, since key derivation writes to its path buffer */
+static void addresses_task(void *batch, size_t chunk)
 {
-    ms_ctx ctx;
+    const struct addresses_batch *b = (const struct addresses_batch *)batch;
+    size_t i = chunk * ADDRESSES_CHUNK, end = i + ADDRESSES_CHUNK, written;
     unsigned char *p;
-    size_t i, written;
+    ms_ctx ctx;
+    int ret = WALLY_OK;
+
+    if (end > b->num_addresses)
+        end = b->num_addresses;
+    memcpy(&ctx, b->descriptor, sizeof(ctx));
+    ctx.variant = b->variant;
+    ctx.multi_index = b->multi_index;
+    ctx.path_buff = NULL;
+    if (!(p = wally_malloc(ctx.script_len)) ||
+        (ctx.max_path_elems &&
+         !(ctx.path_buff = wally_malloc(ctx.max_path_elems * sizeof(uint32_t)))))
+        ret = WALLY_ENOMEM;
+
+    for (; ret == WALLY_OK && i < end; ++i) {
+        ctx.child_num = b->child_num + i;
+        /* The top node has no parent, so generate from it directly
+         * rather than through node_generate_script, which modifies it */
+        written = 0;
+        ret = generate_script(&ctx, ctx.top_node, p, ctx.script_len, &written);
+        if (ret != WALLY_OK)
+            break;
+        if (written > ctx.script_len) {
+            ret = WALLY_ERROR; /* Not enough room - should not happen! */
+            break;
+        }
+        /* Generate the address corresponding to this script */
+        if (b->addresses) {
+            ret = wally_scriptpubkey_to_address(p, written,
+                                                ctx.addr_ver->network,
+                                                &b->addresses[i]);
+            if (ret == WALLY_EINVAL)
+                ret = wally_addr_segwit_from_bytes(p, written,
+                                                   ctx.addr_ver->family,
+                                                   0, &b->addresses[i]);
+        } else {
+            char *slot = b->str_out + i * WALLY_SEGWIT_ADDRESS_MAX_LEN;
+            size_t str_len;
+            ret = wally_scriptpubkey_to_address_into(p, written,
+                                                     ctx.addr_ver->network,
+                                                     slot, WALLY_SEGWIT_ADDRESS_MAX_LEN,
+                                                     &str_len);
+            if (ret == WALLY_EINVAL)
+                ret = wally_addr_segwit_from_bytes_into(p, written,
+                                                        ctx.addr_ver->family, 0,
+                                                        slot, WALLY_SEGWIT_ADDRESS_MAX_LEN,
+                                                        &str_len);
+            if (ret == WALLY_OK && str_len > WALLY_SEGWIT_ADDRESS_MAX_LEN)
+                ret = WALLY_ERROR; /* Not enough room - should not happen! */
+        }
+    }
+    b->rets[chunk] = ret;
+    wally_free(ctx.path_buff);
+    wally_free(p);
+}
+
+/* Generate addresses into either an array of allocated strings, or
+ * into fixed size slots of WALLY_SEGWIT_ADDRESS_MAX_LEN bytes in str_out */
+static int descriptor_to_addresses_impl(const struct wally_descriptor *descriptor,
+                                        uint32_t variant, uint32_t multi_index,
+                                        uint32_t child_num, uint32_t flags,
+                                        char **addresses, char *str_out,
+                                        size_t num_addresses)
+{
+    struct addresses_batch b;
+    size_t i, num_chunks;
     int ret = WALLY_OK;
 
     if (!descriptor || !descriptor->addr_ver || !descriptor->script_len ||
@@ -2874,12 +2953,13 @@ int wally_descriptor_to_addresses(const struct wally_descriptor *descriptor,
         (uint64_t)child_num + num_addresses >= BIP32_INITIAL_HARDENED_CHILD ||
         (child_num && !(descriptor->features & WALLY_MS_IS_RANGED)) ||
         multi_index >= descriptor->num_multipaths ||
-        flags || !addresses || !num_addresses)
+        flags || (!addresses && !str_out) || !num_addresses)
         return WALLY_EINVAL;
 
-    wally_clear(addresses, num_addresses * sizeof(*addresses));
-    if (!(p = wally_malloc(descriptor->script_len)))
-        return WALLY_ENOMEM;
+    if (addresses)
+        wally_clear(addresses, num_addresses * sizeof(*addresses));
+    else
+        wally_clear(str_out, num_addresses * WALLY_SEGWIT_ADDRESS_MAX_LEN);
 
     if (descriptor->features & WALLY_MS_IS_ELEMENTS) {
         /* Disable Elements address generation until:
@@ -2888,44 +2968,70 @@ int wally_descriptor_to_addresses(const struct wally_descriptor *descriptor,
          */
         return WALLY_ERROR;
     }
-    memcpy(&ctx, descriptor, sizeof(ctx));
-    ctx.variant = variant;
-    if (ctx.max_path_elems &&
-        !(ctx.path_buff = wally_malloc(ctx.max_path_elems * sizeof(uint32_t))))
-        return WALLY_ENOMEM;
 
-    for (i = 0; ret == WALLY_OK && i < num_addresses; ++i) {
-        ctx.child_num = child_num + i;
-        ctx.multi_index = multi_index;
-        ret = node_generate_script(&ctx, 0, 0, p, ctx.script_len, &written);
-        if (ret == WALLY_OK) {
-            if (written > ctx.script_len)
-                ret = WALLY_ERROR; /* Not enough room - should not happen! */
-            else {
-                /* Generate the address corresponding to this script */
-                ret = wally_scriptpubkey_to_address(p, written,
-                                                    ctx.addr_ver->network,
-                                                    &addresses[i]);
-                if (ret == WALLY_EINVAL)
-                    ret = wally_addr_segwit_from_bytes(p, written,
-                                                       ctx.addr_ver->family,
-                                                       0, &addresses[i]);
-            }
-        }
-    }
+    b.descriptor = descriptor;
+    b.variant = variant;
+    b.multi_index = multi_index;
+    b.child_num = child_num;
+    b.addresses = addresses;
+    b.str_out = str_out;
+    b.num_addresses = num_addresses;
+    num_chunks = (num_addresses + ADDRESSES_CHUNK - 1) / ADDRESSES_CHUNK;
+    if (!(b.rets = wally_calloc(num_chunks * sizeof(int))))
+        return WALLY_ENOMEM;
+    run_tasks(addresses_task, &b, num_chunks);
+    for (i = 0; ret == WALLY_OK && i < num_chunks; ++i)
+        ret = b.rets[i];
+    wally_free(b.rets);
 
     if (ret != WALLY_OK) {
         /* Free any partial results */
-        for (i = 0; i < num_addresses; ++i) {
-            wally_free_string(addresses[i]);
-            addresses[i] = NULL;
-        }
+        if (addresses) {
+            for (i = 0; i < num_addresses; ++i) {
+                wally_free_string(addresses[i]);
+                addresses[i] = NULL;
+            }
+        } else
+            wally_clear(str_out, num_addresses * WALLY_SEGWIT_ADDRESS_MAX_LEN);
     }
-    wally_free(ctx.path_buff);
-    wally_free(p);
     return ret;
 }
 
+static int descriptor_to_addresses(const struct wally_descriptor *descriptor,
+                                   uint32_t variant, uint32_t multi_index,
+                                   uint32_t child_num, uint32_t flags,
+                                   char **addresses, char *str_out,
+                                   size_t num_addresses)
+{
+    int ret;
+    STATS_BEGIN(WALLY_STATS_DESCRIPTOR_ADDRESSES);
+    ret = descriptor_to_addresses_impl(descriptor, variant, multi_index, child_num,
+                                       flags, addresses, str_out, num_addresses);
+    STATS_END();
+    return ret;
+}
+
+int wally_descriptor_to_addresses(const struct wally_descriptor *descriptor,
+                                  uint32_t variant, uint32_t multi_index,
+                                  uint32_t child_num, uint32_t flags,
+                                  char **addresses, size_t num_addresses)
+{
+    return descriptor_to_addresses(descriptor, variant, multi_index, child_num,
+                                   flags, addresses, NULL, num_addresses);
+}
+
+int wally_descriptor_to_addresses_into(const struct wally_descriptor *descriptor,
+                                       uint32_t variant, uint32_t multi_index,
+                                       uint32_t child_num, uint32_t flags,
+                                       char *output, size_t len)
+{
+    if (!output || !len || len % WALLY_SEGWIT_ADDRESS_MAX_LEN)
+        return WALLY_EINVAL;
+    return descriptor_to_addresses(descriptor, variant, multi_index, child_num,
+                                   flags, NULL, output,
+                                   len / WALLY_SEGWIT_ADDRESS_MAX_LEN);
+}
+
 int wally_descriptor_to_address(const struct wally_descriptor *descriptor,
                                 uint32_t variant, uint32_t multi_index,
                                 uint32_t child_num, uint32_t flags,
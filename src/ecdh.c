@@ -1,6 +1,9 @@
 #include "internal.h"
 #include <include/wally_crypto.h>
 #include <secp256k1_ecdh.h>
+#include "ccan/ccan/crypto/sha256/sha256.h"
+#include <ccan/endian/endian.h>
+#include "script_int.h"
 
 int wally_ecdh(const unsigned char *pub_key, size_t pub_key_len,
                const unsigned char *priv_key, size_t priv_key_len,
@@ -28,3 +31,345 @@ int wally_ecdh(const unsigned char *pub_key, size_t pub_key_len,
     wally_clear(&pub, sizeof(pub));
     return ret;
 }
+
+/* SHA256(BIP0352/Inputs) */
+static const unsigned char BIP352_INPUTS_SHA256[SHA256_LEN] = {
+    0x1e, 0x7b, 0x96, 0xeb, 0x16, 0x0a, 0x68, 0x81, 0x9f, 0x97, 0x76, 0x4b, 0x43, 0xd5, 0xd7, 0x7e,
+    0x66, 0x59, 0xd7, 0x58, 0x77, 0x9d, 0x43, 0xa8, 0xa7, 0x75, 0x5f, 0x5b, 0xe4, 0x5a, 0x7e, 0x33
+};
+/* SHA256(BIP0352/SharedSecret) */
+static const unsigned char BIP352_SHARED_SECRET_SHA256[SHA256_LEN] = {
+    0x9f, 0x6d, 0x80, 0x11, 0x58, 0x1e, 0xb6, 0x2d, 0x72, 0xe6, 0x13, 0x60, 0x4c, 0x33, 0x0d, 0xca,
+    0x2a, 0x0b, 0xd3, 0x49, 0xe2, 0x4a, 0x46, 0xd9, 0xa2, 0xef, 0x24, 0xb9, 0xa9, 0x8f, 0x41, 0xbd
+};
+
+#define BIP352_NO_MATCH 0xffffffff
+
+/* A batch of transactions being scanned for silent payments */
+struct bip352_scan {
+    const secp256k1_context *ctx; /* The callers context, shared by all tasks */
+    const unsigned char *scan_key;
+    secp256k1_pubkey spend_pub_key;
+    const unsigned char *outpoints;
+    const unsigned char *pub_keys;
+    const uint32_t *num_pub_keys;
+    const unsigned char *output_keys;
+    const uint32_t *num_output_keys;
+    size_t *pub_key_offsets;    /* Index of each tx's first input key */
+    size_t *output_key_offsets; /* Index of each tx's first output key */
+    /* Tagged hash contexts with the tag already hashed, shared by all txs */
+    struct sha256_ctx inputs_ctx;
+    struct sha256_ctx shared_secret_ctx;
+    /* Open addressing hash set of output key indices + 1, 0 if empty */
+    uint32_t *set;
+    size_t set_mask;
+    uint64_t set_key[2]; /* SipHash key, secret to the receiver */
+    /* Per output key: the index of the output matched by tweak k */
+    uint32_t *matches;
+    unsigned char *tweaks;
+    int *rets;
+};
+
+static void bip352_tagged_hash_init(struct sha256_ctx *ctx,
+                                    const unsigned char *tag_hash)
+{
+    sha256_init(ctx);
+    sha256_update(ctx, tag_hash, SHA256_LEN);
+    sha256_update(ctx, tag_hash, SHA256_LEN);
+}
+
+#define SIP_ROTL(x, b) (((x) << (b)) | ((x) >> (64 - (b))))
+
+#define SIP_ROUND(v0, v1, v2, v3) do { \
+    v0 += v1; v1 = SIP_ROTL(v1, 13); v1 ^= v0; v0 = SIP_ROTL(v0, 32); \
+    v2 += v3; v3 = SIP_ROTL(v3, 16); v3 ^= v2; \
+    v0 += v3; v3 = SIP_ROTL(v3, 21); v3 ^= v0; \
+    v2 += v1; v1 = SIP_ROTL(v1, 17); v1 ^= v2; v2 = SIP_ROTL(v2, 32); \
+    } while (0)
+
+/* SipHash-2-4 of an x-only key, so every byte of the key affects its slot */
+static size_t bip352_set_hash(const struct bip352_scan *s, const unsigned char *x)
+{
+    uint64_t v0 = s->set_key[0] ^ 0x736f6d6570736575ull;
+    uint64_t v1 = s->set_key[1] ^ 0x646f72616e646f6dull;
+    uint64_t v2 = s->set_key[0] ^ 0x6c7967656e657261ull;
+    uint64_t v3 = s->set_key[1] ^ 0x7465646279746573ull;
+    uint64_t m;
+    size_t i;
+
+    for (i = 0; i <= EC_XONLY_PUBLIC_KEY_LEN; i += sizeof(m)) {
+        if (i == EC_XONLY_PUBLIC_KEY_LEN)
+            m = (uint64_t)EC_XONLY_PUBLIC_KEY_LEN << 56; /* Length block */
+        else {
+            memcpy(&m, x + i, sizeof(m));
+            m = le64_to_cpu(m);
+        }
+        v3 ^= m;
+        SIP_ROUND(v0, v1, v2, v3);
+        SIP_ROUND(v0, v1, v2, v3);
+        v0 ^= m;
+    }
+    v2 ^= 0xff;
+    for (i = 0; i < 4; ++i)
+        SIP_ROUND(v0, v1, v2, v3);
+    return (size_t)(v0 ^ v1 ^ v2 ^ v3) & s->set_mask;
+}
+
+static void bip352_set_insert(struct bip352_scan *s, size_t index)
+{
+    size_t i = bip352_set_hash(s, s->output_keys + index * EC_XONLY_PUBLIC_KEY_LEN);
+    while (s->set[i])
+        i = (i + 1) & s->set_mask;
+    s->set[i] = (uint32_t)index + 1;
+}
+
+/* Find an output key of a tx matching x, returning its index in the tx */
+static uint32_t bip352_set_find(const struct bip352_scan *s, size_t tx_index,
+                                const unsigned char *x)
+{
+    const size_t first = s->output_key_offsets[tx_index];
+    const size_t last = first + s->num_output_keys[tx_index];
+    size_t i = bip352_set_hash(s, x);
+
+    while (s->set[i]) {
+        const size_t index = s->set[i] - 1;
+        if (index >= first && index < last &&
+            !memcmp(s->output_keys + index * EC_XONLY_PUBLIC_KEY_LEN, x,
+                    EC_XONLY_PUBLIC_KEY_LEN))
+            return (uint32_t)(index - first);
+        i = (i + 1) & s->set_mask;
+    }
+    return BIP352_NO_MATCH;
+}
+
+/* Compute the shared secret for a tx, input_hash * b_scan * A.
+ * Returns WALLY_OK if the tx is eligible, WALLY_ERROR if not */
+static int bip352_shared_secret(const struct bip352_scan *s, size_t tx_index,
+                                unsigned char *shared_secret)
+{
+    const size_t num_keys = s->num_pub_keys[tx_index];
+    const unsigned char *pub_keys = s->pub_keys + s->pub_key_offsets[tx_index] * EC_PUBLIC_KEY_LEN;
+    secp256k1_pubkey *keys, **key_ptrs, sum;
+    struct sha256_ctx ctx;
+    struct sha256 input_hash;
+    unsigned char ser[EC_PUBLIC_KEY_LEN], tweak[EC_PRIVATE_KEY_LEN];
+    size_t i, ser_len = sizeof(ser);
+    int ret = WALLY_OK;
+
+    if (!num_keys)
+        return WALLY_ERROR; /* No eligible inputs */
+
+    keys = wally_malloc(num_keys * (sizeof(*keys) + sizeof(*key_ptrs)));
+    if (!keys)
+        return WALLY_ENOMEM;
+    key_ptrs = (secp256k1_pubkey **)(keys + num_keys);
+
+    for (i = 0; ret == WALLY_OK && i < num_keys; ++i) {
+        if (!pubkey_parse(&keys[i], pub_keys + i * EC_PUBLIC_KEY_LEN, EC_PUBLIC_KEY_LEN))
+            ret = WALLY_EINVAL;
+        key_ptrs[i] = &keys[i];
+    }
+    /* Sum the input keys: A = a_1 * G + ... + a_n * G */
+    if (ret == WALLY_OK &&
+        (!pubkey_combine(&sum, (const secp256k1_pubkey *const *)key_ptrs, num_keys) ||
+         !pubkey_serialize(ser, &ser_len, &sum, PUBKEY_COMPRESSED)))
+        ret = WALLY_ERROR; /* A is the point at infinity */
+
+    if (ret == WALLY_OK) {
+        /* input_hash = hash_BIP0352/Inputs(outpoint_L || A) */
+        memcpy(&ctx, &s->inputs_ctx, sizeof(ctx));
+        sha256_update(&ctx, s->outpoints + tx_index * WALLY_BIP352_OUTPOINT_LEN,
+                      WALLY_BIP352_OUTPOINT_LEN);
+        sha256_update(&ctx, ser, sizeof(ser));
+        sha256_done(&ctx, &input_hash);
+
+        /* Multiply the scan key by input_hash once, so that only a single
+         * point multiplication is needed per transaction */
+        memcpy(tweak, s->scan_key, sizeof(tweak));
+        if (!seckey_tweak_mul(tweak, input_hash.u.u8) ||
+            !secp256k1_ec_pubkey_tweak_mul(s->ctx, &sum, tweak) ||
+            !pubkey_serialize(shared_secret, &ser_len, &sum, PUBKEY_COMPRESSED))
+            ret = WALLY_ERROR; /* Invalid input_hash */
+    }
+
+    wally_clear_4(keys, num_keys * sizeof(*keys), &sum, sizeof(sum),
+                  &ctx, sizeof(ctx), tweak, sizeof(tweak));
+    wally_free(keys);
+    return ret;
+}
+
+static void bip352_scan_tx(void *ctx, size_t tx_index)
+{
+    struct bip352_scan *s = (struct bip352_scan *)ctx;
+    const size_t num_outputs = s->num_output_keys[tx_index];
+    const size_t offset = s->output_key_offsets[tx_index];
+    unsigned char shared_secret[EC_PUBLIC_KEY_LEN], ser[EC_PUBLIC_KEY_LEN];
+    struct sha256_ctx sha_ctx;
+    struct sha256 tweak;
+    secp256k1_pubkey p_k;
+    uint32_t k;
+    size_t ser_len = sizeof(ser);
+    int ret;
+
+    if (!num_outputs)
+        return; /* Nothing to match */
+
+    ret = bip352_shared_secret(s, tx_index, shared_secret);
+    if (ret != WALLY_OK) {
+        /* Ineligible transactions are skipped, not an error */
+        s->rets[tx_index] = ret == WALLY_ERROR ? WALLY_OK : ret;
+        return;
+    }
+
+    for (k = 0; k < num_outputs; ++k) {
+        unsigned char k_be[sizeof(uint32_t)];
+        uint32_t match;
+
+        uint32_to_be_bytes(k, k_be);
+
+        /* t_k = hash_BIP0352/SharedSecret(ecdh_shared_secret || ser32(k)) */
+        memcpy(&sha_ctx, &s->shared_secret_ctx, sizeof(sha_ctx));
+        sha256_update(&sha_ctx, shared_secret, sizeof(shared_secret));
+        sha256_update(&sha_ctx, k_be, sizeof(k_be));
+        sha256_done(&sha_ctx, &tweak);
+
+        /* P_k = B_spend + t_k * G */
+        memcpy(&p_k, &s->spend_pub_key, sizeof(p_k));
+        if (!pubkey_tweak_add(s->ctx, &p_k, tweak.u.u8) ||
+            !pubkey_serialize(ser, &ser_len, &p_k, PUBKEY_COMPRESSED))
+            break; /* Invalid tweak: cannot happen for a valid hash */
+
+        match = bip352_set_find(s, tx_index, ser + 1);
+        if (match == BIP352_NO_MATCH)
+            break; /* No payment for k, so none for any larger k */
+        s->matches[offset + k] = match;
+        memcpy(s->tweaks + (offset + k) * EC_PRIVATE_KEY_LEN, tweak.u.u8,
+               EC_PRIVATE_KEY_LEN);
+    }
+    wally_clear_3(shared_secret, sizeof(shared_secret), &sha_ctx, sizeof(sha_ctx),
+                  &tweak, sizeof(tweak));
+}
+
+int wally_bip352_scan(const unsigned char *scan_priv_key, size_t scan_priv_key_len,
+                      const unsigned char *spend_pub_key, size_t spend_pub_key_len,
+                      const unsigned char *outpoints, size_t outpoints_len,
+                      const unsigned char *pub_keys, size_t pub_keys_len,
+                      const uint32_t *num_pub_keys, size_t num_pub_keys_len,
+                      const unsigned char *output_keys, size_t output_keys_len,
+                      const uint32_t *num_output_keys, size_t num_output_keys_len,
+                      uint32_t flags,
+                      unsigned char *bytes_out, size_t len, size_t *written)
+{
+    const size_t num_txs = num_pub_keys_len;
+    struct bip352_scan s;
+    struct sha256_ctx set_key_ctx;
+    struct sha256 set_key;
+    size_t i, j, total_pub_keys = 0, total_outputs = 0, set_size = 1;
+    unsigned char *p = bytes_out;
+    int ret = WALLY_OK;
+
+    if (written)
+        *written = 0;
+    if (!scan_priv_key || scan_priv_key_len != EC_PRIVATE_KEY_LEN ||
+        !spend_pub_key || spend_pub_key_len != EC_PUBLIC_KEY_LEN ||
+        !num_txs || !outpoints || outpoints_len != num_txs * WALLY_BIP352_OUTPOINT_LEN ||
+        !num_pub_keys || BYTES_INVALID(pub_keys, pub_keys_len) ||
+        !num_output_keys || num_output_keys_len != num_txs ||
+        BYTES_INVALID(output_keys, output_keys_len) || flags ||
+        !bytes_out || !len || !written)
+        return WALLY_EINVAL;
+
+    for (i = 0; i < num_txs; ++i) {
+        total_pub_keys += num_pub_keys[i];
+        total_outputs += num_output_keys[i];
+    }
+    if (pub_keys_len != total_pub_keys * EC_PUBLIC_KEY_LEN ||
+        output_keys_len != total_outputs * EC_XONLY_PUBLIC_KEY_LEN ||
+        total_outputs >= BIP352_NO_MATCH ||
+        !seckey_verify(scan_priv_key))
+        return WALLY_EINVAL;
+
+    if (!total_outputs)
+        return WALLY_OK; /* No outputs to match */
+
+    memset(&s, 0, sizeof(s));
+    if (!pubkey_parse(&s.spend_pub_key, spend_pub_key, spend_pub_key_len))
+        return WALLY_EINVAL;
+    if (!(s.ctx = secp_ctx()))
+        return WALLY_ENOMEM;
+    s.scan_key = scan_priv_key;
+    s.outpoints = outpoints;
+    s.pub_keys = pub_keys;
+    s.num_pub_keys = num_pub_keys;
+    s.output_keys = output_keys;
+    s.num_output_keys = num_output_keys;
+    bip352_tagged_hash_init(&s.inputs_ctx, BIP352_INPUTS_SHA256);
+    bip352_tagged_hash_init(&s.shared_secret_ctx, BIP352_SHARED_SECRET_SHA256);
+
+    while (set_size < total_outputs * 2)
+        set_size <<= 1;
+    s.set_mask = set_size - 1;
+    /* Key the set hash with a fresh key for each set, derived from the
+     * secret scan key and the batch being scanned. Senders cannot compute
+     * it, so they cannot choose outputs that share probe chains */
+    sha256_init(&set_key_ctx);
+    sha256_update(&set_key_ctx, scan_priv_key, scan_priv_key_len);
+    sha256_update(&set_key_ctx, outpoints, outpoints_len);
+    sha256_update(&set_key_ctx, output_keys, output_keys_len);
+    sha256_done(&set_key_ctx, &set_key);
+    memcpy(s.set_key, set_key.u.u8, sizeof(s.set_key));
+
+    s.pub_key_offsets = wally_malloc(num_txs * 2 * sizeof(size_t));
+    s.set = wally_calloc(set_size * sizeof(uint32_t));
+    s.matches = wally_malloc(total_outputs * sizeof(uint32_t));
+    s.tweaks = wally_malloc(total_outputs * EC_PRIVATE_KEY_LEN);
+    s.rets = wally_calloc(num_txs * sizeof(int));
+    if (!s.pub_key_offsets || !s.set || !s.matches || !s.tweaks || !s.rets) {
+        ret = WALLY_ENOMEM;
+        goto cleanup;
+    }
+    s.output_key_offsets = s.pub_key_offsets + num_txs;
+    for (i = 0, total_pub_keys = 0, total_outputs = 0; i < num_txs; ++i) {
+        s.pub_key_offsets[i] = total_pub_keys;
+        s.output_key_offsets[i] = total_outputs;
+        total_pub_keys += num_pub_keys[i];
+        total_outputs += num_output_keys[i];
+    }
+    for (i = 0; i < total_outputs; ++i) {
+        bip352_set_insert(&s, i);
+        s.matches[i] = BIP352_NO_MATCH;
+    }
+
+    run_tasks(bip352_scan_tx, &s, num_txs);
+
+    /* Write the matches in transaction order, then by k */
+    for (i = 0; ret == WALLY_OK && i < num_txs; ++i) {
+        const size_t offset = s.output_key_offsets[i];
+        ret = s.rets[i];
+        for (j = 0; ret == WALLY_OK && j < num_output_keys[i]; ++j) {
+            if (s.matches[offset + j] == BIP352_NO_MATCH)
+                break;
+            *written += WALLY_BIP352_MATCH_LEN;
+            if (*written <= len) {
+                uint32_to_le_bytes((uint32_t)i, p);
+                uint32_to_le_bytes(s.matches[offset + j], p + 4);
+                memcpy(p + 8, s.tweaks + (offset + j) * EC_PRIVATE_KEY_LEN,
+                       EC_PRIVATE_KEY_LEN);
+                p += WALLY_BIP352_MATCH_LEN;
+            }
+        }
+    }
+    if (ret != WALLY_OK)
+        *written = 0;
+
+cleanup:
+    if (s.tweaks)
+        clear_and_free(s.tweaks, total_outputs * EC_PRIVATE_KEY_LEN);
+    wally_free(s.rets);
+    wally_free(s.matches);
+    wally_free(s.set);
+    wally_free(s.pub_key_offsets);
+    wally_clear_3(&s, sizeof(s), &set_key_ctx, sizeof(set_key_ctx),
+                  &set_key, sizeof(set_key));
+    return ret;
+}
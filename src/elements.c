@@ -229,17 +229,17 @@ int wally_asset_rangeproof_get_maximum_len(uint64_t value, int min_bits, size_t
 #endif /* BUILD_ELEMENTS */
 }
 
-int wally_asset_rangeproof_with_nonce(uint64_t value,
-                                      const unsigned char *nonce_hash, size_t nonce_hash_len,
-                                      const unsigned char *asset, size_t asset_len,
-                                      const unsigned char *abf, size_t abf_len,
-                                      const unsigned char *vbf, size_t vbf_len,
-                                      const unsigned char *commitment, size_t commitment_len,
-                                      const unsigned char *extra, size_t extra_len,
-                                      const unsigned char *generator, size_t generator_len,
-                                      uint64_t min_value, int exp, int min_bits,
-                                      unsigned char *bytes_out, size_t len,
-                                      size_t *written)
+static int asset_rangeproof_with_nonce(uint64_t value,
+                                       const unsigned char *nonce_hash, size_t nonce_hash_len,
+                                       const unsigned char *asset, size_t asset_len,
+                                       const unsigned char *abf, size_t abf_len,
+                                       const unsigned char *vbf, size_t vbf_len,
+                                       const unsigned char *commitment, size_t commitment_len,
+                                       const unsigned char *extra, size_t extra_len,
+                                       const unsigned char *generator, size_t generator_len,
+                                       uint64_t min_value, int exp, int min_bits,
+                                       unsigned char *bytes_out, size_t len,
+                                       size_t *written)
 {
 #ifndef BUILD_ELEMENTS
     return WALLY_ERROR;
@@ -303,6 +303,29 @@ cleanup:
 #endif /* BUILD_ELEMENTS */
 }
 
+int wally_asset_rangeproof_with_nonce(uint64_t value,
+                                      const unsigned char *nonce_hash, size_t nonce_hash_len,
+                                      const unsigned char *asset, size_t asset_len,
+                                      const unsigned char *abf, size_t abf_len,
+                                      const unsigned char *vbf, size_t vbf_len,
+                                      const unsigned char *commitment, size_t commitment_len,
+                                      const unsigned char *extra, size_t extra_len,
+                                      const unsigned char *generator, size_t generator_len,
+                                      uint64_t min_value, int exp, int min_bits,
+                                      unsigned char *bytes_out, size_t len,
+                                      size_t *written)
+{
+    int ret;
+    STATS_BEGIN(WALLY_STATS_RANGEPROOF);
+    ret = asset_rangeproof_with_nonce(value, nonce_hash, nonce_hash_len, asset,
+                                      asset_len, abf, abf_len, vbf, vbf_len,
+                                      commitment, commitment_len, extra, extra_len,
+                                      generator, generator_len, min_value, exp,
+                                      min_bits, bytes_out, len, written);
+    STATS_END();
+    return ret;
+}
+
 int wally_asset_rangeproof(uint64_t value,
                            const unsigned char *pub_key, size_t pub_key_len,
                            const unsigned char *priv_key, size_t priv_key_len,
@@ -491,15 +514,15 @@ int wally_asset_surjectionproof_size(size_t num_inputs, size_t *written)
 }
 
 #ifdef BUILD_ELEMENTS
-static int surjproof_impl(const unsigned char *output_asset, size_t output_asset_len,
-                          const unsigned char *output_abf, size_t output_abf_len,
-                          const unsigned char *output_generator, size_t output_generator_len,
-                          const unsigned char *bytes, size_t bytes_len,
-                          const unsigned char *asset, size_t asset_len,
-                          const unsigned char *abf, size_t abf_len,
-                          const unsigned char *generator, size_t generator_len,
-                          unsigned char *bytes_out, size_t len,
-                          size_t *written, size_t n_attempts)
+static int surjection_proof(const unsigned char *output_asset, size_t output_asset_len,
+                            const unsigned char *output_abf, size_t output_abf_len,
+                            const unsigned char *output_generator, size_t output_generator_len,
+                            const unsigned char *bytes, size_t bytes_len,
+                            const unsigned char *asset, size_t asset_len,
+                            const unsigned char *abf, size_t abf_len,
+                            const unsigned char *generator, size_t generator_len,
+                            unsigned char *bytes_out, size_t len,
+                            size_t *written, size_t n_attempts)
 {
     const secp256k1_context *ctx = secp_ctx();
     secp256k1_generator gen;
@@ -577,6 +600,27 @@ cleanup:
         clear_and_free(generators, num_inputs * sizeof(secp256k1_generator));
     return ret;
 }
+
+static int surjproof_impl(const unsigned char *output_asset, size_t output_asset_len,
+                          const unsigned char *output_abf, size_t output_abf_len,
+                          const unsigned char *output_generator, size_t output_generator_len,
+                          const unsigned char *bytes, size_t bytes_len,
+                          const unsigned char *asset, size_t asset_len,
+                          const unsigned char *abf, size_t abf_len,
+                          const unsigned char *generator, size_t generator_len,
+                          unsigned char *bytes_out, size_t len,
+                          size_t *written, size_t n_attempts)
+{
+    int ret;
+    STATS_BEGIN(WALLY_STATS_SURJECTIONPROOF);
+    ret = surjection_proof(output_asset, output_asset_len, output_abf,
+                           output_abf_len, output_generator, output_generator_len,
+                           bytes, bytes_len, asset, asset_len, abf, abf_len,
+                           generator, generator_len, bytes_out, len, written,
+                           n_attempts);
+    STATS_END();
+    return ret;
+}
 #endif /* BUILD_ELEMENTS */
 
 int wally_asset_surjectionproof_len(const unsigned char *output_asset, size_t output_asset_len,
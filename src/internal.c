@@ -7,6 +7,7 @@
 #include "ccan/ccan/endian/endian.h"
 
 #undef malloc
+#undef calloc
 #undef free
 
 #if defined(_WIN32)
@@ -15,10 +16,333 @@
 #undef WIN32_LEAN_AND_MEAN
 #endif
 
+#if !defined(BUILD_MINIMAL) && (defined(HAVE_PTHREAD) || defined(_WIN32))
+/* Use a per-thread secp context and extended error code */
+#define WALLY_THREAD_STATE 1
+#endif
+
+#if !defined(_WIN32) && defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#if defined(_WIN32) || defined(MAP_ANON)
+/* Secure arenas can be locked into memory and guard paged */
+#define WALLY_SECURE_ARENA 1
+#endif
+
+/* Pooled allocator size classes, in usable bytes. These cover keys,
+ * signatures, hashes and small scripts */
+#define POOL_NUM_CLASSES 4
+static const size_t pool_sizes[POOL_NUM_CLASSES] = { 32, 48, 80, 128 };
+#define POOL_MAX_CACHED 256 /* Maximum cached blocks per size class */
+#define POOL_HEADER_LEN 16 /* Holds the block size, preserving alignment */
+
+struct pool {
+    unsigned char *cached[POOL_NUM_CLASSES]; /* Free lists of blocks */
+    size_t num_cached[POOL_NUM_CLASSES];
+    struct wally_pool_stats stats;
+};
+
+/* Whether public data is securely cleared when freed */
+static bool wally_clear_public = true;
+
+/* Secure arena allocations are rounded up to preserve alignment */
+#define SECURE_ALIGN 16
+
+struct secure_arena {
+    unsigned char *base; /* Usable memory, between two guard pages */
+    size_t len; /* Usable length */
+    size_t used; /* Bytes currently allocated */
+    size_t dirty; /* Bytes used since the arena was last cleared */
+};
+
+#ifdef WALLY_SECURE_ARENA
+static size_t page_size(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    return si.dwPageSize;
+#else
+    const long ret = sysconf(_SC_PAGESIZE);
+    return ret > 0 ? (size_t)ret : 4096u;
+#endif
+}
+#endif
+
+/* Map an arena of at least len usable bytes, locked into memory and
+ * surrounded by inaccessible guard pages */
+static bool secure_arena_map(struct secure_arena *arena, size_t len)
+{
+#ifdef WALLY_SECURE_ARENA
+    const size_t page = page_size();
+    unsigned char *p;
+    size_t total;
+#ifdef _WIN32
+    DWORD old;
+#endif
+
+    if (len > SIZE_MAX - page * 3)
+        return false;
+    len = (len + page - 1) / page * page;
+    total = len + page * 2;
+#ifdef _WIN32
+    p = (unsigned char *)VirtualAlloc(NULL, total, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    if (!p)
+        return false;
+    if (!VirtualProtect(p, page, PAGE_NOACCESS, &old) ||
+        !VirtualProtect(p + page + len, page, PAGE_NOACCESS, &old) ||
+        !VirtualLock(p + page, len)) {
+        VirtualFree(p, 0, MEM_RELEASE);
+        return false;
+    }
+#else
+    p = (unsigned char *)mmap(NULL, total, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANON, -1, 0);
+    if (p == (unsigned char *)MAP_FAILED)
+        return false;
+    if (mprotect(p, page, PROT_NONE) || mprotect(p + page + len, page, PROT_NONE) ||
+        mlock(p + page, len)) {
+        munmap(p, total);
+        return false;
+    }
+#ifdef MADV_DONTDUMP
+    madvise(p + page, len, MADV_DONTDUMP); /* Keep secrets out of core dumps */
+#endif
+#endif /* _WIN32 */
+    arena->base = p + page;
+    arena->len = len;
+    arena->used = 0;
+    arena->dirty = 0;
+    return true;
+#else
+    (void)arena;
+    (void)len;
+    return false; /* Not supported on this platform */
+#endif /* WALLY_SECURE_ARENA */
+}
+
+/* Clear and unmap an arena */
+static void secure_arena_release(struct secure_arena *arena)
+{
+#ifdef WALLY_SECURE_ARENA
+    if (arena->base) {
+        const size_t page = page_size();
+        wally_clear(arena->base, arena->dirty);
+#ifdef _WIN32
+        VirtualUnlock(arena->base, arena->len);
+        VirtualFree(arena->base - page, 0, MEM_RELEASE);
+#else
+        munlock(arena->base, arena->len);
+        munmap(arena->base - page, arena->len + page * 2);
+#endif
+    }
+#endif
+    memset(arena, 0, sizeof(*arena));
+}
+
+/* Return all cached blocks in a pool to the system allocator */
+static void pool_release(struct pool *pool)
+{
+    size_t i;
+    for (i = 0; i < POOL_NUM_CLASSES; ++i) {
+        while (pool->cached[i]) {
+            unsigned char *block = pool->cached[i];
+            memcpy(&pool->cached[i], block + POOL_HEADER_LEN, sizeof(block));
+            free(block);
+        }
+        pool->num_cached[i] = 0;
+    }
+    pool->stats.num_cached = 0;
+    pool->stats.cached_bytes = 0;
+}
+
+#ifdef WALLY_THREAD_STATE
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+struct thread_state {
+    secp256k1_context *ctx;
+    uint32_t ctx_generation; /* The secp seed generation ctx was randomized with */
+    const secp256k1_context *task_ctx; /* The secp context of the caller whose task is running */
+    int error;
+    struct pool pool;
+    struct secure_arena arena;
+#ifdef BUILD_STATS
+    int stats_op; /* The innermost instrumented operation in progress */
+#endif
+};
+
+/* The entropy last given to wally_secp_randomize, applied to each threads
+ * default context before its next use. Written under secp_seed_lock */
+static unsigned char secp_seed[WALLY_SECP_RANDOMIZE_LEN];
+/* Incremented each time secp_seed changes; zero if it has never been set */
+static uint32_t secp_seed_generation;
+
+#if defined(_MSC_VER)
+#define WALLY_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define WALLY_THREAD_LOCAL __thread
+#endif
+
+#ifdef WALLY_THREAD_LOCAL
+/* The calling threads pool, cached to avoid a thread key lookup for
+ * every pooled allocation and free */
+static WALLY_THREAD_LOCAL struct pool *thread_pool;
+#endif
+
+static void thread_state_free(void *p)
+{
+    struct thread_state *ts = (struct thread_state *)p;
+    if (ts) {
+        wally_secp_context_free(ts->ctx);
+#ifdef WALLY_THREAD_LOCAL
+        if (thread_pool == &ts->pool)
+            thread_pool = NULL;
+#endif
+        pool_release(&ts->pool);
+        secure_arena_release(&ts->arena);
+        free(ts); /* Not wally_free, since the pool may be installed */
+    }
+}
+
+#ifdef _WIN32
+static DWORD thread_key = FLS_OUT_OF_INDEXES;
+static INIT_ONCE thread_key_once = INIT_ONCE_STATIC_INIT;
+
+static VOID WINAPI thread_state_free_win(PVOID p)
+{
+    thread_state_free(p);
+}
+
+static BOOL CALLBACK thread_key_create(PINIT_ONCE once, PVOID param, PVOID *ctx)
+{
+    (void)once;
+    (void)param;
+    (void)ctx;
+    thread_key = FlsAlloc(thread_state_free_win);
+    return TRUE;
+}
+
+#define THREAD_KEY_INIT() \
+    (InitOnceExecuteOnce(&thread_key_once, thread_key_create, NULL, NULL) && \
+     thread_key != FLS_OUT_OF_INDEXES)
+#define THREAD_KEY_GET() FlsGetValue(thread_key)
+#define THREAD_KEY_SET(p) (FlsSetValue(thread_key, p) != 0)
+
+static SRWLOCK secp_seed_lock = SRWLOCK_INIT;
+#define SECP_SEED_LOCK() AcquireSRWLockExclusive(&secp_seed_lock)
+#define SECP_SEED_UNLOCK() ReleaseSRWLockExclusive(&secp_seed_lock)
+#define SECP_SEED_GENERATION() \
+    ((uint32_t)InterlockedCompareExchange((volatile LONG *)&secp_seed_generation, 0, 0))
+#define SECP_SEED_GENERATION_INC() InterlockedIncrement((volatile LONG *)&secp_seed_generation)
+#else
+static pthread_key_t thread_key;
+static pthread_once_t thread_key_once = PTHREAD_ONCE_INIT;
+static bool thread_key_ok = false;
+
+static void thread_key_create(void)
+{
+    thread_key_ok = !pthread_key_create(&thread_key, thread_state_free);
+}
+
+#define THREAD_KEY_INIT() \
+    (!pthread_once(&thread_key_once, thread_key_create) && thread_key_ok)
+#define THREAD_KEY_GET() pthread_getspecific(thread_key)
+#define THREAD_KEY_SET(p) (!pthread_setspecific(thread_key, p))
+
+static pthread_mutex_t secp_seed_lock = PTHREAD_MUTEX_INITIALIZER;
+#define SECP_SEED_LOCK() pthread_mutex_lock(&secp_seed_lock)
+#define SECP_SEED_UNLOCK() pthread_mutex_unlock(&secp_seed_lock)
+#define SECP_SEED_GENERATION() __atomic_load_n(&secp_seed_generation, __ATOMIC_ACQUIRE)
+#define SECP_SEED_GENERATION_INC() __atomic_add_fetch(&secp_seed_generation, 1, __ATOMIC_RELEASE)
+#endif /* _WIN32 */
+
+static void secp_seed_set(const unsigned char *bytes)
+{
+    SECP_SEED_LOCK();
+    memcpy(secp_seed, bytes, sizeof(secp_seed));
+    SECP_SEED_GENERATION_INC();
+    SECP_SEED_UNLOCK();
+}
+
+/* Get the calling threads state, optionally creating it if not present */
+static struct thread_state *thread_state_get(bool create)
+{
+    struct thread_state *ts;
+
+    if (!THREAD_KEY_INIT())
+        return NULL;
+    ts = (struct thread_state *)THREAD_KEY_GET();
+    if (!ts && create && (ts = calloc(1, sizeof(*ts))) != NULL) {
+        if (!THREAD_KEY_SET(ts)) {
+            free(ts);
+            ts = NULL;
+        }
+    }
+    return ts;
+}
+
+static struct pool *pool_get(void)
+{
+#ifdef WALLY_THREAD_LOCAL
+    if (!thread_pool) {
+        struct thread_state *ts = thread_state_get(true);
+        thread_pool = ts ? &ts->pool : NULL;
+    }
+    return thread_pool;
+#else
+    struct thread_state *ts = thread_state_get(true);
+    return ts ? &ts->pool : NULL;
+#endif
+}
+
+static struct secure_arena *secure_arena_get(bool create)
+{
+    struct thread_state *ts = thread_state_get(create);
+    return ts ? &ts->arena : NULL;
+}
+
+#ifdef BUILD_STATS
+static int *stats_op_get(void)
+{
+    struct thread_state *ts = thread_state_get(true);
+    return ts ? &ts->stats_op : NULL;
+}
+#endif
+#else
 /* Caller is responsible for thread safety */
 static secp256k1_context *global_ctx = NULL;
 /* Global extended error code. Not thread-safe unless caller-overridden */
 static int global_error = WALLY_OK;
+/* Global allocation pool. Not thread-safe */
+static struct pool global_pool;
+
+static struct pool *pool_get(void)
+{
+    return &global_pool;
+}
+
+/* Global secure arena. Not thread-safe */
+static struct secure_arena global_arena;
+
+static struct secure_arena *secure_arena_get(bool create)
+{
+    (void)create;
+    return &global_arena;
+}
+
+#ifdef BUILD_STATS
+/* The innermost instrumented operation in progress. Not thread-safe */
+static int global_stats_op = WALLY_STATS_OTHER;
+
+static int *stats_op_get(void)
+{
+    return &global_stats_op;
+}
+#endif
+#endif /* WALLY_THREAD_STATE */
 
 int wally_get_build_version(uint32_t *value)
 {
@@ -130,6 +454,10 @@ int wally_secp_randomize(const unsigned char *bytes, size_t bytes_len)
     if (!bytes || bytes_len != WALLY_SECP_RANDOMIZE_LEN)
         return WALLY_EINVAL;
 
+#ifdef WALLY_THREAD_STATE
+    /* Randomize the default context of every thread before its next use */
+    secp_seed_set(bytes);
+#endif
     if (!(ctx = (secp256k1_context *)secp_ctx()))
         return WALLY_ENOMEM;
 
@@ -327,6 +655,23 @@ int wally_hash160(const unsigned char *bytes, size_t bytes_len,
     return WALLY_OK;
 }
 
+int wally_hash160_batch(const unsigned char *bytes, size_t bytes_len,
+                        size_t item_len,
+                        unsigned char *bytes_out, size_t len)
+{
+    size_t i, num_items = item_len ? bytes_len / item_len : 0;
+    int ret = WALLY_OK;
+
+    if (!bytes || !num_items || bytes_len % item_len || !bytes_out ||
+        len != num_items * HASH160_LEN)
+        return WALLY_EINVAL;
+
+    for (i = 0; ret == WALLY_OK && i < num_items; ++i)
+        ret = wally_hash160(bytes + i * item_len, item_len,
+                            bytes_out + i * HASH160_LEN, HASH160_LEN);
+    return ret;
+}
+
 /*
  * For clang 7.0.1 and up it may be useful to disable the memset builtin for this code to not be elided when on -O3.
  * The following program can be used to check what your compiler is doing.
@@ -364,6 +709,168 @@ static void wally_internal_free(void *ptr)
         free(ptr);
 }
 
+/* Return the size class index for an allocation, or POOL_NUM_CLASSES */
+static size_t pool_class(size_t size)
+{
+    size_t i;
+    for (i = 0; i < POOL_NUM_CLASSES && size > pool_sizes[i]; ++i)
+        ; /* no-op */
+    return i;
+}
+
+void *wally_pool_malloc(size_t size)
+{
+    struct pool *pool = pool_get();
+    const size_t c = pool_class(size);
+    unsigned char *block;
+
+    if (pool)
+        ++pool->stats.num_allocs;
+    if (c < POOL_NUM_CLASSES) {
+        size = pool_sizes[c];
+        if (pool && pool->cached[c]) {
+            /* Reuse a cached block */
+            block = pool->cached[c];
+            memcpy(&pool->cached[c], block + POOL_HEADER_LEN, sizeof(block));
+            memset(block + POOL_HEADER_LEN, 0, sizeof(void *));
+            --pool->num_cached[c];
+            ++pool->stats.num_hits;
+            --pool->stats.num_cached;
+            pool->stats.cached_bytes -= size;
+            return block + POOL_HEADER_LEN;
+        }
+    } else if (size > SIZE_MAX - POOL_HEADER_LEN)
+        return NULL;
+
+    if (!(block = malloc(POOL_HEADER_LEN + size)))
+        return NULL;
+    memcpy(block, &size, sizeof(size));
+    return block + POOL_HEADER_LEN;
+}
+
+void wally_pool_free(void *ptr)
+{
+    struct pool *pool;
+    unsigned char *block;
+    size_t size, c;
+
+    if (!ptr)
+        return;
+    block = (unsigned char *)ptr - POOL_HEADER_LEN;
+    memcpy(&size, block, sizeof(size));
+    pool = pool_get();
+    if (pool)
+        ++pool->stats.num_frees;
+    c = pool_class(size);
+    if (c < POOL_NUM_CLASSES && pool && pool->num_cached[c] < POOL_MAX_CACHED) {
+        /* Cache the block for reuse */
+        memcpy(block + POOL_HEADER_LEN, &pool->cached[c], sizeof(block));
+        pool->cached[c] = block;
+        ++pool->num_cached[c];
+        ++pool->stats.num_cached;
+        pool->stats.cached_bytes += size;
+        return;
+    }
+    free(block);
+}
+
+int wally_pool_get_stats(struct wally_pool_stats *output)
+{
+    struct pool *pool = pool_get();
+    if (!output)
+        return WALLY_EINVAL;
+    if (!pool)
+        return WALLY_ENOMEM;
+    memcpy(output, &pool->stats, sizeof(*output));
+    return WALLY_OK;
+}
+
+int wally_secure_arena_init(size_t len, uint32_t flags)
+{
+    struct secure_arena *arena;
+
+    if (!len || flags)
+        return WALLY_EINVAL;
+    if (!(arena = secure_arena_get(true)))
+        return WALLY_ENOMEM;
+    if (arena->used)
+        return WALLY_EINVAL; /* Called while the arena is in use */
+    secure_arena_release(arena);
+    return secure_arena_map(arena, len) ? WALLY_OK : WALLY_ERROR;
+}
+
+int wally_secure_arena_reset(uint32_t flags, size_t *written)
+{
+    struct secure_arena *arena;
+
+    if (written)
+        *written = 0;
+    if (flags)
+        return WALLY_EINVAL;
+    arena = secure_arena_get(false);
+    if (arena && arena->base) {
+        if (arena->used)
+            return WALLY_EINVAL; /* Called while the arena is in use */
+        /* Clear everything used since the last reset at once */
+        wally_clear(arena->base, arena->dirty);
+        if (written)
+            *written = arena->dirty;
+        arena->dirty = 0;
+    }
+    return WALLY_OK;
+}
+
+int wally_secure_arena_free(uint32_t flags)
+{
+    struct secure_arena *arena;
+
+    if (flags)
+        return WALLY_EINVAL;
+    arena = secure_arena_get(false);
+    if (arena) {
+        if (arena->used)
+            return WALLY_EINVAL; /* Called while the arena is in use */
+        secure_arena_release(arena);
+    }
+    return WALLY_OK;
+}
+
+void *secure_alloc(void *fallback, size_t len)
+{
+    struct secure_arena *arena = secure_arena_get(false);
+    const size_t rounded = (len + SECURE_ALIGN - 1) & ~(size_t)(SECURE_ALIGN - 1);
+
+    if (arena && arena->base && len && rounded >= len &&
+        rounded <= arena->len - arena->used) {
+        unsigned char *p = arena->base + arena->used;
+        arena->used += rounded;
+        if (arena->used > arena->dirty)
+            arena->dirty = arena->used;
+        return p;
+    }
+    return fallback ? fallback : wally_malloc(len);
+}
+
+void secure_free(void *p, void *fallback, size_t len)
+{
+    struct secure_arena *arena;
+    unsigned char *bytes = (unsigned char *)p;
+
+    if (!p)
+        return;
+    arena = secure_arena_get(false);
+    if (arena && arena->base && bytes >= arena->base &&
+        bytes < arena->base + arena->len) {
+        /* Release without clearing: the arena is cleared when reset */
+        if ((size_t)(bytes - arena->base) < arena->used)
+            arena->used = (size_t)(bytes - arena->base);
+        return;
+    }
+    wally_clear(p, len);
+    if (p != fallback)
+        wally_free(p);
+}
+
 static int wally_internal_ec_nonce_fn(unsigned char *nonce32,
                                       const unsigned char *msg32, const unsigned char *key32,
                                       const unsigned char *algo16, void *data, unsigned int attempt)
@@ -376,6 +883,46 @@ struct secp256k1_context_struct *wally_get_new_secp_context(void)
     return secp256k1_context_create(SECP256K1_CONTEXT_VERIFY | SECP256K1_CONTEXT_SIGN);
 }
 
+#ifdef WALLY_THREAD_STATE
+struct secp256k1_context_struct *wally_internal_secp_context(void)
+{
+    /* Default implementation uses a lazy-initialized per-thread context */
+    struct thread_state *ts = thread_state_get(true);
+    unsigned char seed[WALLY_SECP_RANDOMIZE_LEN];
+    uint32_t generation;
+
+    if (!ts)
+        return NULL;
+    if (!ts->ctx && !(ts->ctx = wally_get_new_secp_context()))
+        return NULL;
+    if (ts->ctx_generation != SECP_SEED_GENERATION()) {
+        /* wally_secp_randomize was called since this context was last
+         * randomized: randomize it in place so callers holding it are
+         * protected too, including executor worker threads */
+        SECP_SEED_LOCK();
+        memcpy(seed, secp_seed, sizeof(seed));
+        generation = SECP_SEED_GENERATION();
+        SECP_SEED_UNLOCK();
+        if (secp256k1_context_randomize(ts->ctx, seed))
+            ts->ctx_generation = generation;
+        wally_clear(seed, sizeof(seed));
+    }
+    return ts->ctx;
+}
+
+int wally_internal_get_error(void) {
+    struct thread_state *ts = thread_state_get(false);
+    return ts ? ts->error : WALLY_OK;
+}
+
+int wally_internal_set_error(int error_code)
+{
+    struct thread_state *ts = thread_state_get(error_code != WALLY_OK);
+    if (ts)
+        ts->error = error_code;
+    return error_code;
+}
+#else
 struct secp256k1_context_struct *wally_internal_secp_context(void)
 {
     /* Default implementation uses a lazy-initialized global context,
@@ -396,6 +943,16 @@ int wally_internal_set_error(int error_code)
     global_error = error_code;
     return error_code;
 }
+#endif /* WALLY_THREAD_STATE */
+
+static void wally_internal_executor(wally_task_t task, void *ctx,
+                                    size_t num_tasks, void *executor_ctx)
+{
+    size_t i;
+    (void)executor_ctx;
+    for (i = 0; i < num_tasks; ++i)
+        task(ctx, i);
+}
 
 static struct wally_operations _ops = {
     sizeof(struct wally_operations),
@@ -406,29 +963,137 @@ static struct wally_operations _ops = {
     wally_internal_secp_context,
     wally_internal_get_error,
     wally_internal_set_error,
-    NULL,
+    wally_internal_executor,
     NULL
 };
 
 const secp256k1_context *secp_ctx(void)
 {
+#ifdef WALLY_THREAD_STATE
+    /* Tasks use the context of the thread that started them */
+    const struct thread_state *ts = thread_state_get(false);
+    if (ts && ts->task_ctx)
+        return ts->task_ctx;
+#endif
     return (const secp256k1_context *)_ops.secp_context_fn();
 }
 
+#ifdef BUILD_STATS
+static struct wally_stats global_stats[WALLY_STATS_NUM];
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#define STATS_ADD(p, n) InterlockedExchangeAdd64((volatile LONG64 *)(p), (LONG64)(n))
+#define STATS_TAKE(p, reset) ((reset) ? (uint64_t)InterlockedExchange64((volatile LONG64 *)(p), 0) : \
+                              (uint64_t)InterlockedCompareExchange64((volatile LONG64 *)(p), 0, 0))
+#else
+#define STATS_ADD(p, n) __atomic_fetch_add((p), (uint64_t)(n), __ATOMIC_RELAXED)
+#define STATS_TAKE(p, reset) ((reset) ? __atomic_exchange_n((p), 0, __ATOMIC_RELAXED) : \
+                              __atomic_load_n((p), __ATOMIC_RELAXED))
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif !defined(__aarch64__)
+#include <time.h>
+#endif
+#endif
+
+/* Return a fast, monotonic tick count: CPU cycles where available */
+static uint64_t stats_ticks(void)
+{
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t ticks;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    return (uint64_t)clock();
+#endif
+}
+
+struct stats_scope stats_begin(int op)
+{
+    int *current = stats_op_get();
+    struct stats_scope scope;
+    scope.op = op;
+    scope.prev_op = current ? *current : WALLY_STATS_OTHER;
+    if (current)
+        *current = op;
+    STATS_ADD(&global_stats[op].num_calls, 1);
+    scope.start = stats_ticks();
+    return scope;
+}
+
+void stats_end(const struct stats_scope *scope)
+{
+    int *current = stats_op_get();
+    STATS_ADD(&global_stats[scope->op].ticks, stats_ticks() - scope->start);
+    if (current)
+        *current = scope->prev_op;
+}
+
+static void stats_alloc(size_t size)
+{
+    const int *current = stats_op_get();
+    const int op = current ? *current : WALLY_STATS_OTHER;
+    STATS_ADD(&global_stats[op].num_allocs, 1);
+    STATS_ADD(&global_stats[op].alloc_bytes, size);
+}
+
+static void stats_free(void *ptr)
+{
+    const int *current;
+    if (ptr && (current = stats_op_get()) != NULL)
+        STATS_ADD(&global_stats[*current].num_frees, 1);
+}
+#define STATS_ALLOC(size) stats_alloc(size)
+#define STATS_FREE(ptr) stats_free(ptr)
+#else
+#define STATS_ALLOC(size)
+#define STATS_FREE(ptr)
+#endif /* BUILD_STATS */
+
+int wally_get_stats(uint32_t flags, struct wally_stats *output, size_t num_output)
+{
+    if ((flags & ~WALLY_STATS_FLAG_RESET) || !output || num_output != WALLY_STATS_NUM)
+        return WALLY_EINVAL;
+#ifdef BUILD_STATS
+    {
+        const bool reset = flags & WALLY_STATS_FLAG_RESET;
+        size_t i;
+        for (i = 0; i < WALLY_STATS_NUM; ++i) {
+            output[i].num_calls = STATS_TAKE(&global_stats[i].num_calls, reset);
+            output[i].ticks = STATS_TAKE(&global_stats[i].ticks, reset);
+            output[i].num_allocs = STATS_TAKE(&global_stats[i].num_allocs, reset);
+            output[i].alloc_bytes = STATS_TAKE(&global_stats[i].alloc_bytes, reset);
+            output[i].num_frees = STATS_TAKE(&global_stats[i].num_frees, reset);
+        }
+        return WALLY_OK;
+    }
+#else
+    memset(output, 0, num_output * sizeof(*output));
+    return WALLY_ERROR; /* Not built with instrumentation */
+#endif
+}
+
 void *wally_malloc(size_t size)
 {
+    STATS_ALLOC(size);
     return _ops.malloc_fn(size);
 }
 
 void *wally_calloc(size_t size)
 {
-    void *p = _ops.malloc_fn(size);
+    void *p;
+    STATS_ALLOC(size);
+    p = _ops.malloc_fn(size);
     (void) wally_bzero(p, size);
     return p;
 }
 
 void wally_free(void *ptr)
 {
+    STATS_FREE(ptr);
     _ops.free_fn(ptr);
 }
 
@@ -475,11 +1140,6 @@ int wally_set_operations(const struct wally_operations *ops)
 {
     if (!ops || ops->struct_size != sizeof(struct wally_operations))
         return WALLY_EINVAL; /* Null or invalid version of ops */
-    /* Reserved pointers must be null so they can be enabled in the
-     * future without breaking back compatibility */
-    if (ops->reserved_3 || ops->reserved_4)
-        return WALLY_EINVAL;
-
 #define COPY_FN_PTR(name) if (ops->name) _ops.name = ops->name
     COPY_FN_PTR(malloc_fn);
     COPY_FN_PTR(free_fn);
@@ -489,6 +1149,10 @@ int wally_set_operations(const struct wally_operations *ops)
     COPY_FN_PTR (get_error_fn);
     COPY_FN_PTR (set_error_fn);
 #undef COPY_FN_PTR
+    if (ops->executor_fn) {
+        _ops.executor_fn = ops->executor_fn;
+        _ops.executor_ctx = ops->executor_ctx;
+    }
     return WALLY_OK;
 }
 
@@ -545,6 +1209,46 @@ void clear_and_free_bytes(unsigned char **p, size_t *len)
     }
 }
 
+void clear_public(void *p, size_t len)
+{
+    if (!p)
+        return;
+    if (wally_clear_public)
+        wally_clear(p, len);
+    else
+        memset(p, 0, len);
+}
+
+void free_public(void *p, size_t len)
+{
+    if (p) {
+        if (wally_clear_public)
+            wally_clear(p, len);
+        wally_free(p);
+    }
+}
+
+void clear_bulk(void *p, size_t len)
+{
+    if (!p)
+        return;
+#if defined(HAVE_INLINE_ASM)
+    if (_ops.bzero_fn == wally_internal_bzero) {
+        /* Zero now, and prevent elision with one barrier in clear_bulk_end */
+        memset(p, 0, len);
+        return;
+    }
+#endif
+    wally_clear(p, len);
+}
+
+void clear_bulk_end(void)
+{
+#if defined(HAVE_INLINE_ASM)
+    __asm__ __volatile__ ("" : : : "memory");
+#endif
+}
+
 bool mem_is_zero(const void *mem, size_t len)
 {
     size_t i;
@@ -558,9 +1262,10 @@ static bool wally_init_done = false;
 
 int wally_init(uint32_t flags)
 {
-    if (flags)
+    if (flags & ~WALLY_INIT_FLAG_NO_CLEAR_PUBLIC)
         return WALLY_EINVAL;
 
+    wally_clear_public = !(flags & WALLY_INIT_FLAG_NO_CLEAR_PUBLIC);
     if (!wally_init_done) {
         sha256_optimize();
         wally_init_done = true;
@@ -573,10 +1278,21 @@ int wally_cleanup(uint32_t flags)
 {
     if (flags)
         return WALLY_EINVAL;
+#ifdef WALLY_THREAD_STATE
+    {
+        /* Other threads state is freed when each thread exits */
+        struct thread_state *ts = thread_state_get(false);
+        if (ts && THREAD_KEY_SET(NULL))
+            thread_state_free(ts);
+    }
+#else
     if (global_ctx) {
         wally_secp_context_free(global_ctx);
         global_ctx = NULL;
     }
+    pool_release(&global_pool);
+    secure_arena_release(&global_arena);
+#endif
     return WALLY_OK;
 }
 
@@ -652,6 +1368,49 @@ int array_grow(void **src, size_t num_items, size_t *allocation_len,
     return WALLY_OK;
 }
 
+#ifdef WALLY_THREAD_STATE
+/* A task to run using the secp context of the thread that started it */
+struct ctx_task {
+    wally_task_t fn;
+    void *ctx;
+    const secp256k1_context *secp;
+};
+
+static void ctx_task_run(void *task, size_t i)
+{
+    const struct ctx_task *t = (const struct ctx_task *)task;
+    struct thread_state *ts = thread_state_get(true);
+    const secp256k1_context *prev = ts ? ts->task_ctx : NULL;
+
+    if (ts)
+        ts->task_ctx = t->secp;
+    t->fn(t->ctx, i);
+    if (ts)
+        ts->task_ctx = prev;
+}
+#endif
+
+void run_tasks(wally_task_t fn, void *ctx, size_t num_tasks)
+{
+    if (num_tasks == 1)
+        fn(ctx, 0); /* Avoid executor overhead for a single task */
+    else if (num_tasks) {
+#ifdef WALLY_THREAD_STATE
+        /* Run the tasks with the callers secp context, so that every task
+         * uses the same (possibly caller-randomized) context whichever
+         * thread the executor runs it on */
+        struct ctx_task t;
+        t.fn = fn;
+        t.ctx = ctx;
+        if ((t.secp = secp_ctx()) != NULL) {
+            _ops.executor_fn(ctx_task_run, &t, num_tasks, _ops.executor_ctx);
+            return;
+        }
+#endif
+        _ops.executor_fn(fn, ctx, num_tasks, _ops.executor_ctx);
+    }
+}
+
 
 #ifdef __ANDROID__
 #define malloc(size) wally_malloc(size)
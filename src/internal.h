@@ -68,11 +68,49 @@ void wally_clear_4(void *p, size_t len, void *p2, size_t len2,
 void clear_and_free(void *p, size_t len);
 void clear_and_free_bytes(unsigned char **p, size_t *len);
 
+/* Clear/free public data such as scripts, proofs and transactions. The data
+ * is securely cleared unless wally was initialized with
+ * WALLY_INIT_FLAG_NO_CLEAR_PUBLIC, in which case it is zeroed normally (for
+ * clear_public) or freed without zeroing (for free_public) */
+void clear_public(void *p, size_t len);
+void free_public(void *p, size_t len);
+
+/* Clear secret data in bulk: memory passed to clear_bulk is only
+ * guaranteed to be cleared once clear_bulk_end is called, which must
+ * happen before the memory is freed or goes out of scope */
+void clear_bulk(void *p, size_t len);
+void clear_bulk_end(void);
+
+/* Get len bytes of memory for secret data. Memory comes from the calling
+ * threads secure arena if it has one with enough space, otherwise fallback
+ * is returned if non-NULL, else the memory is allocated with wally_malloc.
+ * Memory must be released with secure_free in reverse allocation order */
+void *secure_alloc(void *fallback, size_t len);
+/* Release memory from secure_alloc. Arena memory is cleared when the arena
+ * is reset, other memory is cleared immediately and freed if allocated */
+void secure_free(void *p, void *fallback, size_t len);
+
 bool mem_is_zero(const void *mem, size_t len);
 
 /* Fetch our internal operations function pointers */
 const struct wally_operations *wally_ops(void);
 
+#ifdef BUILD_STATS
+/* Instrumentation: A scope around an operation, see wally_get_stats */
+struct stats_scope {
+    int op;
+    int prev_op;
+    uint64_t start;
+};
+struct stats_scope stats_begin(int op);
+void stats_end(const struct stats_scope *scope);
+#define STATS_BEGIN(op) const struct stats_scope stats_scope_ = stats_begin(op)
+#define STATS_END() stats_end(&stats_scope_)
+#else
+#define STATS_BEGIN(op)
+#define STATS_END()
+#endif
+
 #define malloc(size) __use_wally_malloc_internally__
 #define calloc(size) __use_wally_calloc_internally__
 #define free(ptr) __use_wally_free_internally__
@@ -104,11 +142,21 @@ void *array_realloc(const void *src, size_t old_n, size_t new_n, size_t size);
 int array_grow(void **src, size_t num_items, size_t *allocation_len,
                size_t item_size);
 
+/* Run independent tasks: calls fn(ctx, i) for each i in [0, num_tasks)
+ * using the current executor. Tasks must not depend on the order in which
+ * they are run, and may run concurrently. secp_ctx() returns the callers
+ * context within each task */
+void run_tasks(wally_task_t fn, void *ctx, size_t num_tasks);
+
 struct ext_key;
 /* Internal: Create a partial bip32 key from a private key (no chaincode, un-derivable) */
 int bip32_key_from_private_key(uint32_t version, const unsigned char *priv_key,
                                size_t priv_key_len, struct ext_key *output);
 
+struct wally_tx;
+/* Internal: Get the hash of a txs full serialization, including witnesses */
+int tx_get_wtxid(const struct wally_tx *tx, unsigned char *bytes_out, size_t len);
+
 struct wally_map;
 int map_add(struct wally_map *map_in,
             const unsigned char *key, size_t key_len,
@@ -121,6 +169,12 @@ int map_add_preimage_and_hash(struct wally_map *map_in,
 const struct wally_map_item *map_find_equal_integer(const struct wally_map *lhs,
                                                     const struct wally_map *rhs,
                                                     uint32_t key);
+/* Clear a maps keys and values with clear_bulk */
+void map_clear_bulk(const struct wally_map *map_in);
+/* Free a maps contents, leaving it empty. Keys and values are freed as
+ * public data unless is_cleared is true, in which case they must have
+ * been cleared by map_clear_bulk */
+void map_release(struct wally_map *map_in, bool is_cleared);
 
 /* Clamp input/output allocation sizing to standard tx sizes for BTC.
  * Liquid numbers are smaller; we use the upper limit */
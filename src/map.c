@@ -38,19 +38,44 @@ int wally_map_init_alloc(size_t allocation_len, wally_map_verify_fn_t verify_fn,
     return ret;
 }
 
-int wally_map_clear(struct wally_map *map_in)
+void map_clear_bulk(const struct wally_map *map_in)
 {
     size_t i;
 
-    if (!map_in)
-        return WALLY_EINVAL;
     for (i = 0; i < map_in->num_items; ++i) {
         if (map_in->items[i].key)
-            clear_and_free(map_in->items[i].key, map_in->items[i].key_len);
-        clear_and_free(map_in->items[i].value, map_in->items[i].value_len);
+            clear_bulk(map_in->items[i].key, map_in->items[i].key_len);
+        clear_bulk(map_in->items[i].value, map_in->items[i].value_len);
     }
-    clear_and_free(map_in->items, map_in->num_items * sizeof(*map_in->items));
-    wally_clear(map_in, sizeof(*map_in));
+}
+
+void map_release(struct wally_map *map_in, bool is_cleared)
+{
+    size_t i;
+
+    for (i = 0; i < map_in->num_items; ++i) {
+        if (is_cleared) {
+            if (map_in->items[i].key)
+                wally_free(map_in->items[i].key);
+            if (map_in->items[i].value)
+                wally_free(map_in->items[i].value);
+        } else {
+            free_public(map_in->items[i].key, map_in->items[i].key_len);
+            free_public(map_in->items[i].value, map_in->items[i].value_len);
+        }
+    }
+    free_public(map_in->items, map_in->num_items * sizeof(*map_in->items));
+    clear_public(map_in, sizeof(*map_in));
+}
+
+int wally_map_clear(struct wally_map *map_in)
+{
+    if (!map_in)
+        return WALLY_EINVAL;
+    /* The map may hold secrets: clear its contents with a single barrier */
+    map_clear_bulk(map_in);
+    clear_bulk_end();
+    map_release(map_in, true);
     return WALLY_OK;
 }
 
@@ -0,0 +1,1179 @@
+#include "internal.h"
+
+#include <include/wally_crypto.h>
+#include <include/wally_script.h>
+#include <include/wally_transaction.h>
+
+#include "miniscript_plan.h"
+#include "psbt_io.h"
+#include "script.h"
+
+/* Miniscript satisfaction plans.
+ *
+ * A witness or redeem script is tokenized and parsed back into its
+ * miniscript fragments by matching the compiled script from the end.
+ * The resulting tree is type checked, and is then reused to find the
+ * cheapest satisfying witness for each input spending the script.
+ *
+ * Only segwit v0 and P2SH scripts are supported. Witnesses are chosen
+ * by size alone: no malleability analysis is performed.
+ */
+
+/* Fragments */
+#define PLAN_0         0
+#define PLAN_1         1
+#define PLAN_PK_K      2
+#define PLAN_PK_H      3
+#define PLAN_OLDER     4
+#define PLAN_AFTER     5
+#define PLAN_SHA256    6
+#define PLAN_HASH256   7
+#define PLAN_RIPEMD160 8
+#define PLAN_HASH160   9
+#define PLAN_ANDOR     10
+#define PLAN_AND_V     11
+#define PLAN_AND_B     12
+#define PLAN_OR_B      13
+#define PLAN_OR_C      14
+#define PLAN_OR_D      15
+#define PLAN_OR_I      16
+#define PLAN_THRESH    17
+#define PLAN_MULTI     18
+#define PLAN_WRAP_A    19
+#define PLAN_WRAP_S    20
+#define PLAN_WRAP_C    21
+#define PLAN_WRAP_D    22
+#define PLAN_WRAP_V    23
+#define PLAN_WRAP_J    24
+#define PLAN_WRAP_N    25
+
+/* Basic types */
+#define PLAN_TYPE_B    0x01
+#define PLAN_TYPE_V    0x02
+#define PLAN_TYPE_K    0x04
+#define PLAN_TYPE_W    0x08
+#define PLAN_TYPE_MASK 0x0f
+/* Type properties */
+#define PLAN_PROP_Z    0x10
+#define PLAN_PROP_O    0x20
+#define PLAN_PROP_N    0x40
+#define PLAN_PROP_D    0x80
+#define PLAN_PROP_U    0x100
+
+#define PLAN_NO_NODE SIZE_MAX
+#define PLAN_NO_COST SIZE_MAX
+
+/* Consensus limit on non-push opcodes for segwit v0 and P2SH scripts.
+ * Each nested fragment uses at least one, so this also bounds recursion */
+#define PLAN_MAX_OPS 201u
+#define PLAN_MAX_MULTI_KEYS 20u
+#define PLAN_CACHE_MIN_SLOTS 8u
+
+struct plan_token {
+    const unsigned char *data; /* Pushed data, or NULL if not a push */
+    size_t len;
+    unsigned char op;
+};
+
+struct plan_node {
+    uint32_t kind;
+    uint32_t type; /* Basic type and properties */
+    uint32_t k; /* Threshold or timelock value */
+    uint32_t n; /* Number of children, or keys for multi */
+    const struct plan_token *tok; /* Key/hash push, or first key for multi */
+    size_t child; /* Index of the first child */
+    size_t next; /* Index of the next sibling */
+    /* Satisfaction state, updated by ms_plan_satisfy */
+    size_t sat, dsat; /* Witness sizes, or PLAN_NO_COST if unavailable */
+    const struct wally_map_item *item; /* Signature or preimage */
+    const unsigned char *key; /* Public key for pk_h */
+    size_t key_len;
+    unsigned char sat_alt, dsat_alt; /* Chosen alternatives */
+    bool use_sat; /* For thresh children, whether to satisfy */
+};
+
+struct ms_plan {
+    unsigned char *script;
+    size_t script_len;
+    struct plan_token *tokens;
+    size_t num_tokens;
+    struct plan_node *nodes; /* Children always precede their parent */
+    size_t num_nodes;
+    size_t max_nodes;
+    bool is_witness;
+};
+
+struct ms_plan_cache_slot {
+    unsigned char hash[SHA256_LEN]; /* SHA256 of the script */
+    struct ms_plan *plan; /* NULL if the script is not miniscript */
+    bool is_witness;
+    bool is_used;
+};
+
+struct plan_parser {
+    struct ms_plan *plan;
+    size_t pos; /* Number of tokens remaining, parsing from the end */
+};
+
+static const unsigned char plan_one[1] = { 1 };
+static const unsigned char plan_zeros[SHA256_LEN] = { 0 };
+
+static void plan_free(struct ms_plan *plan)
+{
+    if (plan) {
+        free_public(plan->script, plan->script_len);
+        wally_free(plan->tokens);
+        wally_free(plan->nodes);
+        wally_free(plan);
+    }
+}
+
+/* Split a script into tokens, returning the number found or 0 on error */
+static size_t plan_tokenize(const unsigned char *script, size_t script_len,
+                            struct plan_token *tokens)
+{
+    size_t i = 0, num_tokens = 0, num_ops = 0;
+
+    while (i < script_len) {
+        const unsigned char op = script[i++];
+        size_t push_len = 0;
+
+        if (op >= OP_PUSHDATA1 && op <= OP_PUSHDATA4)
+            return 0; /* Miniscript never uses long pushes */
+        if (op < OP_PUSHDATA1) {
+            if (op > script_len - i)
+                return 0; /* Truncated push */
+            push_len = op;
+        } else if (op > OP_16 && ++num_ops > PLAN_MAX_OPS)
+            return 0;
+        if (tokens) {
+            tokens[num_tokens].data = op < OP_PUSHDATA1 ? script + i : NULL;
+            tokens[num_tokens].len = push_len;
+            tokens[num_tokens].op = op;
+        }
+        i += push_len;
+        ++num_tokens;
+    }
+    return num_tokens;
+}
+
+static const struct plan_token *plan_peek(const struct plan_parser *p, size_t n)
+{
+    return p->pos >= n ? &p->plan->tokens[p->pos - n] : NULL;
+}
+
+static bool plan_peek_op(const struct plan_parser *p, size_t n, unsigned char op)
+{
+    const struct plan_token *tok = plan_peek(p, n);
+    return tok && !tok->data && tok->op == op;
+}
+
+static bool plan_is_push(const struct plan_token *tok, size_t len)
+{
+    return tok && tok->data && tok->len == len;
+}
+
+static bool plan_is_key(const struct plan_parser *p, const struct plan_token *tok)
+{
+    if (plan_is_push(tok, EC_PUBLIC_KEY_LEN))
+        return tok->data[0] == 0x02 || tok->data[0] == 0x03;
+    if (!p->plan->is_witness && plan_is_push(tok, EC_PUBLIC_KEY_UNCOMPRESSED_LEN))
+        return tok->data[0] == 0x04;
+    return false;
+}
+
+/* Get a positive, minimally encoded number below 2^31 */
+static bool plan_get_number(const struct plan_token *tok, uint32_t *n)
+{
+    size_t i, op_n;
+
+    if (!tok)
+        return false;
+    if (!tok->data) {
+        if (!script_is_op_n(tok->op, false, &op_n))
+            return false;
+        *n = op_n;
+        return true;
+    }
+    if (!tok->len || tok->len > sizeof(uint32_t) ||
+        tok->data[tok->len - 1] & 0x80)
+        return false; /* Zero, too large or negative */
+    if (!(tok->data[tok->len - 1] & 0x7f) &&
+        (tok->len == 1 || !(tok->data[tok->len - 2] & 0x80)))
+        return false; /* Not minimally encoded */
+    for (*n = 0, i = 0; i < tok->len; ++i)
+        *n |= (uint32_t)tok->data[i] << (i * 8);
+    return *n > 16; /* Smaller numbers must use OP_N */
+}
+
+static size_t plan_new_node(struct plan_parser *p, uint32_t kind,
+                            size_t x, size_t y, size_t z)
+{
+    struct ms_plan *plan = p->plan;
+    struct plan_node *node;
+    const size_t children[3] = { x, y, z };
+    size_t i;
+
+    if (plan->num_nodes == plan->max_nodes)
+        return PLAN_NO_NODE;
+    node = &plan->nodes[plan->num_nodes];
+    node->kind = kind;
+    node->child = node->next = PLAN_NO_NODE;
+    for (i = NUM_ELEMS(children); i; --i) {
+        if (children[i - 1] != PLAN_NO_NODE) {
+            plan->nodes[children[i - 1]].next = node->child;
+            node->child = children[i - 1];
+            ++node->n;
+        }
+    }
+    return plan->num_nodes++;
+}
+
+static size_t plan_new_leaf(struct plan_parser *p, uint32_t kind,
+                            const struct plan_token *tok, uint32_t k)
+{
+    size_t ret = plan_new_node(p, kind, PLAN_NO_NODE, PLAN_NO_NODE, PLAN_NO_NODE);
+    if (ret != PLAN_NO_NODE) {
+        p->plan->nodes[ret].tok = tok;
+        p->plan->nodes[ret].k = k;
+    }
+    return ret;
+}
+
+static size_t plan_new_wrap(struct plan_parser *p, uint32_t kind, size_t x)
+{
+    if (x == PLAN_NO_NODE)
+        return PLAN_NO_NODE;
+    return plan_new_node(p, kind, x, PLAN_NO_NODE, PLAN_NO_NODE);
+}
+
+static size_t plan_new_pair(struct plan_parser *p, uint32_t kind, size_t x, size_t y)
+{
+    if (x == PLAN_NO_NODE || y == PLAN_NO_NODE)
+        return PLAN_NO_NODE;
+    return plan_new_node(p, kind, x, y, PLAN_NO_NODE);
+}
+
+static size_t plan_new_andor(struct plan_parser *p, size_t x, size_t y, size_t z)
+{
+    if (x == PLAN_NO_NODE)
+        return PLAN_NO_NODE;
+    return plan_new_node(p, PLAN_ANDOR, x, y, z);
+}
+
+static size_t plan_parse_single(struct plan_parser *p);
+
+/* Whether the expression being parsed starts at the current position */
+static bool plan_at_expr_start(const struct plan_parser *p)
+{
+    return !p->pos || plan_peek_op(p, 1, OP_IF) || plan_peek_op(p, 1, OP_NOTIF) ||
+           plan_peek_op(p, 1, OP_ELSE) || plan_peek_op(p, 1, OP_TOALTSTACK) ||
+           plan_peek_op(p, 1, OP_SWAP);
+}
+
+/* Parse a sequence of fragments, joining them with and_v */
+static size_t plan_parse_expr(struct plan_parser *p)
+{
+    size_t y = plan_parse_single(p);
+    while (y != PLAN_NO_NODE && !plan_at_expr_start(p))
+        y = plan_new_pair(p, PLAN_AND_V, plan_parse_single(p), y);
+    return y;
+}
+
+/* Parse a W expression: a:X or s:X */
+static size_t plan_parse_w(struct plan_parser *p)
+{
+    const bool is_alt = plan_peek_op(p, 1, OP_FROMALTSTACK);
+    size_t x;
+
+    if (is_alt)
+        --p->pos;
+    x = plan_parse_expr(p);
+    if (x == PLAN_NO_NODE ||
+        !plan_peek_op(p, 1, is_alt ? OP_TOALTSTACK : OP_SWAP))
+        return PLAN_NO_NODE;
+    --p->pos;
+    return plan_new_wrap(p, is_alt ? PLAN_WRAP_A : PLAN_WRAP_S, x);
+}
+
+/* Parse a fragment ending in OP_EQUAL: a hash or thresh */
+static size_t plan_parse_equal(struct plan_parser *p)
+{
+    const struct plan_token *tok = plan_peek(p, 1);
+    uint32_t kind = PLAN_0, k;
+    size_t x, last = PLAN_NO_NODE, n = 0, ret;
+
+    if (plan_peek_op(p, 5, OP_SIZE) && plan_is_push(plan_peek(p, 4), 1) &&
+        plan_peek(p, 4)->data[0] == SHA256_LEN && plan_peek_op(p, 3, OP_EQUALVERIFY)) {
+        /* SIZE <32> EQUALVERIFY <hash op> <hash> EQUAL */
+        if (plan_peek_op(p, 2, OP_SHA256) && plan_is_push(tok, SHA256_LEN))
+            kind = PLAN_SHA256;
+        else if (plan_peek_op(p, 2, OP_HASH256) && plan_is_push(tok, SHA256_LEN))
+            kind = PLAN_HASH256;
+        else if (plan_peek_op(p, 2, OP_RIPEMD160) && plan_is_push(tok, RIPEMD160_LEN))
+            kind = PLAN_RIPEMD160;
+        else if (plan_peek_op(p, 2, OP_HASH160) && plan_is_push(tok, HASH160_LEN))
+            kind = PLAN_HASH160;
+        if (kind != PLAN_0) {
+            p->pos -= 5;
+            return plan_new_leaf(p, kind, tok, 0);
+        }
+    }
+
+    /* [X1] [X2] ADD ... [Xn] ADD <k> EQUAL */
+    if (!plan_get_number(tok, &k))
+        return PLAN_NO_NODE;
+    --p->pos;
+    while (plan_peek_op(p, 1, OP_ADD)) {
+        --p->pos;
+        if ((x = plan_parse_w(p)) == PLAN_NO_NODE)
+            return PLAN_NO_NODE;
+        p->plan->nodes[x].next = last;
+        last = x;
+        ++n;
+    }
+    if ((x = plan_parse_single(p)) == PLAN_NO_NODE || k > ++n)
+        return PLAN_NO_NODE;
+    p->plan->nodes[x].next = last;
+    ret = plan_new_leaf(p, PLAN_THRESH, NULL, k);
+    if (ret != PLAN_NO_NODE) {
+        p->plan->nodes[ret].child = x;
+        p->plan->nodes[ret].n = n;
+    }
+    return ret;
+}
+
+/* Parse <k> <key1> ... <keyn> <n> CHECKMULTISIG */
+static size_t plan_parse_multi(struct plan_parser *p)
+{
+    const struct plan_token *first;
+    uint32_t k, n, i;
+    size_t ret;
+
+    if (!plan_get_number(plan_peek(p, 1), &n) || n > PLAN_MAX_MULTI_KEYS ||
+        p->pos < n + 2)
+        return PLAN_NO_NODE;
+    --p->pos;
+    first = plan_peek(p, n);
+    for (i = 0; i < n; ++i)
+        if (!plan_is_key(p, first + i))
+            return PLAN_NO_NODE;
+    p->pos -= n;
+    if (!plan_get_number(plan_peek(p, 1), &k) || k > n)
+        return PLAN_NO_NODE;
+    --p->pos;
+    if ((ret = plan_new_leaf(p, PLAN_MULTI, first, k)) != PLAN_NO_NODE)
+        p->plan->nodes[ret].n = n;
+    return ret;
+}
+
+/* Parse a fragment ending in OP_ENDIF */
+static size_t plan_parse_endif(struct plan_parser *p)
+{
+    size_t last = plan_parse_expr(p), prev;
+
+    if (last == PLAN_NO_NODE)
+        return PLAN_NO_NODE;
+
+    if (plan_peek_op(p, 1, OP_ELSE)) {
+        --p->pos;
+        if ((prev = plan_parse_expr(p)) == PLAN_NO_NODE)
+            return PLAN_NO_NODE;
+        if (plan_peek_op(p, 1, OP_IF)) {
+            /* IF [X] ELSE [Z] ENDIF */
+            --p->pos;
+            return plan_new_pair(p, PLAN_OR_I, prev, last);
+        }
+        if (!plan_peek_op(p, 1, OP_NOTIF))
+            return PLAN_NO_NODE;
+        /* [X] NOTIF [Z] ELSE [Y] ENDIF: 'last' is Y and 'prev' is Z */
+        --p->pos;
+        return plan_new_andor(p, plan_parse_single(p), last, prev);
+    }
+
+    if (plan_peek_op(p, 1, OP_IF)) {
+        --p->pos;
+        if (plan_peek_op(p, 1, OP_DUP)) {
+            /* DUP IF [X] ENDIF */
+            --p->pos;
+            return plan_new_wrap(p, PLAN_WRAP_D, last);
+        }
+        if (plan_peek_op(p, 1, OP_0NOTEQUAL) && plan_peek_op(p, 2, OP_SIZE)) {
+            /* SIZE 0NOTEQUAL IF [X] ENDIF */
+            p->pos -= 2;
+            return plan_new_wrap(p, PLAN_WRAP_J, last);
+        }
+        return PLAN_NO_NODE;
+    }
+
+    if (!plan_peek_op(p, 1, OP_NOTIF))
+        return PLAN_NO_NODE;
+    --p->pos;
+    if (plan_peek_op(p, 1, OP_IFDUP)) {
+        /* [X] IFDUP NOTIF [Z] ENDIF */
+        --p->pos;
+        return plan_new_pair(p, PLAN_OR_D, plan_parse_single(p), last);
+    }
+    /* [X] NOTIF [Z] ENDIF */
+    return plan_new_pair(p, PLAN_OR_C, plan_parse_single(p), last);
+}
+
+/* Parse the fragment ending at tok, which has already been consumed */
+static size_t plan_parse_fragment(struct plan_parser *p, const struct plan_token *tok)
+{
+    uint32_t k;
+
+    if (tok->data) {
+        if (!tok->len)
+            return plan_new_leaf(p, PLAN_0, NULL, 0);
+        return plan_is_key(p, tok) ? plan_new_leaf(p, PLAN_PK_K, tok, 0) : PLAN_NO_NODE;
+    }
+
+    switch (tok->op) {
+    case OP_1:
+        return plan_new_leaf(p, PLAN_1, NULL, 0);
+    case OP_EQUAL:
+        return plan_parse_equal(p);
+    case OP_EQUALVERIFY:
+        if (plan_is_push(plan_peek(p, 1), HASH160_LEN) &&
+            plan_peek_op(p, 2, OP_HASH160) && plan_peek_op(p, 3, OP_DUP)) {
+            /* DUP HASH160 <hash> EQUALVERIFY */
+            tok = plan_peek(p, 1);
+            p->pos -= 3;
+            return plan_new_leaf(p, PLAN_PK_H, tok, 0);
+        }
+        return plan_new_wrap(p, PLAN_WRAP_V, plan_parse_equal(p));
+    case OP_CHECKSIG:
+        return plan_new_wrap(p, PLAN_WRAP_C, plan_parse_single(p));
+    case OP_CHECKSIGVERIFY:
+        return plan_new_wrap(p, PLAN_WRAP_V,
+                             plan_new_wrap(p, PLAN_WRAP_C, plan_parse_single(p)));
+    case OP_CHECKMULTISIG:
+        return plan_parse_multi(p);
+    case OP_CHECKMULTISIGVERIFY:
+        return plan_new_wrap(p, PLAN_WRAP_V, plan_parse_multi(p));
+    case OP_CHECKSEQUENCEVERIFY:
+    case OP_CHECKLOCKTIMEVERIFY:
+        if (!plan_get_number(plan_peek(p, 1), &k))
+            return PLAN_NO_NODE;
+        --p->pos;
+        return plan_new_leaf(p, tok->op == OP_CHECKSEQUENCEVERIFY ?
+                             PLAN_OLDER : PLAN_AFTER, NULL, k);
+    case OP_VERIFY:
+        return plan_new_wrap(p, PLAN_WRAP_V, plan_parse_single(p));
+    case OP_0NOTEQUAL:
+        return plan_new_wrap(p, PLAN_WRAP_N, plan_parse_single(p));
+    case OP_BOOLAND:
+    case OP_BOOLOR: {
+        const size_t y = plan_parse_w(p);
+        if (y == PLAN_NO_NODE)
+            return PLAN_NO_NODE;
+        return plan_new_pair(p, tok->op == OP_BOOLAND ? PLAN_AND_B : PLAN_OR_B,
+                             plan_parse_single(p), y);
+    }
+    case OP_ENDIF:
+        return plan_parse_endif(p);
+    }
+    return PLAN_NO_NODE;
+}
+
+static size_t plan_parse_single(struct plan_parser *p)
+{
+    if (!p->pos)
+        return PLAN_NO_NODE;
+    --p->pos;
+    return plan_parse_fragment(p, &p->plan->tokens[p->pos]);
+}
+
+#define PLAN_HAS(t, bits) (((t) & (bits)) == (bits))
+#define PLAN_IF(cond, bit) ((cond) ? (bit) : 0)
+
+/* Compute the type of a node from its children, or 0 if invalid */
+static uint32_t plan_node_type(const struct ms_plan *plan,
+                               const struct plan_node *node)
+{
+    const struct plan_node *x = NULL, *y = NULL, *z = NULL;
+    uint32_t tx = 0, ty = 0, tz = 0, base, num_non_z = 0;
+    bool is_o = false;
+
+    if (node->child != PLAN_NO_NODE && node->kind != PLAN_THRESH) {
+        x = &plan->nodes[node->child];
+        tx = x->type;
+        if (x->next != PLAN_NO_NODE) {
+            y = &plan->nodes[x->next];
+            ty = y->type;
+            if (y->next != PLAN_NO_NODE) {
+                z = &plan->nodes[y->next];
+                tz = z->type;
+            }
+        }
+    }
+
+    switch (node->kind) {
+    case PLAN_0:
+        return PLAN_TYPE_B | PLAN_PROP_Z | PLAN_PROP_U | PLAN_PROP_D;
+    case PLAN_1:
+        return PLAN_TYPE_B | PLAN_PROP_Z | PLAN_PROP_U;
+    case PLAN_PK_K:
+        return PLAN_TYPE_K | PLAN_PROP_O | PLAN_PROP_N | PLAN_PROP_D | PLAN_PROP_U;
+    case PLAN_PK_H:
+        return PLAN_TYPE_K | PLAN_PROP_N | PLAN_PROP_D | PLAN_PROP_U;
+    case PLAN_OLDER:
+    case PLAN_AFTER:
+        return PLAN_TYPE_B | PLAN_PROP_Z;
+    case PLAN_SHA256:
+    case PLAN_HASH256:
+    case PLAN_RIPEMD160:
+    case PLAN_HASH160:
+        return PLAN_TYPE_B | PLAN_PROP_O | PLAN_PROP_N | PLAN_PROP_D | PLAN_PROP_U;
+    case PLAN_MULTI:
+        return PLAN_TYPE_B | PLAN_PROP_N | PLAN_PROP_D | PLAN_PROP_U;
+    case PLAN_ANDOR:
+        base = ty & PLAN_TYPE_MASK;
+        if (!PLAN_HAS(tx, PLAN_TYPE_B | PLAN_PROP_D | PLAN_PROP_U) ||
+            !(base & (PLAN_TYPE_B | PLAN_TYPE_K | PLAN_TYPE_V)) ||
+            base != (tz & PLAN_TYPE_MASK))
+            return 0;
+        return base | (tx & ty & tz & PLAN_PROP_Z) |
+               PLAN_IF((PLAN_HAS(tx, PLAN_PROP_Z) && PLAN_HAS(ty & tz, PLAN_PROP_O)) ||
+                    (PLAN_HAS(tx, PLAN_PROP_O) && PLAN_HAS(ty & tz, PLAN_PROP_Z)), PLAN_PROP_O) |
+               (ty & tz & PLAN_PROP_U) | (tz & PLAN_PROP_D);
+    case PLAN_AND_V:
+        if (!PLAN_HAS(tx, PLAN_TYPE_V) ||
+            !(ty & (PLAN_TYPE_B | PLAN_TYPE_K | PLAN_TYPE_V)))
+            return 0;
+        return (ty & PLAN_TYPE_MASK) | (tx & ty & PLAN_PROP_Z) |
+               PLAN_IF((PLAN_HAS(tx, PLAN_PROP_Z) && PLAN_HAS(ty, PLAN_PROP_O)) ||
+                    (PLAN_HAS(ty, PLAN_PROP_Z) && PLAN_HAS(tx, PLAN_PROP_O)), PLAN_PROP_O) |
+               PLAN_IF(PLAN_HAS(tx, PLAN_PROP_N) ||
+                    (PLAN_HAS(tx, PLAN_PROP_Z) && PLAN_HAS(ty, PLAN_PROP_N)), PLAN_PROP_N) |
+               (ty & PLAN_PROP_U);
+    case PLAN_AND_B:
+        if (!PLAN_HAS(tx, PLAN_TYPE_B) || !PLAN_HAS(ty, PLAN_TYPE_W))
+            return 0;
+        return PLAN_TYPE_B | (tx & ty & (PLAN_PROP_Z | PLAN_PROP_D)) |
+               PLAN_IF((PLAN_HAS(tx, PLAN_PROP_Z) && PLAN_HAS(ty, PLAN_PROP_O)) ||
+                    (PLAN_HAS(ty, PLAN_PROP_Z) && PLAN_HAS(tx, PLAN_PROP_O)), PLAN_PROP_O) |
+               PLAN_IF(PLAN_HAS(tx, PLAN_PROP_N) ||
+                    (PLAN_HAS(tx, PLAN_PROP_Z) && PLAN_HAS(ty, PLAN_PROP_N)), PLAN_PROP_N) |
+               PLAN_PROP_U;
+    case PLAN_OR_B:
+        if (!PLAN_HAS(tx, PLAN_TYPE_B | PLAN_PROP_D) || !PLAN_HAS(ty, PLAN_TYPE_W | PLAN_PROP_D))
+            return 0;
+        return PLAN_TYPE_B | (tx & ty & PLAN_PROP_Z) |
+               PLAN_IF((PLAN_HAS(tx, PLAN_PROP_Z) && PLAN_HAS(ty, PLAN_PROP_O)) ||
+                    (PLAN_HAS(ty, PLAN_PROP_Z) && PLAN_HAS(tx, PLAN_PROP_O)), PLAN_PROP_O) |
+               PLAN_PROP_D | PLAN_PROP_U;
+    case PLAN_OR_C:
+        if (!PLAN_HAS(tx, PLAN_TYPE_B | PLAN_PROP_D | PLAN_PROP_U) || !PLAN_HAS(ty, PLAN_TYPE_V))
+            return 0;
+        return PLAN_TYPE_V | (tx & ty & PLAN_PROP_Z) |
+               PLAN_IF(PLAN_HAS(tx, PLAN_PROP_O) && PLAN_HAS(ty, PLAN_PROP_Z), PLAN_PROP_O);
+    case PLAN_OR_D:
+        if (!PLAN_HAS(tx, PLAN_TYPE_B | PLAN_PROP_D | PLAN_PROP_U) || !PLAN_HAS(ty, PLAN_TYPE_B))
+            return 0;
+        return PLAN_TYPE_B | (tx & ty & PLAN_PROP_Z) |
+               PLAN_IF(PLAN_HAS(tx, PLAN_PROP_O) && PLAN_HAS(ty, PLAN_PROP_Z), PLAN_PROP_O) |
+               (ty & (PLAN_PROP_D | PLAN_PROP_U));
+    case PLAN_OR_I:
+        base = tx & PLAN_TYPE_MASK;
+        if (!(base & (PLAN_TYPE_B | PLAN_TYPE_K | PLAN_TYPE_V)) ||
+            base != (ty & PLAN_TYPE_MASK))
+            return 0;
+        return base | PLAN_IF(PLAN_HAS(tx & ty, PLAN_PROP_Z), PLAN_PROP_O) |
+               (tx & ty & PLAN_PROP_U) | ((tx | ty) & PLAN_PROP_D);
+    case PLAN_THRESH:
+        for (x = &plan->nodes[node->child]; ; x = &plan->nodes[x->next]) {
+            base = x == &plan->nodes[node->child] ? PLAN_TYPE_B : PLAN_TYPE_W;
+            if (!PLAN_HAS(x->type, base | PLAN_PROP_D | PLAN_PROP_U))
+                return 0;
+            if (!PLAN_HAS(x->type, PLAN_PROP_Z)) {
+                ++num_non_z;
+                is_o = PLAN_HAS(x->type, PLAN_PROP_O);
+            }
+            if (x->next == PLAN_NO_NODE)
+                break;
+        }
+        return PLAN_TYPE_B | PLAN_IF(!num_non_z, PLAN_PROP_Z) |
+               PLAN_IF(num_non_z == 1 && is_o, PLAN_PROP_O) |
+               PLAN_PROP_D | PLAN_PROP_U;
+    case PLAN_WRAP_A:
+        if (!PLAN_HAS(tx, PLAN_TYPE_B))
+            return 0;
+        return PLAN_TYPE_W | (tx & (PLAN_PROP_D | PLAN_PROP_U));
+    case PLAN_WRAP_S:
+        if (!PLAN_HAS(tx, PLAN_TYPE_B | PLAN_PROP_O))
+            return 0;
+        return PLAN_TYPE_W | (tx & (PLAN_PROP_D | PLAN_PROP_U));
+    case PLAN_WRAP_C:
+        if (!PLAN_HAS(tx, PLAN_TYPE_K))
+            return 0;
+        return PLAN_TYPE_B | (tx & (PLAN_PROP_O | PLAN_PROP_N | PLAN_PROP_D)) |
+               PLAN_PROP_U;
+    case PLAN_WRAP_D:
+        if (!PLAN_HAS(tx, PLAN_TYPE_V | PLAN_PROP_Z))
+            return 0;
+        /* Not 'u' outside of tapscript, as IF does not require MINIMALIF */
+        return PLAN_TYPE_B | PLAN_PROP_O | PLAN_PROP_N | PLAN_PROP_D;
+    case PLAN_WRAP_V:
+        if (!PLAN_HAS(tx, PLAN_TYPE_B))
+            return 0;
+        return PLAN_TYPE_V | (tx & (PLAN_PROP_Z | PLAN_PROP_O | PLAN_PROP_N));
+    case PLAN_WRAP_J:
+        if (!PLAN_HAS(tx, PLAN_TYPE_B | PLAN_PROP_N))
+            return 0;
+        return PLAN_TYPE_B | (tx & (PLAN_PROP_O | PLAN_PROP_U)) |
+               PLAN_PROP_N | PLAN_PROP_D;
+    case PLAN_WRAP_N:
+        if (!PLAN_HAS(tx, PLAN_TYPE_B))
+            return 0;
+        return PLAN_TYPE_B |
+               (tx & (PLAN_PROP_Z | PLAN_PROP_O | PLAN_PROP_N | PLAN_PROP_D)) |
+               PLAN_PROP_U;
+    }
+    (void)z;
+    return 0;
+}
+
+static int plan_parse(const unsigned char *script, size_t script_len,
+                      bool is_witness, struct ms_plan **output)
+{
+    struct plan_parser p = { NULL, 0 };
+    size_t num_tokens, top, i;
+    int ret = WALLY_ENOMEM;
+
+    *output = NULL;
+    if (!(num_tokens = plan_tokenize(script, script_len, NULL)))
+        return WALLY_EINVAL;
+
+    if (!(p.plan = wally_calloc(sizeof(*p.plan))) ||
+        !clone_bytes(&p.plan->script, script, script_len) ||
+        !(p.plan->tokens = wally_calloc(num_tokens * sizeof(*p.plan->tokens))))
+        goto fail;
+    p.plan->script_len = script_len;
+    p.plan->num_tokens = num_tokens;
+    p.plan->is_witness = is_witness;
+    plan_tokenize(p.plan->script, script_len, p.plan->tokens);
+
+    /* Each token produces at most two nodes, plus one and_v to join it */
+    p.plan->max_nodes = num_tokens * 3;
+    if (!(p.plan->nodes = wally_calloc(p.plan->max_nodes * sizeof(*p.plan->nodes))))
+        goto fail;
+
+    ret = WALLY_EINVAL;
+    p.pos = num_tokens;
+    top = plan_parse_expr(&p);
+    if (top == PLAN_NO_NODE || p.pos || top != p.plan->num_nodes - 1)
+        goto fail; /* Not miniscript, or trailing script */
+
+    for (i = 0; i < p.plan->num_nodes; ++i)
+        if (!(p.plan->nodes[i].type = plan_node_type(p.plan, &p.plan->nodes[i])))
+            goto fail;
+    if (!PLAN_HAS(p.plan->nodes[top].type, PLAN_TYPE_B))
+        goto fail;
+
+    *output = p.plan;
+    return WALLY_OK;
+fail:
+    plan_free(p.plan);
+    return ret;
+}
+
+static size_t plan_cost_add(size_t a, size_t b)
+{
+    return a == PLAN_NO_COST || b == PLAN_NO_COST ? PLAN_NO_COST : a + b;
+}
+
+/* Return the cheaper of two costs, preferring the first on a tie */
+static size_t plan_cost_min(size_t a, size_t b, unsigned char *alt)
+{
+    *alt = b < a;
+    return b < a ? b : a;
+}
+
+/* The cost of a witness element of len bytes */
+static size_t plan_elem_cost(size_t len)
+{
+    return len + (len < 0xfd ? 1 : 3);
+}
+
+static const struct plan_node *plan_child(const struct ms_plan *plan,
+                                          const struct plan_node *node, size_t n)
+{
+    size_t i = node->child;
+    while (n--)
+        i = plan->nodes[i].next;
+    return &plan->nodes[i];
+}
+
+/* Find a public key in a map whose HASH160 matches hash */
+static const struct wally_map_item *plan_find_hashed_key(const struct ms_plan *plan,
+                                                         const struct wally_map *map,
+                                                         const unsigned char *hash)
+{
+    unsigned char key_hash[HASH160_LEN];
+    size_t i;
+
+    for (i = 0; map && i < map->num_items; ++i) {
+        const struct wally_map_item *item = &map->items[i];
+        if ((item->key_len == EC_PUBLIC_KEY_LEN ||
+             (!plan->is_witness && item->key_len == EC_PUBLIC_KEY_UNCOMPRESSED_LEN)) &&
+            wally_hash160(item->key, item->key_len,
+                          key_hash, sizeof(key_hash)) == WALLY_OK &&
+            !memcmp(key_hash, hash, sizeof(key_hash)))
+            return item;
+    }
+    return NULL;
+}
+
+static const struct wally_map_item *plan_find_preimage(const struct wally_map *map,
+                                                       const struct plan_node *node)
+{
+    static const unsigned char types[] = {
+        PSBT_IN_SHA256, PSBT_IN_HASH256, PSBT_IN_RIPEMD160, PSBT_IN_HASH160
+    };
+    unsigned char key[1 + SHA256_LEN];
+    const struct wally_map_item *item;
+
+    key[0] = types[node->kind - PLAN_SHA256];
+    memcpy(key + 1, node->tok->data, node->tok->len);
+    item = map ? wally_map_get(map, key, node->tok->len + 1) : NULL;
+    /* The SIZE check in the script requires a 32 byte preimage */
+    return item && item->value_len == SHA256_LEN ? item : NULL;
+}
+
+static bool plan_is_older_satisfied(const struct ms_plan_data *data, uint32_t n)
+{
+    const uint32_t mask = (1u << 22u) | 0xffff;
+    if (data->tx_version < 2 || (data->sequence & (1u << 31u)) ||
+        ((data->sequence ^ n) & (1u << 22u)))
+        return false; /* Relative locktime disabled, or of a different type */
+    return (data->sequence & mask) >= (n & mask);
+}
+
+static bool plan_is_after_satisfied(const struct ms_plan_data *data, uint32_t n)
+{
+    const uint32_t threshold = 500000000u; /* Block heights are below this */
+    if (data->sequence == 0xffffffff ||
+        (data->locktime < threshold) != (n < threshold))
+        return false; /* Locktime disabled, or of a different type */
+    return data->locktime >= n;
+}
+
+/* Select the cheapest k signatures for a multi, in key order */
+static size_t plan_select_multi_sigs(const struct plan_node *node,
+                                     const struct ms_plan_data *data,
+                                     const struct wally_map_item **sigs)
+{
+    size_t i, j, cost = 1; /* Dummy element for CHECKMULTISIG */
+    bool chosen[PLAN_MAX_MULTI_KEYS] = { false };
+
+    for (i = 0; i < node->n; ++i)
+        sigs[i] = wally_map_get(data->signatures,
+                                node->tok[i].data, node->tok[i].len);
+    for (i = 0; i < node->k; ++i) {
+        size_t best = node->n;
+        for (j = 0; j < node->n; ++j)
+            if (sigs[j] && !chosen[j] &&
+                (best == node->n || sigs[j]->value_len < sigs[best]->value_len))
+                best = j;
+        if (best == node->n)
+            return PLAN_NO_COST; /* Not enough signatures */
+        chosen[best] = true;
+        cost += plan_elem_cost(sigs[best]->value_len);
+    }
+    for (i = 0; i < node->n; ++i)
+        if (!chosen[i])
+            sigs[i] = NULL;
+    return cost;
+}
+
+/* Choose which children of a thresh to satisfy, returning the sat cost */
+static size_t plan_select_thresh_children(struct ms_plan *plan, struct plan_node *node)
+{
+    struct plan_node *c, *best;
+    size_t i, cost = 0, num_sat = 0;
+
+    for (i = node->child; i != PLAN_NO_NODE; i = c->next) {
+        c = &plan->nodes[i];
+        /* Children that cannot be dissatisfied must be satisfied */
+        c->use_sat = c->dsat == PLAN_NO_COST;
+        cost = plan_cost_add(cost, c->use_sat ? c->sat : c->dsat);
+        num_sat += c->use_sat;
+    }
+    if (cost == PLAN_NO_COST || num_sat > node->k)
+        return PLAN_NO_COST;
+
+    for (; num_sat < node->k; ++num_sat) {
+        best = NULL;
+        for (i = node->child; i != PLAN_NO_NODE; i = c->next) {
+            c = &plan->nodes[i];
+            if (!c->use_sat && c->sat != PLAN_NO_COST &&
+                (!best || c->sat + best->dsat < best->sat + c->dsat))
+                best = c;
+        }
+        if (!best)
+            return PLAN_NO_COST;
+        best->use_sat = true;
+        cost = cost - best->dsat + best->sat;
+    }
+    return cost;
+}
+
+static void plan_node_costs(struct ms_plan *plan, struct plan_node *node,
+                            const struct ms_plan_data *data)
+{
+    const struct plan_node *x = NULL, *y = NULL, *z = NULL;
+    const struct wally_map_item *sigs[PLAN_MAX_MULTI_KEYS];
+    const struct wally_map_item *item;
+    size_t i, cost;
+
+    node->sat = node->dsat = PLAN_NO_COST;
+    node->sat_alt = node->dsat_alt = 0;
+    if (node->child != PLAN_NO_NODE && node->kind != PLAN_THRESH) {
+        x = plan_child(plan, node, 0);
+        y = node->n > 1 ? plan_child(plan, node, 1) : NULL;
+        z = node->n > 2 ? plan_child(plan, node, 2) : NULL;
+    }
+
+    switch (node->kind) {
+    case PLAN_0:
+        node->dsat = 0;
+        break;
+    case PLAN_1:
+        node->sat = 0;
+        break;
+    case PLAN_PK_K:
+        node->item = wally_map_get(data->signatures, node->tok->data, node->tok->len);
+        if (node->item)
+            node->sat = plan_elem_cost(node->item->value_len);
+        node->dsat = plan_elem_cost(0);
+        break;
+    case PLAN_PK_H:
+        node->item = plan_find_hashed_key(plan, data->signatures, node->tok->data);
+        if (!(item = node->item))
+            item = plan_find_hashed_key(plan, data->keypaths, node->tok->data);
+        if (!item)
+            break; /* Key not known */
+        node->key = item->key;
+        node->key_len = item->key_len;
+        if (node->item)
+            node->sat = plan_elem_cost(node->item->value_len) + plan_elem_cost(item->key_len);
+        node->dsat = plan_elem_cost(0) + plan_elem_cost(item->key_len);
+        break;
+    case PLAN_OLDER:
+        if (plan_is_older_satisfied(data, node->k))
+            node->sat = 0;
+        break;
+    case PLAN_AFTER:
+        if (plan_is_after_satisfied(data, node->k))
+            node->sat = 0;
+        break;
+    case PLAN_SHA256:
+    case PLAN_HASH256:
+    case PLAN_RIPEMD160:
+    case PLAN_HASH160:
+        if ((node->item = plan_find_preimage(data->preimages, node)))
+            node->sat = plan_elem_cost(SHA256_LEN);
+        node->dsat = plan_elem_cost(SHA256_LEN);
+        break;
+    case PLAN_MULTI:
+        node->sat = plan_select_multi_sigs(node, data, sigs);
+        node->dsat = plan_elem_cost(0) * (node->k + 1);
+        break;
+    case PLAN_ANDOR:
+        node->sat = plan_cost_min(plan_cost_add(y->sat, x->sat),
+                             plan_cost_add(z->sat, x->dsat), &node->sat_alt);
+        node->dsat = plan_cost_add(z->dsat, x->dsat);
+        break;
+    case PLAN_AND_V:
+        node->sat = plan_cost_add(y->sat, x->sat);
+        break;
+    case PLAN_AND_B:
+        node->sat = plan_cost_add(y->sat, x->sat);
+        node->dsat = plan_cost_add(y->dsat, x->dsat);
+        break;
+    case PLAN_OR_B:
+        node->sat = plan_cost_min(plan_cost_add(y->dsat, x->sat),
+                             plan_cost_add(y->sat, x->dsat), &node->sat_alt);
+        node->dsat = plan_cost_add(y->dsat, x->dsat);
+        break;
+    case PLAN_OR_C:
+    case PLAN_OR_D:
+        node->sat = plan_cost_min(x->sat, plan_cost_add(y->sat, x->dsat), &node->sat_alt);
+        if (node->kind == PLAN_OR_D)
+            node->dsat = plan_cost_add(y->dsat, x->dsat);
+        break;
+    case PLAN_OR_I:
+        node->sat = plan_cost_min(plan_cost_add(x->sat, plan_elem_cost(1)),
+                             plan_cost_add(y->sat, plan_elem_cost(0)), &node->sat_alt);
+        node->dsat = plan_cost_min(plan_cost_add(x->dsat, plan_elem_cost(1)),
+                              plan_cost_add(y->dsat, plan_elem_cost(0)), &node->dsat_alt);
+        break;
+    case PLAN_THRESH:
+        for (cost = 0, i = node->child; i != PLAN_NO_NODE; i = plan->nodes[i].next)
+            cost = plan_cost_add(cost, plan->nodes[i].dsat);
+        node->dsat = cost;
+        node->sat = plan_select_thresh_children(plan, node);
+        break;
+    case PLAN_WRAP_A:
+    case PLAN_WRAP_S:
+    case PLAN_WRAP_C:
+    case PLAN_WRAP_N:
+        node->sat = x->sat;
+        node->dsat = x->dsat;
+        break;
+    case PLAN_WRAP_D:
+        node->sat = plan_cost_add(x->sat, plan_elem_cost(1));
+        node->dsat = plan_elem_cost(0);
+        break;
+    case PLAN_WRAP_V:
+        node->sat = x->sat;
+        break;
+    case PLAN_WRAP_J:
+        node->sat = x->sat;
+        node->dsat = plan_elem_cost(0);
+        break;
+    }
+}
+
+static int plan_emit(const struct ms_plan *plan, const struct plan_node *node,
+                     bool is_sat, const struct ms_plan_data *data,
+                     struct wally_tx_witness_stack *stack);
+
+static int plan_emit_bytes(struct wally_tx_witness_stack *stack,
+                           const unsigned char *bytes, size_t bytes_len)
+{
+    if (!bytes_len)
+        return wally_tx_witness_stack_add_dummy(stack, WALLY_TX_DUMMY_NULL);
+    return wally_tx_witness_stack_add(stack, bytes, bytes_len);
+}
+
+/* Emit two children in witness order, i.e. the second child first */
+static int plan_emit_pair(const struct ms_plan *plan,
+                          const struct plan_node *first, bool first_sat,
+                          const struct plan_node *second, bool second_sat,
+                          const struct ms_plan_data *data,
+                          struct wally_tx_witness_stack *stack)
+{
+    int ret = plan_emit(plan, second, second_sat, data, stack);
+    if (ret == WALLY_OK)
+        ret = plan_emit(plan, first, first_sat, data, stack);
+    return ret;
+}
+
+/* Emit thresh children from the last to the first */
+static int plan_emit_thresh(const struct ms_plan *plan, const struct plan_node *c,
+                            bool is_sat, const struct ms_plan_data *data,
+                            struct wally_tx_witness_stack *stack)
+{
+    int ret = WALLY_OK;
+    if (c->next != PLAN_NO_NODE)
+        ret = plan_emit_thresh(plan, &plan->nodes[c->next], is_sat, data, stack);
+    if (ret == WALLY_OK)
+        ret = plan_emit(plan, c, is_sat && c->use_sat, data, stack);
+    return ret;
+}
+
+static int plan_emit(const struct ms_plan *plan, const struct plan_node *node,
+                     bool is_sat, const struct ms_plan_data *data,
+                     struct wally_tx_witness_stack *stack)
+{
+    const struct plan_node *x = NULL, *y = NULL, *z = NULL;
+    const struct wally_map_item *sigs[PLAN_MAX_MULTI_KEYS] = { NULL };
+    size_t i;
+    int ret = WALLY_OK;
+
+    if (node->child != PLAN_NO_NODE && node->kind != PLAN_THRESH) {
+        x = plan_child(plan, node, 0);
+        y = node->n > 1 ? plan_child(plan, node, 1) : NULL;
+        z = node->n > 2 ? plan_child(plan, node, 2) : NULL;
+    }
+
+    switch (node->kind) {
+    case PLAN_0:
+    case PLAN_1:
+    case PLAN_OLDER:
+    case PLAN_AFTER:
+        break; /* Nothing to push */
+    case PLAN_PK_K:
+        return is_sat ? plan_emit_bytes(stack, node->item->value, node->item->value_len) :
+                        plan_emit_bytes(stack, NULL, 0);
+    case PLAN_PK_H:
+        if (is_sat)
+            ret = plan_emit_bytes(stack, node->item->value, node->item->value_len);
+        else
+            ret = plan_emit_bytes(stack, NULL, 0);
+        if (ret == WALLY_OK)
+            ret = plan_emit_bytes(stack, node->key, node->key_len);
+        break;
+    case PLAN_SHA256:
+    case PLAN_HASH256:
+    case PLAN_RIPEMD160:
+    case PLAN_HASH160:
+        return is_sat ? plan_emit_bytes(stack, node->item->value, node->item->value_len) :
+                        plan_emit_bytes(stack, plan_zeros, sizeof(plan_zeros));
+    case PLAN_MULTI:
+        if (is_sat)
+            plan_select_multi_sigs(node, data, sigs);
+        ret = plan_emit_bytes(stack, NULL, 0);
+        for (i = 0; ret == WALLY_OK && i < node->n; ++i)
+            if (is_sat && sigs[i])
+                ret = plan_emit_bytes(stack, sigs[i]->value, sigs[i]->value_len);
+        for (i = 0; ret == WALLY_OK && !is_sat && i < node->k; ++i)
+            ret = plan_emit_bytes(stack, NULL, 0);
+        break;
+    case PLAN_ANDOR:
+        if (is_sat && !node->sat_alt)
+            return plan_emit_pair(plan, x, true, y, true, data, stack);
+        return plan_emit_pair(plan, x, false, z, is_sat, data, stack);
+    case PLAN_AND_V:
+    case PLAN_AND_B:
+        return plan_emit_pair(plan, x, is_sat, y, is_sat, data, stack);
+    case PLAN_OR_B:
+        if (is_sat)
+            return plan_emit_pair(plan, x, !node->sat_alt, y, node->sat_alt, data, stack);
+        return plan_emit_pair(plan, x, false, y, false, data, stack);
+    case PLAN_OR_C:
+    case PLAN_OR_D:
+        if (is_sat && !node->sat_alt)
+            return plan_emit(plan, x, true, data, stack);
+        return plan_emit_pair(plan, x, false, y, is_sat, data, stack);
+    case PLAN_OR_I:
+        if (!(is_sat ? node->sat_alt : node->dsat_alt)) {
+            if ((ret = plan_emit(plan, x, is_sat, data, stack)) == WALLY_OK)
+                ret = plan_emit_bytes(stack, plan_one, sizeof(plan_one));
+        } else if ((ret = plan_emit(plan, y, is_sat, data, stack)) == WALLY_OK)
+            ret = plan_emit_bytes(stack, NULL, 0);
+        break;
+    case PLAN_THRESH:
+        return plan_emit_thresh(plan, &plan->nodes[node->child], is_sat, data, stack);
+    case PLAN_WRAP_A:
+    case PLAN_WRAP_S:
+    case PLAN_WRAP_C:
+    case PLAN_WRAP_N:
+    case PLAN_WRAP_V:
+        return plan_emit(plan, x, is_sat, data, stack);
+    case PLAN_WRAP_D:
+        if (!is_sat)
+            return plan_emit_bytes(stack, NULL, 0);
+        if ((ret = plan_emit(plan, x, true, data, stack)) == WALLY_OK)
+            ret = plan_emit_bytes(stack, plan_one, sizeof(plan_one));
+        break;
+    case PLAN_WRAP_J:
+        if (!is_sat)
+            return plan_emit_bytes(stack, NULL, 0);
+        return plan_emit(plan, x, true, data, stack);
+    }
+    return ret;
+}
+
+int ms_plan_satisfy(struct ms_plan *plan, const struct ms_plan_data *data,
+                    struct wally_tx_witness_stack **output)
+{
+    const struct plan_node *top;
+    size_t i;
+    int ret;
+
+    OUTPUT_CHECK;
+    if (!plan || !data)
+        return WALLY_EINVAL;
+
+    /* Children precede their parents, so costs are computed bottom up */
+    for (i = 0; i < plan->num_nodes; ++i)
+        plan_node_costs(plan, &plan->nodes[i], data);
+    top = &plan->nodes[plan->num_nodes - 1];
+    if (top->sat == PLAN_NO_COST)
+        return WALLY_EINVAL; /* Cannot be satisfied */
+
+    ret = wally_tx_witness_stack_init_alloc(4, output);
+    if (ret == WALLY_OK)
+        ret = plan_emit(plan, top, true, data, *output);
+    if (ret != WALLY_OK) {
+        wally_tx_witness_stack_free(*output);
+        *output = NULL;
+    }
+    return ret;
+}
+
+static struct ms_plan_cache_slot *plan_cache_slot(const struct ms_plan_cache *cache,
+                                                  const unsigned char *hash,
+                                                  bool is_witness)
+{
+    const size_t mask = cache->num_slots - 1;
+    uint32_t h;
+    size_t i;
+
+    memcpy(&h, hash, sizeof(h)); /* hash is already uniformly distributed */
+    for (i = h & mask; cache->slots[i].is_used; i = (i + 1) & mask)
+        if (cache->slots[i].is_witness == is_witness &&
+            !memcmp(cache->slots[i].hash, hash, SHA256_LEN))
+            break;
+    return &cache->slots[i];
+}
+
+/* Resize the slots to hold at least num_items at a load factor of 1/2 */
+static int plan_cache_reserve(struct ms_plan_cache *cache, size_t num_items)
+{
+    struct ms_plan_cache_slot *old = cache->slots;
+    size_t num_slots = PLAN_CACHE_MIN_SLOTS, old_num_slots = cache->num_slots, i;
+
+    while (num_slots < num_items * 2)
+        num_slots *= 2;
+    if (num_slots <= old_num_slots)
+        return WALLY_OK;
+    if (!(cache->slots = wally_calloc(num_slots * sizeof(*cache->slots)))) {
+        cache->slots = old;
+        return WALLY_ENOMEM;
+    }
+    cache->num_slots = num_slots;
+    for (i = 0; i < old_num_slots; ++i)
+        if (old[i].is_used)
+            *plan_cache_slot(cache, old[i].hash, old[i].is_witness) = old[i];
+    wally_free(old);
+    return WALLY_OK;
+}
+
+int ms_plan_cache_get(struct ms_plan_cache *cache,
+                      const unsigned char *script, size_t script_len,
+                      bool is_witness, struct ms_plan **output)
+{
+    unsigned char hash[SHA256_LEN];
+    struct ms_plan_cache_slot *slot = NULL;
+    int ret;
+
+    OUTPUT_CHECK;
+    if (!cache || !script || !script_len)
+        return WALLY_EINVAL;
+
+    if ((ret = wally_sha256(script, script_len, hash, sizeof(hash))) != WALLY_OK)
+        return ret;
+    if (cache->num_slots)
+        slot = plan_cache_slot(cache, hash, is_witness);
+    if (!slot || !slot->is_used) {
+        if ((ret = plan_cache_reserve(cache, cache->num_items + 1)) != WALLY_OK)
+            return ret;
+        slot = plan_cache_slot(cache, hash, is_witness);
+        ret = plan_parse(script, script_len, is_witness, &slot->plan);
+        if (ret == WALLY_ENOMEM)
+            return ret; /* Don't cache allocation failures */
+        memcpy(slot->hash, hash, sizeof(hash));
+        slot->is_witness = is_witness;
+        slot->is_used = true;
+        cache->num_items += 1;
+    }
+    *output = slot->plan;
+    return *output ? WALLY_OK : WALLY_EINVAL;
+}
+
+void ms_plan_cache_clear(struct ms_plan_cache *cache)
+{
+    size_t i;
+
+    if (cache) {
+        for (i = 0; i < cache->num_slots; ++i)
+            plan_free(cache->slots[i].plan);
+        wally_free(cache->slots);
+        wally_clear(cache, sizeof(*cache));
+    }
+}
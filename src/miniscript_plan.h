@@ -0,0 +1,50 @@
+#ifndef LIBWALLY_CORE_MINISCRIPT_PLAN_H
+#define LIBWALLY_CORE_MINISCRIPT_PLAN_H 1
+
+#include <include/wally_map.h>
+#include <stdbool.h>
+
+/* A satisfaction plan: a miniscript witness or redeem script parsed from
+ * its compiled form, ready to be satisfied from per-input data.
+ */
+struct ms_plan;
+struct ms_plan_cache_slot;
+struct wally_tx_witness_stack;
+
+/* Per-input data used to satisfy a plan */
+struct ms_plan_data {
+    const struct wally_map *signatures; /* DER signatures keyed by pubkey */
+    const struct wally_map *keypaths; /* Keyed by pubkey, used to find pk_h keys */
+    const struct wally_map *preimages; /* Preimages keyed by PSBT keytype + hash */
+    uint32_t tx_version;
+    uint32_t sequence;
+    uint32_t locktime;
+};
+
+/* A cache of plans keyed by script, so that inputs spending the same
+ * script share one plan. Must be zero initialized before use, and
+ * released with ms_plan_cache_clear.
+ */
+struct ms_plan_cache {
+    struct ms_plan_cache_slot *slots;
+    size_t num_slots; /* Always a power of two */
+    size_t num_items;
+};
+
+/* Get the plan for a script, parsing it if it is not already cached.
+ * Returns WALLY_EINVAL if the script is not valid miniscript.
+ * The plan is owned by the cache */
+int ms_plan_cache_get(struct ms_plan_cache *cache,
+                      const unsigned char *script, size_t script_len,
+                      bool is_witness, struct ms_plan **output);
+
+/* Free all cached plans, leaving the cache empty */
+void ms_plan_cache_clear(struct ms_plan_cache *cache);
+
+/* Create the cheapest witness stack satisfying a plan from the given
+ * data, not including the script itself. Returns WALLY_EINVAL if the
+ * data given cannot satisfy the plan */
+int ms_plan_satisfy(struct ms_plan *plan, const struct ms_plan_data *data,
+                    struct wally_tx_witness_stack **output);
+
+#endif /* LIBWALLY_CORE_MINISCRIPT_PLAN_H */
@@ -62,38 +62,41 @@ char *mnemonic_from_bytes(const struct words *w, const unsigned char *bytes, siz
 int mnemonic_to_bytes(const struct words *w, const char *mnemonic,
                       unsigned char *bytes_out, size_t len, size_t *written)
 {
-    struct words *mnemonic_w = NULL;
-    size_t i;
+    const char *p;
+    size_t i, num_words = 1u; /* Always 1 less separator than words */
 
     if (written)
         *written = 0;
 
-    if (!w || !bytes_out || !len)
+    if (!w || !mnemonic || !bytes_out || !len)
         return WALLY_EINVAL;
 
-    mnemonic_w = wordlist_init(mnemonic);
+    for (p = mnemonic; *p; ++p)
+        num_words += *p == ' '; /* FIXME: utf-8 sep */
 
-    if (!mnemonic_w)
-        return WALLY_ENOMEM;
-
-    if ((mnemonic_w->len * w->bits + 7u) / 8u > len)
+    if ((num_words * w->bits + 7u) / 8u > len)
         goto cleanup; /* Return the length we would have written */
 
     wally_clear(bytes_out, len);
 
-    for (i = 0; i < mnemonic_w->len; ++i) {
-        size_t idx = wordlist_lookup_word(w, mnemonic_w->indices[i]);
+    /* Look up each word in place, without copying the mnemonic */
+    for (i = 0, p = mnemonic; i < num_words; ++i) {
+        const char *end = p;
+        size_t idx;
+
+        while (*end && *end != ' ') /* FIXME: utf-8 sep */
+            ++end;
+        idx = wordlist_lookup_word_n(w, p, end - p);
         if (!idx) {
-            wordlist_free(mnemonic_w);
             wally_clear(bytes_out, len);
             return WALLY_EINVAL;
         }
         store_index(w->bits, bytes_out, i, idx - 1);
+        p = end + 1;
     }
 
 cleanup:
     if (written)
-        *written = (mnemonic_w->len * w->bits + 7u) / 8u;
-    wordlist_free(mnemonic_w);
+        *written = (num_words * w->bits + 7u) / 8u;
     return WALLY_OK;
 }
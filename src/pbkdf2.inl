@@ -17,12 +17,12 @@ int SHA_POST(wally_pbkdf2_hmac_)(const unsigned char *pass, size_t pass_len,
                                  uint32_t flags, uint32_t cost,
                                  unsigned char *bytes_out, size_t len)
 {
-    unsigned char *tmp_salt = NULL;
-    struct SHA_T d1, d2, *sha_cp;
-    size_t n, c, j;
+    unsigned char *tmp_salt;
+    struct SHA_T *d1, *d2, *sha_cp;
+    size_t tmp_len, n, c, j;
 
     BUILD_ASSERT(sizeof(beint32_t) == PBKDF2_HMAC_EXTRA_LEN);
-    BUILD_ASSERT(sizeof(d1) == PBKDF2_HMAC_SHA_LEN);
+    BUILD_ASSERT(sizeof(*d1) == PBKDF2_HMAC_SHA_LEN);
 
     if (!bytes_out || !len)
         return WALLY_EINVAL;
@@ -33,9 +33,13 @@ int SHA_POST(wally_pbkdf2_hmac_)(const unsigned char *pass, size_t pass_len,
     if (!len || len % PBKDF2_HMAC_SHA_LEN)
         return WALLY_EINVAL;
 
-    tmp_salt = wally_malloc(salt_len + PBKDF2_HMAC_EXTRA_LEN);
-    if (!tmp_salt)
+    /* Intermediate results and the salt are held in secure memory */
+    tmp_len = sizeof(*d1) * 2 + salt_len + PBKDF2_HMAC_EXTRA_LEN;
+    d1 = secure_alloc(NULL, tmp_len);
+    if (!d1)
         return WALLY_ENOMEM;
+    d2 = d1 + 1;
+    tmp_salt = (unsigned char *)(d2 + 1);
     memcpy(tmp_salt, salt, salt_len);
     salt_len += PBKDF2_HMAC_EXTRA_LEN;
 
@@ -43,21 +47,21 @@ int SHA_POST(wally_pbkdf2_hmac_)(const unsigned char *pass, size_t pass_len,
     if (alignment_ok(bytes_out, sizeof(SHA_ALIGN_T)))
         sha_cp = (void *)bytes_out;
     else
-        sha_cp = &d2;
+        sha_cp = d2;
 
     for (n = 0; n < len / PBKDF2_HMAC_SHA_LEN; ++n) {
         beint32_t block = cpu_to_be32(n + 1); /* Block number */
 
         memcpy(tmp_salt + salt_len - sizeof(block), &block, sizeof(block));
-        SHA_POST_IMPL(hmac_)(&d1, pass, pass_len, tmp_salt, salt_len);
-        memcpy(sha_cp, &d1, sizeof(d1));
+        SHA_POST_IMPL(hmac_)(d1, pass, pass_len, tmp_salt, salt_len);
+        memcpy(sha_cp, d1, sizeof(*d1));
 
         for (c = 0; cost && c < cost - 1; ++c) {
-            SHA_POST_IMPL(hmac_)(&d1, pass, pass_len, d1.u.u8, sizeof(d1));
-            for (j = 0; j < sizeof(d1.u.SHA_MEM)/sizeof(d1.u.SHA_MEM[0]); ++j)
-                sha_cp->u.SHA_MEM[j] ^= d1.u.SHA_MEM[j];
+            SHA_POST_IMPL(hmac_)(d1, pass, pass_len, d1->u.u8, sizeof(*d1));
+            for (j = 0; j < sizeof(d1->u.SHA_MEM)/sizeof(d1->u.SHA_MEM[0]); ++j)
+                sha_cp->u.SHA_MEM[j] ^= d1->u.SHA_MEM[j];
         }
-        if (sha_cp == &d2)
+        if (sha_cp == d2)
             memcpy(bytes_out, sha_cp, sizeof(*sha_cp));
         else
             ++sha_cp;
@@ -65,10 +69,6 @@ int SHA_POST(wally_pbkdf2_hmac_)(const unsigned char *pass, size_t pass_len,
         bytes_out += PBKDF2_HMAC_SHA_LEN;
     }
 
-    wally_clear_2(&d1, sizeof(d1), &d2, sizeof(d2));
-    if (tmp_salt) {
-        wally_clear(tmp_salt, salt_len);
-        wally_free(tmp_salt);
-    }
+    secure_free(d1, NULL, tmp_len);
     return WALLY_OK;
 }
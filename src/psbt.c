@@ -6,6 +6,7 @@
 #include <include/wally_psbt_members.h>
 
 #include <limits.h>
+#include "miniscript_plan.h"
 #include "psbt_io.h"
 #include "script_int.h"
 #include "script.h"
@@ -14,7 +15,7 @@
 
 /* TODO:
  * - When setting utxo in an input via the psbt (in the SWIG
- *   case), check the txid matches the input (see is_matching_txid() call
+ *   case), check the txid matches the input (see is_matching_utxo() call
  *   in the signing code).
  * - When signing, validate the existing signatures and refuse to sign if
  *   any are incorrect. This prevents others pretending to sign and then
@@ -73,23 +74,172 @@ static int tx_clone_alloc(const struct wally_tx *src, struct wally_tx **dst) {
     return wally_tx_clone_alloc(src, 0, dst);
 }
 
-static bool is_matching_txid(const struct wally_tx *tx,
-                             const unsigned char *txid, size_t txid_len)
+/* A non-witness utxo set by wally, shared by the inputs of a PSBT that
+ * spend it. Each utxo is allocated with its reference count and hashes,
+ * so that inputs can be freed or given new utxos without their PSBT.
+ * The tx is first, so freeing it frees the whole allocation. Inputs only
+ * share a utxo if its serialization including witnesses is identical,
+ * so that each input keeps exactly the tx it was given.
+ */
+struct psbt_utxo {
+    struct wally_tx tx;
+    size_t refs;
+    unsigned char txid[WALLY_TXHASH_LEN];
+    unsigned char wtxid[WALLY_TXHASH_LEN]; /* Hash of the full serialization */
+};
+
+/* A temporary table for finding the shared utxos of a PSBT by wtxid */
+struct utxo_table {
+    struct psbt_utxo **slots;
+    size_t num_slots; /* Always a power of two */
+};
+
+static struct psbt_utxo *psbt_input_get_utxo(const struct wally_psbt_input *input)
 {
-    unsigned char src_txid[WALLY_TXHASH_LEN];
-    bool ret;
+    return (struct psbt_utxo *)input->utxo;
+}
 
-    if (!tx || !txid || txid_len != WALLY_TXHASH_LEN)
-        return false;
+static void psbt_input_release_utxo(struct wally_psbt_input *input)
+{
+    struct psbt_utxo *utxo = psbt_input_get_utxo(input);
+    if (utxo && !--utxo->refs)
+        wally_tx_free(&utxo->tx);
+    input->utxo = NULL;
+}
 
-    if (wally_tx_get_txid(tx, src_txid, sizeof(src_txid)) != WALLY_OK)
-        return false;
+static void psbt_input_share_utxo(struct wally_psbt_input *input,
+                                  struct psbt_utxo *utxo)
+{
+    if (input->utxo != &utxo->tx) {
+        psbt_input_release_utxo(input);
+        input->utxo = &utxo->tx;
+        ++utxo->refs;
+    }
+}
+
+/* Give a newly allocated tx with the given txid and wtxid to an input */
+static int psbt_input_give_utxo(struct wally_psbt_input *input,
+                                struct wally_tx *tx, const unsigned char *txid,
+                                const unsigned char *wtxid,
+                                struct psbt_utxo **utxo_out)
+{
+    struct psbt_utxo *utxo = wally_calloc(sizeof(*utxo));
+    *utxo_out = utxo;
+    if (!utxo) {
+        wally_tx_free(tx);
+        return WALLY_ENOMEM;
+    }
+    /* Move the tx into the utxo allocation */
+    memcpy(&utxo->tx, tx, sizeof(*tx));
+    wally_free(tx);
+    memcpy(utxo->txid, txid, WALLY_TXHASH_LEN);
+    memcpy(utxo->wtxid, wtxid, WALLY_TXHASH_LEN);
+    psbt_input_share_utxo(input, utxo);
+    return WALLY_OK;
+}
 
-    ret = memcmp(src_txid, txid, txid_len) == 0;
-    wally_clear(src_txid, sizeof(src_txid));
+/* Get the txid of a tx given its wtxid. Txs without witnesses serialize
+ * identically for both, so their wtxid is reused rather than rehashing */
+static int utxo_get_txid(const struct wally_tx *tx, const unsigned char *wtxid,
+                         unsigned char *txid)
+{
+    size_t witness_count;
+    int ret = wally_tx_get_witness_count(tx, &witness_count);
+    if (ret == WALLY_OK) {
+        if (witness_count)
+            ret = wally_tx_get_txid(tx, txid, WALLY_TXHASH_LEN);
+        else
+            memcpy(txid, wtxid, WALLY_TXHASH_LEN);
+    }
     return ret;
 }
 
+/* Get the txid of a tx parsed from bytes that hash to wtxid. If the bytes
+ * are the txs serialization without witnesses, they hash to its txid */
+static int utxo_get_txid_from_bytes(const struct wally_tx *tx,
+                                    const unsigned char *bytes, size_t bytes_len,
+                                    const unsigned char *wtxid,
+                                    unsigned char *txid)
+{
+    size_t witness_count, is_elements = 0, written;
+    uint32_t flags = WALLY_TX_FLAG_ALLOW_PARTIAL;
+    unsigned char *buf;
+    bool is_same = false;
+    int ret;
+
+#ifdef BUILD_ELEMENTS
+    if ((ret = wally_tx_is_elements(tx, &is_elements)) != WALLY_OK)
+        return ret;
+#endif
+    if (!is_elements)
+        flags |= WALLY_TX_FLAG_PRE_BIP144; /* As for wally_tx_get_txid */
+    if ((ret = wally_tx_get_witness_count(tx, &witness_count)) != WALLY_OK)
+        return ret;
+    if (!witness_count) {
+        if (!(buf = wally_malloc(bytes_len)))
+            return WALLY_ENOMEM;
+        is_same = wally_tx_to_bytes(tx, flags, buf, bytes_len, &written) == WALLY_OK &&
+                  written == bytes_len && !memcmp(buf, bytes, bytes_len);
+        wally_free(buf);
+    }
+    if (!is_same)
+        return wally_tx_get_txid(tx, txid, WALLY_TXHASH_LEN);
+    memcpy(txid, wtxid, WALLY_TXHASH_LEN);
+    return WALLY_OK;
+}
+
+static struct psbt_utxo **utxo_table_slot(struct utxo_table *t,
+                                          const unsigned char *wtxid)
+{
+    const size_t mask = t->num_slots - 1;
+    uint32_t h;
+    size_t i;
+
+    if (!t->num_slots)
+        return NULL;
+    memcpy(&h, wtxid, sizeof(h)); /* wtxid is already uniformly distributed */
+    for (i = h & mask; t->slots[i]; i = (i + 1) & mask)
+        if (!memcmp(t->slots[i]->wtxid, wtxid, WALLY_TXHASH_LEN))
+            break;
+    return t->slots + i;
+}
+
+/* Create a table for the shared utxos of a PSBT, including existing ones */
+static int utxo_table_init(const struct wally_psbt *psbt, struct utxo_table *t)
+{
+    struct psbt_utxo **slot;
+    size_t i;
+
+    t->slots = NULL;
+    t->num_slots = 0;
+    if (!psbt->num_inputs)
+        return WALLY_OK;
+    for (t->num_slots = 8; t->num_slots < psbt->num_inputs * 2; t->num_slots *= 2) ;
+    if (!(t->slots = wally_calloc(t->num_slots * sizeof(*t->slots)))) {
+        t->num_slots = 0;
+        return WALLY_ENOMEM;
+    }
+    for (i = 0; i < psbt->num_inputs; ++i) {
+        struct psbt_utxo *utxo = psbt_input_get_utxo(psbt->inputs + i);
+        if (utxo && !*(slot = utxo_table_slot(t, utxo->wtxid)))
+            *slot = utxo;
+    }
+    return WALLY_OK;
+}
+
+static void utxo_table_free(struct utxo_table *t)
+{
+    wally_free(t->slots);
+}
+
+static bool is_matching_utxo(const struct wally_psbt_input *input,
+                             const unsigned char *txid, size_t txid_len)
+{
+    const struct psbt_utxo *utxo = psbt_input_get_utxo(input);
+    return utxo && txid && txid_len == WALLY_TXHASH_LEN &&
+           !memcmp(utxo->txid, txid, txid_len);
+}
+
 static bool psbt_is_valid(const struct wally_psbt *psbt)
 {
     if (!psbt)
@@ -360,7 +510,24 @@ int wally_psbt_input_is_finalized(const struct wally_psbt_input *input,
     return WALLY_OK;
 }
 
-SET_STRUCT(wally_psbt_input, utxo, wally_tx, tx_clone_alloc, wally_tx_free)
+int wally_psbt_input_set_utxo(struct wally_psbt_input *input, const struct wally_tx *utxo)
+{
+    unsigned char txid[WALLY_TXHASH_LEN], wtxid[WALLY_TXHASH_LEN];
+    struct wally_tx *new_utxo;
+    struct psbt_utxo *shared;
+    int ret;
+    if (!input)
+        return WALLY_EINVAL;
+    if (!utxo) {
+        psbt_input_release_utxo(input);
+        return WALLY_OK;
+    }
+    if ((ret = tx_get_wtxid(utxo, wtxid, sizeof(wtxid))) == WALLY_OK &&
+        (ret = utxo_get_txid(utxo, wtxid, txid)) == WALLY_OK &&
+        (ret = tx_clone_alloc(utxo, &new_utxo)) == WALLY_OK)
+        ret = psbt_input_give_utxo(input, new_utxo, txid, wtxid, &shared);
+    return ret;
+}
 
 int wally_psbt_input_set_witness_utxo(struct wally_psbt_input *input, const struct wally_tx_output *utxo)
 {
@@ -843,29 +1010,47 @@ static void psbt_input_init(struct wally_psbt_input *input)
 #endif /* BUILD_ELEMENTS */
 }
 
-static int psbt_input_free(struct wally_psbt_input *input, bool free_parent)
+/* Clear an inputs secret data with clear_bulk */
+static void psbt_input_clear_secrets(const struct wally_psbt_input *input)
 {
-    if (input) {
-        wally_tx_free(input->utxo);
-        wally_tx_output_free(input->witness_utxo);
-        wally_tx_witness_stack_free(input->final_witness);
-        wally_map_clear(&input->keypaths);
-        wally_map_clear(&input->signatures);
-        wally_map_clear(&input->unknowns);
-        wally_map_clear(&input->preimages);
-        wally_map_clear(&input->psbt_fields);
-        wally_map_clear(&input->taproot_leaf_signatures);
-        wally_map_clear(&input->taproot_leaf_scripts);
-        wally_map_clear(&input->taproot_leaf_hashes);
-        wally_map_clear(&input->taproot_leaf_paths);
+    map_clear_bulk(&input->unknowns);
+    map_clear_bulk(&input->preimages);
 #ifdef BUILD_ELEMENTS
-        wally_tx_free(input->pegin_tx);
-        wally_tx_witness_stack_free(input->pegin_witness);
-        wally_map_clear(&input->pset_fields);
+    map_clear_bulk(&input->pset_fields);
 #endif /* BUILD_ELEMENTS */
-        wally_clear(input, sizeof(*input));
-        if (free_parent)
-            wally_free(input);
+}
+
+/* Free an input whose secret data has been cleared */
+static void psbt_input_release(struct wally_psbt_input *input, bool free_parent)
+{
+    psbt_input_release_utxo(input);
+    wally_tx_output_free(input->witness_utxo);
+    wally_tx_witness_stack_free(input->final_witness);
+    map_release(&input->keypaths, false);
+    map_release(&input->signatures, false);
+    map_release(&input->unknowns, true);
+    map_release(&input->preimages, true);
+    map_release(&input->psbt_fields, false);
+    map_release(&input->taproot_leaf_signatures, false);
+    map_release(&input->taproot_leaf_scripts, false);
+    map_release(&input->taproot_leaf_hashes, false);
+    map_release(&input->taproot_leaf_paths, false);
+#ifdef BUILD_ELEMENTS
+    wally_tx_free(input->pegin_tx);
+    wally_tx_witness_stack_free(input->pegin_witness);
+    map_release(&input->pset_fields, true);
+#endif /* BUILD_ELEMENTS */
+    clear_public(input, sizeof(*input));
+    if (free_parent)
+        wally_free(input);
+}
+
+static int psbt_input_free(struct wally_psbt_input *input, bool free_parent)
+{
+    if (input) {
+        psbt_input_clear_secrets(input);
+        clear_bulk_end();
+        psbt_input_release(input, free_parent);
     }
     return WALLY_OK;
 }
@@ -1130,23 +1315,40 @@ static void psbt_output_init(struct wally_psbt_output *output)
 #endif /* BUILD_ELEMENTS */
 }
 
-static int psbt_output_free(struct wally_psbt_output *output, bool free_parent)
+/* Clear an outputs secret data with clear_bulk */
+static void psbt_output_clear_secrets(const struct wally_psbt_output *output)
 {
-    if (output) {
-        wally_map_clear(&output->keypaths);
-        wally_map_clear(&output->unknowns);
-        clear_and_free(output->script, output->script_len);
-        wally_map_clear(&output->psbt_fields);
-        wally_map_clear(&output->taproot_tree);
-        wally_map_clear(&output->taproot_leaf_hashes);
-        wally_map_clear(&output->taproot_leaf_paths);
+    map_clear_bulk(&output->unknowns);
+#ifdef BUILD_ELEMENTS
+    map_clear_bulk(&output->pset_fields);
+#endif /* BUILD_ELEMENTS */
+}
+
+/* Free an output whose secret data has been cleared */
+static void psbt_output_release(struct wally_psbt_output *output, bool free_parent)
+{
+    map_release(&output->keypaths, false);
+    map_release(&output->unknowns, true);
+    free_public(output->script, output->script_len);
+    map_release(&output->psbt_fields, false);
+    map_release(&output->taproot_tree, false);
+    map_release(&output->taproot_leaf_hashes, false);
+    map_release(&output->taproot_leaf_paths, false);
 #ifdef BUILD_ELEMENTS
-        wally_map_clear(&output->pset_fields);
+    map_release(&output->pset_fields, true);
 #endif /* BUILD_ELEMENTS */
 
-        wally_clear(output, sizeof(*output));
-        if (free_parent)
-            wally_free(output);
+    clear_public(output, sizeof(*output));
+    if (free_parent)
+        wally_free(output);
+}
+
+static int psbt_output_free(struct wally_psbt_output *output, bool free_parent)
+{
+    if (output) {
+        psbt_output_clear_secrets(output);
+        clear_bulk_end();
+        psbt_output_release(output, free_parent);
     }
     return WALLY_OK;
 }
@@ -1295,22 +1497,34 @@ int wally_psbt_free(struct wally_psbt *psbt)
 {
     size_t i;
     if (psbt) {
+        /* Clear all secret data before freeing, with a single barrier */
+        for (i = 0; i < psbt->num_inputs; ++i)
+            psbt_input_clear_secrets(&psbt->inputs[i]);
+        for (i = 0; i < psbt->num_outputs; ++i)
+            psbt_output_clear_secrets(&psbt->outputs[i]);
+        map_clear_bulk(&psbt->unknowns);
+#ifdef BUILD_ELEMENTS
+        map_clear_bulk(&psbt->global_scalars);
+#endif /* BUILD_ELEMENTS */
+        clear_bulk_end();
+
         wally_tx_free(psbt->tx);
         for (i = 0; i < psbt->num_inputs; ++i)
-            psbt_input_free(&psbt->inputs[i], false);
+            psbt_input_release(&psbt->inputs[i], false);
 
         wally_free(psbt->inputs);
         for (i = 0; i < psbt->num_outputs; ++i)
-            psbt_output_free(&psbt->outputs[i], false);
+            psbt_output_release(&psbt->outputs[i], false);
 
         wally_free(psbt->outputs);
-        wally_map_clear(&psbt->unknowns);
-        wally_map_clear(&psbt->global_xpubs);
+        map_release(&psbt->unknowns, true);
+        map_release(&psbt->global_xpubs, false);
 #ifdef BUILD_ELEMENTS
-        wally_map_clear(&psbt->global_scalars);
+        map_release(&psbt->global_scalars, true);
 #endif /* BUILD_ELEMENTS */
         wally_psbt_signing_cache_disable(psbt);
-        clear_and_free(psbt, sizeof(*psbt));
+        wally_psbt_outpoint_index_disable(psbt);
+        free_public(psbt, sizeof(*psbt));
     }
     return WALLY_OK;
 }
@@ -1433,32 +1647,249 @@ int wally_psbt_set_tx_modifiable_flags(struct wally_psbt *psbt, uint32_t flags)
     return WALLY_OK;
 }
 
+/* Open addressed hash table of input outpoints, using linear probing.
+ * Keys are read from the PSBT inputs, each slot stores the hash of
+ * its key and the index of its input plus one, or zero if empty.
+ */
+struct psbt_outpoint_slot {
+    uint32_t hash;
+    uint32_t pos;
+};
+
+struct psbt_outpoint_index {
+    struct psbt_outpoint_slot *slots;
+    size_t num_slots; /* Always a power of two */
+    size_t num_items;
+};
+
+#define OUTPOINT_INDEX_MIN_SLOTS 16u
+
+static void psbt_get_outpoint(const struct wally_psbt *psbt, size_t i,
+                              const unsigned char **txhash, uint32_t *utxo_index)
+{
+    if (psbt->version == PSBT_0) {
+        *txhash = psbt->tx->inputs[i].txhash;
+        *utxo_index = psbt->tx->inputs[i].index;
+    } else {
+        *txhash = psbt->inputs[i].txhash;
+        *utxo_index = psbt->inputs[i].index;
+    }
+}
+
+static uint32_t outpoint_hash(const unsigned char *txhash, uint32_t utxo_index)
+{
+    uint32_t h;
+    memcpy(&h, txhash, sizeof(h)); /* txhash is already uniformly distributed */
+    return h ^ (utxo_index * 0x9e3779b1u);
+}
+
+static uint32_t input_outpoint_hash(const struct wally_psbt *psbt, size_t i)
+{
+    const unsigned char *txhash;
+    uint32_t utxo_index;
+    psbt_get_outpoint(psbt, i, &txhash, &utxo_index);
+    return outpoint_hash(txhash, utxo_index);
+}
+
+static void outpoint_index_free(struct psbt_outpoint_index *idx)
+{
+    if (idx) {
+        wally_free(idx->slots);
+        wally_free(idx);
+    }
+}
+
+static void outpoint_index_insert(struct psbt_outpoint_index *idx,
+                                  uint32_t hash, uint32_t pos)
+{
+    const size_t mask = idx->num_slots - 1;
+    size_t i = hash & mask;
+    while (idx->slots[i].pos)
+        i = (i + 1) & mask;
+    idx->slots[i].hash = hash;
+    idx->slots[i].pos = pos;
+    idx->num_items += 1;
+}
+
+/* Resize the slots to hold at least num_items at a load factor of 1/2 */
+static int outpoint_index_reserve(struct psbt_outpoint_index *idx, size_t num_items)
+{
+    struct psbt_outpoint_slot *old = idx->slots;
+    size_t num_slots = OUTPOINT_INDEX_MIN_SLOTS, old_num_slots = idx->num_slots, i;
+
+    while (num_slots < num_items * 2)
+        num_slots *= 2;
+    if (num_slots <= old_num_slots)
+        return WALLY_OK;
+    if (!(idx->slots = wally_calloc(num_slots * sizeof(*idx->slots)))) {
+        idx->slots = old;
+        return WALLY_ENOMEM;
+    }
+    idx->num_slots = num_slots;
+    idx->num_items = 0;
+    for (i = 0; i < old_num_slots; ++i)
+        if (old[i].pos)
+            outpoint_index_insert(idx, old[i].hash, old[i].pos);
+    wally_free(old);
+    return WALLY_OK;
+}
+
+static void outpoint_index_remove(struct psbt_outpoint_index *idx,
+                                  uint32_t hash, uint32_t pos)
+{
+    const size_t mask = idx->num_slots - 1;
+    size_t i = hash & mask, j, k;
+
+    while (idx->slots[i].pos && idx->slots[i].pos != pos)
+        i = (i + 1) & mask;
+    if (!idx->slots[i].pos)
+        return; /* Not found */
+    /* Shift back any following entries that would become unreachable */
+    for (j = (i + 1) & mask; idx->slots[j].pos; j = (j + 1) & mask) {
+        k = idx->slots[j].hash & mask;
+        if (i <= j ? (i < k && k <= j) : (i < k || k <= j))
+            continue; /* Entry j is still reachable from its home slot k */
+        idx->slots[i] = idx->slots[j];
+        i = j;
+    }
+    idx->slots[i].pos = 0;
+    idx->num_items -= 1;
+}
+
+/* Adjust the positions of all inputs at or after pos after an insert/remove */
+static void outpoint_index_shift(struct psbt_outpoint_index *idx,
+                                 uint32_t pos, bool is_insert)
+{
+    size_t i;
+    for (i = 0; i < idx->num_slots; ++i) {
+        if (idx->slots[i].pos >= pos) {
+            if (is_insert)
+                ++idx->slots[i].pos;
+            else
+                --idx->slots[i].pos;
+        }
+    }
+}
+
+static void psbt_outpoint_index_add(struct wally_psbt *psbt, size_t index)
+{
+    struct psbt_outpoint_index *idx = psbt->outpoint_index;
+    if (idx) {
+        if (outpoint_index_reserve(idx, idx->num_items + 1) != WALLY_OK) {
+            wally_psbt_outpoint_index_disable(psbt);
+            return;
+        }
+        if (index + 1 != psbt->num_inputs)
+            outpoint_index_shift(idx, index + 1, true);
+        outpoint_index_insert(idx, input_outpoint_hash(psbt, index), index + 1);
+    }
+}
+
+/* Re-index an input whose outpoint previously hashed to old_hash */
+static void psbt_outpoint_index_update(struct wally_psbt *psbt, size_t index,
+                                       uint32_t old_hash)
+{
+    struct psbt_outpoint_index *idx = psbt->outpoint_index;
+    outpoint_index_remove(idx, old_hash, index + 1);
+    outpoint_index_insert(idx, input_outpoint_hash(psbt, index), index + 1);
+}
+
+static size_t psbt_find_input(const struct wally_psbt *psbt,
+                              const unsigned char *txhash, uint32_t utxo_index)
+{
+    const struct psbt_outpoint_index *idx = psbt->outpoint_index;
+    const unsigned char *input_txhash;
+    uint32_t input_utxo_index;
+    size_t i, found = 0;
+
+    if (idx) {
+        const size_t mask = idx->num_slots - 1;
+        const uint32_t hash = outpoint_hash(txhash, utxo_index);
+        /* Duplicate outpoints may be present: return the first input */
+        for (i = hash & mask; idx->slots[i].pos; i = (i + 1) & mask) {
+            const struct psbt_outpoint_slot *slot = idx->slots + i;
+            if (slot->hash == hash && (!found || slot->pos < found)) {
+                psbt_get_outpoint(psbt, slot->pos - 1,
+                                  &input_txhash, &input_utxo_index);
+                if (input_utxo_index == utxo_index &&
+                    !memcmp(input_txhash, txhash, WALLY_TXHASH_LEN))
+                    found = slot->pos;
+            }
+        }
+        return found;
+    }
+    for (i = 0; i < psbt->num_inputs; ++i) {
+        psbt_get_outpoint(psbt, i, &input_txhash, &input_utxo_index);
+        if (input_utxo_index == utxo_index &&
+            !memcmp(input_txhash, txhash, WALLY_TXHASH_LEN))
+            return i + 1;
+    }
+    return 0; /* Not found */
+}
+
 int wally_psbt_find_input_spending_utxo(const struct wally_psbt *psbt,
                                         const unsigned char *txhash, size_t txhash_len,
                                         uint32_t utxo_index, size_t *written)
 {
-    size_t i;
     if (written)
         *written = 0;
     if (!psbt_is_valid(psbt) || !txhash || txhash_len != WALLY_TXHASH_LEN ||
         !written)
         return WALLY_EINVAL;
-    for (i = 0; i < psbt->num_inputs; ++i) {
-        if (psbt->version == PSBT_0) {
-            const struct wally_tx_input *input = &psbt->tx->inputs[i];
-            if (input->index == utxo_index && !memcmp(input->txhash, txhash, txhash_len)) {
-                *written = i + 1;
-                return WALLY_OK;
-            }
-        } else {
-            const struct wally_psbt_input *input = &psbt->inputs[i];
-            if (input->index == utxo_index && !memcmp(input->txhash, txhash, txhash_len)) {
-                *written = i + 1;
-                return WALLY_OK;
-            }
-        }
+    *written = psbt_find_input(psbt, txhash, utxo_index);
+    return WALLY_OK;
+}
+
+int wally_psbt_find_inputs_spending_utxos(const struct wally_psbt *psbt,
+                                          const unsigned char *txhashes, size_t txhashes_len,
+                                          const uint32_t *utxo_indices, size_t num_utxo_indices,
+                                          uint32_t *indices_out, size_t indices_out_len,
+                                          size_t *written)
+{
+    size_t i;
+
+    if (written)
+        *written = 0;
+    if (!psbt_is_valid(psbt) || !txhashes || !utxo_indices || !num_utxo_indices ||
+        txhashes_len != num_utxo_indices * WALLY_TXHASH_LEN ||
+        !indices_out || indices_out_len < num_utxo_indices || !written)
+        return WALLY_EINVAL;
+    for (i = 0; i < num_utxo_indices; ++i)
+        indices_out[i] = (uint32_t)psbt_find_input(psbt, txhashes + i * WALLY_TXHASH_LEN,
+                                                   utxo_indices[i]);
+    *written = num_utxo_indices;
+    return WALLY_OK;
+}
+
+int wally_psbt_outpoint_index_enable(struct wally_psbt *psbt, uint32_t flags)
+{
+    struct psbt_outpoint_index *idx;
+    size_t i;
+    int ret;
+
+    if (!psbt_is_valid(psbt) || (psbt->version == PSBT_0 && !psbt->tx && psbt->num_inputs) ||
+        psbt->num_inputs > UINT32_MAX - 1 || flags)
+        return WALLY_EINVAL;
+    wally_psbt_outpoint_index_disable(psbt);
+    if (!(idx = wally_calloc(sizeof(*idx))))
+        return WALLY_ENOMEM;
+    if ((ret = outpoint_index_reserve(idx, psbt->num_inputs)) != WALLY_OK) {
+        outpoint_index_free(idx);
+        return ret;
     }
-    return WALLY_OK; /* Not found, return 0 */
+    for (i = 0; i < psbt->num_inputs; ++i)
+        outpoint_index_insert(idx, input_outpoint_hash(psbt, i), i + 1);
+    psbt->outpoint_index = idx;
+    return WALLY_OK;
+}
+
+int wally_psbt_outpoint_index_disable(struct wally_psbt *psbt)
+{
+    if (!psbt)
+        return WALLY_EINVAL;
+    outpoint_index_free(psbt->outpoint_index);
+    psbt->outpoint_index = NULL;
+    return WALLY_OK;
 }
 
 #ifndef WALLY_ABI_NO_ELEMENTS
@@ -1624,6 +2055,8 @@ static int psbt_set_global_tx(struct wally_psbt *psbt, struct wally_tx *tx, bool
     psbt->num_inputs = tx->num_inputs;
     psbt->num_outputs = tx->num_outputs;
     psbt->tx = do_clone ? new_tx : tx;
+    if (psbt->outpoint_index)
+        wally_psbt_outpoint_index_enable(psbt, 0); /* Rebuild, or disable on failure */
     return WALLY_OK;
 }
 
@@ -1812,6 +2245,7 @@ int wally_psbt_add_tx_input_at(struct wally_psbt *psbt,
             memcpy(dst, &tmp, sizeof(tmp));
             wally_clear(&tmp, sizeof(tmp));
             psbt->num_inputs += 1;
+            psbt_outpoint_index_add(psbt, index);
         }
     }
 
@@ -1823,6 +2257,7 @@ int wally_psbt_add_tx_input_at(struct wally_psbt *psbt,
 
 int wally_psbt_remove_input(struct wally_psbt *psbt, uint32_t index)
 {
+    uint32_t hash = 0;
     int ret = WALLY_OK;
 
     if (!psbt_is_valid(psbt) || (psbt->version == PSBT_0 && !psbt->tx) ||
@@ -1832,6 +2267,9 @@ int wally_psbt_remove_input(struct wally_psbt *psbt, uint32_t index)
     if (!psbt_can_modify(psbt, WALLY_PSBT_TXMOD_INPUTS))
         return WALLY_EINVAL; /* FIXME: WALLY_PSBT_TXMOD_SINGLE */
 
+    if (psbt->outpoint_index)
+        hash = input_outpoint_hash(psbt, index);
+
     if (psbt->version == PSBT_0)
         ret = wally_tx_remove_input(psbt->tx, index);
     if (ret == WALLY_OK) {
@@ -1852,6 +2290,10 @@ int wally_psbt_remove_input(struct wally_psbt *psbt, uint32_t index)
         memmove(to_remove, to_remove + 1,
                 (psbt->num_inputs - index - 1) * sizeof(*to_remove));
         psbt->num_inputs -= 1;
+        if (psbt->outpoint_index) {
+            outpoint_index_remove(psbt->outpoint_index, hash, index + 1);
+            outpoint_index_shift(psbt->outpoint_index, index + 2, false);
+        }
     }
     return ret;
 }
@@ -2292,9 +2734,43 @@ static struct wally_psbt *pull_psbt(const unsigned char **cursor, size_t *max)
     return ret == WALLY_OK ? psbt : NULL;
 }
 
+/* Pull a non-witness utxo, sharing it if identical to one already
+ * pulled for another input */
+static int pull_utxo(const unsigned char **cursor, size_t *max,
+                     uint32_t tx_flags, struct utxo_table *utxos,
+                     struct wally_psbt_input *result)
+{
+    unsigned char txid[WALLY_TXHASH_LEN], wtxid[WALLY_TXHASH_LEN];
+    struct psbt_utxo **slot = NULL, *shared;
+    struct wally_tx *tx = NULL;
+    const unsigned char *val;
+    size_t val_len;
+    int ret;
+
+    if (result->utxo)
+        return WALLY_EINVAL; /* Duplicate */
+    pull_subfield_start(cursor, max, pull_varint(cursor, max), &val, &val_len);
+    /* Hash the serialized tx without parsing it, so that identical
+     * copies are parsed once */
+    if (val && wally_sha256d(val, val_len, wtxid, sizeof(wtxid)) == WALLY_OK)
+        slot = utxo_table_slot(utxos, wtxid);
+    if (slot && *slot) {
+        psbt_input_share_utxo(result, *slot);
+        ret = WALLY_OK;
+    } else if ((ret = wally_tx_from_bytes(val, val_len, tx_flags, &tx)) == WALLY_OK) {
+        if ((ret = utxo_get_txid_from_bytes(tx, val, val_len, wtxid, txid)) != WALLY_OK)
+            wally_tx_free(tx);
+        else if ((ret = psbt_input_give_utxo(result, tx, txid, wtxid, &shared)) == WALLY_OK && slot)
+            *slot = shared;
+    }
+    pull_subfield_end(cursor, max, val, val_len);
+    return ret;
+}
+
 static int pull_psbt_input(const struct wally_psbt *psbt,
                            const unsigned char **cursor, size_t *max,
                            uint32_t tx_flags, uint32_t flags,
+                           struct utxo_table *utxos,
                            struct wally_psbt_input *result)
 {
     size_t key_len, val_len;
@@ -2349,7 +2825,7 @@ static int pull_psbt_input(const struct wally_psbt *psbt,
 
             switch (field_type) {
             case PSBT_IN_NON_WITNESS_UTXO:
-                ret = pull_tx(cursor, max, tx_flags, &result->utxo);
+                ret = pull_utxo(cursor, max, tx_flags, utxos, result);
                 break;
             case PSBT_IN_WITNESS_UTXO:
                 ret = pull_tx_output(cursor, max, is_pset, &result->witness_utxo);
@@ -2643,14 +3119,15 @@ unknown:
     return ret;
 }
 
-int wally_psbt_from_bytes(const unsigned char *bytes, size_t len,
-                          uint32_t flags, struct wally_psbt **output)
+static int psbt_from_bytes(const unsigned char *bytes, size_t len,
+                           uint32_t flags, struct wally_psbt **output)
 {
     const unsigned char **cursor = &bytes;
     const unsigned char *pre_key;
     size_t *max = &len, i, key_len, input_count = 0, output_count = 0;
     uint32_t tx_flags = 0, pre144flag = WALLY_TX_FLAG_PRE_BIP144;
     uint64_t mandatory, disallowed, keyset = 0;
+    struct utxo_table utxos = { NULL, 0 };
     bool is_pset = false;
     int ret = WALLY_OK;
 
@@ -2816,9 +3293,12 @@ unknown:
     }
 
     /* Read inputs */
+    if (ret == WALLY_OK)
+        ret = utxo_table_init(*output, &utxos);
     for (i = 0; ret == WALLY_OK && i < (*output)->num_inputs; ++i)
         ret = pull_psbt_input(*output, cursor, max, tx_flags,flags,
-                              (*output)->inputs + i);
+                              &utxos, (*output)->inputs + i);
+    utxo_table_free(&utxos);
 
     /* Read outputs */
     for (i = 0; ret == WALLY_OK && i < (*output)->num_outputs; ++i)
@@ -2835,6 +3315,16 @@ unknown:
     return ret;
 }
 
+int wally_psbt_from_bytes(const unsigned char *bytes, size_t len,
+                          uint32_t flags, struct wally_psbt **output)
+{
+    int ret;
+    STATS_BEGIN(WALLY_STATS_PSBT_PARSE);
+    ret = psbt_from_bytes(bytes, len, flags, output);
+    STATS_END();
+    return ret;
+}
+
 int wally_psbt_get_length(const struct wally_psbt *psbt, uint32_t flags, size_t *written)
 {
     return wally_psbt_to_bytes(psbt, flags, NULL, 0, written);
@@ -3351,49 +3841,108 @@ static int push_psbt_output(const struct wally_psbt *psbt,
     return WALLY_OK;
 }
 
-static int psbt_sigs_to_bytes(const struct wally_psbt *psbt, uint32_t flags,
-                              unsigned char *bytes_out, size_t len,
-                              size_t *written)
+static int push_psbt_globals(const struct wally_psbt *psbt,
+                             unsigned char **cursor, size_t *max)
 {
-    unsigned char *cursor = bytes_out;
-    size_t max = len;
-    (void)flags;
-
-    push_bytes(&cursor, &max, psbt->magic, sizeof(psbt->magic));
-    push_psbt_le32(&cursor, &max, PSBT_GLOBAL_VERSION, false, 2);
-    push_psbt_key(&cursor, &max, PSBT_GLOBAL_INPUT_COUNT, NULL, 0);
-    push_varint_varbuff(&cursor, &max, psbt->num_inputs);
-    push_psbt_key(&cursor, &max, PSBT_GLOBAL_OUTPUT_COUNT, NULL, 0);
-    push_varint_varbuff(&cursor, &max, 0);
-    push_u8(&cursor, &max, PSBT_SEPARATOR);
-
-    /* Push each inputs signatures */
-    for (size_t i = 0; i < psbt->num_inputs; ++i) {
-        const struct wally_psbt_input *input = &psbt->inputs[i];
-        int ret;
-        push_psbt_map(&cursor, &max, PSBT_IN_PARTIAL_SIG, false, &input->signatures);
-        ret = push_varbuff_from_map(&cursor, &max, PSBT_IN_TAP_KEY_SIG,
-                                    PSBT_IN_TAP_KEY_SIG, false, &input->psbt_fields);
-        if (ret == WALLY_OK)
-            ret = push_taproot_leaf_signatures(&cursor, &max, PSBT_IN_TAP_SCRIPT_SIG,
-                                               &input->taproot_leaf_signatures);
+    int ret;
 
+    /* Global tx */
+    if (psbt->tx) {
+        push_psbt_key(cursor, max, PSBT_GLOBAL_UNSIGNED_TX, NULL, 0);
+        ret = push_length_and_tx(cursor, max, psbt->tx,
+                                 WALLY_TX_FLAG_ALLOW_PARTIAL | WALLY_TX_FLAG_PRE_BIP144);
         if (ret != WALLY_OK)
             return ret;
-        push_u8(&cursor, &max, PSBT_SEPARATOR);
-    }
-    if (cursor == NULL) {
-        /* Once cursor is NULL, max holds how many bytes we needed */
-        *written = len + max;
-    } else {
-        *written = len - max;
     }
+    /* Global XPubs */
+    push_psbt_map(cursor, max, PSBT_GLOBAL_XPUB, false, &psbt->global_xpubs);
+
+    if (psbt->version == PSBT_2) {
+        push_psbt_le32(cursor, max, PSBT_GLOBAL_TX_VERSION, false, psbt->tx_version);
+
+        if (psbt->has_fallback_locktime)
+            push_psbt_le32(cursor, max, PSBT_GLOBAL_FALLBACK_LOCKTIME, false, psbt->fallback_locktime);
+
+        push_psbt_key(cursor, max, PSBT_GLOBAL_INPUT_COUNT, NULL, 0);
+        push_varint_varbuff(cursor, max, psbt->num_inputs);
+
+        push_psbt_key(cursor, max, PSBT_GLOBAL_OUTPUT_COUNT, NULL, 0);
+        push_varint_varbuff(cursor, max, psbt->num_outputs);
+
+        if (psbt->tx_modifiable_flags) {
+            push_psbt_key(cursor, max, PSBT_GLOBAL_TX_MODIFIABLE, NULL, 0);
+            push_varint(cursor, max, sizeof(uint8_t));
+            push_u8(cursor, max, psbt->tx_modifiable_flags & 0xff);
+        }
+#ifdef BUILD_ELEMENTS
+        push_psbt_map(cursor, max, PSET_GLOBAL_SCALAR, true, &psbt->global_scalars);
+
+        if (psbt->pset_modifiable_flags) {
+            push_key(cursor, max, PSET_GLOBAL_TX_MODIFIABLE, true, NULL, 0);
+            push_varint(cursor, max, sizeof(uint8_t));
+            push_u8(cursor, max, psbt->pset_modifiable_flags);
+        }
+        if (!mem_is_zero(psbt->genesis_blockhash, sizeof(psbt->genesis_blockhash))) {
+            push_key(cursor, max, PSET_GLOBAL_GENESIS_HASH, true, NULL, 0);
+            push_varbuff(cursor, max, psbt->genesis_blockhash, sizeof(psbt->genesis_blockhash));
+        }
+#endif /* BUILD_ELEMENTS */
+    }
+
+    if (psbt->version == PSBT_2)
+        push_psbt_le32(cursor, max, PSBT_GLOBAL_VERSION, false, psbt->version);
+
+    /* Unknowns */
+    push_map(cursor, max, &psbt->unknowns);
+
+    /* Separator */
+    push_u8(cursor, max, PSBT_SEPARATOR);
     return WALLY_OK;
 }
 
-int wally_psbt_to_bytes(const struct wally_psbt *psbt, uint32_t flags,
-                        unsigned char *bytes_out, size_t len,
-                        size_t *written)
+static int psbt_sigs_to_bytes(const struct wally_psbt *psbt, uint32_t flags,
+                              unsigned char *bytes_out, size_t len,
+                              size_t *written)
+{
+    unsigned char *cursor = bytes_out;
+    size_t max = len;
+    (void)flags;
+
+    push_bytes(&cursor, &max, psbt->magic, sizeof(psbt->magic));
+    push_psbt_le32(&cursor, &max, PSBT_GLOBAL_VERSION, false, 2);
+    push_psbt_key(&cursor, &max, PSBT_GLOBAL_INPUT_COUNT, NULL, 0);
+    push_varint_varbuff(&cursor, &max, psbt->num_inputs);
+    push_psbt_key(&cursor, &max, PSBT_GLOBAL_OUTPUT_COUNT, NULL, 0);
+    push_varint_varbuff(&cursor, &max, 0);
+    push_u8(&cursor, &max, PSBT_SEPARATOR);
+
+    /* Push each inputs signatures */
+    for (size_t i = 0; i < psbt->num_inputs; ++i) {
+        const struct wally_psbt_input *input = &psbt->inputs[i];
+        int ret;
+        push_psbt_map(&cursor, &max, PSBT_IN_PARTIAL_SIG, false, &input->signatures);
+        ret = push_varbuff_from_map(&cursor, &max, PSBT_IN_TAP_KEY_SIG,
+                                    PSBT_IN_TAP_KEY_SIG, false, &input->psbt_fields);
+        if (ret == WALLY_OK)
+            ret = push_taproot_leaf_signatures(&cursor, &max, PSBT_IN_TAP_SCRIPT_SIG,
+                                               &input->taproot_leaf_signatures);
+
+        if (ret != WALLY_OK)
+            return ret;
+        push_u8(&cursor, &max, PSBT_SEPARATOR);
+    }
+    if (cursor == NULL) {
+        /* Once cursor is NULL, max holds how many bytes we needed */
+        *written = len + max;
+    } else {
+        *written = len - max;
+    }
+    return WALLY_OK;
+}
+
+static int psbt_to_bytes(const struct wally_psbt *psbt, uint32_t flags,
+                         unsigned char *bytes_out, size_t len,
+                         size_t *written)
 {
     const uint32_t all_flags = WALLY_PSBT_SERIALIZE_FLAG_REDUNDANT |
                                WALLY_PSBT_SERIALIZE_SIGS_ONLY;
@@ -3417,57 +3966,8 @@ int wally_psbt_to_bytes(const struct wally_psbt *psbt, uint32_t flags,
     tx_flags = is_pset ? WALLY_TX_FLAG_USE_ELEMENTS : 0;
     push_bytes(&cursor, &max, psbt->magic, sizeof(psbt->magic));
 
-    /* Global tx */
-    if (psbt->tx) {
-        push_psbt_key(&cursor, &max, PSBT_GLOBAL_UNSIGNED_TX, NULL, 0);
-        ret = push_length_and_tx(&cursor, &max, psbt->tx,
-                                 WALLY_TX_FLAG_ALLOW_PARTIAL | WALLY_TX_FLAG_PRE_BIP144);
-        if (ret != WALLY_OK)
-            return ret;
-    }
-    /* Global XPubs */
-    push_psbt_map(&cursor, &max, PSBT_GLOBAL_XPUB, false, &psbt->global_xpubs);
-
-    if (psbt->version == PSBT_2) {
-        push_psbt_le32(&cursor, &max, PSBT_GLOBAL_TX_VERSION, false, psbt->tx_version);
-
-        if (psbt->has_fallback_locktime)
-            push_psbt_le32(&cursor, &max, PSBT_GLOBAL_FALLBACK_LOCKTIME, false, psbt->fallback_locktime);
-
-        push_psbt_key(&cursor, &max, PSBT_GLOBAL_INPUT_COUNT, NULL, 0);
-        push_varint_varbuff(&cursor, &max, psbt->num_inputs);
-
-        push_psbt_key(&cursor, &max, PSBT_GLOBAL_OUTPUT_COUNT, NULL, 0);
-        push_varint_varbuff(&cursor, &max, psbt->num_outputs);
-
-        if (psbt->tx_modifiable_flags) {
-            push_psbt_key(&cursor, &max, PSBT_GLOBAL_TX_MODIFIABLE, NULL, 0);
-            push_varint(&cursor, &max, sizeof(uint8_t));
-            push_u8(&cursor, &max, psbt->tx_modifiable_flags & 0xff);
-        }
-#ifdef BUILD_ELEMENTS
-        push_psbt_map(&cursor, &max, PSET_GLOBAL_SCALAR, true, &psbt->global_scalars);
-
-        if (psbt->pset_modifiable_flags) {
-            push_key(&cursor, &max, PSET_GLOBAL_TX_MODIFIABLE, true, NULL, 0);
-            push_varint(&cursor, &max, sizeof(uint8_t));
-            push_u8(&cursor, &max, psbt->pset_modifiable_flags);
-        }
-        if (!mem_is_zero(psbt->genesis_blockhash, sizeof(psbt->genesis_blockhash))) {
-            push_key(&cursor, &max, PSET_GLOBAL_GENESIS_HASH, true, NULL, 0);
-            push_varbuff(&cursor, &max, psbt->genesis_blockhash, sizeof(psbt->genesis_blockhash));
-        }
-#endif /* BUILD_ELEMENTS */
-    }
-
-    if (psbt->version == PSBT_2)
-        push_psbt_le32(&cursor, &max, PSBT_GLOBAL_VERSION, false, psbt->version);
-
-    /* Unknowns */
-    push_map(&cursor, &max, &psbt->unknowns);
-
-    /* Separator */
-    push_u8(&cursor, &max, PSBT_SEPARATOR);
+    if ((ret = push_psbt_globals(psbt, &cursor, &max)) != WALLY_OK)
+        return ret;
 
     /* Push each input and output */
     for (i = 0; i < psbt->num_inputs; ++i) {
@@ -3491,6 +3991,551 @@ int wally_psbt_to_bytes(const struct wally_psbt *psbt, uint32_t flags,
     return WALLY_OK;
 }
 
+int wally_psbt_to_bytes(const struct wally_psbt *psbt, uint32_t flags,
+                        unsigned char *bytes_out, size_t len,
+                        size_t *written)
+{
+    int ret;
+    STATS_BEGIN(WALLY_STATS_PSBT_SERIALIZE);
+    ret = psbt_to_bytes(psbt, flags, bytes_out, len, written);
+    STATS_END();
+    return ret;
+}
+
+/* A PSBT patch holds the key-value records that differ between two PSBTs
+ * of the same transaction. Records are grouped into sections (globals,
+ * then each input, then each output), with sections and the records
+ * within them sorted. A record value is prefixed with its length + 1,
+ * or with 0 if the record is to be removed.
+ */
+static const uint8_t PSBT_PATCH_MAGIC[5] = {'p', 't', 'c', 'h', 0xff};
+#define PSBT_PATCH_HEADER_LEN (sizeof(PSBT_PATCH_MAGIC) + 2 + WALLY_TXHASH_LEN)
+
+struct psbt_record {
+    const unsigned char *key;
+    size_t key_len;
+    const unsigned char *value; /* NULL if the record is to be removed */
+    size_t value_len;
+};
+
+struct psbt_patch_section {
+    size_t section; /* 0 for globals, then inputs followed by outputs */
+    const unsigned char *records; /* Records including the separator */
+    size_t records_len;
+};
+
+static int push_psbt_section(const struct wally_psbt *psbt, size_t section,
+                             bool is_pset, unsigned char **cursor, size_t *max)
+{
+    const uint32_t tx_flags = is_pset ? WALLY_TX_FLAG_USE_ELEMENTS : 0;
+
+    if (!section)
+        return push_psbt_globals(psbt, cursor, max);
+    if (--section < psbt->num_inputs)
+        return push_psbt_input(psbt, cursor, max, tx_flags, 0,
+                               psbt->inputs + section);
+    return push_psbt_output(psbt, cursor, max, is_pset,
+                            psbt->outputs + section - psbt->num_inputs);
+}
+
+/* Serialize a single section of a PSBT into a newly allocated buffer */
+static int psbt_section_alloc(const struct wally_psbt *psbt, size_t section,
+                              bool is_pset, unsigned char **output,
+                              size_t *written)
+{
+    unsigned char *cursor = NULL;
+    size_t max = 0;
+    int ret = push_psbt_section(psbt, section, is_pset, &cursor, &max);
+
+    *output = NULL;
+    *written = max;
+    if (ret == WALLY_OK && !(*output = wally_malloc(max)))
+        ret = WALLY_ENOMEM;
+    if (ret == WALLY_OK) {
+        cursor = *output;
+        ret = push_psbt_section(psbt, section, is_pset, &cursor, &max);
+        if (ret != WALLY_OK)
+            clear_and_free_bytes(output, written);
+    }
+    return ret;
+}
+
+/* Pull the next record of a section, returning false at its end */
+static bool pull_psbt_record(const unsigned char **cursor, size_t *max,
+                             bool is_patch, struct psbt_record *record)
+{
+    if (!(record->key_len = pull_varlength(cursor, max)))
+        return false; /* Separator, or out of data */
+    record->key = pull_skip(cursor, max, record->key_len);
+    if (is_patch) {
+        const uint64_t v = pull_varint(cursor, max);
+        if (v && v - 1 > *max)
+            pull_failed(cursor, max); /* Impossible length */
+        record->value_len = v ? v - 1 : 0;
+        record->value = v ? pull_skip(cursor, max, record->value_len) : NULL;
+    } else
+        pull_varlength_buff(cursor, max, &record->value, &record->value_len);
+    return *cursor != NULL;
+}
+
+static void push_psbt_record(unsigned char **cursor, size_t *max,
+                             bool is_patch, const struct psbt_record *record)
+{
+    push_varbuff(cursor, max, record->key, record->key_len);
+    if (!is_patch)
+        push_varbuff(cursor, max, record->value, record->value_len);
+    else if (!record->value)
+        push_varint(cursor, max, 0); /* Removed */
+    else {
+        push_varint(cursor, max, (uint64_t)record->value_len + 1);
+        push_bytes(cursor, max, record->value, record->value_len);
+    }
+}
+
+static int psbt_record_compare(const void *lhs, const void *rhs)
+{
+    const struct psbt_record *l = lhs, *r = rhs;
+    const size_t len = l->key_len < r->key_len ? l->key_len : r->key_len;
+    const int cmp = memcmp(l->key, r->key, len);
+    if (cmp)
+        return cmp;
+    return l->key_len < r->key_len ? -1 : l->key_len > r->key_len;
+}
+
+/* Split a section ending in a separator into its records */
+static int psbt_records_alloc(const unsigned char *bytes, size_t len,
+                              bool is_patch, bool sort,
+                              struct psbt_record **output, size_t *num_records)
+{
+    const unsigned char *cursor = bytes;
+    struct psbt_record record;
+    size_t max = len, i;
+
+    *output = NULL;
+    *num_records = 0;
+    while (pull_psbt_record(&cursor, &max, is_patch, &record))
+        ++*num_records;
+    if (!cursor || max)
+        return WALLY_EINVAL; /* Truncated, or data after the separator */
+    if (!*num_records)
+        return WALLY_OK;
+    if (!(*output = wally_malloc(*num_records * sizeof(record))))
+        return WALLY_ENOMEM;
+    cursor = bytes;
+    max = len;
+    for (i = 0; i < *num_records; ++i)
+        pull_psbt_record(&cursor, &max, is_patch, *output + i);
+    if (sort)
+        qsort(*output, *num_records, sizeof(record), psbt_record_compare);
+    return WALLY_OK;
+}
+
+/* Push the changes needed to turn section "base" into section "bytes" */
+static int push_psbt_section_diff(unsigned char **cursor, size_t *max,
+                                  size_t section,
+                                  const unsigned char *base, size_t base_len,
+                                  const unsigned char *bytes, size_t len)
+{
+    struct psbt_record *from = NULL, *to = NULL, removed;
+    size_t num_from, num_to, i = 0, j = 0;
+    int ret;
+
+    if (base_len == len && !memcmp(base, bytes, len))
+        return WALLY_OK; /* Unchanged */
+
+    ret = psbt_records_alloc(base, base_len, false, true, &from, &num_from);
+    if (ret == WALLY_OK)
+        ret = psbt_records_alloc(bytes, len, false, true, &to, &num_to);
+    if (ret == WALLY_OK) {
+        push_varint(cursor, max, section + 1);
+        while (i < num_from || j < num_to) {
+            const int cmp = i == num_from ? 1 : j == num_to ? -1 :
+                            psbt_record_compare(from + i, to + j);
+            if (cmp < 0) {
+                removed = from[i++];
+                removed.value = NULL;
+                push_psbt_record(cursor, max, true, &removed);
+                continue;
+            }
+            if (cmp || from[i].value_len != to[j].value_len ||
+                memcmp(from[i].value, to[j].value, to[j].value_len))
+                push_psbt_record(cursor, max, true, to + j); /* Added/changed */
+            if (!cmp)
+                ++i;
+            ++j;
+        }
+        push_u8(cursor, max, PSBT_SEPARATOR);
+    }
+    wally_free(from);
+    wally_free(to);
+    return ret;
+}
+
+/* Push a section with the records from a patch section applied to it.
+ * Existing records keep their order, with any new records appended */
+static int push_patched_section(unsigned char **cursor, size_t *max,
+                                const unsigned char *bytes, size_t len,
+                                const struct psbt_patch_section *patch)
+{
+    struct psbt_record *records = NULL, *changes = NULL, *change;
+    size_t num_records, num_changes, i;
+    unsigned char *applied = NULL;
+    int ret;
+
+    if (!patch) {
+        push_bytes(cursor, max, bytes, len);
+        return WALLY_OK;
+    }
+    ret = psbt_records_alloc(bytes, len, false, false, &records, &num_records);
+    if (ret == WALLY_OK)
+        ret = psbt_records_alloc(patch->records, patch->records_len, true,
+                                 false, &changes, &num_changes);
+    if (ret == WALLY_OK && num_changes && !(applied = wally_calloc(num_changes)))
+        ret = WALLY_ENOMEM;
+    if (ret == WALLY_OK) {
+        for (i = 0; i < num_records; ++i) {
+            change = NULL;
+            if (num_changes)
+                change = bsearch(records + i, changes, num_changes,
+                                 sizeof(*changes), psbt_record_compare);
+            if (!change)
+                push_psbt_record(cursor, max, false, records + i);
+            else {
+                if (change->value)
+                    push_psbt_record(cursor, max, false, change);
+                applied[change - changes] = 1;
+            }
+        }
+        /* Removing a record that isn't present is not an error */
+        for (i = 0; i < num_changes; ++i)
+            if (!applied[i] && changes[i].value)
+                push_psbt_record(cursor, max, false, changes + i);
+        push_u8(cursor, max, PSBT_SEPARATOR);
+    }
+    wally_free(applied);
+    wally_free(records);
+    wally_free(changes);
+    return ret;
+}
+
+static int psbt_get_id_and_is_pset(const struct wally_psbt *psbt,
+                                   unsigned char *id, bool *is_pset)
+{
+    size_t is_elements;
+    int ret = wally_psbt_is_elements(psbt, &is_elements);
+    *is_pset = is_elements != 0;
+    if (ret == WALLY_OK)
+        ret = wally_psbt_get_id(psbt, 0, id, WALLY_TXHASH_LEN);
+    return ret;
+}
+
+int wally_psbt_get_patch(const struct wally_psbt *base,
+                         const struct wally_psbt *psbt, uint32_t flags,
+                         unsigned char *bytes_out, size_t len,
+                         size_t *written)
+{
+    unsigned char id[WALLY_TXHASH_LEN], base_id[WALLY_TXHASH_LEN];
+    unsigned char *cursor = bytes_out, *from = NULL, *to = NULL;
+    size_t max = len, from_len, to_len, num_sections, i;
+    bool is_pset;
+    int ret;
+
+    if (written)
+        *written = 0;
+    if (!psbt_is_valid(base) || !psbt_is_valid(psbt) || flags || !written ||
+        base->version != psbt->version ||
+        base->num_inputs != psbt->num_inputs ||
+        base->num_outputs != psbt->num_outputs ||
+        memcmp(base->magic, psbt->magic, sizeof(psbt->magic)))
+        return WALLY_EINVAL;
+
+    ret = psbt_get_id_and_is_pset(base, base_id, &is_pset);
+    if (ret == WALLY_OK)
+        ret = wally_psbt_get_id(psbt, 0, id, sizeof(id));
+    if (ret == WALLY_OK && memcmp(base_id, id, sizeof(id)))
+        ret = WALLY_EINVAL; /* Different transactions */
+    if (ret == WALLY_OK) {
+        push_bytes(&cursor, &max, PSBT_PATCH_MAGIC, sizeof(PSBT_PATCH_MAGIC));
+        push_u8(&cursor, &max, psbt->version);
+        push_u8(&cursor, &max, is_pset);
+        push_bytes(&cursor, &max, id, sizeof(id));
+
+        num_sections = 1 + psbt->num_inputs + psbt->num_outputs;
+        for (i = 0; ret == WALLY_OK && i < num_sections; ++i) {
+            ret = psbt_section_alloc(base, i, is_pset, &from, &from_len);
+            if (ret == WALLY_OK)
+                ret = psbt_section_alloc(psbt, i, is_pset, &to, &to_len);
+            if (ret == WALLY_OK)
+                ret = push_psbt_section_diff(&cursor, &max, i,
+                                             from, from_len, to, to_len);
+            clear_and_free_bytes(&from, &from_len);
+            clear_and_free_bytes(&to, &to_len);
+        }
+        push_varint(&cursor, &max, 0); /* End of sections */
+    }
+    if (ret == WALLY_OK)
+        *written = cursor ? len - max : len + max;
+    wally_clear_2(id, sizeof(id), base_id, sizeof(base_id));
+    return ret;
+}
+
+int wally_psbt_get_patch_length(const struct wally_psbt *base,
+                                const struct wally_psbt *psbt,
+                                uint32_t flags, size_t *written)
+{
+    return wally_psbt_get_patch(base, psbt, flags, NULL, 0, written);
+}
+
+/* Split a patch into its sections, validating their ordering */
+static int psbt_patch_sections_alloc(const struct wally_psbt *psbt,
+                                     const unsigned char *bytes, size_t len,
+                                     struct psbt_patch_section **output,
+                                     size_t *num_sections)
+{
+    const size_t max_section = 1 + psbt->num_inputs + psbt->num_outputs;
+    const unsigned char *cursor = bytes, *start;
+    struct psbt_record record, prev;
+    size_t max = len, allocation_len = 0, num_records;
+    uint64_t section, prev_section = 0;
+    int ret = WALLY_OK;
+
+    *output = NULL;
+    *num_sections = 0;
+    while (ret == WALLY_OK && (section = pull_varint(&cursor, &max)) != 0) {
+        if (section <= prev_section || section > max_section) {
+            ret = WALLY_EINVAL; /* Out of order or out of range */
+            break;
+        }
+        prev_section = section;
+        start = cursor;
+        for (num_records = 0; pull_psbt_record(&cursor, &max, true, &record); ++num_records) {
+            if (num_records && psbt_record_compare(&prev, &record) >= 0) {
+                pull_failed(&cursor, &max); /* Out of order or duplicate */
+                break;
+            }
+            prev = record;
+        }
+        if (!cursor)
+            ret = WALLY_EINVAL;
+        else if ((ret = array_grow((void **)output, *num_sections, &allocation_len,
+                                   sizeof(**output))) == WALLY_OK) {
+            (*output)[*num_sections].section = section - 1;
+            (*output)[*num_sections].records = start;
+            (*output)[*num_sections].records_len = cursor - start;
+            ++*num_sections;
+        }
+    }
+    if (ret == WALLY_OK && (!cursor || max))
+        ret = WALLY_EINVAL; /* Truncated, or trailing data */
+    if (ret != WALLY_OK) {
+        wally_free(*output);
+        *output = NULL;
+        *num_sections = 0;
+    }
+    return ret;
+}
+
+/* Apply a patch that changes globals by re-parsing the whole PSBT */
+static int psbt_apply_patch_all(struct wally_psbt *psbt, bool is_pset,
+                                const unsigned char *id, size_t patch_len,
+                                const struct psbt_patch_section *sections,
+                                size_t num_sections)
+{
+    const size_t max_section = 1 + psbt->num_inputs + psbt->num_outputs;
+    unsigned char new_id[WALLY_TXHASH_LEN], *bytes = NULL, *section = NULL, *cursor;
+    size_t bytes_len, section_len, max, i, j = 0;
+    struct wally_psbt *parsed = NULL, tmp;
+    int ret = wally_psbt_get_length(psbt, 0, &bytes_len);
+
+    if (ret == WALLY_OK) {
+        /* A patched record is never longer than the patch record itself */
+        bytes_len += patch_len;
+        if (!(bytes = wally_malloc(bytes_len)))
+            ret = WALLY_ENOMEM;
+    }
+    cursor = bytes;
+    max = bytes_len;
+    push_bytes(&cursor, &max, psbt->magic, sizeof(psbt->magic));
+    for (i = 0; ret == WALLY_OK && i < max_section; ++i) {
+        const struct psbt_patch_section *patch = NULL;
+        if (j < num_sections && sections[j].section == i)
+            patch = sections + j++;
+        ret = psbt_section_alloc(psbt, i, is_pset, &section, &section_len);
+        if (ret == WALLY_OK)
+            ret = push_patched_section(&cursor, &max, section, section_len, patch);
+        clear_and_free_bytes(&section, &section_len);
+    }
+    if (ret == WALLY_OK && !cursor)
+        ret = WALLY_ERROR; /* Should not happen */
+    if (ret == WALLY_OK)
+        ret = psbt_from_bytes(bytes, bytes_len - max, 0, &parsed);
+    if (ret == WALLY_OK && (parsed->version != psbt->version ||
+                            parsed->num_inputs != psbt->num_inputs ||
+                            parsed->num_outputs != psbt->num_outputs))
+        ret = WALLY_EINVAL;
+    if (ret == WALLY_OK &&
+        (ret = wally_psbt_get_id(parsed, 0, new_id, sizeof(new_id))) == WALLY_OK &&
+        memcmp(new_id, id, sizeof(new_id)))
+        ret = WALLY_EINVAL; /* The patch changed the transaction */
+    if (ret == WALLY_OK) {
+        /* Swap in the patched contents, keeping our local caches */
+        tmp = *psbt;
+        *psbt = *parsed;
+        psbt->signing_cache = tmp.signing_cache;
+        psbt->outpoint_index = tmp.outpoint_index;
+        tmp.signing_cache = NULL;
+        tmp.outpoint_index = NULL;
+        *parsed = tmp;
+    }
+    wally_psbt_free(parsed);
+    clear_and_free(bytes, bytes_len);
+    wally_clear(new_id, sizeof(new_id));
+    return ret;
+}
+
+static void swap_patched_sections(struct wally_psbt *psbt,
+                                  const struct psbt_patch_section *sections,
+                                  size_t num_sections,
+                                  struct wally_psbt_input *inputs, size_t num_inputs,
+                                  struct wally_psbt_output *outputs)
+{
+    struct wally_psbt_input tmp_input;
+    struct wally_psbt_output tmp_output;
+    size_t i;
+
+    for (i = 0; i < num_sections; ++i) {
+        const size_t index = sections[i].section - 1;
+        if (i < num_inputs) {
+            tmp_input = psbt->inputs[index];
+            psbt->inputs[index] = inputs[i];
+            inputs[i] = tmp_input;
+        } else {
+            tmp_output = psbt->outputs[index - psbt->num_inputs];
+            psbt->outputs[index - psbt->num_inputs] = outputs[i - num_inputs];
+            outputs[i - num_inputs] = tmp_output;
+        }
+    }
+}
+
+/* Apply a patch that changes only inputs and outputs, re-parsing only
+ * the sections that are changed */
+static int psbt_apply_patch_sections(struct wally_psbt *psbt, bool is_pset,
+                                     const unsigned char *id,
+                                     const struct psbt_patch_section *sections,
+                                     size_t num_sections)
+{
+    const uint32_t tx_flags = is_pset ? WALLY_TX_FLAG_USE_ELEMENTS : 0;
+    unsigned char new_id[WALLY_TXHASH_LEN], *section = NULL, *bytes = NULL, *cursor;
+    struct wally_psbt_input *inputs = NULL;
+    struct wally_psbt_output *outputs = NULL;
+    size_t num_inputs = 0, num_outputs = 0, section_len, bytes_len, max, i;
+    struct utxo_table utxos;
+    int ret;
+
+    /* Parse the patched sections into new inputs/outputs */
+    for (i = 0; i < num_sections && sections[i].section <= psbt->num_inputs; ++i)
+        ++num_inputs;
+    if (num_inputs && !(inputs = wally_malloc(num_inputs * sizeof(*inputs))))
+        return WALLY_ENOMEM;
+    if (num_sections > num_inputs &&
+        !(outputs = wally_malloc((num_sections - num_inputs) * sizeof(*outputs)))) {
+        wally_free(inputs);
+        return WALLY_ENOMEM;
+    }
+    num_inputs = 0;
+    ret = utxo_table_init(psbt, &utxos);
+    for (i = 0; ret == WALLY_OK && i < num_sections; ++i) {
+        const unsigned char *p;
+        ret = psbt_section_alloc(psbt, sections[i].section, is_pset,
+                                 &section, &section_len);
+        if (ret == WALLY_OK) {
+            /* A patched record is never longer than the patch record itself */
+            bytes_len = section_len + sections[i].records_len;
+            if (!(bytes = wally_malloc(bytes_len)))
+                ret = WALLY_ENOMEM;
+        }
+        if (ret == WALLY_OK) {
+            cursor = bytes;
+            max = bytes_len;
+            ret = push_patched_section(&cursor, &max, section, section_len,
+                                       sections + i);
+        }
+        if (ret == WALLY_OK) {
+            p = bytes;
+            max = bytes_len - max;
+            if (sections[i].section <= psbt->num_inputs) {
+                psbt_input_init(inputs + num_inputs);
+                ret = pull_psbt_input(psbt, &p, &max, tx_flags, 0, &utxos,
+                                      inputs + num_inputs++);
+            } else {
+                psbt_output_init(outputs + num_outputs);
+                ret = pull_psbt_output(psbt, &p, &max, tx_flags, 0,
+                                       outputs + num_outputs++);
+            }
+            if (ret == WALLY_OK && (!p || max))
+                ret = WALLY_EINVAL; /* Invalid or trailing data */
+        }
+        clear_and_free_bytes(&section, &section_len);
+        clear_and_free_bytes(&bytes, &bytes_len);
+    }
+    utxo_table_free(&utxos);
+
+    if (ret == WALLY_OK) {
+        swap_patched_sections(psbt, sections, num_sections, inputs, num_inputs, outputs);
+        ret = wally_psbt_get_id(psbt, 0, new_id, sizeof(new_id));
+        if (ret == WALLY_OK && memcmp(new_id, id, sizeof(new_id)))
+            ret = WALLY_EINVAL; /* The patch changed the transaction */
+        if (ret != WALLY_OK)
+            swap_patched_sections(psbt, sections, num_sections, inputs, num_inputs, outputs);
+    }
+    /* Free the replaced (or on error, unused) inputs/outputs */
+    for (i = 0; i < num_inputs; ++i)
+        psbt_input_free(inputs + i, false);
+    for (i = 0; i < num_outputs; ++i)
+        psbt_output_free(outputs + i, false);
+    wally_free(inputs);
+    wally_free(outputs);
+    wally_clear(new_id, sizeof(new_id));
+    return ret;
+}
+
+int wally_psbt_apply_patch(struct wally_psbt *psbt,
+                           const unsigned char *bytes, size_t bytes_len,
+                           uint32_t flags)
+{
+    unsigned char id[WALLY_TXHASH_LEN];
+    struct psbt_patch_section *sections = NULL;
+    size_t num_sections = 0;
+    bool is_pset;
+    int ret;
+
+    if (!psbt_is_valid(psbt) || !bytes || bytes_len < PSBT_PATCH_HEADER_LEN ||
+        flags || memcmp(bytes, PSBT_PATCH_MAGIC, sizeof(PSBT_PATCH_MAGIC)))
+        return WALLY_EINVAL;
+
+    ret = psbt_get_id_and_is_pset(psbt, id, &is_pset);
+    if (ret == WALLY_OK &&
+        (bytes[sizeof(PSBT_PATCH_MAGIC)] != psbt->version ||
+         bytes[sizeof(PSBT_PATCH_MAGIC) + 1] != is_pset ||
+         memcmp(bytes + sizeof(PSBT_PATCH_MAGIC) + 2, id, sizeof(id))))
+        ret = WALLY_EINVAL; /* Patch is for a different PSBT */
+    if (ret == WALLY_OK)
+        ret = psbt_patch_sections_alloc(psbt, bytes + PSBT_PATCH_HEADER_LEN,
+                                        bytes_len - PSBT_PATCH_HEADER_LEN,
+                                        &sections, &num_sections);
+    if (ret == WALLY_OK && num_sections) {
+        if (!sections[0].section)
+            ret = psbt_apply_patch_all(psbt, is_pset, id, bytes_len,
+                                       sections, num_sections);
+        else
+            ret = psbt_apply_patch_sections(psbt, is_pset, id,
+                                            sections, num_sections);
+    }
+    wally_free(sections);
+    wally_clear(id, sizeof(id));
+    return ret;
+}
+
 int wally_psbt_from_base64_n(const char *str_in, size_t str_len, uint32_t flags, struct wally_psbt **output)
 {
     unsigned char *decoded;
@@ -3625,8 +4670,31 @@ static int merge_value_commitment(struct wally_map *dst_fields, uint64_t *dst_am
 }
 #endif /* BUILD_ELEMENTS */
 
+static int combine_utxo(struct utxo_table *utxos, struct wally_psbt_input *dst,
+                        const struct wally_psbt_input *src)
+{
+    const struct psbt_utxo *src_utxo = psbt_input_get_utxo(src);
+    struct psbt_utxo **slot, *shared;
+    struct wally_tx *tx;
+    int ret;
+
+    if (dst->utxo || !src_utxo)
+        return WALLY_OK;
+    /* Share the copy of the utxo made for any other input */
+    if ((slot = utxo_table_slot(utxos, src_utxo->wtxid)) && *slot) {
+        psbt_input_share_utxo(dst, *slot);
+        return WALLY_OK;
+    }
+    if ((ret = tx_clone_alloc(&src_utxo->tx, &tx)) == WALLY_OK &&
+        (ret = psbt_input_give_utxo(dst, tx, src_utxo->txid, src_utxo->wtxid,
+                                    &shared)) == WALLY_OK && slot)
+        *slot = shared;
+    return ret;
+}
+
 static int combine_input(struct wally_psbt_input *dst,
                          const struct wally_psbt_input *src,
+                         struct utxo_table *utxos,
                          bool is_pset, bool for_clone)
 {
     int ret;
@@ -3641,7 +4709,7 @@ static int combine_input(struct wally_psbt_input *dst,
     if (dst->sequence == WALLY_TX_SEQUENCE_FINAL)
         dst->sequence = src->sequence;
 
-    if ((ret = combine_txs(&dst->utxo, src->utxo)) != WALLY_OK)
+    if ((ret = combine_utxo(utxos, dst, src)) != WALLY_OK)
         return ret;
 
     if (!dst->witness_utxo && src->witness_utxo) {
@@ -3834,8 +4902,9 @@ static int combine_output(struct wally_psbt_output *dst,
 static int psbt_combine(struct wally_psbt *psbt, const struct wally_psbt *src,
                         bool is_pset, bool for_clone)
 {
+    struct utxo_table utxos;
     size_t i;
-    int ret = WALLY_OK;
+    int ret;
 
     if (psbt->num_inputs != src->num_inputs ||
         psbt->num_outputs != src->num_outputs ||
@@ -3850,8 +4919,11 @@ static int psbt_combine(struct wally_psbt *psbt, const struct wally_psbt *src,
     /* Take any extra flags from the source psbt that we don't have  */
     psbt->tx_modifiable_flags |= src->tx_modifiable_flags;
 
+    ret = utxo_table_init(psbt, &utxos);
     for (i = 0; ret == WALLY_OK && i < psbt->num_inputs; ++i)
-        ret = combine_input(&psbt->inputs[i], &src->inputs[i], is_pset, for_clone);
+        ret = combine_input(&psbt->inputs[i], &src->inputs[i], &utxos,
+                            is_pset, for_clone);
+    utxo_table_free(&utxos);
 
     for (i = 0; ret == WALLY_OK && i < psbt->num_outputs; ++i)
         ret = combine_output(&psbt->outputs[i], &src->outputs[i], is_pset, for_clone);
@@ -4473,7 +5545,7 @@ static int get_scriptcode(const struct wally_psbt *psbt, size_t index,
         unsigned char txid[WALLY_TXHASH_LEN];
 
         ret = wally_psbt_get_input_previous_txid(psbt, index, txid, sizeof(txid));
-        if (ret != WALLY_OK || !is_matching_txid(inp->utxo, txid, sizeof(txid)))
+        if (ret != WALLY_OK || !is_matching_utxo(inp, txid, sizeof(txid)))
             return WALLY_EINVAL; /* Prevout doesn't match input */
         *script = scriptcode;
         *script_len = scriptcode_len;
@@ -4641,17 +5713,25 @@ int wally_psbt_get_input_signature_hash(struct wally_psbt *psbt, size_t index,
     return ret;
 }
 
-int wally_psbt_sign_input_bip32(struct wally_psbt *psbt,
-                                size_t index, size_t subindex,
-                                const unsigned char *txhash, size_t txhash_len,
-                                const struct ext_key *hdkey,
-                                uint32_t flags)
+/* A signature made for a PSBT input, ready to be added to it */
+struct psbt_input_sig {
+    unsigned char sig[EC_SIGNATURE_DER_MAX_LEN + 1]; /* Including sighash byte */
+    size_t sig_len;
+    size_t pubkey_idx; /* 1-based index of the signing key in keypaths, or 0 for taproot */
+};
+
+/* Create the signature for an input without modifying the PSBT */
+static int psbt_input_make_sig(const struct wally_psbt *psbt,
+                               size_t index, size_t subindex,
+                               const unsigned char *txhash, size_t txhash_len,
+                               const struct ext_key *hdkey, uint32_t flags,
+                               struct psbt_input_sig *out)
 {
-    unsigned char sig[EC_SIGNATURE_LEN + 1], der[EC_SIGNATURE_DER_MAX_LEN + 1];
-    unsigned char signing_key[EC_PRIVATE_KEY_LEN];
-    size_t sig_len = EC_SIGNATURE_LEN, der_len, pubkey_idx;
+    unsigned char sig[EC_SIGNATURE_LEN];
+    unsigned char signing_key_buf[EC_PRIVATE_KEY_LEN], *signing_key;
+    size_t pubkey_idx;
     uint32_t sighash;
-    struct wally_psbt_input *inp = psbt_get_input(psbt, index);
+    const struct wally_psbt_input *inp = psbt_get_input(psbt, index);
     const bool is_taproot = is_taproot_input(psbt, inp);
     int ret;
 
@@ -4676,6 +5756,7 @@ int wally_psbt_sign_input_bip32(struct wally_psbt *psbt,
     if (ret != WALLY_OK || !pubkey_idx)
         return WALLY_EINVAL; /* Signing pubkey key not found */
 
+    signing_key = secure_alloc(signing_key_buf, sizeof(signing_key_buf));
     if (!is_taproot) {
         /* ECDSA: Use untweaked private key. Only grinding flag is relevant */
         memcpy(signing_key, hdkey->priv_key + 1, EC_PRIVATE_KEY_LEN);
@@ -4690,7 +5771,7 @@ int wally_psbt_sign_input_bip32(struct wally_psbt *psbt,
         ret = wally_ec_private_key_bip341_tweak(hdkey->priv_key + 1, EC_PRIVATE_KEY_LEN,
                                                 merkle_root, merkle_root_len,
                                                 flags & EC_FLAG_ELEMENTS,
-                                                signing_key, sizeof(signing_key));
+                                                signing_key, EC_PRIVATE_KEY_LEN);
         if (ret != WALLY_OK)
             goto done;
         /* Only Elements flag is relevant */
@@ -4707,38 +5788,98 @@ int wally_psbt_sign_input_bip32(struct wally_psbt *psbt,
 
     /* Compute the sig */
     ret = wally_ec_sig_from_bytes(signing_key, EC_PRIVATE_KEY_LEN,
-                                  txhash, txhash_len, flags, sig, sig_len);
+                                  txhash, txhash_len, flags, sig, sizeof(sig));
     if (ret == WALLY_OK) {
         if (flags & EC_FLAG_SCHNORR) {
-            /* Add sighash byte (if needed) and store */
+            /* Add sighash byte (if needed) */
+            memcpy(out->sig, sig, sizeof(sig));
+            out->sig_len = sizeof(sig);
             if (sighash != WALLY_SIGHASH_DEFAULT)
-                sig[sig_len++] = sighash & 0xff;
-            ret = wally_psbt_input_set_taproot_signature(inp, sig, sig_len);
+                out->sig[out->sig_len++] = sighash & 0xff;
+            out->pubkey_idx = 0;
         } else {
-            /* Convert to DER, add sighash byte and store */
-            ret = wally_ec_sig_to_der(sig, sig_len, der, sizeof(der), &der_len);
+            /* Convert to DER and add sighash byte */
+            ret = wally_ec_sig_to_der(sig, sizeof(sig), out->sig,
+                                      sizeof(out->sig), &out->sig_len);
             if (ret == WALLY_OK) {
-                const struct wally_map_item *pk;
-                der[der_len++] = sighash & 0xff;
-                pk = &inp->keypaths.items[pubkey_idx - 1];
-                ret = wally_psbt_input_add_signature(inp, pk->key, pk->key_len,
-                                                     der, der_len);
+                out->sig[out->sig_len++] = sighash & 0xff;
+                out->pubkey_idx = pubkey_idx;
             }
         }
     }
 done:
-    wally_clear_3(signing_key, sizeof(signing_key), sig,
-                  sizeof(sig), der, sizeof(der));
+    wally_clear(sig, sizeof(sig));
+    secure_free(signing_key, signing_key_buf, sizeof(signing_key_buf));
     return ret;
 }
 
-int wally_psbt_sign_bip32(struct wally_psbt *psbt,
-                          const struct ext_key *hdkey, uint32_t flags)
+/* Store a signature created by psbt_input_make_sig in its input */
+static int psbt_input_add_sig(struct wally_psbt *psbt, size_t index,
+                              const struct psbt_input_sig *in)
+{
+    struct wally_psbt_input *inp = &psbt->inputs[index];
+    const struct wally_map_item *pk;
+
+    if (!in->pubkey_idx)
+        return wally_psbt_input_set_taproot_signature(inp, in->sig, in->sig_len);
+    pk = &inp->keypaths.items[in->pubkey_idx - 1];
+    return wally_psbt_input_add_signature(inp, pk->key, pk->key_len,
+                                          in->sig, in->sig_len);
+}
+
+int wally_psbt_sign_input_bip32(struct wally_psbt *psbt,
+                                size_t index, size_t subindex,
+                                const unsigned char *txhash, size_t txhash_len,
+                                const struct ext_key *hdkey,
+                                uint32_t flags)
+{
+    struct psbt_input_sig sig;
+    int ret = psbt_input_make_sig(psbt, index, subindex, txhash, txhash_len,
+                                  hdkey, flags, &sig);
+    if (ret == WALLY_OK)
+        ret = psbt_input_add_sig(psbt, index, &sig);
+    wally_clear(&sig, sizeof(sig));
+    return ret;
+}
+
+/* Per-input state for signing a PSBT with run_tasks */
+struct sign_batch {
+    const struct wally_psbt *psbt;
+    const struct ext_key *hdkey;
+    struct ext_key **keys; /* The derived key to sign each input with, if any */
+    unsigned char *txhashes; /* The signature hash of each input */
+    struct psbt_input_sig *sigs; /* The signature made for each input */
+    uint32_t flags;
+    int *rets; /* The result of each inputs task */
+};
+
+static void sign_derive_task(void *batch, size_t i)
+{
+    const struct sign_batch *b = (const struct sign_batch *)batch;
+    /* Note that we do not iterate subindex, so we will not sign more
+     * than one signature that derives from the same parent key */
+    b->rets[i] = wally_psbt_get_input_bip32_key_from_alloc(b->psbt, i, 0, 0,
+                                                           b->hdkey, &b->keys[i]);
+}
+
+static void sign_input_task(void *batch, size_t i)
+{
+    const struct sign_batch *b = (const struct sign_batch *)batch;
+    if (b->keys[i])
+        b->rets[i] = psbt_input_make_sig(b->psbt, i, 0,
+                                         b->txhashes + i * WALLY_TXHASH_LEN,
+                                         WALLY_TXHASH_LEN, b->keys[i],
+                                         b->flags, &b->sigs[i]);
+}
+
+static int psbt_sign_bip32(struct wally_psbt *psbt,
+                           const struct ext_key *hdkey, uint32_t flags)
 {
     unsigned char p2pkh[WALLY_SCRIPTPUBKEY_P2PKH_LEN];
-    size_t i;
+    struct sign_batch b;
+    size_t i, num_to_sign;
     bool is_pset;
-    int ret;
+    int ret, hash_ret;
     struct wally_tx *tx;
 
     if (!hdkey || hdkey->priv_key[0] != BIP32_FLAG_KEY_PRIVATE ||
@@ -4754,25 +5895,36 @@ int wally_psbt_sign_bip32(struct wally_psbt *psbt,
     }
 #endif
 
-    /* Go through each of the inputs */
-    for (i = 0; ret == WALLY_OK && i < psbt->num_inputs; ++i) {
-        unsigned char txhash[WALLY_TXHASH_LEN];
+    b.psbt = psbt;
+    b.hdkey = hdkey;
+    b.flags = flags;
+    b.keys = wally_calloc(psbt->num_inputs * sizeof(*b.keys));
+    b.txhashes = wally_malloc(psbt->num_inputs * WALLY_TXHASH_LEN);
+    b.sigs = wally_malloc(psbt->num_inputs * sizeof(*b.sigs));
+    b.rets = wally_calloc(psbt->num_inputs * sizeof(int));
+    if (psbt->num_inputs && (!b.keys || !b.txhashes || !b.sigs || !b.rets)) {
+        ret = WALLY_ENOMEM;
+        goto done;
+    }
+
+    /* Derive the key for signing each input, if we have one */
+    run_tasks(sign_derive_task, &b, psbt->num_inputs);
+
+    /* Compute the hash to sign for each input in order, stopping at the
+     * first failure. Hashing updates the signing cache so is not run
+     * as tasks */
+    for (num_to_sign = 0; num_to_sign < psbt->num_inputs; ++num_to_sign) {
         const unsigned char *script = NULL, *scriptcode = NULL;
-        size_t script_len, scriptcode_len, subindex = 0;
-        struct ext_key *derived = NULL;
+        size_t script_len, scriptcode_len;
 
-        /* Get or derive a key for signing this input.
-         * Note that we do not iterate subindex in this loop, so we will not
-         * sign more than one signature that derives from the same parent key.
-         */
-        ret = wally_psbt_get_input_bip32_key_from_alloc(psbt, i, subindex,
-                                                        0, hdkey, &derived);
-        if (!derived)
+        i = num_to_sign;
+        if ((ret = b.rets[i]) != WALLY_OK)
+            break;
+        if (!b.keys[i])
             continue; /* No key to sign with */
 
         /* Get the scriptpubkey or redeemscript */
-        if (ret == WALLY_OK)
-            ret = get_signing_script(psbt, i, &script, &script_len);
+        ret = get_signing_script(psbt, i, &script, &script_len);
 
         /* Get the actual script to sign with */
         if (ret == WALLY_OK)
@@ -4784,19 +5936,48 @@ int wally_psbt_sign_bip32(struct wally_psbt *psbt,
         if (ret == WALLY_OK)
             ret = wally_psbt_get_input_signature_hash(psbt, i, tx,
                                                       scriptcode, scriptcode_len,
-                                                      0, txhash, sizeof(txhash));
-        /* Sign the input */
-        if (ret == WALLY_OK)
-            ret = wally_psbt_sign_input_bip32(psbt, i, subindex,
-                                              txhash, sizeof(txhash),
-                                              derived, flags);
-        bip32_key_free(derived);
+                                                      0, b.txhashes + i * WALLY_TXHASH_LEN,
+                                                      WALLY_TXHASH_LEN);
+        if (ret != WALLY_OK)
+            break;
     }
 
+    /* Create the signatures for the inputs before any failure as tasks,
+     * then add them in order, stopping at the first failure. As when
+     * signing one input at a time, the inputs before a failing input
+     * are signed and those from it onwards are not */
+    hash_ret = ret;
+    run_tasks(sign_input_task, &b, num_to_sign);
+    for (i = 0, ret = WALLY_OK; ret == WALLY_OK && i < num_to_sign; ++i) {
+        if (b.keys[i] && (ret = b.rets[i]) == WALLY_OK)
+            ret = psbt_input_add_sig(psbt, i, &b.sigs[i]);
+    }
+    if (ret == WALLY_OK)
+        ret = hash_ret;
+
+done:
+    if (b.keys) {
+        for (i = 0; i < psbt->num_inputs; ++i)
+            bip32_key_free(b.keys[i]);
+        wally_free(b.keys);
+    }
+    clear_and_free(b.txhashes, psbt->num_inputs * WALLY_TXHASH_LEN);
+    clear_and_free(b.sigs, psbt->num_inputs * sizeof(*b.sigs));
+    wally_free(b.rets);
     wally_tx_free(tx);
     return ret;
 }
 
+int wally_psbt_sign_bip32(struct wally_psbt *psbt,
+                          const struct ext_key *hdkey, uint32_t flags)
+{
+    int ret;
+    STATS_BEGIN(WALLY_STATS_PSBT_SIGN);
+    ret = psbt_sign_bip32(psbt, hdkey, flags);
+    STATS_END();
+    return ret;
+}
+
 int wally_psbt_sign(struct wally_psbt *psbt,
                     const unsigned char *priv_key, size_t priv_key_len, uint32_t flags)
 {
@@ -5069,7 +6250,92 @@ static bool finalize_csv2of2_1(const struct wally_psbt *psbt,
     return false;
 }
 
-int wally_psbt_finalize_input(struct wally_psbt *psbt, size_t index, uint32_t flags)
+/* Create a P2SH scriptSig pushing each witness item then the redeem script */
+static bool finalize_p2sh_from_witness(struct wally_psbt_input *input,
+                                       const struct wally_tx_witness_stack *witness,
+                                       const unsigned char *redeem_script,
+                                       size_t redeem_script_len)
+{
+    unsigned char *script, *p;
+    size_t script_len = script_get_push_size(redeem_script_len), written, i;
+    bool ret = false;
+
+    for (i = 0; i < witness->num_items; ++i)
+        script_len += script_get_push_size(witness->items[i].witness_len);
+    if (!(p = script = wally_malloc(script_len)))
+        return false;
+
+    for (i = 0; i <= witness->num_items; ++i) {
+        const bool is_redeem_script = i == witness->num_items;
+        const unsigned char *bytes = is_redeem_script ? redeem_script : witness->items[i].witness;
+        const size_t bytes_len = is_redeem_script ? redeem_script_len : witness->items[i].witness_len;
+
+        if (bytes_len == 1 && bytes[0] && bytes[0] <= 16)
+            *p++ = value_to_op_n(bytes[0]); /* Minimal push of a small number */
+        else if (wally_script_push_from_bytes(bytes, bytes_len, 0, p,
+                                              script_len - (p - script),
+                                              &written) != WALLY_OK)
+            goto done;
+        else
+            p += written;
+    }
+    ret = wally_psbt_input_set_final_scriptsig(input, script, p - script) == WALLY_OK;
+done:
+    wally_free(script);
+    return ret;
+}
+
+static bool finalize_miniscript(const struct wally_psbt *psbt,
+                                struct wally_psbt_input *input, size_t index,
+                                const unsigned char *out_script, size_t out_script_len,
+                                bool is_witness, bool is_p2sh,
+                                uint32_t locktime, struct ms_plan_cache *cache)
+{
+    struct ms_plan *plan;
+    struct ms_plan_data data;
+    struct wally_tx_witness_stack *witness;
+    bool ret;
+
+    if (is_witness ? !wally_map_get_integer(&input->psbt_fields, PSBT_IN_WITNESS_SCRIPT) : !is_p2sh)
+        return false; /* Miniscript must be given as a witness or redeem script */
+
+    if (ms_plan_cache_get(cache, out_script, out_script_len,
+                          is_witness, &plan) != WALLY_OK)
+        return false; /* Not miniscript */
+
+    data.signatures = &input->signatures;
+    data.keypaths = &input->keypaths;
+    data.preimages = &input->preimages;
+    data.tx_version = psbt->tx ? psbt->tx->version : psbt->tx_version;
+    data.sequence = psbt->version == PSBT_0 ? psbt->tx->inputs[index].sequence : input->sequence;
+    data.locktime = locktime;
+    if (ms_plan_satisfy(plan, &data, &witness) != WALLY_OK)
+        return false; /* Not enough data to satisfy the script */
+
+    if (!is_witness) {
+        ret = finalize_p2sh_from_witness(input, witness, out_script, out_script_len);
+        wally_tx_witness_stack_free(witness);
+        return ret;
+    }
+    if (wally_tx_witness_stack_add(witness, out_script, out_script_len) != WALLY_OK) {
+        wally_tx_witness_stack_free(witness);
+        return false;
+    }
+    input->final_witness = witness;
+    return !is_p2sh || finalize_p2sh_wrapped(input);
+}
+
+/* Get the locktime that the extracted tx will have */
+static uint32_t psbt_get_final_locktime(const struct wally_psbt *psbt)
+{
+    size_t locktime;
+    if (psbt->version == PSBT_0)
+        return psbt->tx->locktime;
+    return wally_psbt_get_locktime(psbt, &locktime) == WALLY_OK ? locktime : 0;
+}
+
+static int psbt_finalize_input(struct wally_psbt *psbt, size_t index, uint32_t flags,
+                               uint32_t locktime, struct ms_plan_cache *cache)
 {
     struct wally_psbt_input *input = psbt_get_input(psbt, index);
     const struct wally_map_item *script;
@@ -5078,7 +6344,7 @@ int wally_psbt_finalize_input(struct wally_psbt *psbt, size_t index, uint32_t fl
     uint32_t utxo_index;
     bool is_witness = false, is_p2sh = false;
 
-    if (!psbt_is_valid(psbt) || !input || (flags & ~WALLY_PSBT_FINALIZE_NO_CLEAR))
+    if (!input)
         return WALLY_EINVAL;
 
     if (wally_psbt_get_input_output_index(psbt, index, &utxo_index) != WALLY_OK)
@@ -5119,7 +6385,12 @@ int wally_psbt_finalize_input(struct wally_psbt *psbt, size_t index, uint32_t fl
 
     switch (type) {
     case WALLY_SCRIPT_TYPE_P2PKH:
-        if (!finalize_p2pkh(input))
+        if (is_witness || is_p2sh) {
+            /* pkh() inside a witness or redeem script */
+            if (!finalize_miniscript(psbt, input, index, out_script, out_script_len,
+                                     is_witness, is_p2sh, locktime, cache))
+                return WALLY_OK;
+        } else if (!finalize_p2pkh(input))
             return WALLY_OK;
         break;
     case WALLY_SCRIPT_TYPE_P2WPKH:
@@ -5146,7 +6417,10 @@ int wally_psbt_finalize_input(struct wally_psbt *psbt, size_t index, uint32_t fl
             return WALLY_OK;
         break;
     default:
-        return WALLY_OK; /* Unhandled script type  */
+        if (!finalize_miniscript(psbt, input, index, out_script, out_script_len,
+                                 is_witness, is_p2sh, locktime, cache))
+            return WALLY_OK; /* Unhandled script type  */
+        break;
     }
 
 done:
@@ -5164,15 +6438,33 @@ done:
     return WALLY_OK;
 }
 
+int wally_psbt_finalize_input(struct wally_psbt *psbt, size_t index, uint32_t flags)
+{
+    struct ms_plan_cache cache = { NULL, 0, 0 };
+    int ret;
+
+    if (!psbt_is_valid(psbt) || (flags & ~WALLY_PSBT_FINALIZE_NO_CLEAR))
+        return WALLY_EINVAL;
+    ret = psbt_finalize_input(psbt, index, flags,
+                              psbt_get_final_locktime(psbt), &cache);
+    ms_plan_cache_clear(&cache);
+    return ret;
+}
+
 int wally_psbt_finalize(struct wally_psbt *psbt, uint32_t flags)
 {
+    /* Inputs spending the same miniscript share its satisfaction plan */
+    struct ms_plan_cache cache = { NULL, 0, 0 };
+    uint32_t locktime;
     size_t i;
     int ret = WALLY_OK;
 
     if (!psbt_is_valid(psbt) || (flags & ~WALLY_PSBT_FINALIZE_NO_CLEAR))
         return WALLY_EINVAL;
+    locktime = psbt_get_final_locktime(psbt);
     for (i = 0; ret == WALLY_OK && i < psbt->num_inputs; ++i)
-        ret = wally_psbt_finalize_input(psbt, i, flags);
+        ret = psbt_finalize_input(psbt, i, flags, locktime, &cache);
+    ms_plan_cache_clear(&cache);
     return ret;
 }
 
@@ -5269,14 +6561,14 @@ static int compute_final_vbf(struct wally_psbt *psbt,
 #endif /* BUILD_ELEMENTS */
 
 #ifndef WALLY_ABI_NO_ELEMENTS
-int wally_psbt_blind(struct wally_psbt *psbt,
-                     const struct wally_map *values,
-                     const struct wally_map *vbfs,
-                     const struct wally_map *assets,
-                     const struct wally_map *abfs,
-                     const unsigned char *entropy, size_t entropy_len,
-                     uint32_t output_index, uint32_t flags,
-                     struct wally_map *ephemeral_keys_out)
+static int psbt_blind(struct wally_psbt *psbt,
+                      const struct wally_map *values,
+                      const struct wally_map *vbfs,
+                      const struct wally_map *assets,
+                      const struct wally_map *abfs,
+                      const unsigned char *entropy, size_t entropy_len,
+                      uint32_t output_index, uint32_t flags,
+                      struct wally_map *ephemeral_keys_out)
 {
 #ifdef BUILD_ELEMENTS
     const secp256k1_context *ctx = secp_ctx();
@@ -5557,6 +6849,23 @@ done:
 #endif /* BUILD_ELEMENTS */
 }
 
+int wally_psbt_blind(struct wally_psbt *psbt,
+                     const struct wally_map *values,
+                     const struct wally_map *vbfs,
+                     const struct wally_map *assets,
+                     const struct wally_map *abfs,
+                     const unsigned char *entropy, size_t entropy_len,
+                     uint32_t output_index, uint32_t flags,
+                     struct wally_map *ephemeral_keys_out)
+{
+    int ret;
+    STATS_BEGIN(WALLY_STATS_PSBT_BLIND);
+    ret = psbt_blind(psbt, values, vbfs, assets, abfs, entropy, entropy_len,
+                     output_index, flags, ephemeral_keys_out);
+    STATS_END();
+    return ret;
+}
+
 int wally_psbt_blind_alloc(struct wally_psbt *psbt,
                            const struct wally_map *values,
                            const struct wally_map *vbfs,
@@ -5887,7 +7196,33 @@ int wally_psbt_has_input_required_lockheight(const struct wally_psbt *psbt,
     return WALLY_OK;
 }
 
-PSBT_SET_S(input, utxo, wally_tx)
+int wally_psbt_set_input_utxo(struct wally_psbt *psbt, size_t index,
+                              const struct wally_tx *utxo)
+{
+    struct wally_psbt_input *p = psbt_get_input(psbt, index);
+    unsigned char txid[WALLY_TXHASH_LEN], wtxid[WALLY_TXHASH_LEN];
+    struct wally_tx *new_utxo;
+    struct psbt_utxo *shared;
+    size_t i;
+    int ret;
+
+    if (!p || !utxo)
+        return wally_psbt_input_set_utxo(p, utxo);
+    if ((ret = tx_get_wtxid(utxo, wtxid, sizeof(wtxid))) != WALLY_OK)
+        return ret;
+    /* Share the utxo of any other input with an identical copy of the tx */
+    for (i = 0; i < psbt->num_inputs; ++i) {
+        shared = psbt_input_get_utxo(psbt->inputs + i);
+        if (shared && !memcmp(shared->wtxid, wtxid, sizeof(wtxid))) {
+            psbt_input_share_utxo(p, shared);
+            return WALLY_OK;
+        }
+    }
+    if ((ret = utxo_get_txid(utxo, wtxid, txid)) == WALLY_OK &&
+        (ret = tx_clone_alloc(utxo, &new_utxo)) == WALLY_OK)
+        ret = psbt_input_give_utxo(p, new_utxo, txid, wtxid, &shared);
+    return ret;
+}
 PSBT_SET_S(input, witness_utxo, wally_tx_output)
 int wally_psbt_set_input_witness_utxo_from_tx(struct wally_psbt *psbt, size_t index,
                                               const struct wally_tx *utxo, uint32_t utxo_index)
@@ -5922,8 +7257,36 @@ int wally_psbt_add_input_signature(struct wally_psbt *psbt, size_t index,
 
 PSBT_SET_S(input, unknowns, wally_map)
 PSBT_SET_I(input, sighash, uint32_t, PSBT_0)
-PSBT_SET_B(input, previous_txid, PSBT_2)
-PSBT_SET_I(input, output_index, uint32_t, PSBT_2)
+int wally_psbt_set_input_previous_txid(struct wally_psbt *psbt, size_t index,
+                                       const unsigned char *txhash, size_t txhash_len)
+{
+    struct wally_psbt_input *p = psbt_get_input(psbt, index);
+    uint32_t hash;
+    int ret;
+    if (!psbt || psbt->version != PSBT_2) return WALLY_EINVAL;
+    if (!p || !psbt->outpoint_index)
+        return wally_psbt_input_set_previous_txid(p, txhash, txhash_len);
+    hash = input_outpoint_hash(psbt, index);
+    ret = wally_psbt_input_set_previous_txid(p, txhash, txhash_len);
+    if (ret == WALLY_OK)
+        psbt_outpoint_index_update(psbt, index, hash);
+    return ret;
+}
+int wally_psbt_set_input_output_index(struct wally_psbt *psbt, size_t index,
+                                      uint32_t output_index)
+{
+    struct wally_psbt_input *p = psbt_get_input(psbt, index);
+    uint32_t hash;
+    int ret;
+    if (!psbt || psbt->version != PSBT_2) return WALLY_EINVAL;
+    if (!p || !psbt->outpoint_index)
+        return wally_psbt_input_set_output_index(p, output_index);
+    hash = input_outpoint_hash(psbt, index);
+    ret = wally_psbt_input_set_output_index(p, output_index);
+    if (ret == WALLY_OK)
+        psbt_outpoint_index_update(psbt, index, hash);
+    return ret;
+}
 PSBT_SET_I(input, sequence, uint32_t, PSBT_2)
 int wally_psbt_clear_input_sequence(struct wally_psbt *psbt, size_t index) {
     if (!psbt || psbt->version != PSBT_2) return WALLY_EINVAL;
@@ -314,34 +314,21 @@ int wally_ec_sig_from_bytes_len(const unsigned char *priv_key, size_t priv_key_l
                                            NULL, 0, flags, written);
 }
 
-int wally_ec_sig_from_bytes_aux(const unsigned char *priv_key, size_t priv_key_len,
-                                const unsigned char *bytes, size_t bytes_len,
-                                const unsigned char *aux_rand, size_t aux_rand_len,
-                                uint32_t flags, unsigned char *bytes_out, size_t len)
+/* Sign a message hash with a private key that has already been verified.
+ * For schnorr signatures, keypair must be the keypair for priv_key */
+static int ec_sig_from_bytes(const secp256k1_context *ctx,
+                             const unsigned char *priv_key,
+                             const secp256k1_keypair *keypair,
+                             const unsigned char *bytes,
+                             const unsigned char *aux_rand,
+                             uint32_t flags, unsigned char *bytes_out)
 {
-    wally_ec_nonce_t nonce_fn = wally_ops()->ec_nonce_fn;
-    const secp256k1_context *ctx = secp_ctx();
-    size_t expected_len;
-
-    if (wally_ec_sig_from_bytes_aux_len(priv_key, priv_key_len,
-                                        bytes, bytes_len, aux_rand, aux_rand_len,
-                                        flags, &expected_len) != WALLY_OK ||
-        !bytes_out || len != expected_len)
-        return WALLY_EINVAL;
-
-    if (!ctx)
-        return WALLY_ENOMEM;
-
     if (flags & EC_FLAG_SCHNORR) {
-        secp256k1_keypair keypair;
-        int ret = WALLY_OK;
-        if (!keypair_create(&keypair, priv_key))
-            ret = WALLY_EINVAL;
-        else if (!secp256k1_schnorrsig_sign32(ctx, bytes_out, bytes, &keypair, aux_rand))
-            ret = WALLY_ERROR;
-        wally_clear(&keypair, sizeof(&keypair));
-        return ret;
+        if (!secp256k1_schnorrsig_sign32(ctx, bytes_out, bytes, keypair, aux_rand))
+            return WALLY_ERROR;
+        return WALLY_OK;
     } else {
+        wally_ec_nonce_t nonce_fn = wally_ops()->ec_nonce_fn;
         unsigned char extra_entropy[32] = {0}, *entropy_p = (unsigned char *)aux_rand;
         unsigned char *bytes_out_p = flags & EC_FLAG_RECOVERABLE ? bytes_out + 1 : bytes_out;
         secp256k1_ecdsa_recoverable_signature sig_secp;
@@ -352,9 +339,7 @@ int wally_ec_sig_from_bytes_aux(const unsigned char *priv_key, size_t priv_key_l
             if (!secp256k1_ecdsa_sign_recoverable(ctx, &sig_secp, bytes,
                                                   priv_key, nonce_fn, entropy_p)) {
                 wally_clear(&sig_secp, sizeof(sig_secp));
-                if (!secp256k1_ec_seckey_verify(ctx, priv_key))
-                    return WALLY_EINVAL; /* Invalid priv_key */
-                return WALLY_ERROR;     /* Nonce function failed */
+                return WALLY_ERROR; /* Nonce function failed */
             }
 
             /* Note this function is documented as never failing */
@@ -374,7 +359,138 @@ int wally_ec_sig_from_bytes_aux(const unsigned char *priv_key, size_t priv_key_l
             uint32_to_le_bytes(counter, entropy_p);
         }
     }
+}
+
+int wally_ec_sig_from_bytes_aux(const unsigned char *priv_key, size_t priv_key_len,
+                                const unsigned char *bytes, size_t bytes_len,
+                                const unsigned char *aux_rand, size_t aux_rand_len,
+                                uint32_t flags, unsigned char *bytes_out, size_t len)
+{
+    const secp256k1_context *ctx = secp_ctx();
+    secp256k1_keypair keypair;
+    size_t expected_len;
+    int ret;
+
+    if (wally_ec_sig_from_bytes_aux_len(priv_key, priv_key_len,
+                                        bytes, bytes_len, aux_rand, aux_rand_len,
+                                        flags, &expected_len) != WALLY_OK ||
+        !bytes_out || len != expected_len)
+        return WALLY_EINVAL;
+
+    if (!ctx)
+        return WALLY_ENOMEM;
+
+    if ((flags & EC_FLAG_SCHNORR) && !keypair_create(&keypair, priv_key))
+        return WALLY_EINVAL;
+
+    ret = ec_sig_from_bytes(ctx, priv_key, &keypair, bytes, aux_rand, flags, bytes_out);
+    if (ret != WALLY_OK && !(flags & EC_FLAG_SCHNORR) &&
+        !secp256k1_ec_seckey_verify(ctx, priv_key))
+        ret = WALLY_EINVAL; /* Invalid priv_key */
+    wally_clear(&keypair, sizeof(keypair));
+    return ret;
+}
+
+/* The number of signatures made by each batch signing task */
+#define SIG_BATCH_CHUNK 64
+
+struct sig_batch {
+    const secp256k1_context *ctx; /* The callers context, shared by all tasks */
+    const unsigned char *priv_key;
+    const secp256k1_keypair *keypair;
+    const unsigned char *bytes;
+    const unsigned char *aux_rand;
+    uint32_t flags;
+    size_t num_sigs;
+    size_t sig_len;
+    unsigned char *bytes_out;
+    int *rets;
+};
+
+static void sig_batch_task(void *ctx, size_t chunk)
+{
+    const struct sig_batch *b = (const struct sig_batch *)ctx;
+    size_t i = chunk * SIG_BATCH_CHUNK, end = i + SIG_BATCH_CHUNK;
+    int ret = WALLY_OK;
+
+    if (end > b->num_sigs)
+        end = b->num_sigs;
+    for (; ret == WALLY_OK && i < end; ++i)
+        ret = ec_sig_from_bytes(b->ctx, b->priv_key, b->keypair,
+                                b->bytes + i * EC_MESSAGE_HASH_LEN,
+                                b->aux_rand ? b->aux_rand + i * 32 : NULL,
+                                b->flags, b->bytes_out + i * b->sig_len);
+    b->rets[chunk] = ret;
+}
+
+int wally_ec_sig_from_bytes_batch_len(const unsigned char *priv_key, size_t priv_key_len,
+                                      const unsigned char *bytes, size_t bytes_len,
+                                      const unsigned char *aux_rand, size_t aux_rand_len,
+                                      uint32_t flags, size_t *written)
+{
+    const size_t num_sigs = bytes_len / EC_MESSAGE_HASH_LEN;
+    size_t sig_len;
+
+    if (written)
+        *written = 0;
+    if (!num_sigs || bytes_len % EC_MESSAGE_HASH_LEN ||
+        (aux_rand && aux_rand_len != num_sigs * 32) ||
+        wally_ec_sig_from_bytes_aux_len(priv_key, priv_key_len, bytes,
+                                        EC_MESSAGE_HASH_LEN, aux_rand,
+                                        aux_rand ? 32 : aux_rand_len,
+                                        flags, &sig_len) != WALLY_OK)
+        return WALLY_EINVAL;
+    *written = num_sigs * sig_len;
+    return WALLY_OK;
+}
+
+int wally_ec_sig_from_bytes_batch(const unsigned char *priv_key, size_t priv_key_len,
+                                  const unsigned char *bytes, size_t bytes_len,
+                                  const unsigned char *aux_rand, size_t aux_rand_len,
+                                  uint32_t flags, unsigned char *bytes_out, size_t len)
+{
+    const secp256k1_context *ctx = secp_ctx();
+    secp256k1_keypair keypair;
+    struct sig_batch b;
+    size_t expected_len, num_chunks, i;
+    int ret = WALLY_OK;
+
+    if (wally_ec_sig_from_bytes_batch_len(priv_key, priv_key_len,
+                                          bytes, bytes_len, aux_rand, aux_rand_len,
+                                          flags, &expected_len) != WALLY_OK ||
+        !bytes_out || len != expected_len)
+        return WALLY_EINVAL;
+
+    if (!ctx)
+        return WALLY_ENOMEM;
 
+    /* Validate the key once, creating the keypair for schnorr signing */
+    if (!seckey_verify(priv_key) ||
+        ((flags & EC_FLAG_SCHNORR) && !keypair_create(&keypair, priv_key)))
+        return WALLY_EINVAL;
+
+    b.ctx = ctx;
+    b.priv_key = priv_key;
+    b.keypair = &keypair;
+    b.bytes = bytes;
+    b.aux_rand = aux_rand;
+    b.flags = flags;
+    b.num_sigs = bytes_len / EC_MESSAGE_HASH_LEN;
+    b.sig_len = len / b.num_sigs;
+    b.bytes_out = bytes_out;
+    num_chunks = (b.num_sigs + SIG_BATCH_CHUNK - 1) / SIG_BATCH_CHUNK;
+    if (!(b.rets = wally_calloc(num_chunks * sizeof(int))))
+        ret = WALLY_ENOMEM;
+    else {
+        run_tasks(sig_batch_task, &b, num_chunks);
+        for (i = 0; ret == WALLY_OK && i < num_chunks; ++i)
+            ret = b.rets[i];
+        wally_free(b.rets);
+    }
+    if (ret != WALLY_OK)
+        wally_clear(bytes_out, len);
+    wally_clear(&keypair, sizeof(keypair));
+    return ret;
 }
 
 int wally_ec_sig_from_bytes(const unsigned char *priv_key, size_t priv_key_len,
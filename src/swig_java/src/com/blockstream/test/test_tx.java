@@ -1,6 +1,7 @@
 package com.blockstream.test;
 
 import com.blockstream.libwally.Wally;
+import java.nio.ByteBuffer;
 
 public class test_tx {
 
@@ -96,6 +97,50 @@ public class test_tx {
         }
     }
 
+    public void test_direct() {
+        final byte[] tx_bytes = h(p2pkh_hex);
+        final ByteBuffer buf = ByteBuffer.allocateDirect(tx_bytes.length * 2);
+        final ByteBuffer out = ByteBuffer.allocateDirect(Wally.WALLY_TXHASH_LEN * 2);
+
+        // Parse and serialize from/to native memory
+        buf.put(tx_bytes).flip();
+        final Object tx = Wally.tx_from_bytes_direct(buf, 0);
+        assert_eq(0, buf.position(), "direct buffer position changed");
+        assert_eq(p2pkh_hex, Wally.tx_to_hex(tx, 0), "direct parse mismatch");
+        buf.clear();
+        assert_eq(tx_bytes.length, Wally.tx_to_bytes_direct(tx, 0, buf), "direct serialize length mismatch");
+
+        // Compute the txids of two concatenated transactions in one call
+        buf.put(tx_bytes).put(tx_bytes).flip();
+        assert_eq(Wally.WALLY_TXHASH_LEN * 2, Wally.tx_get_txids_batch_direct(buf, 0, out), "txids length mismatch");
+        final byte[] txids = new byte[Wally.WALLY_TXHASH_LEN * 2];
+        out.get(txids);
+        final String txid = h(Wally.tx_get_txid(tx));
+        assert_eq(txid + txid, h(txids), "txids mismatch");
+
+        // Heap buffers are rejected
+        boolean threw = false;
+        try {
+            Wally.tx_from_bytes_direct(ByteBuffer.wrap(tx_bytes), 0);
+        } catch (final IllegalArgumentException e) {
+            threw = true;
+        }
+        assert_eq(true, threw, "heap buffer not rejected");
+
+        // Read-only buffers are accepted as inputs but rejected as outputs
+        buf.clear();
+        buf.put(tx_bytes).flip();
+        assert_eq(p2pkh_hex, Wally.tx_to_hex(Wally.tx_from_bytes_direct(buf.asReadOnlyBuffer(), 0), 0),
+                  "read-only input rejected");
+        threw = false;
+        try {
+            Wally.tx_to_bytes_direct(tx, 0, ByteBuffer.allocateDirect(tx_bytes.length).asReadOnlyBuffer());
+        } catch (final IllegalArgumentException e) {
+            threw = true;
+        }
+        assert_eq(true, threw, "read-only output not rejected");
+    }
+
     private String h(final byte[] bytes) { return Wally.hex_from_bytes(bytes); }
     private byte[] h(final String hex) { return Wally.hex_to_bytes(hex); }
 
@@ -103,6 +148,7 @@ public class test_tx {
         final test_tx t = new test_tx();
         t.test();
         t.test_dersigs();
+        t.test_direct();
     }
 
 }
@@ -136,6 +136,71 @@ static jobjectArray create_jstringArray(JNIEnv *jenv, char **p, size_t len) {
     return ret;
 }
 
+/* Direct ByteBuffers are passed to wally without copying. The bytes
+ * between the buffers position and limit are used, and its position is
+ * not updated. Buffers allocated from the Java heap are rejected, as are
+ * read-only buffers when used for output */
+static jmethodID g_buffer_position, g_buffer_limit, g_buffer_is_read_only;
+
+/* Look up the Buffer method IDs once when the library is loaded, so
+ * that concurrent callers never race to initialize them */
+JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM *vm, void *reserved) {
+    JNIEnv *jenv;
+    jclass clazz;
+
+    (void)reserved;
+    if ((*vm)->GetEnv(vm, (void **)&jenv, JNI_VERSION_1_6) != JNI_OK)
+        return JNI_ERR;
+    if (!(clazz = (*jenv)->FindClass(jenv, "java/nio/Buffer")) ||
+        !(g_buffer_position = (*jenv)->GetMethodID(jenv, clazz, "position", "()I")) ||
+        !(g_buffer_limit = (*jenv)->GetMethodID(jenv, clazz, "limit", "()I")) ||
+        !(g_buffer_is_read_only = (*jenv)->GetMethodID(jenv, clazz, "isReadOnly", "()Z")))
+        return JNI_ERR;
+    return JNI_VERSION_1_6;
+}
+
+static void get_direct_buffer(JNIEnv *jenv, jobject buf, int is_output,
+                              void **p, size_t *len) {
+    unsigned char *base;
+    jint position, limit;
+
+    *p = NULL;
+    *len = 0;
+    if (!buf)
+        return;
+    if (!(base = (unsigned char *)(*jenv)->GetDirectBufferAddress(jenv, buf))) {
+        SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "Not a direct ByteBuffer");
+        return;
+    }
+    if (is_output && (*jenv)->CallBooleanMethod(jenv, buf, g_buffer_is_read_only)) {
+        if (!(*jenv)->ExceptionOccurred(jenv))
+            SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "Read-only ByteBuffer");
+        return;
+    }
+    position = (*jenv)->CallIntMethod(jenv, buf, g_buffer_position);
+    limit = (*jenv)->CallIntMethod(jenv, buf, g_buffer_limit);
+    if ((*jenv)->ExceptionOccurred(jenv))
+        return;
+    *p = base + position;
+    *len = (size_t)(limit - position);
+}
+
+/* Direct buffer variants call the underlying wally function */
+#define wally_hash160_direct wally_hash160
+#define wally_hash160_batch_direct wally_hash160_batch
+#define wally_addr_segwit_from_bytes_direct wally_addr_segwit_from_bytes
+#define wally_addr_segwit_from_bytes_batch_direct wally_addr_segwit_from_bytes_batch
+#define wally_addr_segwit_to_bytes_direct wally_addr_segwit_to_bytes
+#define wally_address_to_scriptpubkey_direct wally_address_to_scriptpubkey
+#define wally_scriptpubkey_to_address_direct wally_scriptpubkey_to_address
+#define wally_ec_sig_from_bytes_batch_direct wally_ec_sig_from_bytes_batch
+#define wally_psbt_from_bytes_direct wally_psbt_from_bytes
+#define wally_psbt_to_bytes_direct wally_psbt_to_bytes
+#define wally_tx_from_bytes_direct wally_tx_from_bytes
+#define wally_tx_to_bytes_direct wally_tx_to_bytes
+#define wally_tx_get_txids_batch_direct wally_tx_get_txids_batch
+#define wally_tx_get_input_signature_hash_batch_direct wally_tx_get_input_signature_hash_batch
+
 #define member_size(struct_, member) sizeof(((struct struct_ *)0)->member)
 %}
 
@@ -257,6 +322,27 @@ static jobjectArray create_jstringArray(JNIEnv *jenv, char **p, size_t len) {
 %java_int_array(uint32_t, jintArray, int, GetIntArrayElements, ReleaseIntArrayElements)
 %java_int_array(uint64_t, jlongArray, long, GetLongArrayElements, ReleaseLongArrayElements)
 
+/* Direct ByteBuffers are passed as pointers into their native memory */
+%define %java_direct_buffer(TYPE, IS_OUTPUT)
+%typemap(jni)     (TYPE *DIRECT, size_t DIRECT_LEN) "jobject"
+%typemap(jtype)   (TYPE *DIRECT, size_t DIRECT_LEN) "java.nio.ByteBuffer"
+%typemap(jstype)  (TYPE *DIRECT, size_t DIRECT_LEN) "java.nio.ByteBuffer"
+%typemap(javain)  (TYPE *DIRECT, size_t DIRECT_LEN) "$javainput"
+%typemap(in)      (TYPE *DIRECT, size_t DIRECT_LEN) {
+    $1 = 0;
+    $2 = 0;
+    if (!(*jenv)->ExceptionOccurred(jenv))
+        get_direct_buffer(jenv, $input, IS_OUTPUT, (void **)&$1, &$2);
+}
+%enddef
+
+%java_direct_buffer(const unsigned char, 0)
+%java_direct_buffer(unsigned char, 1)
+%java_direct_buffer(char, 1)
+%apply(const unsigned char *DIRECT, size_t DIRECT_LEN) { (const unsigned char *direct, size_t direct_len) };
+%apply(unsigned char *DIRECT, size_t DIRECT_LEN) { (unsigned char *direct_out, size_t direct_out_len) };
+%apply(char *DIRECT, size_t DIRECT_LEN) { (char *direct_out, size_t direct_out_len) };
+
 /* BEGIN AUTOGENERATED */
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* abf, size_t abf_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* annex, size_t annex_len) };
@@ -291,23 +377,28 @@ static jobjectArray create_jstringArray(JNIEnv *jenv, char **p, size_t len) {
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* online_keys, size_t online_keys_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* online_priv_key, size_t online_priv_key_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* operand, size_t operand_len) };
+%apply(char *STRING, size_t LENGTH) { (const unsigned char* outpoints, size_t outpoints_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* output_abf, size_t output_abf_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* output_asset, size_t output_asset_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* output_generator, size_t output_generator_len) };
+%apply(char *STRING, size_t LENGTH) { (const unsigned char* output_keys, size_t output_keys_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* parent160, size_t parent160_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* pass, size_t pass_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* priv_key, size_t priv_key_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* proof, size_t proof_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* pub_key, size_t pub_key_len) };
+%apply(char *STRING, size_t LENGTH) { (const unsigned char* pub_keys, size_t pub_keys_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* rangeproof, size_t rangeproof_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* redeem_script, size_t redeem_script_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* s2c_data, size_t s2c_data_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* s2c_opening, size_t s2c_opening_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* salt, size_t salt_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* scalar, size_t scalar_len) };
+%apply(char *STRING, size_t LENGTH) { (const unsigned char* scan_priv_key, size_t scan_priv_key_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* script, size_t script_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* scriptpubkey, size_t scriptpubkey_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* sig, size_t sig_len) };
+%apply(char *STRING, size_t LENGTH) { (const unsigned char* spend_pub_key, size_t spend_pub_key_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* sub_pubkey, size_t sub_pubkey_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* summed_key, size_t summed_key_len) };
 %apply(char *STRING, size_t LENGTH) { (const unsigned char* surjectionproof, size_t surjectionproof_len) };
@@ -352,9 +443,12 @@ static jobjectArray create_jstringArray(JNIEnv *jenv, char **p, size_t len) {
 
 %apply(uint32_t *STRING, size_t LENGTH) { (const uint32_t *child_path, size_t child_path_len) }
 %apply(uint32_t *STRING, size_t LENGTH) { (uint32_t *child_path_out, size_t child_path_out_len) }
+%apply(uint32_t *STRING, size_t LENGTH) { (const uint32_t *num_output_keys, size_t num_output_keys_len) }
+%apply(uint32_t *STRING, size_t LENGTH) { (const uint32_t *num_pub_keys, size_t num_pub_keys_len) }
 %apply(uint32_t *STRING, size_t LENGTH) { (const uint32_t *sighash, size_t sighash_len) }
 %apply(uint32_t *STRING, size_t LENGTH) { (uint32_t *indices_out, size_t indices_out_len) }
 %apply(uint32_t *STRING, size_t LENGTH) { (const uint32_t *utxo_indices, size_t num_utxo_indices) }
+%apply(uint32_t *STRING, size_t LENGTH) { (const uint32_t *weights, size_t num_weights) }
 %apply(uint64_t *STRING, size_t LENGTH) { (const uint64_t *values, size_t num_values) }
 
 %typemap(in, numinputs=0) uint32_t *value_out (uint32_t val) {
@@ -562,7 +656,10 @@ static jobjectArray create_jstringArray(JNIEnv *jenv, char **p, size_t len) {
 %returns_string(wally_bip32_key_to_address);
 %returns_string(wally_bip32_key_to_addr_segwit);
 %returns_array_(wally_bip340_tagged_hash, 4, 5, SHA256_LEN);
+%returns_size_t(wally_bip352_scan);
+%returns_size_t(wally_coinselect);
 %returns_size_t(wally_coinselect_assets);
+%returns_size_t(wally_coinselect_assets_split);
 %returns_string(wally_confidential_addr_to_addr);
 %returns_array_(wally_confidential_addr_to_ec_public_key, 3, 4, EC_PUBLIC_KEY_LEN);
 %returns_string(wally_confidential_addr_from_addr);
@@ -598,6 +695,8 @@ static jobjectArray create_jstringArray(JNIEnv *jenv, char **p, size_t len) {
 %returns_array_(wally_ec_public_key_decompress, 3, 4, EC_PUBLIC_KEY_UNCOMPRESSED_LEN);
 %returns_array_(wally_ec_public_key_negate, 3, 4, EC_PUBLIC_KEY_LEN);
 %returns_array_(wally_ec_public_key_from_private_key, 3, 4, EC_PUBLIC_KEY_LEN);
+%returns_void__(wally_ec_sig_from_bytes_batch);
+%returns_size_t(wally_ec_sig_from_bytes_batch_len);
 %returns_size_t(wally_ec_sig_from_bytes_aux_len);
 %returns_size_t(wally_ec_sig_from_bytes_len);
 %returns_array_check_flag(wally_ec_sig_from_bytes_aux, 8, 9, jarg7, 10, EC_SIGNATURE_RECOVERABLE_LEN, EC_SIGNATURE_LEN);
@@ -622,6 +721,7 @@ static jobjectArray create_jstringArray(JNIEnv *jenv, char **p, size_t len) {
 %returns_size_t(wally_get_build_version)
 %returns_array_(wally_get_hash_prevouts, 5, 6, SHA256_LEN);
 %returns_array_(wally_hash160, 3, 4, HASH160_LEN);
+%returns_void__(wally_hash160_batch);
 %returns_string(wally_hex_from_bytes);
 %returns_size_t(wally_hex_n_to_bytes);
 %returns_void__(wally_hex_n_verify);
@@ -727,12 +827,14 @@ static jobjectArray create_jstringArray(JNIEnv *jenv, char **p, size_t len) {
 %rename("psbt_clone") wally_psbt_clone_alloc;
 %returns_void__(wally_psbt_combine);
 %returns_void__(wally_psbt_combine_ex);
+%returns_void__(wally_psbt_apply_patch);
 %returns_struct(wally_psbt_extract, wally_tx);
 %returns_void__(wally_psbt_finalize);
 %returns_void__(wally_psbt_finalize_input);
 %returns_size_t(wally_psbt_find_input_keypath);
 %returns_size_t(wally_psbt_find_input_signature);
 %returns_size_t(wally_psbt_find_input_spending_utxo);
+%returns_size_t(wally_psbt_find_inputs_spending_utxos);
 %returns_size_t(wally_psbt_find_input_unknown);
 %returns_size_t(wally_psbt_find_output_keypath);
 %returns_size_t(wally_psbt_find_output_unknown);
@@ -829,6 +931,8 @@ static jobjectArray create_jstringArray(JNIEnv *jenv, char **p, size_t len) {
 %rename("psbt_get_input_witness_utxo") wally_psbt_get_input_witness_utxo_alloc;
 %returns_size_t(wally_psbt_get_fallback_locktime);
 %returns_size_t(wally_psbt_get_length);
+%returns_size_t(wally_psbt_get_patch);
+%returns_size_t(wally_psbt_get_patch_length);
 %returns_size_t(wally_psbt_get_locktime);
 %returns_size_t(wally_psbt_get_num_inputs);
 %returns_size_t(wally_psbt_get_num_outputs);
@@ -961,6 +1065,8 @@ static jobjectArray create_jstringArray(JNIEnv *jenv, char **p, size_t len) {
 %returns_void__(wally_psbt_sign_input_bip32);
 %returns_void__(wally_psbt_signing_cache_enable);
 %returns_void__(wally_psbt_signing_cache_disable);
+%returns_void__(wally_psbt_outpoint_index_enable);
+%returns_void__(wally_psbt_outpoint_index_disable);
 %returns_string(wally_psbt_to_base64);
 %returns_size_t(wally_psbt_to_bytes);
 %returns_array_(wally_ripemd160, 3, 4, RIPEMD160_LEN);
@@ -1022,6 +1128,7 @@ static jobjectArray create_jstringArray(JNIEnv *jenv, char **p, size_t len) {
 %returns_array_(wally_tx_get_btc_taproot_signature_hash, 14, 15, SHA256_LEN);
 %returns_array_(wally_tx_get_elements_signature_hash, 9, 10, SHA256_LEN);
 %returns_array_(wally_tx_get_input_signature_hash, 17, 18, SHA256_LEN);
+%returns_void__(wally_tx_get_input_signature_hash_batch);
 %returns_size_t(wally_tx_get_elements_weight_discount);
 %returns_array_(wally_tx_get_hash_prevouts, 4, 5, SHA256_LEN);
 %returns_array_(wally_tx_get_input_blinding_nonce, 3, 4, SHA256_LEN);
@@ -1071,6 +1178,7 @@ static jobjectArray create_jstringArray(JNIEnv *jenv, char **p, size_t len) {
 %returns_array_(wally_tx_get_signature_hash, 12, 13, SHA256_LEN);
 %returns_uint64(wally_tx_get_total_output_satoshi);
 %returns_array_(wally_tx_get_txid, 2, 3, WALLY_TXHASH_LEN);
+%returns_size_t(wally_tx_get_txids_batch);
 %returns_size_t(wally_tx_get_version);
 %returns_size_t(wally_tx_get_vsize);
 %returns_size_t(wally_tx_get_weight);
@@ -1390,3 +1498,66 @@ static jobjectArray create_jstringArray(JNIEnv *jenv, char **p, size_t len) {
 %include "../include/wally_transaction.h"
 %include "../include/wally_transaction_members.h"
 %include "../include/wally_elements.h"
+
+/* Direct ByteBuffer variants of hot path and batch calls */
+%returns_void__(wally_hash160_direct);
+%returns_void__(wally_hash160_batch_direct);
+%returns_string(wally_addr_segwit_from_bytes_direct);
+%returns_size_t(wally_addr_segwit_from_bytes_batch_direct);
+%returns_size_t(wally_addr_segwit_to_bytes_direct);
+%returns_size_t(wally_address_to_scriptpubkey_direct);
+%returns_string(wally_scriptpubkey_to_address_direct);
+%returns_void__(wally_ec_sig_from_bytes_batch_direct);
+%returns_struct(wally_psbt_from_bytes_direct, wally_psbt);
+%returns_size_t(wally_psbt_to_bytes_direct);
+%returns_struct(wally_tx_from_bytes_direct, wally_tx);
+%returns_size_t(wally_tx_to_bytes_direct);
+%returns_size_t(wally_tx_get_txids_batch_direct);
+%returns_void__(wally_tx_get_input_signature_hash_batch_direct);
+
+int wally_hash160_direct(const unsigned char *direct, size_t direct_len,
+                         unsigned char *direct_out, size_t direct_out_len);
+int wally_hash160_batch_direct(const unsigned char *direct, size_t direct_len, size_t item_len,
+                               unsigned char *direct_out, size_t direct_out_len);
+int wally_addr_segwit_from_bytes_direct(const unsigned char *direct, size_t direct_len,
+                                        const char *addr_family, uint32_t flags, char **output);
+int wally_addr_segwit_from_bytes_batch_direct(const unsigned char *direct, size_t direct_len,
+                                              const char *addr_family, uint32_t flags,
+                                              char *direct_out, size_t direct_out_len,
+                                              size_t *written);
+int wally_addr_segwit_to_bytes_direct(const char *addr, const char *addr_family, uint32_t flags,
+                                      unsigned char *direct_out, size_t direct_out_len,
+                                      size_t *written);
+int wally_address_to_scriptpubkey_direct(const char *addr, uint32_t network,
+                                         unsigned char *direct_out, size_t direct_out_len,
+                                         size_t *written);
+int wally_scriptpubkey_to_address_direct(const unsigned char *direct, size_t direct_len,
+                                         uint32_t network, char **output);
+int wally_ec_sig_from_bytes_batch_direct(const unsigned char *priv_key, size_t priv_key_len,
+                                         const unsigned char *direct, size_t direct_len,
+                                         const unsigned char *aux_rand, size_t aux_rand_len,
+                                         uint32_t flags,
+                                         unsigned char *direct_out, size_t direct_out_len);
+int wally_psbt_from_bytes_direct(const unsigned char *direct, size_t direct_len,
+                                 uint32_t flags, struct wally_psbt **output);
+int wally_psbt_to_bytes_direct(const struct wally_psbt *psbt, uint32_t flags,
+                               unsigned char *direct_out, size_t direct_out_len,
+                               size_t *written);
+int wally_tx_from_bytes_direct(const unsigned char *direct, size_t direct_len,
+                               uint32_t flags, struct wally_tx **output);
+int wally_tx_to_bytes_direct(const struct wally_tx *tx, uint32_t flags,
+                             unsigned char *direct_out, size_t direct_out_len,
+                             size_t *written);
+int wally_tx_get_txids_batch_direct(const unsigned char *direct, size_t direct_len,
+                                    uint32_t flags,
+                                    unsigned char *direct_out, size_t direct_out_len,
+                                    size_t *written);
+int wally_tx_get_input_signature_hash_batch_direct(const struct wally_tx *tx,
+                                                   const struct wally_map *scripts,
+                                                   const struct wally_map *assets,
+                                                   const struct wally_map *values,
+                                                   const unsigned char *genesis_blockhash,
+                                                   size_t genesis_blockhash_len,
+                                                   uint32_t sighash, uint32_t flags,
+                                                   struct wally_map *cache,
+                                                   unsigned char *direct_out, size_t direct_out_len);
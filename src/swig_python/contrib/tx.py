@@ -111,5 +111,52 @@ class TxTests(unittest.TestCase):
             total_to_overflow = WALLY_SATOSHI_MAX - tx_get_total_output_satoshi(tx) + 1
             tx_add_raw_output(tx, total_to_overflow, script, 0)
 
+    def test_batch(self):
+        """Test batch calls writing to preallocated buffers"""
+        txhash, seq, script = b'0' * 32, 0xffffffff, bytes.fromhex('0014' + '11' * 20)
+        txs, txids = [], []
+        for i in range(3):
+            tx = tx_init(2, i, 1, 1)
+            tx_add_raw_input(tx, txhash, i, seq, None, None, 0)
+            tx_add_raw_output(tx, 10000, script, 0)
+            txs.append(tx_to_bytes(tx, 0))
+            txids.append(tx_get_txid(tx))
+
+            # Per input signature hashes match the single input call
+            scripts = map_init(1, None)
+            values = map_init(1, None)
+            map_add_integer(scripts, 0, script)
+            map_add_integer(values, 0, (10000).to_bytes(8, 'little'))
+            out = bytearray(32)
+            tx_get_input_signature_hash_batch(tx, scripts, None, values, None, 1,
+                                              WALLY_SIGTYPE_SW_V0, None, out)
+            scriptcode = bytes.fromhex('76a914' + '11' * 20 + '88ac')
+            expected = tx_get_input_signature_hash(tx, 0, scripts, None, values,
+                                                   scriptcode, 0, WALLY_NO_CODESEPARATOR,
+                                                   None, None, 1, WALLY_SIGTYPE_SW_V0, None)
+            self.assertEqual(out, expected)
+
+        # Inputs can be any buffer; outputs are written in place
+        out = bytearray(32 * len(txs))
+        written = tx_get_txids_batch(memoryview(b''.join(txs)), 0, out)
+        self.assertEqual(written, len(out))
+        self.assertEqual(bytes(out), b''.join(txids))
+
+        out = bytearray(20 * 2)
+        hash160_batch(memoryview(script).cast('B'), len(script) // 2, memoryview(out)[:])
+        self.assertEqual(bytes(out[:20]), hash160(script[:11]))
+        self.assertEqual(bytes(out[20:]), hash160(script[11:]))
+
+        out = bytearray(WALLY_SEGWIT_ADDRESS_MAX_LEN * 2)
+        written = addr_segwit_from_bytes_batch(script + script, 'bc', 0, out)
+        self.assertEqual(written, len(out))
+        addr = bytes(out[:WALLY_SEGWIT_ADDRESS_MAX_LEN]).rstrip(b'\0').decode()
+        self.assertEqual(addr, addr_segwit_from_bytes(script, 'bc', 0))
+
+        with self.assertRaises(ValueError):
+            tx_get_txids_batch(b''.join(txs)[:-1], 0, bytearray(96))
+        with self.assertRaises(TypeError):
+            tx_get_txids_batch(b''.join(txs), 0, bytes(96)) # Read-only output
+
 if __name__ == '__main__':
     unittest.main()
@@ -128,11 +128,12 @@ static void destroy_words(PyObject *obj) { (void)obj; }
  * NOTE: the code in the 'else' branch is essentially taken from swig4's
  * pybuffer_binary macro implementation.
  * Note local fix for: https://github.com/swig/swig/issues/1640
+ * The buffer is held until the call completes, so that its contents
+ * cannot be resized or freed by another thread while the GIL is released.
  */
 %define %pybuffer_nullable_binary(TYPEMAP, SIZE)
-%typemap(in) (TYPEMAP, SIZE) {
-  int res; Py_ssize_t size = 0; const void *buf = 0;
-  Py_buffer view;
+%typemap(in) (TYPEMAP, SIZE) (Py_buffer view, int have_view = 0) {
+  int res;
   if ($input == Py_None)
     $2 = 0;
   else {
@@ -141,38 +142,59 @@ static void destroy_words(PyObject *obj) { (void)obj; }
       PyErr_Clear();
       %argument_fail(res, "(TYPEMAP, SIZE)", $symname, $argnum);
     }
-    size = view.len;
-    buf = view.buf;
-    PyBuffer_Release(&view);
-    $1 = ($1_ltype) buf;
-    $2 = ($2_ltype) (size / sizeof($*1_type));
+    have_view = 1;
+    $1 = ($1_ltype) view.buf;
+    $2 = ($2_ltype) (view.len / sizeof($*1_type));
   }
 }
+%typemap(freearg) (TYPEMAP, SIZE) {
+  if (have_view$argnum)
+    PyBuffer_Release(&view$argnum);
+}
 %enddef
 
 /*
  * This is a copy of swig4's 'pybuffer_mutable_binary' but with the
  * call to PyBuffer_Release() only made if the call to PyObject_GetBuffer()
- * returned 0 (ie. succeeded).
+ * returned 0 (ie. succeeded), and once the call has completed.
  * FIXME: Remove in favour of pybuffer_mutable_binary when:
  * a) we move to swig4
  * b) the call to Release() is fixed upstream
  * see: https://github.com/swig/swig/issues/1640
  */
 %define %pybuffer_output_binary(TYPEMAP, SIZE)
-%typemap(in) (TYPEMAP, SIZE) {
-  int res; Py_ssize_t size = 0; void *buf = 0;
-  Py_buffer view;
+%typemap(in) (TYPEMAP, SIZE) (Py_buffer view, int have_view = 0) {
+  int res;
   res = PyObject_GetBuffer($input, &view, PyBUF_WRITABLE);
   if (res < 0) {
     PyErr_Clear();
     %argument_fail(res, "(TYPEMAP, SIZE)", $symname, $argnum);
   }
-  size = view.len;
-  buf = view.buf;
-  PyBuffer_Release(&view);
-  $1 = ($1_ltype) buf;
-  $2 = ($2_ltype) (size/sizeof($*1_type));
+  have_view = 1;
+  $1 = ($1_ltype) view.buf;
+  $2 = ($2_ltype) (view.len / sizeof($*1_type));
+}
+%typemap(freearg) (TYPEMAP, SIZE) {
+  if (have_view$argnum)
+    PyBuffer_Release(&view$argnum);
+}
+%enddef
+
+/*
+ * Batch calls taking only buffers release the GIL while they run. Their
+ * inputs and outputs may be any object supporting the buffer protocol,
+ * such as bytes, bytearray, memoryview or array.array. Outputs must be
+ * preallocated. Calls taking wally structs or maps (such as a signature
+ * hash cache) keep the GIL, since other threads could modify or free
+ * those objects while the call reads or writes them.
+ */
+%define %py_nogil(NAME)
+%exception NAME {
+    Py_BEGIN_ALLOW_THREADS
+    $action
+    Py_END_ALLOW_THREADS
+    if (check_result(result))
+        SWIG_fail;
 }
 %enddef
 
@@ -364,23 +386,28 @@ static void destroy_words(PyObject *obj) { (void)obj; }
 %pybuffer_nullable_binary(const unsigned char* online_keys, size_t online_keys_len);
 %pybuffer_nullable_binary(const unsigned char* online_priv_key, size_t online_priv_key_len);
 %pybuffer_nullable_binary(const unsigned char* operand, size_t operand_len);
+%pybuffer_nullable_binary(const unsigned char* outpoints, size_t outpoints_len);
 %pybuffer_nullable_binary(const unsigned char* output_abf, size_t output_abf_len);
 %pybuffer_nullable_binary(const unsigned char* output_asset, size_t output_asset_len);
 %pybuffer_nullable_binary(const unsigned char* output_generator, size_t output_generator_len);
+%pybuffer_nullable_binary(const unsigned char* output_keys, size_t output_keys_len);
 %pybuffer_nullable_binary(const unsigned char* parent160, size_t parent160_len);
 %pybuffer_nullable_binary(const unsigned char* pass, size_t pass_len);
 %pybuffer_nullable_binary(const unsigned char* priv_key, size_t priv_key_len);
 %pybuffer_nullable_binary(const unsigned char* proof, size_t proof_len);
 %pybuffer_nullable_binary(const unsigned char* pub_key, size_t pub_key_len);
+%pybuffer_nullable_binary(const unsigned char* pub_keys, size_t pub_keys_len);
 %pybuffer_nullable_binary(const unsigned char* rangeproof, size_t rangeproof_len);
 %pybuffer_nullable_binary(const unsigned char* redeem_script, size_t redeem_script_len);
 %pybuffer_nullable_binary(const unsigned char* s2c_data, size_t s2c_data_len);
 %pybuffer_nullable_binary(const unsigned char* s2c_opening, size_t s2c_opening_len);
 %pybuffer_nullable_binary(const unsigned char* salt, size_t salt_len);
 %pybuffer_nullable_binary(const unsigned char* scalar, size_t scalar_len);
+%pybuffer_nullable_binary(const unsigned char* scan_priv_key, size_t scan_priv_key_len);
 %pybuffer_nullable_binary(const unsigned char* script, size_t script_len);
 %pybuffer_nullable_binary(const unsigned char* scriptpubkey, size_t scriptpubkey_len);
 %pybuffer_nullable_binary(const unsigned char* sig, size_t sig_len);
+%pybuffer_nullable_binary(const unsigned char* spend_pub_key, size_t spend_pub_key_len);
 %pybuffer_nullable_binary(const unsigned char* sub_pubkey, size_t sub_pubkey_len);
 %pybuffer_nullable_binary(const unsigned char* summed_key, size_t summed_key_len);
 %pybuffer_nullable_binary(const unsigned char* surjectionproof, size_t surjectionproof_len);
@@ -424,12 +451,26 @@ static void destroy_words(PyObject *obj) { (void)obj; }
 /* END AUTOGENERATED */
 
 %py_int_array(uint32_t, 0xffffffffull, child_path, child_path_len)
+%py_int_array(uint32_t, 0xffffffffull, num_output_keys, num_output_keys_len)
+%py_int_array(uint32_t, 0xffffffffull, num_pub_keys, num_pub_keys_len)
 %py_int_array(uint32_t, 0xffull, sighash, sighash_len)
 %py_int_array(uint32_t, 0xffffffffull, utxo_indices, num_utxo_indices)
+%py_int_array(uint32_t, 0xffffffffull, weights, num_weights)
 %py_int_array(uint64_t, 0xffffffffffffffffull, values, num_values)
 %py_int_array_out(uint32_t, 0xffffffffull, child_path_out, child_path_out_len)
 %py_int_array_out(uint32_t, 0xffffffffull, indices_out, indices_out_len)
 
+/* Segwit address batches use fixed-size string slots in byte buffers */
+%pybuffer_nullable_binary(const char* addrs, size_t addrs_len);
+%pybuffer_output_binary(char* output, size_t len);
+
+%py_nogil(wally_addr_segwit_from_bytes_batch);
+%py_nogil(wally_addr_segwit_to_bytes_batch);
+%py_nogil(wally_addr_segwit_verify_batch);
+%py_nogil(wally_ec_sig_from_bytes_batch);
+%py_nogil(wally_hash160_batch);
+%py_nogil(wally_tx_get_txids_batch);
+
 %py_opaque_struct(ext_key);
 %py_opaque_struct(wally_descriptor);
 %py_opaque_struct(wally_psbt);
@@ -24,6 +24,8 @@ NETWORK_LIQUID_TESTNET  = 0x05
 SCRIPTPUBKEY_P2PKH_LEN = 25
 SCRIPTPUBKEY_P2SH_LEN = 23
 
+WALLY_SEGWIT_ADDRESS_MAX_LEN = 91
+
 # Vector from test_bip32.py. We only need an xpub to derive addresses.
 vec = {
 
@@ -152,6 +154,29 @@ class AddressTests(unittest.TestCase):
         self.assertEqual(ret, WALLY_OK)
         self.assertEqual(new_addr, vec[path]['address_p2sh_segwit'])
 
+        # Non-allocating variants
+        str_out = create_string_buffer(WALLY_SEGWIT_ADDRESS_MAX_LEN)
+        for fn, args, expected in [
+            (wally_bip32_key_to_address_into,
+             (key, ADDRESS_TYPE_P2PKH, p2pkh_ver), 'address_legacy'),
+            (wally_bip32_key_to_address_into,
+             (key, ADDRESS_TYPE_P2SH_P2WPKH, p2sh_p2wsh_ver), 'address_p2sh_segwit'),
+            (wally_bip32_key_to_addr_segwit_into,
+             (key, utf8(bech32_prefix), 0), 'address_segwit'),
+            (wally_scriptpubkey_to_address_into,
+             (out, written, network), 'address_p2sh_segwit'),
+            ]:
+            expected = vec[path][expected]
+            ret, str_len = fn(*args, str_out, len(str_out))
+            self.assertEqual((ret, str_len), (WALLY_OK, len(expected) + 1))
+            self.assertEqual(str_out.value, utf8(expected))
+            # Output buffer too small returns OK and the number of bytes required
+            ret, str_len = fn(*args, str_out, len(expected))
+            self.assertEqual((ret, str_len), (WALLY_OK, len(expected) + 1))
+            # NULL/empty output
+            for bad_out in [(None, len(str_out)), (str_out, 0)]:
+                self.assertEqual(fn(*args, *bad_out), (WALLY_EINVAL, 0))
+
         # Parse native SegWit address (P2WPKH):
         out, out_len = make_cbuffer('00' * (100))
         ret, written = wally_addr_segwit_to_bytes(utf8(vec[path]['address_segwit']), utf8(bech32_prefix), 0, out, out_len)
@@ -159,6 +159,54 @@ class Base58Tests(unittest.TestCase):
         self.assertEqual(self.encode('45046252208D', self.FLAG_CHECKSUM),
                                      '4stwEBjT6FYyVV')
 
+    def test_from_bytes_into(self):
+        for hex_in in ['00', '0000', '00CEF022FA', '45046252208D',
+                       '00' + 'ff' * 20, '05' + '11' * 20, '0488ade4' + 'ab' * 74,
+                       '00' * 3 + 'ff' * 300]:
+            for flags in [0, self.FLAG_CHECKSUM]:
+                buf, buf_len = make_cbuffer(hex_in)
+                expected = self.encode(hex_in, flags)
+                out = create_string_buffer(len(expected) + 1)
+                ret, written = wally_base58_from_bytes_into(buf, buf_len, flags,
+                                                            out, len(out))
+                self.assertEqual((ret, written), (WALLY_OK, len(expected) + 1))
+                self.assertEqual(out.value.decode('utf-8'), expected)
+                # Output buffer too small returns OK and the number of bytes required
+                ret, written = wally_base58_from_bytes_into(buf, buf_len, flags,
+                                                            out, len(out) - 1)
+                self.assertEqual((ret, written), (WALLY_OK, len(expected) + 1))
+                # Round trip through the decoder
+                decoded = self.decode(expected, flags)
+                self.assertEqual(decoded, utf8(hex_in.upper()))
+
+        buf, buf_len = make_cbuffer('00CEF022FA')
+        out = create_string_buffer(16)
+        for args in [(None, buf_len, 0, out, len(out)), # NULL bytes
+                     (buf, 0, 0, out, len(out)),        # Empty bytes
+                     (buf, buf_len, 0x7, out, len(out)), # Unknown flags
+                     (buf, buf_len, 0, None, len(out)), # NULL output
+                     (buf, buf_len, 0, out, 0)]:        # Empty output
+            self.assertEqual(wally_base58_from_bytes_into(*args), (WALLY_EINVAL, 0))
+
+    def test_round_trip(self):
+        """Compare against a reference big integer implementation"""
+        alphabet = '123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz'
+        def encode_ref(data):
+            n, ret = int.from_bytes(data, 'big'), ''
+            while n:
+                n, rem = divmod(n, 58)
+                ret = alphabet[rem] + ret
+            return '1' * (len(data) - len(data.lstrip(b'\x00'))) + ret
+
+        for n in list(range(1, 90)) + [128, 255, 512, 1024]:
+            data = urandom(n)
+            if n % 3 == 0:
+                data = b'\x00' * (n % 7) + data
+            hex_in = hexlify(data).decode('utf-8')
+            base58 = self.encode(hex_in, 0)
+            self.assertEqual(base58, encode_ref(data))
+            self.assertEqual(self.decode(base58, 0), utf8(hex_in.upper()))
+
 
 
 if __name__ == '__main__':
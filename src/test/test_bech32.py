@@ -2,6 +2,8 @@ import unittest
 from util import *
 
 WALLY_WITNESSSCRIPT_MAX_LEN = 42
+WALLY_SEGWIT_ADDRESS_MAX_LEN = 91
+WALLY_SEGWIT_VERSION_INVALID = 0xff
 
 valid_cases = {
     # https://github.com/bitcoin/bips/blob/master/bip-0350.mediawiki
@@ -127,5 +129,71 @@ class Bech32Tests(unittest.TestCase):
         ret, ver = wally_addr_segwit_n_get_version(addr, len(addr), family, 0, 0)
         self.assertEqual(ret, WALLY_EINVAL) # Bad family length
 
+    def test_segwit_address_batch(self):
+        """Tests for batch encoding, decoding and validation of segwit addresses"""
+        SLOT = WALLY_SEGWIT_ADDRESS_MAX_LEN
+        def to_slots(addrs):
+            return b''.join([utf8(a).ljust(SLOT, b'\0') for a in addrs])
+
+        for family in ['bc', 'tb']:
+            cases = [(a.lower(), d[1], d[2]) for a, d in valid_cases.items() if d[0] == family]
+            scripts_hex = ''.join([c[2] for c in cases])
+            scripts, scripts_len = make_cbuffer(scripts_hex)
+
+            # Encode
+            out = create_string_buffer(len(cases) * SLOT)
+            ret, written = wally_addr_segwit_from_bytes_batch(scripts, scripts_len,
+                                                              utf8(family), 0, out, len(out))
+            self.assertEqual((ret, written), (WALLY_OK, len(cases) * SLOT))
+            self.assertEqual(out.raw, to_slots([c[0] for c in cases]))
+            # Output buffer too small returns OK and the number of bytes required
+            ret, written = wally_addr_segwit_from_bytes_batch(scripts, scripts_len,
+                                                              utf8(family), 0, out, len(out) - 1)
+            self.assertEqual((ret, written), (WALLY_OK, len(cases) * SLOT))
+
+            # Decode, including the upper case forms
+            for addrs in [[c[0] for c in cases], [c[0].upper() for c in cases]]:
+                addrs = to_slots(addrs)
+                buf, buf_len = make_cbuffer('00' * scripts_len)
+                ret, written = wally_addr_segwit_to_bytes_batch(addrs, len(addrs), utf8(family),
+                                                                0, buf, buf_len)
+                self.assertEqual((ret, written), (WALLY_OK, scripts_len))
+                self.assertEqual(h(buf), utf8(scripts_hex))
+                ret, written = wally_addr_segwit_to_bytes_batch(addrs, len(addrs), utf8(family),
+                                                                0, buf, buf_len - 1)
+                self.assertEqual((ret, written), (WALLY_OK, scripts_len))
+
+            # Validate a mix of valid and invalid addresses
+            invalid = [a for f, a in invalid_cases if f == family] + ['', 'x' * (SLOT - 1)]
+            addrs = to_slots([c[0] for c in cases] + invalid)
+            versions, versions_len = make_cbuffer('00' * (len(cases) + len(invalid)))
+            ret = wally_addr_segwit_verify_batch(addrs, len(addrs), utf8(family), 0,
+                                                 versions, versions_len)
+            self.assertEqual(ret, WALLY_OK)
+            expected = [c[1] for c in cases] + [WALLY_SEGWIT_VERSION_INVALID] * len(invalid)
+            self.assertEqual(list(versions), expected)
+            # Any invalid address fails batch decoding
+            buf, buf_len = make_cbuffer('00' * len(addrs))
+            ret, written = wally_addr_segwit_to_bytes_batch(addrs, len(addrs), utf8(family),
+                                                            0, buf, buf_len)
+            self.assertEqual((ret, written), (WALLY_EINVAL, 0))
+
+        # Invalid arguments
+        scripts, scripts_len = make_cbuffer('0014751e76e8199196d454941c45d1b3a323f1433bd6')
+        out = create_string_buffer(SLOT)
+        for args in [(None, scripts_len, utf8('bc'), 0, out, len(out)),   # NULL bytes
+                     (scripts, 0, utf8('bc'), 0, out, len(out)),          # Empty bytes
+                     (scripts, scripts_len - 1, utf8('bc'), 0, out, len(out)), # Truncated
+                     (scripts, scripts_len, None, 0, out, len(out)),      # NULL family
+                     (scripts, scripts_len, utf8('bc'), 1, out, len(out)), # Bad flags
+                     (scripts, scripts_len, utf8('bc'), 0, None, len(out)), # NULL output
+                     (scripts, scripts_len, utf8('bc'), 0, out, 0)]:      # Empty output
+            self.assertEqual(wally_addr_segwit_from_bytes_batch(*args), (WALLY_EINVAL, 0))
+        addrs = to_slots(['bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4'])
+        buf, buf_len = make_cbuffer('00' * 2)
+        for args in [(addrs, len(addrs) - 1, utf8('bc'), 0, buf, buf_len), # Partial slot
+                     (addrs, len(addrs), utf8('bc'), 0, buf, buf_len)]:     # Bad output length
+            self.assertEqual(wally_addr_segwit_verify_batch(*args), WALLY_EINVAL)
+
 if __name__ == '__main__':
     unittest.main()
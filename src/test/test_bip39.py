@@ -107,6 +107,50 @@ class BIP39Tests(unittest.TestCase):
         self.assertEqual(h(out_buf).upper(), utf8(expected))
 
 
+    def test_validate_batch(self):
+        """Test batch validation and language detection"""
+        RESULT_LEN, INVALID = 42, 0xff # BIP39_VALIDATE_BATCH_RESULT_LEN, BIP39_LANGUAGE_INVALID
+        mnemonics, expected = [], []
+        for lang in self.all_langs:
+            wl = self.wordlists[lang]
+            for entropy_len in [16, 20, 24, 28, 32, 36, 40]:
+                entropy = urandom(entropy_len)
+                ret, mnemonic = bip39_mnemonic_from_bytes(wl, entropy, entropy_len)
+                self.assertEqual(ret, WALLY_OK)
+                mnemonic = utf8(mnemonic)
+                # The detected language is the first that validates
+                for i, l in enumerate(self.all_langs):
+                    if bip39_mnemonic_validate(self.wordlists[l], mnemonic) == WALLY_OK:
+                        break
+                mnemonics.append(mnemonic)
+                expected.append(bytes([i, entropy_len]) + entropy)
+        # Invalid mnemonics
+        words = self.cases[0][1].split()
+        for bad in [words[:-1],                # Too few words
+                    words + words[:3],         # Bad checksum
+                    words[:-1] + [b'zzz'],     # Unknown word
+                    words * 3,                 # Too many words
+                    [w + b' ' for w in words], # Double spaces
+                    []]:                       # Empty
+            mnemonics.append(b' '.join(bad))
+            expected.append(bytes([INVALID]))
+
+        out = create_string_buffer(len(mnemonics) * RESULT_LEN)
+        ret = bip39_mnemonics_validate_batch(b'\n'.join(mnemonics), 0, out, len(out))
+        self.assertEqual(ret, WALLY_OK)
+        for i, e in enumerate(expected):
+            result = out.raw[i * RESULT_LEN : (i + 1) * RESULT_LEN]
+            self.assertEqual(result, e + b'\0' * (RESULT_LEN - len(e)))
+
+        # Invalid args
+        batch = b'\n'.join(mnemonics[:2])
+        for args in [(None,  0, out, RESULT_LEN * 2),     # NULL mnemonics
+                     (batch, 1, out, RESULT_LEN * 2),     # Unknown flags
+                     (batch, 0, None, RESULT_LEN * 2),    # NULL output
+                     (batch, 0, out, RESULT_LEN),         # Too few results
+                     (batch, 0, out, RESULT_LEN * 2 + 1)]: # Bad result length
+            self.assertEqual(bip39_mnemonics_validate_batch(*args), WALLY_EINVAL)
+
     def test_mnemonic_to_seed(self):
 
         for case in self.cases:
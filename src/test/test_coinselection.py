@@ -25,6 +25,107 @@ class CoinSelectionTests(unittest.TestCase):
         for args in bad_args:
             ret = wally_coinselect_assets(*args)
             self.assertEqual(ret, (WALLY_EINVAL, 0))
+            # The split search takes the same arguments plus num_subtrees
+            split_args = args[:5] + (4,) + args[5:]
+            ret = wally_coinselect_assets_split(*split_args)
+            self.assertEqual(ret, (WALLY_EINVAL, 0))
+        # Zero subtrees
+        ret = wally_coinselect_assets_split(values, values_len, target,
+                                            attempts, ratio, 0, out, out_len)
+        self.assertEqual(ret, (WALLY_EINVAL, 0))
+        # Values whose total overflows
+        big = (c_uint64 * 4)(2**64 - 1, 3, 2, 1)
+        ret = wally_coinselect_assets(big, values_len, target, attempts,
+                                      ratio, out, out_len)
+        self.assertEqual(ret, (WALLY_EINVAL, 0))
+        ret = wally_coinselect_assets_split(big, values_len, target, attempts,
+                                            ratio, 4, out, out_len)
+        self.assertEqual(ret, (WALLY_EINVAL, 0))
+
+    def test_invalid_utxos(self):
+        """Test invalid arguments for effective value selection"""
+        values = (c_uint64 * 4)(4000, 3000, 2000, 1000)
+        weights = (c_uint32 * 4)(272, 272, 272, 272)
+        n = len(values)
+        out, out_len = (c_uint32 * n)(), n
+        fee, lt_fee, coc, attempts = 1000, 1000, 100, 100000
+        bad_args = [
+            (None,   n, weights, n,   1, fee, lt_fee, coc, attempts, 0, out,  out_len),   # Null values
+            (values, 0, weights, n,   1, fee, lt_fee, coc, attempts, 0, out,  out_len),   # Empty values
+            (values, n, None,    n,   1, fee, lt_fee, coc, attempts, 0, out,  out_len),   # Null weights
+            (values, n, weights, n-1, 1, fee, lt_fee, coc, attempts, 0, out,  out_len),   # Mismatched weights
+            (values, n, weights, n,   0, fee, lt_fee, coc, attempts, 0, out,  out_len),   # Zero target
+            (values, n, weights, n,   1, fee, lt_fee, coc, 0,        0, out,  out_len),   # Zero attempts
+            (values, n, weights, n,   1, fee, lt_fee, coc, attempts, 1, out,  out_len),   # Unknown flags
+            (values, n, weights, n,   1, fee, lt_fee, coc, attempts, 0, None, out_len),   # Null output
+            (values, n, weights, n,   1, fee, lt_fee, coc, attempts, 0, out,  out_len-1), # Output too small
+        ]
+        big = (c_uint64 * 4)(2**64 - 1, 2**64 - 1, 2000, 1000)
+        max_rate = 2**64 - 1
+        bad_args.extend([
+            (values, n, weights, n,   1, max_rate, lt_fee, coc, attempts, 0, out, out_len), # Fee overflows
+            (values, n, weights, n,   1, fee, max_rate, coc, attempts, 0, out, out_len),    # Long term fee overflows
+            (big,    n, weights, n,   1, fee, lt_fee, coc, attempts, 0, out, out_len),      # Total value overflows
+        ])
+        for args in bad_args:
+            ret = wally_coinselect(*args)
+            self.assertEqual(ret, (WALLY_EINVAL, 0))
+
+    def test_large_utxo_set(self):
+        """Test effective value selection from a large UTXO set"""
+        import random
+        rng = random.Random(1)
+        n, weight, fee_rate, coc = 100000, 272, 2000, 5000
+        values = (c_uint64 * n)(*[rng.randint(1, 10000000) for _ in range(n)])
+        weights = (c_uint32 * n)(*[weight] * n)
+        out, out_len = (c_uint32 * 256)(), 256
+        fee = (weight // 4 * fee_rate + 999) // 1000
+        for target in [10000, 1234567, 9999999, 50000000]:
+            ret, written = wally_coinselect(values, n, weights, n, target,
+                                            fee_rate, 1000, coc, 100000, 0,
+                                            out, out_len)
+            self.assertEqual(ret, WALLY_OK)
+            self.assertNotEqual(written, 0)
+            selected = [out[i] for i in range(written)]
+            self.assertEqual(len(set(selected)), written)
+            total = sum([values[i] - fee for i in selected])
+            # A changeless solution is always found for this UTXO set
+            self.assertTrue(target <= total <= target + coc)
+
+    def test_assets_split(self):
+        """Test the split asset search is deterministic"""
+        if not wally_is_elements_build()[1]:
+            return # # No Elements support, skip this test case
+        import random
+        rng = random.Random(1)
+        n = 2000
+        values = sorted([rng.randint(1, 1000000) for _ in range(n)], reverse=True)
+        values = (c_uint64 * n)(*values)
+        out, out_len = (c_uint32 * 256)(), 256
+        for target in [1000, 777777, 5000000]:
+            results = []
+            for num_subtrees in [1, 4, 16]:
+                ret, written = wally_coinselect_assets_split(values, n, target,
+                                                             n + 1000, 5,
+                                                             num_subtrees,
+                                                             out, out_len)
+                self.assertEqual(ret, WALLY_OK)
+                self.assertNotEqual(written, 0)
+                selected = [out[i] for i in range(written)]
+                self.assertTrue(sum([values[i] for i in selected]) >= target)
+                # Repeating the search gives the same result
+                ret, again = wally_coinselect_assets_split(values, n, target,
+                                                           n + 1000, 5,
+                                                           num_subtrees,
+                                                           out, out_len)
+                self.assertEqual(selected, [out[i] for i in range(again)])
+                results.append(selected)
+            # A single subtree searches the same space as the serial search
+            ret, written = wally_coinselect_assets(values, n, target,
+                                                   n + 1000, 5, out, out_len)
+            serial = [out[i] for i in range(written)]
+            self.assertEqual(sum([values[i] for i in serial]),
+                             sum([values[i] for i in results[0]]))
 
 
 if __name__ == '__main__':
@@ -28,6 +28,7 @@ MS_IS_PARENTED     = 0x80
 MS_IS_ELEMENTS     = 0x100
 
 NO_CHECKSUM = 0x1 # WALLY_MS_CANONICAL_NO_CHECKSUM
+WALLY_SEGWIT_ADDRESS_MAX_LEN = 91
 
 def wally_map_from_dict(d):
     m = pointer(wally_map())
@@ -159,6 +160,18 @@ class DescriptorTests(unittest.TestCase):
             self.assertEqual(ret, WALLY_OK)
             for i in range(len(expected)):
                 self.assertEqual(utf8(expected[i]), addrs[i])
+            # Non-allocating variant
+            slots = create_string_buffer(len(expected) * WALLY_SEGWIT_ADDRESS_MAX_LEN)
+            ret = wally_descriptor_to_addresses_into(d, variant, multi_index,
+                                                     child_num, 0, slots, len(slots))
+            self.assertEqual(ret, WALLY_OK)
+            for i in range(len(expected)):
+                slot = slots.raw[i * WALLY_SEGWIT_ADDRESS_MAX_LEN:]
+                self.assertEqual(utf8(expected[i]), slot[:slot.index(b'\0')])
+            # Output length must be a multiple of the slot size
+            ret = wally_descriptor_to_addresses_into(d, variant, multi_index,
+                                                     child_num, 0, slots, len(slots) - 1)
+            self.assertEqual(ret, WALLY_EINVAL)
             wally_descriptor_free(d)
 
         # Invalid args
@@ -1,5 +1,45 @@
 import unittest
 from util import *
+from hashlib import sha256
+
+WALLY_BIP352_OUTPOINT_LEN = 36
+WALLY_BIP352_MATCH_LEN = 40
+
+# Minimal secp256k1 point arithmetic for computing silent payments
+# outputs independently of the library
+P = 2**256 - 2**32 - 977
+N = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141
+G = (0x79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798,
+     0x483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8)
+
+def point_add(p1, p2):
+    if p1 is None:
+        return p2
+    if p2 is None:
+        return p1
+    if p1[0] == p2[0] and (p1[1] + p2[1]) % P == 0:
+        return None
+    if p1 == p2:
+        l = 3 * p1[0] * p1[0] * pow(2 * p1[1], P - 2, P) % P
+    else:
+        l = (p2[1] - p1[1]) * pow(p2[0] - p1[0], P - 2, P) % P
+    x = (l * l - p1[0] - p2[0]) % P
+    return (x, (l * (p1[0] - x) - p1[1]) % P)
+
+def point_mul(p, n):
+    r = None
+    for i in range(256):
+        if (n >> i) & 1:
+            r = point_add(r, p)
+        p = point_add(p, p)
+    return r
+
+def ser_p(p):
+    return bytes([2 + (p[1] & 1)]) + p[0].to_bytes(32, 'big')
+
+def tagged_hash(tag, data):
+    tag_hash = sha256(tag.encode()).digest()
+    return sha256(tag_hash + tag_hash + data).digest()
 
 
 class ECDHTests(unittest.TestCase):
@@ -44,6 +84,107 @@ class ECDHTests(unittest.TestCase):
             self.assertEqual(WALLY_EINVAL, wally_ecdh(*args))
             self.assertEqual(h(out), utf8('00'*32))
 
+    def bip352_send(self, input_privs, outpoint, scan_pub, spend_pub, n):
+        """Create n silent payment output keys as a sender"""
+        a = sum(input_privs) % N
+        A = point_mul(G, a)
+        input_hash = tagged_hash('BIP0352/Inputs', outpoint + ser_p(A))
+        secret = point_mul(scan_pub, int.from_bytes(input_hash, 'big') * a % N)
+        outputs, tweaks = [], []
+        for k in range(n):
+            t_k = tagged_hash('BIP0352/SharedSecret', ser_p(secret) + k.to_bytes(4, 'big'))
+            outputs.append(point_add(spend_pub, point_mul(G, int.from_bytes(t_k, 'big')))[0].to_bytes(32, 'big'))
+            tweaks.append(t_k)
+        return [ser_p(point_mul(G, priv)) for priv in input_privs], outputs, tweaks
+
+    def test_bip352_scan(self):
+        """Tests for BIP352 silent payments scanning"""
+        b_scan, b_spend = 0x1234567, 0xabcdef
+        scan_priv = b_scan.to_bytes(32, 'big')
+        scan_pub, spend_pub = point_mul(G, b_scan), point_mul(G, b_spend)
+        spend_pub_bytes = ser_p(spend_pub)
+        other_pub = point_mul(G, 0x999)
+
+        # Build a batch of transactions: (input privs, num payments to us,
+        # num other outputs). Tx 2 pays a different receiver, tx 3 has
+        # inputs whose keys sum to the point at infinity.
+        txs = [([0x11], 1, 1), ([0x22, 0x33], 3, 2), ([0x44], 0, 2),
+               ([0x55, N - 0x55], 0, 1), ([0x66, 0x77, 0x88], 2, 0)]
+        outpoints, pub_keys, num_pub_keys = b'', b'', []
+        output_keys, num_output_keys, expected = b'', [], b''
+        for i, (privs, n, others) in enumerate(txs):
+            outpoint = bytes([i]) * 32 + i.to_bytes(4, 'little')
+            if n:
+                keys, outputs, tweaks = self.bip352_send(privs, outpoint, scan_pub, spend_pub, n)
+            else:
+                keys = [ser_p(point_mul(G, priv)) if priv % N else b'' for priv in privs]
+                outputs, tweaks = [], []
+            if i == 2:
+                # Pay someone else
+                _, outputs, _ = self.bip352_send(privs, outpoint, other_pub, spend_pub, 1)
+            # Place our outputs after any others, in reverse order
+            tx_outputs = [urandom(32) for _ in range(others)] + outputs[::-1]
+            for k, t_k in enumerate(tweaks):
+                index = tx_outputs.index(outputs[k])
+                expected += i.to_bytes(4, 'little') + index.to_bytes(4, 'little') + t_k
+            outpoints += outpoint
+            pub_keys += b''.join(keys)
+            num_pub_keys.append(len(keys))
+            output_keys += b''.join(tx_outputs)
+            num_output_keys.append(len(tx_outputs))
+
+        n_txs = len(txs)
+        args = [scan_priv, len(scan_priv), spend_pub_bytes, len(spend_pub_bytes),
+                outpoints, len(outpoints), pub_keys, len(pub_keys),
+                (c_uint32 * n_txs)(*num_pub_keys), n_txs,
+                output_keys, len(output_keys),
+                (c_uint32 * n_txs)(*num_output_keys), n_txs, 0]
+        out, out_len = make_cbuffer('00' * len(output_keys))
+        ret, written = wally_bip352_scan(*args, out, out_len)
+        self.assertEqual((ret, written), (WALLY_OK, len(expected)))
+        self.assertEqual(out[:written], expected)
+        self.assertEqual(written, 6 * WALLY_BIP352_MATCH_LEN)
+
+        # Each match gives the tweak to add to the spend key to spend it
+        for m in range(0, written, WALLY_BIP352_MATCH_LEN):
+            tweak = int.from_bytes(out[m + 8:m + 40], 'big')
+            d = (b_spend + tweak) % N
+            tx_index = int.from_bytes(out[m:m + 4], 'little')
+            output_index = int.from_bytes(out[m + 4:m + 8], 'little')
+            start = (sum(num_output_keys[:tx_index]) + output_index) * 32
+            self.assertEqual(point_mul(G, d)[0].to_bytes(32, 'big'),
+                             output_keys[start:start + 32])
+
+        # Too small an output buffer returns the required length
+        ret, written = wally_bip352_scan(*args, out, WALLY_BIP352_MATCH_LEN)
+        self.assertEqual((ret, written), (WALLY_OK, len(expected)))
+
+        # Scanning with a different scan key finds nothing
+        bad_args = list(args)
+        bad_args[0] = (b_scan + 1).to_bytes(32, 'big')
+        ret, written = wally_bip352_scan(*bad_args, out, out_len)
+        self.assertEqual((ret, written), (WALLY_OK, 0))
+
+        # Invalid arguments
+        for i, bad in [(0, None),                      # Missing scan key
+                       (0, bytes(32)),                 # Invalid scan key
+                       (1, 31),                        # Bad scan key length
+                       (2, None),                      # Missing spend key
+                       (3, 32),                        # Bad spend key length
+                       (5, len(outpoints) - 1),        # Bad outpoints length
+                       (7, len(pub_keys) - 33),        # Bad pub_keys length
+                       (9, 0),                         # No transactions
+                       (11, len(output_keys) - 32),    # Bad output_keys length
+                       (13, n_txs - 1),                # Mismatched tx counts
+                       (14, 1)]:                       # Unknown flags
+            bad_args = list(args)
+            bad_args[i] = bad
+            ret, written = wally_bip352_scan(*bad_args, out, out_len)
+            self.assertEqual((ret, written), (WALLY_EINVAL, 0))
+        for bad_out in [(None, out_len), (out, 0)]:
+            ret, written = wally_bip352_scan(*args, *bad_out)
+            self.assertEqual((ret, written), (WALLY_EINVAL, 0))
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -140,6 +140,30 @@ class HashTests(unittest.TestCase):
                 self.assertEqual(result, utf8(expected.lower()))
 
 
+    def test_hash160_batch(self):
+        msgs = [m for m, _ in hash160_cases]
+        item = h(utf8(msgs[0])).decode('utf-8')
+        items = [h(utf8(m)).decode('utf-8')[:len(item)].ljust(len(item), '0')
+                 for m in msgs]
+        in_bytes, in_bytes_len = make_cbuffer(''.join(items))
+        item_len = len(item) // 2
+        buf, buf_len = make_cbuffer('00' * self.HASH160_LEN * len(items))
+        ret = wally_hash160_batch(in_bytes, in_bytes_len, item_len, buf, buf_len)
+        self.assertEqual(ret, WALLY_OK)
+        for i, msg in enumerate(items):
+            expected = self.do_hash(wally_hash160, utf8(msg), True)
+            result = h(buf[i * self.HASH160_LEN:(i + 1) * self.HASH160_LEN])
+            self.assertEqual(result, expected)
+
+        for args in [(None,     in_bytes_len,     item_len,     buf,  buf_len),      # NULL input
+                     (in_bytes, 0,                item_len,     buf,  buf_len),      # Empty input
+                     (in_bytes, in_bytes_len,     0,            buf,  buf_len),      # Zero item length
+                     (in_bytes, in_bytes_len - 1, item_len,     buf,  buf_len),      # Partial item
+                     (in_bytes, in_bytes_len,     item_len,     None, buf_len),      # NULL output
+                     (in_bytes, in_bytes_len,     item_len,     buf,  buf_len - 1)]: # Wrong output length
+            self.assertEqual(wally_hash160_batch(*args), WALLY_EINVAL)
+
+
     def test_ripemd_vectors(self):
         for in_msg, expected in ripemd160_cases:
             msg = h(utf8(in_msg)).decode('utf-8')
@@ -1,6 +1,8 @@
 import unittest
 from util import *
 
+FLAG_SCHNORR = 0x2
+
 class InternalTests(unittest.TestCase):
 
     def test_secp_context(self):
@@ -12,6 +14,340 @@ class InternalTests(unittest.TestCase):
         # Freeing a NULL context is a no-op
         wally_secp_context_free(None)
 
+    def test_secp_context_threads(self):
+        """Tests for the default per-thread secp context"""
+        from threading import Thread
+        main_ctx = wally_get_secp_context()
+        self.assertIsNotNone(main_ctx)
+        self.assertEqual(wally_get_secp_context(), main_ctx)
+
+        priv_key, priv_key_len = make_cbuffer('11' * 32)
+        msgs, msgs_len = make_cbuffer('22' * 32 * 8)
+        expected, expected_len = make_cbuffer('00' * 64 * 8)
+        ret = wally_ec_sig_from_bytes_batch(priv_key, priv_key_len, msgs, msgs_len,
+                                            None, 0, FLAG_SCHNORR, expected, expected_len)
+        self.assertEqual(ret, WALLY_OK)
+
+        results = [None] * 4
+        def run(i):
+            # Each thread gets its own context, which it can randomize
+            ctx = wally_get_secp_context()
+            ok = ctx is not None and ctx == wally_get_secp_context()
+            ok = ok and wally_secp_randomize(urandom(32), 32) == WALLY_OK
+            out, out_len = make_cbuffer('00' * 64 * 8)
+            for _ in range(10):
+                ret = wally_ec_sig_from_bytes_batch(priv_key, priv_key_len,
+                                                    msgs, msgs_len, None, 0,
+                                                    FLAG_SCHNORR, out, out_len)
+                ok = ok and ret == WALLY_OK and out == expected
+            # Free this threads context
+            ok = ok and wally_cleanup(0) == WALLY_OK
+            results[i] = (ok, ctx)
+
+        threads = [Thread(target=run, args=(i,)) for i in range(len(results))]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        for ok, ctx in results:
+            self.assertTrue(ok)
+            self.assertNotEqual(ctx, main_ctx)
+        # The main threads context is unchanged
+        self.assertEqual(wally_get_secp_context(), main_ctx)
+
+    def test_secp_randomize_threads(self):
+        """Tests that randomizing protects the contexts of other threads"""
+        from threading import Thread, Event
+        # The start of a context holds its generator blinding scalar (after
+        # an int and padding), which is the same for all unrandomized contexts
+        BLIND_OFFSET, BLIND_LEN = 8, 32
+        def blinding(ctx):
+            return string_at(ctx + BLIND_OFFSET, BLIND_LEN)
+        fresh_ctx = wally_get_new_secp_context()
+        unrandomized = blinding(fresh_ctx)
+        wally_secp_context_free(fresh_ctx)
+
+        priv_key, priv_key_len = make_cbuffer('11' * 32)
+        msgs, msgs_len = make_cbuffer('22' * 32 * 8)
+        expected, expected_len = make_cbuffer('00' * 64 * 8)
+        ret = wally_ec_sig_from_bytes_batch(priv_key, priv_key_len, msgs, msgs_len,
+                                            None, 0, FLAG_SCHNORR, expected, expected_len)
+        self.assertEqual(ret, WALLY_OK)
+
+        results = {}
+        started, randomized = Event(), Event()
+        def run(name, wait):
+            ctx = wally_get_secp_context()
+            if wait:
+                # Use this threads context before the caller randomizes
+                started.set()
+                randomized.wait()
+            out, out_len = make_cbuffer('00' * 64 * 8)
+            ret = wally_ec_sig_from_bytes_batch(priv_key, priv_key_len,
+                                                msgs, msgs_len, None, 0,
+                                                FLAG_SCHNORR, out, out_len)
+            same_ctx = ctx == wally_get_secp_context()
+            results[name] = (ret == WALLY_OK and out == expected and same_ctx,
+                             blinding(ctx))
+            wally_cleanup(0)
+
+        existing = Thread(target=run, args=('existing', True))
+        existing.start()
+        started.wait()
+        self.assertEqual(wally_secp_randomize(urandom(32), 32), WALLY_OK)
+        randomized.set()
+        created = Thread(target=run, args=('created', False))
+        created.start()
+        for t in [existing, created]:
+            t.join()
+        for name in ['existing', 'created']:
+            ok, thread_blinding = results[name]
+            self.assertTrue(ok)
+            self.assertNotEqual(thread_blinding, unrandomized)
+
+    def test_executor(self):
+        """Tests for overriding the default executor"""
+        default_ops, ops = wally_operations(), wally_operations()
+        for o in [default_ops, ops]:
+            o.struct_size = sizeof(wally_operations)
+            self.assertEqual(wally_get_operations(byref(o)), WALLY_OK)
+
+        # Sign a batch with the default executor
+        priv_key, priv_key_len = make_cbuffer('11' * 32)
+        msgs, msgs_len = make_cbuffer('22' * 32 * 200)
+        def sign_batch():
+            out, out_len = make_cbuffer('00' * 64 * 200)
+            ret = wally_ec_sig_from_bytes_batch(priv_key, priv_key_len,
+                                                msgs, msgs_len, None, 0,
+                                                FLAG_SCHNORR, out, out_len)
+            self.assertEqual(ret, WALLY_OK)
+            return out
+        expected = sign_batch()
+
+        # Set an executor that runs tasks in reverse order
+        calls = []
+        def reverse_executor(task, ctx, num_tasks, executor_ctx):
+            calls.append((num_tasks, executor_ctx))
+            for i in reversed(range(num_tasks)):
+                task(ctx, i)
+        task_fn_t = CFUNCTYPE(None, c_void_p, c_size_t)
+        executor_fn_t = CFUNCTYPE(None, task_fn_t, c_void_p, c_size_t, c_void_p)
+        executor_fn = executor_fn_t(reverse_executor)
+        ops.executor_fn = executor_fn
+        ops.executor_ctx = 1234
+        self.assertEqual(wally_set_operations(byref(ops)), WALLY_OK)
+
+        # The executor is used, and results are unchanged
+        self.assertEqual(sign_batch(), expected)
+        self.assertEqual(calls, [(4, 1234)])
+
+        # Restore the default executor
+        self.assertEqual(wally_set_operations(byref(default_ops)), WALLY_OK)
+        self.assertEqual(sign_batch(), expected)
+        self.assertEqual(len(calls), 1)
+
+    def test_pool(self):
+        """Tests for the pooled allocator"""
+        default_ops, ops = wally_operations(), wally_operations()
+        for o in [default_ops, ops]:
+            o.struct_size = sizeof(wally_operations)
+            self.assertEqual(wally_get_operations(byref(o)), WALLY_OK)
+        ops.malloc_fn = cast(libwally.wally_pool_malloc, type(ops.malloc_fn))
+        ops.free_fn = cast(libwally.wally_pool_free, type(ops.free_fn))
+        self.assertEqual(wally_set_operations(byref(ops)), WALLY_OK)
+
+        def get_stats():
+            stats = wally_pool_stats()
+            self.assertEqual(wally_pool_get_stats(byref(stats)), WALLY_OK)
+            return stats
+
+        tx_hex = '0100000001' + '11' * 32 + '00000000' + '19' + '76a914' + '22' * 20 + \
+                 '88ac' + 'ffffffff' + '02' + ('e803000000000000' + '160014' + '33' * 20) * 2 + \
+                 '00000000'
+        start = get_stats()
+        for i in range(3):
+            tx = POINTER(wally_tx)()
+            self.assertEqual(wally_tx_from_hex(tx_hex, 0, byref(tx)), WALLY_OK)
+            self.assertEqual(wally_tx_to_hex(tx, 0), (WALLY_OK, tx_hex))
+            wally_tx_free(tx)
+        stats = get_stats()
+        num_allocs = stats.num_allocs - start.num_allocs
+        self.assertGreater(num_allocs, 0)
+        # Everything allocated was freed, and later rounds reused blocks
+        self.assertEqual(stats.num_frees - start.num_frees, num_allocs)
+        self.assertGreater(stats.num_hits - start.num_hits, 0)
+        self.assertGreater(stats.num_cached, 0)
+        self.assertGreater(stats.cached_bytes, 0)
+
+        # Cleaning up releases the calling threads cached blocks
+        self.assertEqual(wally_cleanup(0), WALLY_OK)
+        self.assertEqual(get_stats().num_cached, 0)
+
+        self.assertEqual(wally_pool_get_stats(None), WALLY_EINVAL)
+        self.assertEqual(wally_set_operations(byref(default_ops)), WALLY_OK)
+
+    def test_secure_arena(self):
+        """Tests for the secure arena"""
+        for args in [(0, 0),       # Zero length
+                     (4096, 0x1)]: # Unknown flags
+            self.assertEqual(wally_secure_arena_init(*args), WALLY_EINVAL)
+        self.assertEqual(wally_secure_arena_reset(0x1), (WALLY_EINVAL, 0))
+        self.assertEqual(wally_secure_arena_free(0x1), WALLY_EINVAL)
+        # Without an arena, reset and free do nothing
+        self.assertEqual(wally_secure_arena_reset(0), (WALLY_OK, 0))
+        self.assertEqual(wally_secure_arena_free(0), WALLY_OK)
+
+        mnemonic = ' '.join(['abandon'] * 11 + ['about'])
+        def derive():
+            seed, seed_len = make_cbuffer('00' * 64)
+            ret = bip39_mnemonic_to_seed(mnemonic, 'passphrase', seed, seed_len)
+            self.assertEqual(ret, (WALLY_OK, 64))
+            master, child = ext_key(), ext_key()
+            self.assertEqual(bip32_key_from_seed(seed, 32, 0x0488ADE4, 0,
+                                                 byref(master)), WALLY_OK)
+            path = (c_uint32 * 3)(0x80000054, 0x80000000, 0)
+            self.assertEqual(bip32_key_from_parent_path(byref(master), path, 3, 0,
+                                                        byref(child)), WALLY_OK)
+            return seed, bytes(child.priv_key), bytes(child.chain_code)
+        expected = derive()
+
+        ret = wally_secure_arena_init(4096, 0)
+        if ret == WALLY_ERROR:
+            return # Locked memory is unsupported or unavailable
+        self.assertEqual(ret, WALLY_OK)
+        # Results are unchanged when using the arena
+        self.assertEqual(derive(), expected)
+        # Resetting clears the memory used, once
+        ret, written = wally_secure_arena_reset(0)
+        self.assertEqual(ret, WALLY_OK)
+        self.assertGreater(written, 0)
+        self.assertEqual(wally_secure_arena_reset(0), (WALLY_OK, 0))
+        # Re-creating the arena replaces it
+        self.assertEqual(wally_secure_arena_init(4096, 0), WALLY_OK)
+        self.assertEqual(derive(), expected)
+        self.assertEqual(wally_secure_arena_free(0), WALLY_OK)
+        self.assertEqual(wally_secure_arena_reset(0), (WALLY_OK, 0))
+        self.assertEqual(derive(), expected)
+
+    def test_clear_public(self):
+        """Tests for freeing public data without clearing it"""
+        FLAG_NO_CLEAR_PUBLIC = 0x1
+        self.assertEqual(wally_init(0x2), WALLY_EINVAL) # Unknown flag
+
+        default_ops, ops = wally_operations(), wally_operations()
+        for o in [default_ops, ops]:
+            o.struct_size = sizeof(wally_operations)
+            self.assertEqual(wally_get_operations(byref(o)), WALLY_OK)
+        # Record the lengths of all memory securely cleared
+        cleared = []
+        def bzero(p, n):
+            cleared.append(n)
+            memset(p, 0, n)
+        bzero_fn = CFUNCTYPE(None, c_void_p, c_size_t)(bzero)
+        ops.bzero_fn = cast(bzero_fn, type(ops.bzero_fn))
+        self.assertEqual(wally_set_operations(byref(ops)), WALLY_OK)
+
+        tx_hex = '0100000001' + '11' * 32 + '00000000' + '19' + '76a914' + '22' * 20 + \
+                 '88ac' + 'ffffffff' + '01' + 'e803000000000000' + '160014' + '33' * 20 + \
+                 '00000000'
+        def free_tx():
+            tx = POINTER(wally_tx)()
+            self.assertEqual(wally_tx_from_hex(tx_hex, 0, byref(tx)), WALLY_OK)
+            del cleared[:]
+            wally_tx_free(tx)
+            return list(cleared)
+        def free_map():
+            m = POINTER(wally_map)()
+            self.assertEqual(wally_map_init_alloc(1, None, byref(m)), WALLY_OK)
+            self.assertEqual(wally_map_add(m, b'\x01' * 3, 3, b'\x02' * 5, 5), WALLY_OK)
+            del cleared[:]
+            wally_map_free(m)
+            return list(cleared)
+
+        # By default, public and secret data is cleared
+        self.assertIn(25, free_tx()) # The input script
+        self.assertTrue(all(n in free_map() for n in [3, 5]))
+
+        # With the flag, public data is not cleared while secret data is
+        self.assertEqual(wally_init(FLAG_NO_CLEAR_PUBLIC), WALLY_OK)
+        self.assertEqual(free_tx(), [])
+        self.assertTrue(all(n in free_map() for n in [3, 5]))
+
+        self.assertEqual(wally_init(0), WALLY_OK)
+        self.assertIn(25, free_tx())
+        self.assertEqual(wally_set_operations(byref(default_ops)), WALLY_OK)
+
+    def test_clear_integer_keys(self):
+        """Tests freeing integer-keyed maps with a custom bzero_fn"""
+        default_ops, ops = wally_operations(), wally_operations()
+        for o in [default_ops, ops]:
+            o.struct_size = sizeof(wally_operations)
+            self.assertEqual(wally_get_operations(byref(o)), WALLY_OK)
+        # Record any attempt to clear a NULL pointer
+        null_clears = []
+        def bzero(p, n):
+            if p is None:
+                null_clears.append(n)
+            else:
+                memset(p, 0, n)
+        bzero_fn = CFUNCTYPE(None, c_void_p, c_size_t)(bzero)
+        ops.bzero_fn = cast(bzero_fn, type(ops.bzero_fn))
+        self.assertEqual(wally_set_operations(byref(ops)), WALLY_OK)
+
+        m = POINTER(wally_map)()
+        self.assertEqual(wally_map_init_alloc(2, None, byref(m)), WALLY_OK)
+        for k in [1, 2]:
+            self.assertEqual(wally_map_add_integer(m, k, b'\x02' * 5, 5), WALLY_OK)
+        self.assertEqual(wally_map_clear(m), WALLY_OK)
+        self.assertEqual(wally_map_free(m), WALLY_OK)
+        self.assertEqual(null_clears, [])
+
+        self.assertEqual(wally_set_operations(byref(default_ops)), WALLY_OK)
+
+    def test_stats(self):
+        """Tests for instrumentation statistics"""
+        STATS_TX_PARSE, STATS_TX_SERIALIZE, STATS_BIP32_DERIVE = 1, 2, 6
+        STATS_NUM, FLAG_RESET = 12, 0x1
+        stats = (wally_stats * STATS_NUM)()
+
+        for args in [(0x2, stats, STATS_NUM),           # Unknown flags
+                     (0, None, STATS_NUM),              # NULL output
+                     (0, stats, STATS_NUM - 1)]:        # Wrong output count
+            self.assertEqual(wally_get_stats(*args), WALLY_EINVAL)
+
+        ret = wally_get_stats(FLAG_RESET, stats, STATS_NUM)
+        if ret == WALLY_ERROR:
+            # Not built with --enable-stats: output is zeroed
+            self.assertTrue(all(s.num_calls == 0 and s.ticks == 0 for s in stats))
+            return
+        self.assertEqual(ret, WALLY_OK)
+
+        tx_hex = '0100000001' + '11' * 32 + '00000000' + '00' + 'ffffffff' + \
+                 '01' + 'e803000000000000' + '160014' + '33' * 20 + '00000000'
+        for i in range(3):
+            tx = POINTER(wally_tx)()
+            self.assertEqual(wally_tx_from_hex(tx_hex, 0, byref(tx)), WALLY_OK)
+            self.assertEqual(wally_tx_to_hex(tx, 0), (WALLY_OK, tx_hex))
+            wally_tx_free(tx)
+        seed, _ = make_cbuffer('00' * 32)
+        master, child = ext_key(), ext_key()
+        self.assertEqual(bip32_key_from_seed(seed, len(seed), 0x0488ADE4, 0,
+                                             byref(master)), WALLY_OK)
+        self.assertEqual(bip32_key_from_parent(byref(master), 1, 0, byref(child)),
+                         WALLY_OK)
+
+        self.assertEqual(wally_get_stats(FLAG_RESET, stats, STATS_NUM), WALLY_OK)
+        self.assertEqual(stats[STATS_TX_PARSE].num_calls, 3)
+        self.assertEqual(stats[STATS_TX_SERIALIZE].num_calls, 3)
+        self.assertEqual(stats[STATS_BIP32_DERIVE].num_calls, 1)
+        # Parsing allocates the tx, which is freed outside of any operation
+        self.assertGreater(stats[STATS_TX_PARSE].num_allocs, 0)
+        self.assertGreater(stats[STATS_TX_PARSE].alloc_bytes, 0)
+
+        # Resetting zeroes the statistics
+        self.assertEqual(wally_get_stats(0, stats, STATS_NUM), WALLY_OK)
+        self.assertEqual(stats[STATS_TX_PARSE].num_calls, 0)
+
     def test_operations(self):
         """Tests for overriding the libraries default operations"""
         # get_operations
@@ -24,6 +360,9 @@ class InternalTests(unittest.TestCase):
         # Correct struct size succeeds
         ops.struct_size = sizeof(wally_operations)
         self.assertEqual(wally_get_operations(byref(ops)), WALLY_OK)
+        default_ops = wally_operations()
+        default_ops.struct_size = sizeof(wally_operations)
+        self.assertEqual(wally_get_operations(byref(default_ops)), WALLY_OK)
 
         # set_operations
         # NULL input
@@ -49,6 +388,10 @@ class InternalTests(unittest.TestCase):
         #self.assertEqual(wally_set_operations(byref(ops)), WALLY_OK)
         #self.assertEqual(wally_secp_randomize(urandom(32), 32), WALLY_ENOMEM)
 
+        # Restore the default operations
+        self.assertEqual(wally_set_operations(byref(default_ops)), WALLY_OK)
+        self.assertEqual(wally_secp_randomize(urandom(32), 32), WALLY_OK)
+
 
 if __name__ == '__main__':
     unittest.main()
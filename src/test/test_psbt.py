@@ -1,3 +1,4 @@
+import base64
 import json
 import unittest
 from util import *
@@ -234,6 +235,68 @@ class PSBTTests(unittest.TestCase):
             if is_elements_build or not case.get('is_pset', False):
                 self.do_sign(case)
 
+    def test_signer_failure(self):
+        """Test that signing stops at the first input that fails"""
+        case = JSON['signer'][0]
+        key = POINTER(ext_key)()
+        ret = bip32_key_from_base58_alloc(case['master_xpriv'], byref(key))
+        self.assertEqual(ret, WALLY_OK)
+
+        def sign(bad_index):
+            psbt = self.parse_base64(case['psbt'])
+            # Moving the input's keys to its taproot keypaths makes signing
+            # (but not key derivation or hashing) fail, since the input
+            # is not taproot
+            inp = psbt.contents.inputs[bad_index]
+            keypaths = byref(inp.keypaths)
+            pub_key, fingerprint = (c_ubyte * 33)(), (c_ubyte * 4)()
+            path, path_len = (c_uint32 * 16)(), 16
+            moved = []
+            for i in range(wally_map_get_num_items(keypaths)[1]):
+                self.assertEqual(wally_map_get_item_key(keypaths, i, pub_key, 33), (WALLY_OK, 33))
+                ret = wally_map_keypath_get_item_fingerprint(keypaths, i, fingerprint, 4)
+                self.assertEqual(ret, WALLY_OK)
+                ret, written = wally_map_keypath_get_item_path(keypaths, i, path, path_len)
+                self.assertEqual(ret, WALLY_OK)
+                moved.append((bytes(pub_key)[1:], bytes(fingerprint), list(path)[:written]))
+            self.assertEqual(wally_map_clear(keypaths), WALLY_OK)
+            for xonly, fp, child_path in moved:
+                child_path = (c_uint32 * len(child_path))(*child_path)
+                ret = wally_psbt_input_taproot_keypath_add(inp, xonly, 32,
+                                                           None, 0, fp, 4,
+                                                           child_path,
+                                                           len(child_path))
+                self.assertEqual(ret, WALLY_OK)
+            ret = wally_psbt_sign_bip32(psbt, key, 0)
+            self.assertEqual(ret, WALLY_EINVAL)
+            num_inputs = wally_psbt_get_num_inputs(psbt)[1]
+            return [wally_psbt_get_input_signatures_size(psbt, i)[1]
+                    for i in range(num_inputs)]
+
+        # Run signing tasks in reverse order, so later inputs are
+        # signed before earlier failures are seen
+        default_ops, ops = wally_operations(), wally_operations()
+        for o in [default_ops, ops]:
+            o.struct_size = sizeof(wally_operations)
+            self.assertEqual(wally_get_operations(byref(o)), WALLY_OK)
+        def reverse_executor(task, ctx, num_tasks, executor_ctx):
+            for i in reversed(range(num_tasks)):
+                task(ctx, i)
+        task_fn_t = CFUNCTYPE(None, c_void_p, c_size_t)
+        executor_fn_t = CFUNCTYPE(None, task_fn_t, c_void_p, c_size_t, c_void_p)
+        executor_fn = executor_fn_t(reverse_executor)
+        ops.executor_fn = executor_fn
+
+        expected = [sign(0), sign(1)]
+        # Inputs before the failing input are signed, later ones are not
+        self.assertEqual(expected, [[0, 0], [1, 0]])
+        self.assertEqual(wally_set_operations(byref(ops)), WALLY_OK)
+        try:
+            self.assertEqual([sign(0), sign(1)], expected)
+        finally:
+            self.assertEqual(wally_set_operations(byref(default_ops)), WALLY_OK)
+        bip32_key_free(key)
+
     def test_finalizer_role(self):
         """Test the PSBT finalizer role"""
         _, is_elements_build = wally_is_elements_build()
@@ -441,5 +504,443 @@ class PSBTTests(unittest.TestCase):
         serialized = self.to_base64(psbt, None, SERIALIZE_FLAG_REDUNDANT)
         self.assertNotEqual(serialized, b64)
 
+    def test_outpoint_index(self):
+        """Test finding inputs by outpoint with and without an index"""
+        import random
+        rng = random.Random(7)
+        txids = [bytes([rng.randrange(256) for _ in range(32)]) for _ in range(8)]
+
+        def rand_outpoint():
+            # A small keyspace gives duplicate outpoints and hash collisions
+            return rng.choice(txids), rng.randrange(4)
+
+        def find_all(psbt, outpoints):
+            txhashes = b''.join([o[0] for o in outpoints])
+            num = len(outpoints)
+            indices = (c_uint32 * num)(*[o[1] for o in outpoints])
+            out = (c_uint32 * num)()
+            ret, written = wally_psbt_find_inputs_spending_utxos(psbt, txhashes, len(txhashes),
+                                                                 indices, num, out, num)
+            self.assertEqual((ret, written), (WALLY_OK, num))
+            return list(out)
+
+        def check(psbt):
+            outpoints = [(txid, i) for txid in txids for i in range(4)]
+            expected = []
+            for txid, i in outpoints:
+                ret, found = wally_psbt_find_input_spending_utxo(psbt, txid, 32, i)
+                self.assertEqual(ret, WALLY_OK)
+                expected.append(found)
+            # Compare against a linear search, and the bulk lookup
+            self.assertEqual(wally_psbt_outpoint_index_disable(psbt), WALLY_OK)
+            self.assertEqual([wally_psbt_find_input_spending_utxo(psbt, txid, 32, i)[1]
+                              for txid, i in outpoints], expected)
+            self.assertEqual(find_all(psbt, outpoints), expected)
+            self.assertEqual(wally_psbt_outpoint_index_enable(psbt, 0), WALLY_OK)
+            self.assertEqual(find_all(psbt, outpoints), expected)
+
+        for version in [0, 2]:
+            psbt = pointer(wally_psbt())
+            self.assertEqual(wally_psbt_init_alloc(version, 0, 0, 0, 0, psbt), WALLY_OK)
+            if version == 0:
+                tx = pointer(wally_tx())
+                self.assertEqual(wally_tx_init_alloc(2, 0, 0, 0, tx), WALLY_OK)
+                self.assertEqual(wally_psbt_set_global_tx(psbt, tx), WALLY_OK)
+                wally_tx_free(tx)
+            self.assertEqual(wally_psbt_outpoint_index_enable(psbt, 0), WALLY_OK)
+            for n in range(300):
+                op = rng.randrange(4)
+                num_inputs = psbt.contents.num_inputs
+                if op < 2 or not num_inputs:
+                    txid, i = rand_outpoint()
+                    tx_in = pointer(wally_tx_input())
+                    ret = wally_tx_input_init_alloc(txid, 32, i, 0xffffffff, None, 0, None, tx_in)
+                    self.assertEqual(ret, WALLY_OK)
+                    pos = rng.randrange(num_inputs + 1)
+                    self.assertEqual(wally_psbt_add_tx_input_at(psbt, pos, 0, tx_in), WALLY_OK)
+                    wally_tx_input_free(tx_in)
+                elif op == 2:
+                    pos = rng.randrange(num_inputs)
+                    self.assertEqual(wally_psbt_remove_input(psbt, pos), WALLY_OK)
+                elif version == 2:
+                    txid, i = rand_outpoint()
+                    pos = rng.randrange(num_inputs)
+                    self.assertEqual(wally_psbt_set_input_previous_txid(psbt, pos, txid, 32), WALLY_OK)
+                    self.assertEqual(wally_psbt_set_input_output_index(psbt, pos, i), WALLY_OK)
+                if n % 25 == 0:
+                    check(psbt)
+            check(psbt)
+            wally_psbt_free(psbt)
+
+        # Invalid args
+        psbt = pointer(wally_psbt())
+        self.assertEqual(wally_psbt_init_alloc(2, 0, 0, 0, 0, psbt), WALLY_OK)
+        txid = txids[0]
+        out = (c_uint32 * 2)()
+        one = (c_uint32 * 1)(0)
+        for args in [
+                (None, txid, 32, one, 1, out, 2),     # NULL PSBT
+                (psbt, None, 32, one, 1, out, 2),     # NULL txhashes
+                (psbt, txid, 31, one, 1, out, 2),     # Bad txhashes length
+                (psbt, txid, 32, None, 1, out, 2),    # NULL utxo_indices
+                (psbt, txid, 0, one, 0, out, 2),      # Empty utxo_indices
+                (psbt, txid, 32, one, 1, None, 2),    # NULL output
+                (psbt, txid, 32, one, 1, out, 0),     # Output too short
+            ]:
+            ret, written = wally_psbt_find_inputs_spending_utxos(*args)
+            self.assertEqual((ret, written), (WALLY_EINVAL, 0))
+        for args in [(None, 0), (psbt, 1)]:
+            self.assertEqual(wally_psbt_outpoint_index_enable(*args), WALLY_EINVAL)
+        self.assertEqual(wally_psbt_outpoint_index_disable(None), WALLY_EINVAL)
+        wally_psbt_free(psbt)
+
+    def test_shared_utxos(self):
+        """Test that inputs spending the same tx share its utxo"""
+        def make_tx(n):
+            tx = pointer(wally_tx())
+            self.assertEqual(wally_tx_init_alloc(2, 0, 1, 2, tx), WALLY_OK)
+            self.assertEqual(wally_tx_add_raw_input(tx, bytes([n] * 32), 32, 0, 0xffffffff,
+                                                    None, 0, None, 0), WALLY_OK)
+            script = bytes([0x00, 0x14]) + bytes([n] * 20)
+            for i in range(2):
+                self.assertEqual(wally_tx_add_raw_output(tx, 1000 + i, script, len(script), 0),
+                                 WALLY_OK)
+            txid, txid_len = make_cbuffer('00' * 32)
+            self.assertEqual(wally_tx_get_txid(tx, txid, txid_len), WALLY_OK)
+            return tx, txid
+
+        def utxo_ptrs(psbt):
+            inputs = psbt.contents.inputs
+            return [cast(inputs[i].utxo, c_void_p).value for i in range(psbt.contents.num_inputs)]
+
+        tx_a, txid_a = make_tx(1)
+        tx_b, txid_b = make_tx(2)
+        psbt = pointer(wally_psbt())
+        self.assertEqual(wally_psbt_init_alloc(2, 0, 0, 0, 0, psbt), WALLY_OK)
+        for i, (txid, tx, vout) in enumerate([(txid_a, tx_a, 0), (txid_b, tx_b, 0),
+                                              (txid_a, tx_a, 1)]):
+            tx_in = pointer(wally_tx_input())
+            ret = wally_tx_input_init_alloc(txid, 32, vout, 0xffffffff, None, 0, None, tx_in)
+            self.assertEqual(ret, WALLY_OK)
+            self.assertEqual(wally_psbt_add_tx_input_at(psbt, i, 0, tx_in), WALLY_OK)
+            wally_tx_input_free(tx_in)
+            self.assertEqual(wally_psbt_set_input_utxo(psbt, i, tx), WALLY_OK)
+
+        def check_shared(psbt):
+            a0, b, a1 = utxo_ptrs(psbt)
+            self.assertEqual(a0, a1)
+            self.assertNotEqual(a0, b)
+
+        check_shared(psbt)
+        b64 = self.to_base64(psbt)
+        # Parsing and cloning share utxos
+        parsed = self.parse_base64(b64)
+        check_shared(parsed)
+        self.assertEqual(self.to_base64(parsed), b64)
+        clone = pointer(wally_psbt())
+        self.assertEqual(wally_psbt_clone_alloc(parsed, 0, clone), WALLY_OK)
+        check_shared(clone)
+        self.assertEqual(self.to_base64(clone), b64)
+        # Setting an input's utxo directly stops it being shared
+        inputs = clone.contents.inputs
+        self.assertEqual(wally_psbt_input_set_utxo(inputs[0], tx_a), WALLY_OK)
+        a0, _, a1 = utxo_ptrs(clone)
+        self.assertNotEqual(a0, a1)
+        self.assertEqual(self.to_base64(clone), b64)
+        # Removing or clearing inputs leaves the others' utxos intact
+        self.assertEqual(wally_psbt_remove_input(parsed, 0), WALLY_OK)
+        self.assertEqual(wally_psbt_set_input_utxo(psbt, 2, None), WALLY_OK)
+        txid, txid_len = make_cbuffer('00' * 32)
+        for p, i in [(psbt, 0), (parsed, 1)]:
+            utxo = pointer(wally_tx())
+            self.assertEqual(wally_psbt_get_input_utxo_alloc(p, i, utxo), WALLY_OK)
+            self.assertEqual(wally_tx_get_txid(utxo, txid, txid_len), WALLY_OK)
+            self.assertEqual(txid, txid_a)
+            wally_tx_free(utxo)
+        # The cached utxo txid is checked against the input's previous txid
+        script = bytes([0x51])
+        for p in [psbt, parsed, clone]:
+            for i in range(p.contents.num_inputs):
+                if p.contents.inputs[i].utxo:
+                    ret, _ = wally_psbt_get_input_scriptcode_len(p, i, script, 1)
+                    self.assertEqual(ret, WALLY_OK)
+        self.assertEqual(wally_psbt_set_input_utxo(clone, 0, tx_b), WALLY_OK)
+        ret, _ = wally_psbt_get_input_scriptcode_len(clone, 0, script, 1)
+        self.assertEqual(ret, WALLY_EINVAL)
+        for p in [psbt, parsed, clone]:
+            wally_psbt_free(p)
+
+        # Copies of a tx with the same txid but different serializations
+        # (here, with and without a witness) are not shared
+        tx_w = pointer(wally_tx())
+        self.assertEqual(wally_tx_clone_alloc(tx_a, 0, tx_w), WALLY_OK)
+        wit = pointer(wally_tx_witness_stack())
+        self.assertEqual(wally_tx_witness_stack_init_alloc(1, wit), WALLY_OK)
+        self.assertEqual(wally_tx_witness_stack_add(wit, b'\x01' * 72, 72), WALLY_OK)
+        self.assertEqual(wally_tx_set_input_witness(tx_w, 0, wit), WALLY_OK)
+        wally_tx_witness_stack_free(wit)
+        psbt = pointer(wally_psbt())
+        self.assertEqual(wally_psbt_init_alloc(2, 0, 0, 0, 0, psbt), WALLY_OK)
+        for i, tx in enumerate([tx_a, tx_w, tx_a]):
+            tx_in = pointer(wally_tx_input())
+            ret = wally_tx_input_init_alloc(txid_a, 32, i % 2, 0xffffffff, None, 0, None, tx_in)
+            self.assertEqual(ret, WALLY_OK)
+            self.assertEqual(wally_psbt_add_tx_input_at(psbt, i, 0, tx_in), WALLY_OK)
+            wally_tx_input_free(tx_in)
+            self.assertEqual(wally_psbt_set_input_utxo(psbt, i, tx), WALLY_OK)
+        # Serializing drops utxo witnesses, so build the PSBT bytes with
+        # the witness copy of the tx as input 1's utxo to test parsing
+        b64 = self.to_base64(psbt)
+        tx_hex = [wally_tx_to_hex(tx, 1)[1] for tx in [tx_a, tx_w]]
+        psbt_hex = base64.b64decode(b64).hex()
+        fields = ['%02x%s' % (len(h) // 2, h) for h in tx_hex]
+        parts = psbt_hex.split(fields[0])
+        self.assertEqual(len(parts), 4)
+        psbt_hex = parts[0] + fields[0] + parts[1] + fields[1] + parts[2] + fields[0] + parts[3]
+        parsed = self.parse_base64(base64.b64encode(bytes.fromhex(psbt_hex)).decode())
+        clone = pointer(wally_psbt())
+        self.assertEqual(wally_psbt_clone_alloc(parsed, 0, clone), WALLY_OK)
+        for p in [psbt, parsed, clone]:
+            a0, w, a1 = utxo_ptrs(p)
+            self.assertEqual(a0, a1)
+            self.assertNotEqual(a0, w)
+            self.assertEqual(self.to_base64(p), b64)
+            for i, expected in [(0, 0), (1, 1)]:
+                utxo = pointer(wally_tx())
+                self.assertEqual(wally_psbt_get_input_utxo_alloc(p, i, utxo), WALLY_OK)
+                self.assertEqual(wally_tx_get_witness_count(utxo), (WALLY_OK, expected))
+                wally_tx_free(utxo)
+            # Each copy's cached txid matches, with or without witnesses
+            for i in range(3):
+                ret, _ = wally_psbt_get_input_scriptcode_len(p, i, script, 1)
+                self.assertEqual(ret, WALLY_OK)
+            wally_psbt_free(p)
+        wally_tx_free(tx_w)
+        wally_tx_free(tx_a)
+        wally_tx_free(tx_b)
+
+    def test_patch(self):
+        """Test creating and applying PSBT patches"""
+        def get_patch(base, psbt, expected=WALLY_OK):
+            ret, patch_len = wally_psbt_get_patch_length(base, psbt, 0)
+            self.assertEqual(ret, expected)
+            if ret != WALLY_OK:
+                return None
+            patch, patch_len = make_cbuffer('00' * patch_len)
+            ret, written = wally_psbt_get_patch(base, psbt, 0, patch, patch_len)
+            self.assertEqual((ret, written), (WALLY_OK, patch_len))
+            return patch
+
+        def apply_patch(psbt, patch, expected=WALLY_OK):
+            self.assertEqual(wally_psbt_apply_patch(psbt, patch, len(patch), 0), expected)
+
+        for case in JSON['signer']:
+            base = self.parse_base64(case['psbt'])
+            signed = self.parse_base64(case['result'])
+            patch = get_patch(base, signed)
+            signed_len = wally_psbt_get_length(signed, 0)[1]
+            self.assertLess(len(patch), signed_len)
+            # Applying the patch is equivalent to combining
+            combined = self.parse_base64(case['psbt'])
+            self.assertEqual(wally_psbt_combine(combined, signed), WALLY_OK)
+            apply_patch(base, patch)
+            self.assertEqual(self.to_base64(base), self.to_base64(combined))
+            self.assertEqual(self.to_base64(base), case['result'])
+            # A reverse patch removes the added fields
+            unsigned = self.parse_base64(case['psbt'])
+            unsigned_b64 = self.to_base64(unsigned)
+            apply_patch(base, get_patch(signed, unsigned))
+            self.assertEqual(self.to_base64(base), unsigned_b64)
+            # A patch between identical PSBTs is empty, and a no-op
+            empty = get_patch(base, base)
+            self.assertEqual(len(empty), 40)
+            apply_patch(base, empty)
+            self.assertEqual(self.to_base64(base), unsigned_b64)
+            # Patches changing globals are applied
+            for p in [base, signed, combined]:
+                self.assertEqual(wally_psbt_set_version(p, 0, 2), WALLY_OK)
+            ret, mod_flags = wally_psbt_get_tx_modifiable_flags(signed)
+            self.assertEqual(ret, WALLY_OK)
+            self.assertEqual(wally_psbt_set_tx_modifiable_flags(signed, mod_flags | 1), WALLY_OK)
+            self.assertEqual(wally_psbt_combine(combined, signed), WALLY_OK)
+            apply_patch(base, get_patch(base, signed))
+            self.assertEqual(self.to_base64(base), self.to_base64(combined))
+            for p in [base, signed, combined, unsigned]:
+                wally_psbt_free(p)
+
+        # Invalid cases
+        base = self.parse_base64(JSON['signer'][0]['psbt'])
+        signed = self.parse_base64(JSON['signer'][0]['result'])
+        other = self.parse_base64(JSON['signer'][1]['psbt'])
+        b64 = self.to_base64(base)
+        patch = get_patch(base, signed)
+        get_patch(None, signed, WALLY_EINVAL)  # NULL base
+        get_patch(base, None, WALLY_EINVAL)    # NULL psbt
+        get_patch(base, other, WALLY_EINVAL)   # Different transactions
+        self.assertEqual(wally_psbt_get_patch_length(base, signed, 1)[0], WALLY_EINVAL) # Bad flags
+        for args in [(None, patch, len(patch), 0),        # NULL psbt
+                     (base, None, len(patch), 0),         # NULL patch
+                     (base, patch, 38, 0),                # Short patch
+                     (base, patch, len(patch) - 1, 0),    # Truncated patch
+                     (base, patch, len(patch), 1),        # Bad flags
+                     (other, patch, len(patch), 0),       # Different transaction
+                     (base, b'x' + patch[1:], len(patch), 0), # Bad magic
+                     (base, patch + b'\0', len(patch) + 1, 0)]: # Trailing data
+            self.assertEqual(wally_psbt_apply_patch(*args), WALLY_EINVAL)
+        self.assertEqual(self.to_base64(base), b64)
+        # A patch that changes the transaction is rejected, leaving the PSBT intact
+        self.assertEqual(wally_psbt_set_version(base, 0, 2), WALLY_OK)
+        b64 = self.to_base64(base)
+        id, id_len = make_cbuffer('00' * 32)
+        self.assertEqual(wally_psbt_get_id(base, 0, id, id_len), WALLY_OK)
+        output_section = 1 + base.contents.num_inputs + 1
+        patch = b'ptch\xff\x02\x00' + bytes(id) + bytes([output_section])
+        patch += b'\x01\x03\x09' + (1234).to_bytes(8, 'little') + b'\x00\x00'
+        apply_patch(base, patch, WALLY_EINVAL)
+        self.assertEqual(self.to_base64(base), b64)
+        for p in [base, signed, other]:
+            wally_psbt_free(p)
+
+    def test_finalize_miniscript(self):
+        """Test finalizing inputs spending miniscript witness/redeem scripts"""
+        MS_ONLY, FLAG_ECDSA, SCRIPT_SHA256 = 0x2, 0x1, 0x2
+        msg = bytes(range(32))
+        keys, sigs = [], []
+        for i in range(1, 4):
+            priv = bytes([i]) * 32
+            pub, pub_len = make_cbuffer('00' * 33)
+            self.assertEqual(wally_ec_public_key_from_private_key(priv, 32, pub, pub_len), WALLY_OK)
+            sig, sig_len = make_cbuffer('00' * 64)
+            self.assertEqual(wally_ec_sig_from_bytes(priv, 32, msg, 32, FLAG_ECDSA, sig, sig_len), WALLY_OK)
+            der, der_len = make_cbuffer('00' * 72)
+            ret, written = wally_ec_sig_to_der(sig, sig_len, der, der_len)
+            self.assertEqual(ret, WALLY_OK)
+            keys.append(bytes(pub))
+            sigs.append(bytes(der[:written]) + b'\x01')
+        A, B, C = keys
+        preimage = b'\x42' * 32
+        digest, digest_len = make_cbuffer('00' * 32)
+        self.assertEqual(wally_sha256(preimage, 32, digest, digest_len), WALLY_OK)
+
+        def compile_ms(ms):
+            for name, key in zip('ABC', keys):
+                ms = ms.replace(name + ')', key.hex() + ')').replace(name + ',', key.hex() + ',')
+            d = c_void_p()
+            self.assertEqual(wally_descriptor_parse(ms.replace('H', digest.hex()), None,
+                                                    0, MS_ONLY, d), WALLY_OK)
+            script, script_len = make_cbuffer('00' * 256)
+            ret, written = wally_descriptor_to_script(d, 0, 0, 0, 0, 0, 0, script, script_len)
+            self.assertEqual(ret, WALLY_OK)
+            wally_descriptor_free(d)
+            return bytes(script[:written])
+
+        def make_psbt(script, input_sigs, sequence=0xffffffff, legacy=False):
+            """Make a PSBT with an input spending script for each list in input_sigs"""
+            psbt = pointer(wally_psbt())
+            self.assertEqual(wally_psbt_init_alloc(2, 0, 0, 0, 0, psbt), WALLY_OK)
+            txid = bytes([0x11]) * 32
+            if legacy:
+                script_hash, hash_len = make_cbuffer('00' * 20)
+                self.assertEqual(wally_hash160(script, len(script), script_hash, hash_len), WALLY_OK)
+                spk = b'\xa9\x14' + bytes(script_hash) + b'\x87'
+                tx = pointer(wally_tx())
+                self.assertEqual(wally_tx_init_alloc(2, 0, 0, len(input_sigs), tx), WALLY_OK)
+                for i in range(len(input_sigs)):
+                    self.assertEqual(wally_tx_add_raw_output(tx, 1000, spk, len(spk), 0), WALLY_OK)
+                txid, txid_len = make_cbuffer('00' * 32)
+                self.assertEqual(wally_tx_get_txid(tx, txid, txid_len), WALLY_OK)
+            for i in range(len(input_sigs)):
+                tx_in = pointer(wally_tx_input())
+                ret = wally_tx_input_init_alloc(txid, 32, i, sequence, None, 0, None, tx_in)
+                self.assertEqual(ret, WALLY_OK)
+                self.assertEqual(wally_psbt_add_tx_input_at(psbt, i, 0, tx_in), WALLY_OK)
+                wally_tx_input_free(tx_in)
+            for i in range(len(input_sigs)):
+                if legacy:
+                    self.assertEqual(wally_psbt_set_input_utxo(psbt, i, tx), WALLY_OK)
+                    ret = wally_psbt_set_input_redeem_script(psbt, i, script, len(script))
+                else:
+                    spk, spk_len = make_cbuffer('00' * 34)
+                    ret, _ = wally_witness_program_from_bytes(script, len(script),
+                                                              SCRIPT_SHA256, spk, spk_len)
+                    self.assertEqual(ret, WALLY_OK)
+                    utxo = pointer(wally_tx_output())
+                    self.assertEqual(wally_tx_output_init_alloc(1000, spk, spk_len, utxo), WALLY_OK)
+                    self.assertEqual(wally_psbt_set_input_witness_utxo(psbt, i, utxo), WALLY_OK)
+                    wally_tx_output_free(utxo)
+                    ret = wally_psbt_set_input_witness_script(psbt, i, script, len(script))
+                self.assertEqual(ret, WALLY_OK)
+                for key, sig in input_sigs[i]:
+                    ret = wally_psbt_add_input_signature(psbt, i, key, 33, sig, len(sig))
+                    self.assertEqual(ret, WALLY_OK)
+            if legacy:
+                wally_tx_free(tx)
+            return psbt
+
+        def get_witness(psbt, i=0):
+            w = psbt.contents.inputs[i].final_witness
+            if not w:
+                return None
+            items = [w.contents.items[j] for j in range(w.contents.num_items)]
+            return [string_at(item.witness, item.len) if item.len else b'' for item in items]
+
+        # or_d: the cheapest available branch is used, subject to its timelock
+        script = compile_ms('or_d(pk(A),and_v(v:pk(B),older(10)))')
+        for input_sigs, sequence, expected in [
+            ([(A, sigs[0])], 0xffffffff, [sigs[0]]),
+            ([(B, sigs[1])], 10, [sigs[1], b'']),
+            ([(B, sigs[1])], 9, None),           # Relative timelock not met
+            ([(A, sigs[0]), (B, sigs[1])], 10, [sigs[0]])]:
+            psbt = make_psbt(script, [input_sigs], sequence)
+            self.assertEqual(wally_psbt_finalize_input(psbt, 0, 0), WALLY_OK)
+            self.assertEqual(get_witness(psbt), expected + [script] if expected else None)
+            wally_psbt_free(psbt)
+
+        # Hash preimages are taken from the input's preimages
+        script = compile_ms('and_v(v:pk(A),sha256(H))')
+        psbt = make_psbt(script, [[(A, sigs[0])]])
+        self.assertEqual(wally_psbt_finalize(psbt, 0), WALLY_OK)
+        self.assertIsNone(get_witness(psbt))
+        preimages = byref(psbt.contents.inputs[0].preimages)
+        self.assertEqual(wally_map_preimage_sha256_add(preimages, preimage, 32), WALLY_OK)
+        self.assertEqual(wally_psbt_finalize(psbt, 0), WALLY_OK)
+        self.assertEqual(get_witness(psbt), [preimage, sigs[0], script])
+        wally_psbt_free(psbt)
+
+        # thresh, and inputs sharing a script, including pkh() in a witness script
+        for ms, input_sigs, expected in [
+            ('thresh(2,pk(A),s:pk(B),s:pk(C))',
+             [[(A, sigs[0]), (C, sigs[2])], [(B, sigs[1]), (C, sigs[2])]],
+             [[sigs[2], b'', sigs[0]], [sigs[2], sigs[1], b'']]),
+            ('pkh(A)', [[(A, sigs[0])], []], [[sigs[0], A], None])]:
+            script = compile_ms(ms)
+            psbt = make_psbt(script, input_sigs)
+            self.assertEqual(wally_psbt_finalize(psbt, 0), WALLY_OK)
+            for i in range(2):
+                witness = expected[i] + [script] if expected[i] else None
+                self.assertEqual(get_witness(psbt, i), witness)
+                ret, script_sig_len = wally_psbt_get_input_final_scriptsig_len(psbt, i)
+                self.assertEqual((ret, script_sig_len), (WALLY_OK, 0))
+            wally_psbt_free(psbt)
+
+        # Legacy P2SH: the satisfaction is pushed in the scriptSig
+        script = compile_ms('and_v(v:pk(A),pk(B))')
+        psbt = make_psbt(script, [[(A, sigs[0]), (B, sigs[1])]], legacy=True)
+        self.assertEqual(wally_psbt_finalize(psbt, 0), WALLY_OK)
+        self.assertIsNone(get_witness(psbt))
+        expected = b''.join([bytes([len(sigs[1])]) + sigs[1], bytes([len(sigs[0])]) + sigs[0],
+                             bytes([len(script)]) + script])
+        script_sig, script_sig_len = make_cbuffer('00' * len(expected))
+        ret, written = wally_psbt_get_input_final_scriptsig(psbt, 0, script_sig, script_sig_len)
+        self.assertEqual((ret, bytes(script_sig[:written])), (WALLY_OK, expected))
+        wally_psbt_free(psbt)
+
+        # Scripts that are not miniscript are left unfinalized
+        for script in [bytes([0x6a]), compile_ms('pk(A)')[:-1] + bytes([0x87])]:
+            psbt = make_psbt(script, [[(A, sigs[0])]])
+            self.assertEqual(wally_psbt_finalize(psbt, 0), WALLY_OK)
+            self.assertIsNone(get_witness(psbt))
+            wally_psbt_free(psbt)
+
 if __name__ == '__main__':
     unittest.main()
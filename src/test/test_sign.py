@@ -450,6 +450,56 @@ class SignTests(unittest.TestCase):
 
         self.assertGreater(num_tests_run, 0)
 
+    def test_sign_batch(self):
+        """Test batch signing matches signing each message hash separately"""
+        priv_key, priv_key_len = make_cbuffer('11' * EC_PRIV_KEY_LEN)
+        num_msgs = 70 # Spans more than one internal chunk
+        msgs = bytes([i % 256 for i in range(num_msgs * 32)])
+        msgs, msgs_len = make_cbuffer(msgs.hex())
+        auxs, auxs_len = make_cbuffer(('ab' * 32) * num_msgs)
+
+        for flags, use_aux in [(FLAG_ECDSA, False),
+                               (FLAG_ECDSA | FLAG_GRIND_R, False),
+                               (FLAG_ECDSA | FLAG_RECOVERABLE, False),
+                               (FLAG_ECDSA, True),
+                               (FLAG_SCHNORR, False),
+                               (FLAG_SCHNORR, True)]:
+            aux, aux_len = (auxs, auxs_len) if use_aux else (None, 0)
+            ret, out_len = wally_ec_sig_from_bytes_batch_len(
+                priv_key, priv_key_len, msgs, msgs_len, aux, aux_len, flags)
+            sig_len = EC_SIGNATURE_RECOVERABLE_LEN if flags & FLAG_RECOVERABLE else EC_SIGNATURE_LEN
+            self.assertEqual((ret, out_len), (WALLY_OK, num_msgs * sig_len))
+            out, _ = make_cbuffer('00' * out_len)
+            ret = wally_ec_sig_from_bytes_batch(priv_key, priv_key_len, msgs, msgs_len,
+                                                aux, aux_len, flags, out, out_len)
+            self.assertEqual(ret, WALLY_OK)
+
+            sig, _ = make_cbuffer('00' * sig_len)
+            for i in range(num_msgs):
+                msg = msgs[i * 32:(i + 1) * 32]
+                a = aux[i * 32:(i + 1) * 32] if use_aux else None
+                ret = self.sign(priv_key, msg, flags, sig, None, a)
+                self.assertEqual(ret, WALLY_OK)
+                self.assertEqual(out[i * sig_len:(i + 1) * sig_len], sig)
+
+        out, out_len = make_cbuffer('00' * num_msgs * EC_SIGNATURE_LEN)
+        bad_key, _ = make_cbuffer('00' * EC_PRIV_KEY_LEN)
+        for args in [
+            (None,     priv_key_len,   msgs, msgs_len,      None, 0,             FLAG_ECDSA,   out,  out_len),     # Null priv_key
+            (priv_key, priv_key_len-1, msgs, msgs_len,      None, 0,             FLAG_ECDSA,   out,  out_len),     # Bad priv_key len
+            (bad_key,  priv_key_len,   msgs, msgs_len,      None, 0,             FLAG_ECDSA,   out,  out_len),     # Invalid priv_key
+            (bad_key,  priv_key_len,   msgs, msgs_len,      None, 0,             FLAG_SCHNORR, out,  out_len),     # Invalid priv_key
+            (priv_key, priv_key_len,   None, msgs_len,      None, 0,             FLAG_ECDSA,   out,  out_len),     # Null bytes
+            (priv_key, priv_key_len,   msgs, 0,             None, 0,             FLAG_ECDSA,   out,  0),           # Empty bytes
+            (priv_key, priv_key_len,   msgs, msgs_len-1,    None, 0,             FLAG_ECDSA,   out,  out_len),     # Bad bytes len
+            (priv_key, priv_key_len,   msgs, msgs_len,      auxs, auxs_len-32,   FLAG_ECDSA,   out,  out_len),     # Bad aux_rand len
+            (priv_key, priv_key_len,   msgs, msgs_len,      auxs, auxs_len,      FLAG_ECDSA | FLAG_GRIND_R, out, out_len), # aux_rand with grinding
+            (priv_key, priv_key_len,   msgs, msgs_len,      None, 0,             FLAG_SCHNORR | FLAG_RECOVERABLE, out, out_len), # Bad flags
+            (priv_key, priv_key_len,   msgs, msgs_len,      None, 0,             FLAG_ECDSA,   None, out_len),     # Null output
+            (priv_key, priv_key_len,   msgs, msgs_len,      None, 0,             FLAG_ECDSA,   out,  out_len-1),   # Bad output len
+            ]:
+            self.assertEqual(wally_ec_sig_from_bytes_batch(*args), WALLY_EINVAL)
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -567,6 +567,7 @@ class TransactionTests(unittest.TestCase):
             [(10, fake_annex_len)],  # NULL annex
             [(9,  bad_annex), (10, bad_annex_len)], # Missing 0x50 annex prefix
             [(11, 0xffffffff)],      # Invalid sighash
+            [(1,  3), (11, 0x3)],   # SIGHASH_SINGLE without a matching output
             [(12, 0x1)],             # Unknown flag(s)
             [(13, None)],            # NULL output
             [(14, 0)],               # Zero length output
@@ -690,6 +691,97 @@ class TransactionTests(unittest.TestCase):
             ret = wally_tx_get_input_signature_hash(*args)
             self.assertEqual(ret, WALLY_EINVAL)
 
+    def test_get_txids_batch(self):
+        """Tests for computing the txids of a batch of transactions"""
+        txs = [TX_HEX, TX_WITNESS_HEX, TX_FAKE_HEX]
+        expected = ''
+        for tx_hex in txs:
+            tx = self.tx_deserialize_hex(tx_hex)
+            txid, txid_len = make_cbuffer('00' * 32)
+            self.assertEqual(wally_tx_get_txid(tx, txid, txid_len), WALLY_OK)
+            expected += h(txid).decode('utf-8')
+
+        tx_bytes, tx_bytes_len = make_cbuffer(''.join([t.decode('utf-8') for t in txs]))
+        out, out_len = make_cbuffer('00' * 32 * len(txs))
+        ret, written = wally_tx_get_txids_batch(tx_bytes, tx_bytes_len, 0, out, out_len)
+        self.assertEqual((ret, written), (WALLY_OK, out_len))
+        self.assertEqual(h(out).decode('utf-8'), expected)
+
+        # A too-short output returns the required length
+        ret, written = wally_tx_get_txids_batch(tx_bytes, tx_bytes_len, 0, out, 32)
+        self.assertEqual((ret, written), (WALLY_OK, out_len))
+
+        for args in [(None,     tx_bytes_len,     0,    out,  out_len), # NULL input
+                     (tx_bytes, 0,                0,    out,  out_len), # Empty input
+                     (tx_bytes, tx_bytes_len - 1, 0,    out,  out_len), # Truncated tx
+                     (tx_bytes, tx_bytes_len,     0xff, out,  out_len), # Unknown flags
+                     (tx_bytes, tx_bytes_len,     0,    None, out_len), # NULL output
+                     (tx_bytes, tx_bytes_len,     0,    out,  0)]:      # Empty output
+            self.assertEqual(wally_tx_get_txids_batch(*args), (WALLY_EINVAL, 0))
+
+    def test_get_input_signature_hash_batch(self):
+        """Tests for computing the signature hashes of every input"""
+        keyspend_case = JSON['keyPathSpending'][0]
+        utxos = keyspend_case['given']['utxosSpent']
+        tx = self.tx_deserialize_hex(keyspend_case['given']['rawUnsignedTx'])
+
+        def make_map(items):
+            m = pointer(wally_map())
+            wally_map_init_alloc(len(items), None, m)
+            for i, v in enumerate(items):
+                buf, buf_len = make_cbuffer(v)
+                wally_map_add_integer(m, i, buf, buf_len)
+            return m
+
+        values = make_map([bytes(c_uint64(int(u['amountSats']))).hex() for u in utxos])
+        # Taproot signing requires every input to be taproot
+        fake_p2tr = '5120' + '22' * 32
+        tr_scripts = make_map([u['scriptPubKey'] if u['scriptPubKey'].startswith('5120')
+                               else fake_p2tr for u in utxos])
+        p2wpkh = '0014' + '11' * 20
+        p2pkh = '76a914' + '11' * 20 + '88ac'
+        wpkh_scripts = make_map([p2wpkh] * len(utxos))
+        pkh_scripts = make_map([p2pkh] * len(utxos))
+        out, out_len = make_cbuffer('00' * 32 * len(utxos))
+        sighash_out, sighash_out_len = make_cbuffer('00' * 32)
+
+        for flags, scripts, script in [
+                (SIGTYPE_SW_V1,  tr_scripts,   None),
+                (SIGTYPE_SW_V0,  wpkh_scripts, p2pkh), # P2WPKH converted to scriptCode
+                (SIGTYPE_SW_V0,  pkh_scripts,  p2pkh),
+                (SIGTYPE_PRE_SW, pkh_scripts,  p2pkh)]:
+            sighash = 0 if flags == SIGTYPE_SW_V1 else 1
+            script, script_len = make_cbuffer(script) if script else (None, 0)
+            for cache in [None, make_map([])]:
+                args = [tx, scripts, None, values, None, 0, sighash, flags, cache,
+                        out, out_len]
+                self.assertEqual(wally_tx_get_input_signature_hash_batch(*args), WALLY_OK)
+                for i in range(len(utxos)):
+                    args = [tx, i, scripts, None, values, script, script_len, 0,
+                            0xffffffff, None, 0, None, 0, sighash, flags, None,
+                            sighash_out, sighash_out_len]
+                    self.assertEqual(wally_tx_get_input_signature_hash(*args), WALLY_OK)
+                    self.assertEqual(out[i * 32:(i + 1) * 32], sighash_out[:])
+
+        empty_map = make_map([])
+        invalid_cases = [
+            [(0,  None)],               # NULL tx
+            [(1,  None)],               # NULL scripts
+            [(1,  empty_map)],          # Missing scripts
+            [(3,  None)],               # NULL values
+            [(6,  0xffffffff)],         # Invalid sighash
+            [(7,  0xff)],               # Unknown flag(s)
+            [(9,  None)],               # NULL output
+            [(10, out_len - 1)],        # Incorrect length output
+        ]
+        for case in invalid_cases:
+            args = [tx, tr_scripts, None, values, None, 0, 0, SIGTYPE_SW_V1, None,
+                    out, out_len]
+            for i, arg in case:
+                args[i] = arg
+            ret = wally_tx_get_input_signature_hash_batch(*args)
+            self.assertEqual(ret, WALLY_EINVAL)
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -49,6 +49,27 @@ class WordlistTests(unittest.TestCase):
 
             wl.free()
 
+    @internal_only()
+    def test_builtin_wordlists(self):
+        """Test the perfect hash lookup of the built-in wordlists"""
+        langs = { 'en': 'english', 'es': 'spanish', 'fr': 'french',
+                  'it': 'italian', 'jp': 'japanese', 'zhs': 'chinese_simplified',
+                  'zht': 'chinese_traditional' }
+        for lang, name in langs.items():
+            wl = c_void_p()
+            self.assertEqual(bip39_get_wordlist(utf8(lang), byref(wl)), WALLY_OK)
+            words, _ = load_words(name)
+            encoded = set([utf8(w) for w in words])
+            for idx, word in enumerate(words):
+                w = utf8(word)
+                self.assertEqual(wordlist_lookup_word(wl, w), idx + 1)
+                self.assertEqual(wordlist_lookup_index(wl, idx), w)
+                # Prefixes, extensions and empty words are not found
+                for bad in [w[:-1], w + b'a', w + w]:
+                    if bad not in encoded:
+                        self.assertEqual(wordlist_lookup_word(wl, bad), 0)
+            self.assertEqual(wordlist_lookup_word(wl, b''), 0)
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -26,6 +26,8 @@ _free_fn_t = CFUNCTYPE(c_void_p)
 _bzero_fn_t = CFUNCTYPE(c_void_p, c_size_t)
 _ec_nonce_fn_t = CFUNCTYPE(c_int, c_void_p, c_void_p, c_void_p, c_void_p, c_void_p, c_uint)
 _secp_context_fn_t = CFUNCTYPE(c_void_p)
+_task_fn_t = CFUNCTYPE(None, c_void_p, c_size_t)
+_executor_fn_t = CFUNCTYPE(None, _task_fn_t, c_void_p, c_size_t, c_void_p)
 
 class wally_operations(Structure):
     _fields_ = [('struct_size', c_size_t),
@@ -36,8 +38,22 @@ class wally_operations(Structure):
                 ('secp_context_fn', _secp_context_fn_t),
                 ('reserved_1', c_void_p),
                 ('reserved_2', c_void_p),
-                ('reserved_3', c_void_p),
-                ('reserved_4', c_void_p)]
+                ('executor_fn', _executor_fn_t),
+                ('executor_ctx', c_void_p)]
+
+class wally_pool_stats(Structure):
+    _fields_ = [('num_allocs', c_uint64),
+                ('num_hits', c_uint64),
+                ('num_frees', c_uint64),
+                ('num_cached', c_uint64),
+                ('cached_bytes', c_uint64)]
+
+class wally_stats(Structure):
+    _fields_ = [('num_calls', c_uint64),
+                ('ticks', c_uint64),
+                ('num_allocs', c_uint64),
+                ('alloc_bytes', c_uint64),
+                ('num_frees', c_uint64)]
 
 class ext_key(Structure):
     _fields_ = [('chain_code', c_ubyte * 32),
@@ -195,7 +211,8 @@ class wally_psbt(Structure):
                 ('global_scalars', wally_map),
                 ('pset_modifiable_flags', c_uint32),
                 ('genesis_blockhash', c_ubyte * 32),
-                ('signing_cache', POINTER(wally_map))]
+                ('signing_cache', POINTER(wally_map)),
+                ('outpoint_index', c_void_p)]
 
 for f in (
     # Internal functions
@@ -257,14 +274,19 @@ for f in (
     ('bip39_mnemonic_to_seed', c_int, [c_char_p, c_char_p, c_void_p, c_size_t, c_size_t_p]),
     ('bip39_mnemonic_to_seed512', c_int, [c_char_p, c_char_p, c_void_p, c_size_t]),
     ('bip39_mnemonic_validate', c_int, [c_void_p, c_char_p]),
+    ('bip39_mnemonics_validate_batch', c_int, [c_char_p, c_uint32, c_void_p, c_size_t]),
     ('bip85_get_bip39_entropy', c_int, [POINTER(ext_key), c_char_p, c_uint32, c_uint32, c_void_p, c_size_t, c_size_t_p]),
     ('bip85_get_languages', c_int, [c_char_p_p]),
     ('bip85_get_rsa_entropy', c_int, [POINTER(ext_key), c_uint32, c_uint32, c_void_p, c_size_t, c_size_t_p]),
     ('wally_addr_segwit_from_bytes', c_int, [c_void_p, c_size_t, c_char_p, c_uint32, c_char_p_p]),
+    ('wally_addr_segwit_from_bytes_batch', c_int, [c_void_p, c_size_t, c_char_p, c_uint32, c_char_p, c_size_t, c_size_t_p]),
+    ('wally_addr_segwit_from_bytes_into', c_int, [c_void_p, c_size_t, c_char_p, c_uint32, c_char_p, c_size_t, c_size_t_p]),
     ('wally_addr_segwit_get_version', c_int, [c_char_p, c_char_p, c_uint32, c_size_t_p]),
     ('wally_addr_segwit_n_get_version', c_int, [c_char_p, c_size_t, c_char_p, c_size_t, c_uint32, c_size_t_p]),
     ('wally_addr_segwit_n_to_bytes', c_int, [c_char_p, c_size_t, c_char_p, c_size_t, c_uint32, c_void_p, c_size_t, c_size_t_p]),
     ('wally_addr_segwit_to_bytes', c_int, [c_char_p, c_char_p, c_uint32, c_void_p, c_size_t, c_size_t_p]),
+    ('wally_addr_segwit_to_bytes_batch', c_int, [c_char_p, c_size_t, c_char_p, c_uint32, c_void_p, c_size_t, c_size_t_p]),
+    ('wally_addr_segwit_verify_batch', c_int, [c_char_p, c_size_t, c_char_p, c_uint32, c_void_p, c_size_t]),
     ('wally_address_to_scriptpubkey', c_int, [c_char_p, c_uint32, c_void_p, c_size_t, c_size_t_p]),
     ('wally_ae_host_commit_from_bytes', c_int, [c_void_p, c_size_t, c_uint32, c_void_p, c_size_t]),
     ('wally_ae_sig_from_bytes', c_int, [c_void_p, c_size_t, c_void_p, c_size_t, c_void_p, c_size_t, c_uint32, c_void_p, c_size_t]),
@@ -297,6 +319,7 @@ for f in (
     ('wally_asset_unblind_with_nonce', c_int, [c_void_p, c_size_t, c_void_p, c_size_t, c_void_p, c_size_t, c_void_p, c_size_t, c_void_p, c_size_t, c_void_p, c_size_t, c_void_p, c_size_t, c_void_p, c_size_t, c_uint64_p]),
     ('wally_asset_value_commitment', c_int, [c_uint64, c_void_p, c_size_t, c_void_p, c_size_t, c_void_p, c_size_t]),
     ('wally_base58_from_bytes', c_int, [c_void_p, c_size_t, c_uint32, c_char_p_p]),
+    ('wally_base58_from_bytes_into', c_int, [c_void_p, c_size_t, c_uint32, c_char_p, c_size_t, c_size_t_p]),
     ('wally_base58_get_length', c_int, [c_char_p, c_size_t_p]),
     ('wally_base58_n_get_length', c_int, [c_char_p, c_size_t, c_size_t_p]),
     ('wally_base58_n_to_bytes', c_int, [c_char_p, c_size_t, c_uint32, c_void_p, c_size_t, c_size_t_p]),
@@ -307,11 +330,16 @@ for f in (
     ('wally_base64_n_to_bytes', c_int, [c_char_p, c_size_t, c_uint32, c_void_p, c_size_t, c_size_t_p]),
     ('wally_base64_to_bytes', c_int, [c_char_p, c_uint32, c_void_p, c_size_t, c_size_t_p]),
     ('wally_bip32_key_to_addr_segwit', c_int, [POINTER(ext_key), c_char_p, c_uint32, c_char_p_p]),
+    ('wally_bip32_key_to_addr_segwit_into', c_int, [POINTER(ext_key), c_char_p, c_uint32, c_char_p, c_size_t, c_size_t_p]),
     ('wally_bip32_key_to_address', c_int, [POINTER(ext_key), c_uint32, c_uint32, c_char_p_p]),
+    ('wally_bip32_key_to_address_into', c_int, [POINTER(ext_key), c_uint32, c_uint32, c_char_p, c_size_t, c_size_t_p]),
     ('wally_bip340_tagged_hash', c_int, [c_void_p, c_size_t, c_char_p, c_void_p, c_size_t]),
+    ('wally_bip352_scan', c_int, [c_void_p, c_size_t, c_void_p, c_size_t, c_void_p, c_size_t, c_void_p, c_size_t, POINTER(c_uint32), c_size_t, c_void_p, c_size_t, POINTER(c_uint32), c_size_t, c_uint32, c_void_p, c_size_t, c_size_t_p]),
     ('wally_bzero', c_int, [c_void_p, c_size_t]),
     ('wally_cleanup', c_int, [c_uint32]),
+    ('wally_coinselect', c_int, [POINTER(c_uint64), c_size_t, POINTER(c_uint32), c_size_t, c_uint64, c_uint64, c_uint64, c_uint64, c_uint64, c_uint32, POINTER(c_uint32), c_size_t, c_size_t_p]),
     ('wally_coinselect_assets', c_int, [POINTER(c_uint64), c_size_t, c_uint64, c_uint64, c_uint32, POINTER(c_uint32), c_size_t, c_size_t_p]),
+    ('wally_coinselect_assets_split', c_int, [POINTER(c_uint64), c_size_t, c_uint64, c_uint64, c_uint32, c_uint32, POINTER(c_uint32), c_size_t, c_size_t_p]),
     ('wally_confidential_addr_from_addr', c_int, [c_char_p, c_uint32, c_void_p, c_size_t, c_char_p_p]),
     ('wally_confidential_addr_from_addr_segwit', c_int, [c_char_p, c_char_p, c_char_p, c_void_p, c_size_t, c_char_p_p]),
     ('wally_confidential_addr_segwit_to_ec_public_key', c_int, [c_char_p, c_char_p, c_void_p, c_size_t]),
@@ -338,6 +366,7 @@ for f in (
     ('wally_descriptor_set_network', c_int, [c_void_p, c_uint32]),
     ('wally_descriptor_to_address', c_int, [c_void_p, c_uint32, c_uint32, c_uint32, c_uint32, c_char_p_p]),
     ('wally_descriptor_to_addresses', c_int, [c_void_p, c_uint32, c_uint32, c_uint32, c_uint32, POINTER(c_char_p), c_size_t]),
+    ('wally_descriptor_to_addresses_into', c_int, [c_void_p, c_uint32, c_uint32, c_uint32, c_uint32, c_char_p, c_size_t]),
     ('wally_descriptor_to_script', c_int, [c_void_p, c_uint32, c_uint32, c_uint32, c_uint32, c_uint32, c_uint32, c_void_p, c_size_t, c_size_t_p]),
     ('wally_descriptor_to_script_get_maximum_length', c_int, [c_void_p, c_uint32, c_uint32, c_uint32, c_uint32, c_uint32, c_uint32, c_size_t_p]),
     ('wally_ec_private_key_bip341_tweak', c_int, [c_void_p, c_size_t, c_void_p, c_size_t, c_uint32, c_void_p, c_size_t]),
@@ -357,6 +386,8 @@ for f in (
     ('wally_ec_sig_from_bytes', c_int, [c_void_p, c_size_t, c_void_p, c_size_t, c_uint32, c_void_p, c_size_t]),
     ('wally_ec_sig_from_bytes_aux', c_int, [c_void_p, c_size_t, c_void_p, c_size_t, c_void_p, c_size_t, c_uint32, c_void_p, c_size_t]),
     ('wally_ec_sig_from_bytes_aux_len', c_int, [c_void_p, c_size_t, c_void_p, c_size_t, c_void_p, c_size_t, c_uint32, c_size_t_p]),
+    ('wally_ec_sig_from_bytes_batch', c_int, [c_void_p, c_size_t, c_void_p, c_size_t, c_void_p, c_size_t, c_uint32, c_void_p, c_size_t]),
+    ('wally_ec_sig_from_bytes_batch_len', c_int, [c_void_p, c_size_t, c_void_p, c_size_t, c_void_p, c_size_t, c_uint32, c_size_t_p]),
     ('wally_ec_sig_from_bytes_len', c_int, [c_void_p, c_size_t, c_void_p, c_size_t, c_uint32, c_size_t_p]),
     ('wally_ec_sig_from_der', c_int, [c_void_p, c_size_t, c_void_p, c_size_t]),
     ('wally_ec_sig_normalize', c_int, [c_void_p, c_size_t, c_void_p, c_size_t]),
@@ -378,7 +409,9 @@ for f in (
     ('wally_get_build_version', c_int, [c_uint32_p]),
     ('wally_get_hash_prevouts', c_int, [c_void_p, c_size_t, POINTER(c_uint32), c_size_t, c_void_p, c_size_t]),
     ('wally_get_operations', c_int, [POINTER(wally_operations)]),
+    ('wally_get_stats', c_int, [c_uint32, POINTER(wally_stats), c_size_t]),
     ('wally_hash160', c_int, [c_void_p, c_size_t, c_void_p, c_size_t]),
+    ('wally_hash160_batch', c_int, [c_void_p, c_size_t, c_size_t, c_void_p, c_size_t]),
     ('wally_hex_from_bytes', c_int, [c_void_p, c_size_t, c_char_p_p]),
     ('wally_hex_n_to_bytes', c_int, [c_char_p, c_size_t, c_void_p, c_size_t, c_size_t_p]),
     ('wally_hex_n_verify', c_int, [c_char_p, c_size_t]),
@@ -436,6 +469,7 @@ for f in (
     ('wally_merkle_path_xonly_public_key_verify', c_int, [c_void_p, c_size_t, c_void_p, c_size_t]),
     ('wally_pbkdf2_hmac_sha256', c_int, [c_void_p, c_size_t, c_void_p, c_size_t, c_uint32, c_uint32, c_void_p, c_size_t]),
     ('wally_pbkdf2_hmac_sha512', c_int, [c_void_p, c_size_t, c_void_p, c_size_t, c_uint32, c_uint32, c_void_p, c_size_t]),
+    ('wally_pool_get_stats', c_int, [POINTER(wally_pool_stats)]),
     ('wally_psbt_add_global_scalar', c_int, [POINTER(wally_psbt), c_void_p, c_size_t]),
     ('wally_psbt_add_input_keypath', c_int, [POINTER(wally_psbt), c_uint32, c_void_p, c_size_t, c_void_p, c_size_t, POINTER(c_uint32), c_size_t]),
     ('wally_psbt_add_input_taproot_keypath', c_int, [POINTER(wally_psbt), c_uint32, c_uint32, c_void_p, c_size_t, c_void_p, c_size_t, c_void_p, c_size_t, POINTER(c_uint32), c_size_t]),
@@ -443,6 +477,7 @@ for f in (
     ('wally_psbt_add_output_taproot_keypath', c_int, [POINTER(wally_psbt), c_uint32, c_uint32, c_void_p, c_size_t, c_void_p, c_size_t, c_void_p, c_size_t, POINTER(c_uint32), c_size_t]),
     ('wally_psbt_add_tx_input_at', c_int, [POINTER(wally_psbt), c_uint32, c_uint32, POINTER(wally_tx_input)]),
     ('wally_psbt_add_tx_output_at', c_int, [POINTER(wally_psbt), c_uint32, c_uint32, POINTER(wally_tx_output)]),
+    ('wally_psbt_apply_patch', c_int, [POINTER(wally_psbt), c_void_p, c_size_t, c_uint32]),
     ('wally_psbt_blind', c_int, [POINTER(wally_psbt), POINTER(wally_map), POINTER(wally_map), POINTER(wally_map), POINTER(wally_map), c_void_p, c_size_t, c_uint32, c_uint32, POINTER(wally_map)]),
     ('wally_psbt_blind_alloc', c_int, [POINTER(wally_psbt), POINTER(wally_map), POINTER(wally_map), POINTER(wally_map), POINTER(wally_map), c_void_p, c_size_t, c_uint32, c_uint32, POINTER(POINTER(wally_map))]),
     ('wally_psbt_clear_fallback_locktime', c_int, [POINTER(wally_psbt)]),
@@ -454,6 +489,7 @@ for f in (
     ('wally_psbt_finalize_input', c_int, [POINTER(wally_psbt), c_size_t, c_uint32]),
     ('wally_psbt_find_global_scalar', c_int, [POINTER(wally_psbt), c_void_p, c_size_t, c_size_t_p]),
     ('wally_psbt_find_input_spending_utxo', c_int, [POINTER(wally_psbt), c_void_p, c_size_t, c_uint32, c_size_t_p]),
+    ('wally_psbt_find_inputs_spending_utxos', c_int, [POINTER(wally_psbt), c_void_p, c_size_t, POINTER(c_uint32), c_size_t, POINTER(c_uint32), c_size_t, c_size_t_p]),
     ('wally_psbt_free', c_int, [POINTER(wally_psbt)]),
     ('wally_psbt_from_base64', c_int, [c_char_p, c_uint32, POINTER(POINTER(wally_psbt))]),
     ('wally_psbt_from_base64_n', c_int, [c_char_p, c_size_t, c_uint32, POINTER(POINTER(wally_psbt))]),
@@ -469,6 +505,8 @@ for f in (
     ('wally_psbt_get_input_signing_script_len', c_int, [POINTER(wally_psbt), c_size_t, c_size_t_p]),
     ('wally_psbt_get_length', c_int, [POINTER(wally_psbt), c_uint32, c_size_t_p]),
     ('wally_psbt_get_locktime', c_int, [POINTER(wally_psbt), c_size_t_p]),
+    ('wally_psbt_get_patch', c_int, [POINTER(wally_psbt), POINTER(wally_psbt), c_uint32, c_void_p, c_size_t, c_size_t_p]),
+    ('wally_psbt_get_patch_length', c_int, [POINTER(wally_psbt), POINTER(wally_psbt), c_uint32, c_size_t_p]),
     ('wally_psbt_get_tx_version', c_int, [POINTER(wally_psbt), c_size_t_p]),
     ('wally_psbt_has_global_genesis_blockhash', c_int, [POINTER(wally_psbt), c_size_t_p]),
     ('wally_psbt_init_alloc', c_int, [c_uint32, c_size_t, c_size_t, c_size_t, c_uint32, POINTER(POINTER(wally_psbt))]),
@@ -570,6 +608,8 @@ for f in (
     ('wally_psbt_is_elements', c_int, [POINTER(wally_psbt), c_size_t_p]),
     ('wally_psbt_is_finalized', c_int, [POINTER(wally_psbt), c_size_t_p]),
     ('wally_psbt_is_input_finalized', c_int, [POINTER(wally_psbt), c_size_t, c_size_t_p]),
+    ('wally_psbt_outpoint_index_disable', c_int, [POINTER(wally_psbt)]),
+    ('wally_psbt_outpoint_index_enable', c_int, [POINTER(wally_psbt), c_uint32]),
     ('wally_psbt_output_clear_amount', c_int, [POINTER(wally_psbt_output)]),
     ('wally_psbt_output_clear_asset', c_int, [POINTER(wally_psbt_output)]),
     ('wally_psbt_output_clear_asset_blinding_surjectionproof', c_int, [POINTER(wally_psbt_output)]),
@@ -652,11 +692,15 @@ for f in (
     ('wally_scriptpubkey_p2sh_from_bytes', c_int, [c_void_p, c_size_t, c_uint32, c_void_p, c_size_t, c_size_t_p]),
     ('wally_scriptpubkey_p2tr_from_bytes', c_int, [c_void_p, c_size_t, c_uint32, c_void_p, c_size_t, c_size_t_p]),
     ('wally_scriptpubkey_to_address', c_int, [c_void_p, c_size_t, c_uint32, c_char_p_p]),
+    ('wally_scriptpubkey_to_address_into', c_int, [c_void_p, c_size_t, c_uint32, c_char_p, c_size_t, c_size_t_p]),
     ('wally_scriptsig_multisig_from_bytes', c_int, [c_void_p, c_size_t, c_void_p, c_size_t, POINTER(c_uint32), c_size_t, c_uint32, c_void_p, c_size_t, c_size_t_p]),
     ('wally_scriptsig_p2pkh_from_der', c_int, [c_void_p, c_size_t, c_void_p, c_size_t, c_void_p, c_size_t, c_size_t_p]),
     ('wally_scriptsig_p2pkh_from_sig', c_int, [c_void_p, c_size_t, c_void_p, c_size_t, c_uint32, c_void_p, c_size_t, c_size_t_p]),
     ('wally_scrypt', c_int, [c_void_p, c_size_t, c_void_p, c_size_t, c_uint32, c_uint32, c_uint32, c_void_p, c_size_t]),
     ('wally_secp_randomize', c_int, [c_void_p, c_size_t]),
+    ('wally_secure_arena_free', c_int, [c_uint32]),
+    ('wally_secure_arena_init', c_int, [c_size_t, c_uint32]),
+    ('wally_secure_arena_reset', c_int, [c_uint32, c_size_t_p]),
     ('wally_set_operations', c_int, [POINTER(wally_operations)]),
     ('wally_sha256', c_int, [c_void_p, c_size_t, c_void_p, c_size_t]),
     ('wally_sha256_midstate', c_int, [c_void_p, c_size_t, c_void_p, c_size_t]),
@@ -699,10 +743,12 @@ for f in (
     ('wally_tx_get_elements_weight_discount', c_int, [POINTER(wally_tx), c_uint32, c_size_t_p]),
     ('wally_tx_get_hash_prevouts', c_int, [POINTER(wally_tx), c_size_t, c_size_t, c_void_p, c_size_t]),
     ('wally_tx_get_input_signature_hash', c_int, [POINTER(wally_tx), c_size_t, POINTER(wally_map), POINTER(wally_map), POINTER(wally_map), c_void_p, c_size_t, c_uint32, c_uint32, c_void_p, c_size_t, c_void_p, c_size_t, c_uint32, c_uint32, POINTER(wally_map), c_void_p, c_size_t]),
+    ('wally_tx_get_input_signature_hash_batch', c_int, [POINTER(wally_tx), POINTER(wally_map), POINTER(wally_map), POINTER(wally_map), c_void_p, c_size_t, c_uint32, c_uint32, POINTER(wally_map), c_void_p, c_size_t]),
     ('wally_tx_get_length', c_int, [POINTER(wally_tx), c_uint32, c_size_t_p]),
     ('wally_tx_get_signature_hash', c_int, [POINTER(wally_tx), c_size_t, c_void_p, c_size_t, c_void_p, c_size_t, c_uint32, c_uint64, c_uint32, c_uint32, c_uint32, c_void_p, c_size_t]),
     ('wally_tx_get_total_output_satoshi', c_int, [POINTER(wally_tx), c_uint64_p]),
     ('wally_tx_get_txid', c_int, [POINTER(wally_tx), c_void_p, c_size_t]),
+    ('wally_tx_get_txids_batch', c_int, [c_void_p, c_size_t, c_uint32, c_void_p, c_size_t, c_size_t_p]),
     ('wally_tx_get_vsize', c_int, [POINTER(wally_tx), c_size_t_p]),
     ('wally_tx_get_weight', c_int, [POINTER(wally_tx), c_size_t_p]),
     ('wally_tx_get_witness_count', c_int, [POINTER(wally_tx), c_size_t_p]),
@@ -1,6 +1,7 @@
 #include "internal.h"
 
 #include "ccan/ccan/build_assert/build_assert.h"
+#include "ccan/ccan/crypto/sha256/sha256.h"
 
 #include <include/wally_crypto.h>
 #include <include/wally_transaction.h>
@@ -181,12 +182,12 @@ static int tx_witness_stack_free(struct wally_tx_witness_stack *stack,
         if (stack->items) {
             for (i = 0; i < stack->num_items; ++i) {
                 if (stack->items[i].witness)
-                    clear_and_free(stack->items[i].witness,
-                                   stack->items[i].witness_len);
+                    free_public(stack->items[i].witness,
+                                stack->items[i].witness_len);
             }
-            clear_and_free(stack->items, stack->num_items * sizeof(*stack->items));
+            free_public(stack->items, stack->num_items * sizeof(*stack->items));
         }
-        wally_clear(stack, sizeof(*stack));
+        clear_public(stack, sizeof(*stack));
         if (free_parent)
             wally_free(stack);
     }
@@ -542,10 +543,10 @@ int wally_tx_elements_input_issuance_free(
 #ifdef BUILD_ELEMENTS
     if (input) {
         input->features &= ~(WALLY_TX_IS_ELEMENTS | WALLY_TX_IS_ISSUANCE);
-        wally_clear(input->blinding_nonce, sizeof(input->blinding_nonce));
-        wally_clear(input->entropy, sizeof(input->entropy));
+        clear_public(input->blinding_nonce, sizeof(input->blinding_nonce));
+        clear_public(input->entropy, sizeof(input->entropy));
 
-#define FREE_PTR_AND_LEN(name) clear_and_free(input->name, input->name ## _len); \
+#define FREE_PTR_AND_LEN(name) free_public(input->name, input->name ## _len); \
     input->name = NULL; input->name ## _len = 0
 
         FREE_PTR_AND_LEN(issuance_amount);
@@ -739,10 +740,10 @@ int wally_tx_input_init_alloc(const unsigned char *txhash, size_t txhash_len,
 static int tx_input_free(struct wally_tx_input *input, bool free_parent)
 {
     if (input) {
-        clear_and_free(input->script, input->script_len);
+        free_public(input->script, input->script_len);
         tx_witness_stack_free(input->witness, true);
         wally_tx_elements_input_issuance_free(input);
-        wally_clear(input, sizeof(*input));
+        clear_public(input, sizeof(*input));
         if (free_parent)
             wally_free(input);
     }
@@ -955,11 +956,11 @@ int wally_tx_elements_output_commitment_free(
 #ifdef BUILD_ELEMENTS
     if (output) {
         output->features &= ~WALLY_TX_IS_ELEMENTS;
-        clear_and_free(output->asset, output->asset_len);
-        clear_and_free(output->value, output->value_len);
-        clear_and_free(output->nonce, output->nonce_len);
-        clear_and_free(output->surjectionproof, output->surjectionproof_len);
-        clear_and_free(output->rangeproof, output->rangeproof_len);
+        free_public(output->asset, output->asset_len);
+        free_public(output->value, output->value_len);
+        free_public(output->nonce, output->nonce_len);
+        free_public(output->surjectionproof, output->surjectionproof_len);
+        free_public(output->rangeproof, output->rangeproof_len);
     }
 #endif /* BUILD_ELEMENTS */
     return WALLY_OK;
@@ -1098,9 +1099,9 @@ int wally_tx_output_init_alloc(uint64_t satoshi,
 static int tx_output_free(struct wally_tx_output *output, bool free_parent)
 {
     if (output) {
-        clear_and_free(output->script, output->script_len);
+        free_public(output->script, output->script_len);
         wally_tx_elements_output_commitment_free(output);
-        wally_clear(output, sizeof(*output));
+        clear_public(output, sizeof(*output));
         if (free_parent)
             wally_free(output);
     }
@@ -1174,11 +1175,11 @@ static int tx_free(struct wally_tx *tx, bool free_parent)
     if (tx) {
         for (i = 0; i < tx->num_inputs; ++i)
             tx_input_free(&tx->inputs[i], false);
-        clear_and_free(tx->inputs, tx->inputs_allocation_len * sizeof(*tx->inputs));
+        free_public(tx->inputs, tx->inputs_allocation_len * sizeof(*tx->inputs));
         for (i = 0; i < tx->num_outputs; ++i)
             tx_output_free(&tx->outputs[i], false);
-        clear_and_free(tx->outputs, tx->outputs_allocation_len * sizeof(*tx->outputs));
-        wally_clear(tx, sizeof(*tx));
+        free_public(tx->outputs, tx->outputs_allocation_len * sizeof(*tx->outputs));
+        clear_public(tx, sizeof(*tx));
         if (free_parent)
             wally_free(tx);
     }
@@ -1967,11 +1968,11 @@ int wally_tx_get_hash_prevouts(const struct wally_tx *tx,
     return hash_prevouts(buff_p, inputs_size, bytes_out, len, inputs_size > sizeof(buff));
 }
 
-static int tx_to_bytes(const struct wally_tx *tx,
-                       uint32_t flags,
-                       unsigned char *bytes_out, size_t len,
-                       size_t *written,
-                       bool is_elements)
+static int tx_to_bytes_impl(const struct wally_tx *tx,
+                            uint32_t flags,
+                            unsigned char *bytes_out, size_t len,
+                            size_t *written,
+                            bool is_elements)
 {
     size_t n, i, j, witness_count;
     unsigned char *p = bytes_out;
@@ -2116,6 +2117,19 @@ static int tx_to_bytes(const struct wally_tx *tx,
     return WALLY_OK;
 }
 
+static int tx_to_bytes(const struct wally_tx *tx,
+                       uint32_t flags,
+                       unsigned char *bytes_out, size_t len,
+                       size_t *written,
+                       bool is_elements)
+{
+    int ret;
+    STATS_BEGIN(WALLY_STATS_TX_SERIALIZE);
+    ret = tx_to_bytes_impl(tx, flags, bytes_out, len, written, is_elements);
+    STATS_END();
+    return ret;
+}
+
 int wally_tx_to_bytes(const struct wally_tx *tx, uint32_t flags,
                       unsigned char *bytes_out, size_t len,
                       size_t *written)
@@ -2194,9 +2208,31 @@ int wally_tx_get_txid(const struct wally_tx *tx, unsigned char *bytes_out, size_
     return tx_to_hex_or_txid(tx, flags, NULL, bytes_out, len, is_elements);
 }
 
+int tx_get_wtxid(const struct wally_tx *tx, unsigned char *bytes_out, size_t len)
+{
+    uint32_t flags = WALLY_TX_FLAG_USE_WITNESS | WALLY_TX_FLAG_ALLOW_PARTIAL;
+    size_t is_elements = 0;
+
+#ifdef BUILD_ELEMENTS
+    if (wally_tx_is_elements(tx, &is_elements) != WALLY_OK)
+        return WALLY_EINVAL;
+#endif
+    if (tx && !tx->num_inputs && !is_elements)
+        flags |= WALLY_TX_FLAG_PRE_BIP144; /* No witnesses to serialize */
+    return tx_to_hex_or_txid(tx, flags, NULL, bytes_out, len, is_elements);
+}
+
+/* Offsets of the parts of a serialized tx that are hashed for its txid */
+struct tx_layout {
+    size_t body_start; /* The start of the inputs */
+    size_t body_end; /* The end of the outputs */
+    size_t locktime; /* The locktime */
+    size_t len; /* The total serialized length */
+};
+
 static int analyze_tx(const unsigned char *bytes, size_t bytes_len,
                       uint32_t flags, size_t *num_inputs, size_t *num_outputs,
-                      bool *expect_witnesses)
+                      bool *expect_witnesses, struct tx_layout *layout)
 {
     const unsigned char *p = bytes, *end = bytes + bytes_len;
     uint64_t v, num_witnesses;
@@ -2267,6 +2303,9 @@ static int analyze_tx(const unsigned char *bytes, size_t bytes_len,
 #define ensure_committed_nonce(dst) \
     ensure_commitment(dst, WALLY_TX_ASSET_CT_NONCE_LEN, WALLY_TX_ASSET_CT_NONCE_PREFIX_A, WALLY_TX_ASSET_CT_NONCE_PREFIX_B)
 
+    if (layout)
+        layout->body_start = p - bytes;
+
     ensure_varint(&v);
     *num_inputs = v;
 
@@ -2309,6 +2348,9 @@ static int analyze_tx(const unsigned char *bytes, size_t bytes_len,
         p += v;
     }
 
+    if (layout)
+        layout->body_end = p - bytes;
+
     if (*expect_witnesses && !is_elements) {
         for (i = 0; i < *num_inputs; ++i) {
             ensure_varint(&num_witnesses);
@@ -2320,9 +2362,11 @@ static int analyze_tx(const unsigned char *bytes, size_t bytes_len,
     }
 
     ensure_n(sizeof(uint32_t)); /* Locktime */
+    if (layout)
+        layout->locktime = p - bytes;
+    p += sizeof(uint32_t);
 
     if (*expect_witnesses && is_elements) {
-        p += sizeof(uint32_t);
         for (i = 0; i < *num_inputs; ++i) {
             ensure_varbuff(&v); /* issuance amount rangeproof */
             p += v;
@@ -2355,6 +2399,8 @@ static int analyze_tx(const unsigned char *bytes, size_t bytes_len,
 #undef ensure_committed_value
 #undef ensure_committed_asset
 #undef ensure_committed_nonce
+    if (layout)
+        layout->len = p - bytes;
     return WALLY_OK;
 }
 
@@ -2386,8 +2432,8 @@ cleanup:
     return ret;
 }
 
-static int tx_from_bytes(const unsigned char *bytes, size_t bytes_len,
-                         uint32_t flags, struct wally_tx **output)
+static int tx_from_bytes_impl(const unsigned char *bytes, size_t bytes_len,
+                              uint32_t flags, struct wally_tx **output)
 {
     const unsigned char *p = bytes;
     const bool is_elements = flags & WALLY_TX_FLAG_USE_ELEMENTS;
@@ -2399,7 +2445,7 @@ static int tx_from_bytes(const unsigned char *bytes, size_t bytes_len,
     OUTPUT_CHECK;
 
     if (analyze_tx(bytes, bytes_len, flags, &num_inputs, &num_outputs,
-                   &expect_witnesses) != WALLY_OK)
+                   &expect_witnesses, NULL) != WALLY_OK)
         return WALLY_EINVAL;
 
     /* Allow pre-allocating all inputs as we have already analyzed the tx */
@@ -2555,12 +2601,66 @@ fail:
     return ret;
 }
 
+static int tx_from_bytes(const unsigned char *bytes, size_t bytes_len,
+                         uint32_t flags, struct wally_tx **output)
+{
+    int ret;
+    STATS_BEGIN(WALLY_STATS_TX_PARSE);
+    ret = tx_from_bytes_impl(bytes, bytes_len, flags, output);
+    STATS_END();
+    return ret;
+}
+
 int wally_tx_from_bytes(const unsigned char *bytes, size_t bytes_len,
                         uint32_t flags, struct wally_tx **output)
 {
     return tx_from_bytes(bytes, bytes_len, flags, output);
 }
 
+int wally_tx_get_txids_batch(const unsigned char *bytes, size_t bytes_len,
+                             uint32_t flags,
+                             unsigned char *bytes_out, size_t len,
+                             size_t *written)
+{
+    const bool is_elements = flags & WALLY_TX_FLAG_USE_ELEMENTS;
+    const unsigned char zero = 0;
+    size_t offset = 0, num_inputs, num_outputs;
+    bool expect_witnesses;
+
+    if (written)
+        *written = 0;
+    if (!bytes || !bytes_len || !bytes_out || !len || !written)
+        return WALLY_EINVAL;
+
+    while (offset < bytes_len) {
+        const unsigned char *p = bytes + offset;
+        struct tx_layout layout;
+
+        if (analyze_tx(p, bytes_len - offset, flags, &num_inputs, &num_outputs,
+                       &expect_witnesses, &layout) != WALLY_OK) {
+            *written = 0;
+            return WALLY_EINVAL;
+        }
+        if (*written + WALLY_TXHASH_LEN <= len) {
+            /* Hash the non-witness serialization in place */
+            struct sha256_ctx ctx;
+            struct sha256 sha;
+            sha256_init(&ctx);
+            sha256_update(&ctx, p, sizeof(uint32_t)); /* Version */
+            if (is_elements)
+                sha256_update(&ctx, &zero, sizeof(zero)); /* No witness flag */
+            sha256_update(&ctx, p + layout.body_start,
+                          layout.body_end - layout.body_start);
+            sha256_update(&ctx, p + layout.locktime, sizeof(uint32_t));
+            sha256_done(&ctx, &sha);
+            wally_sha256(sha.u.u8, sizeof(sha), bytes_out + *written, WALLY_TXHASH_LEN);
+        }
+        *written += WALLY_TXHASH_LEN;
+        offset += layout.len;
+    }
+    return WALLY_OK;
+}
+
 int wally_tx_from_hex(const char *hex, uint32_t flags,
                       struct wally_tx **output)
 {
@@ -1,4 +1,5 @@
 #include "internal.h"
+#include <include/wally_script.h>
 #include <include/wally_transaction.h>
 #include "pullpush.h"
 #include "script.h"
@@ -814,7 +815,8 @@ static int bip341_signature_hash(
     const bool sh_anyprevout_anyscript = bip341_is_input_hash_type(sighash, WALLY_SIGHASH_ANYPREVOUTANYSCRIPT);
     cursor_io io;
 
-    if (index >= tx->num_inputs || (annex && *annex != 0x50))
+    if (index >= tx->num_inputs || (annex && *annex != 0x50) ||
+        (output_type == WALLY_SIGHASH_SINGLE && index >= tx->num_outputs))
         return WALLY_EINVAL;
 
     if (is_elements) {
@@ -935,7 +937,7 @@ static int bip341_signature_hash(
     return txio_done(&io, 0);
 }
 
-int wally_tx_get_input_signature_hash(
+static int tx_get_input_signature_hash(
     const struct wally_tx *tx, size_t index,
     const struct wally_map *scripts,
     const struct wally_map *assets,
@@ -1026,3 +1028,98 @@ int wally_tx_get_input_signature_hash(
                                      bytes_out, len);
     return WALLY_EINVAL; /* Unknown sighash type */
 }
+
+int wally_tx_get_input_signature_hash(
+    const struct wally_tx *tx, size_t index,
+    const struct wally_map *scripts,
+    const struct wally_map *assets,
+    const struct wally_map *values,
+    const unsigned char *script, size_t script_len,
+    uint32_t key_version,
+    uint32_t codesep_position,
+    const unsigned char *annex, size_t annex_len,
+    const unsigned char *genesis_blockhash, size_t genesis_blockhash_len,
+    uint32_t sighash,
+    uint32_t flags,
+    struct wally_map *cache,
+    unsigned char *bytes_out, size_t len)
+{
+    int ret;
+    STATS_BEGIN(WALLY_STATS_SIGHASH);
+    ret = tx_get_input_signature_hash(tx, index, scripts, assets, values, script,
+                                      script_len, key_version, codesep_position,
+                                      annex, annex_len, genesis_blockhash,
+                                      genesis_blockhash_len, sighash, flags, cache,
+                                      bytes_out, len);
+    STATS_END();
+    return ret;
+}
+
+int wally_tx_get_input_signature_hash_batch(
+    const struct wally_tx *tx,
+    const struct wally_map *scripts,
+    const struct wally_map *assets,
+    const struct wally_map *values,
+    const unsigned char *genesis_blockhash, size_t genesis_blockhash_len,
+    uint32_t sighash,
+    uint32_t flags,
+    struct wally_map *cache,
+    unsigned char *bytes_out, size_t len)
+{
+    const uint32_t sighash_type = flags & WALLY_SIGTYPE_MASK;
+    struct wally_map local_cache;
+    size_t i;
+    int ret;
+
+    if (!tx || !tx->num_inputs || !scripts || !bytes_out ||
+        len != tx->num_inputs * SHA256_LEN)
+        return WALLY_EINVAL;
+
+    if (!cache) {
+        /* Share the hashes common to all inputs even if not caching */
+        if ((ret = wally_map_init(0, NULL, &local_cache)) != WALLY_OK)
+            return ret;
+        cache = &local_cache;
+    }
+
+    for (i = 0, ret = WALLY_OK; ret == WALLY_OK && i < tx->num_inputs; ++i) {
+        const struct wally_map_item *item = NULL;
+        unsigned char p2pkh[WALLY_SCRIPTPUBKEY_P2PKH_LEN];
+        const unsigned char *script = NULL;
+        size_t script_len = 0, script_type, written;
+
+        if (sighash_type != WALLY_SIGTYPE_SW_V1) {
+            /* Taproot key path signing uses no script: all others require one */
+            if (!(item = wally_map_get_integer(scripts, i)) || !item->value_len) {
+                ret = WALLY_EINVAL;
+                break;
+            }
+            script = item->value;
+            script_len = item->value_len;
+        }
+        if (sighash_type == WALLY_SIGTYPE_SW_V0 &&
+            wally_scriptpubkey_get_type(script, script_len, &script_type) == WALLY_OK &&
+            script_type == WALLY_SCRIPT_TYPE_P2WPKH) {
+            /* Sign a P2WPKH scriptpubkey with its P2PKH scriptCode */
+            ret = wally_scriptpubkey_p2pkh_from_bytes(script + 2, HASH160_LEN, 0,
+                                                      p2pkh, sizeof(p2pkh), &written);
+            if (ret == WALLY_OK && written != sizeof(p2pkh))
+                ret = WALLY_EINVAL;
+            script = p2pkh;
+            script_len = sizeof(p2pkh);
+        }
+        if (ret == WALLY_OK)
+            ret = tx_get_input_signature_hash(tx, i, scripts, assets, values,
+                                              script, script_len, 0,
+                                              WALLY_NO_CODESEPARATOR, NULL, 0,
+                                              genesis_blockhash, genesis_blockhash_len,
+                                              sighash, flags, cache,
+                                              bytes_out + i * SHA256_LEN, SHA256_LEN);
+    }
+
+    if (cache == &local_cache)
+        wally_map_clear(&local_cache);
+    if (ret != WALLY_OK)
+        wally_clear(bytes_out, len);
+    return ret;
+}
@@ -9,6 +9,11 @@ const hex_n_to_bytes_len = (_hex, hex_len) => Math.floor(hex_len / 2)
 const base58_to_bytes_len = (base58, flags) => base58_get_length(base58)
 const base58_n_to_bytes_len = (base58, n, flags) => base58_n_get_length(base58, n)
 
+// At most one match per output key
+const bip352_scan_len = (_scan_priv_key, _spend_pub_key, _outpoints, _pub_keys,
+                         _num_pub_keys, output_keys, _num_output_keys, _flags) =>
+    Math.floor(output_keys.length / C.EC_XONLY_PUBLIC_KEY_LEN) * C.WALLY_BIP352_MATCH_LEN
+
 const wif_to_public_key_len = (wif, _prefix) =>
     wif_is_uncompressed(wif) ? C.EC_PUBLIC_KEY_UNCOMPRESSED_LEN : C.EC_PUBLIC_KEY_LEN
 
@@ -140,6 +145,7 @@ export const bip32_path_from_str_n_len = wrap('bip32_path_from_str_n_len', [T.St
 export const bip32_path_str_get_features = wrap('bip32_path_str_get_features', [T.String, T.DestPtr(T.Int32)]);
 export const bip32_path_str_n_get_features = wrap('bip32_path_str_n_get_features', [T.String, T.Int32, T.DestPtr(T.Int32)]);
 export const bip340_tagged_hash = wrap('wally_bip340_tagged_hash', [T.Bytes, T.String, T.DestPtrSized(T.Bytes, C.SHA256_LEN)]);
+export const bip352_scan = wrap('wally_bip352_scan', [T.Bytes, T.Bytes, T.Bytes, T.Bytes, T.Uint32Array, T.Bytes, T.Uint32Array, T.Int32, T.DestPtrVarLen(T.Bytes, bip352_scan_len, true)]);
 export const bip38_get_flags = wrap('bip38_get_flags', [T.String, T.DestPtr(T.Int32)]);
 export const bip38_raw_get_flags = wrap('bip38_raw_get_flags', [T.Bytes, T.DestPtr(T.Int32)]);
 export const bip39_get_languages = wrap('bip39_get_languages', [T.DestPtrPtr(T.String)]);
@@ -154,7 +160,9 @@ export const bip85_get_languages = wrap('bip85_get_languages', [T.DestPtrPtr(T.S
 export const bip85_get_rsa_entropy = wrap('bip85_get_rsa_entropy', [T.OpaqueRef, T.Int32, T.Int32, T.DestPtrVarLen(T.Bytes, C.HMAC_SHA512_LEN, true)]);
 export const bzero = wrap('wally_bzero', [T.OpaqueRef, T.Int32]);
 export const cleanup = wrap('wally_cleanup', [T.Int32]);
+export const coinselect = wrap('wally_coinselect', [T.Uint64Array, T.Uint32Array, T.Int64, T.Int64, T.Int64, T.Int64, T.Int64, T.Int32, T.DestPtrVarLen(T.Uint32Array, C.WALLY_CS_MAX_INPUTS, true)]);
 export const coinselect_assets = wrap('wally_coinselect_assets', [T.Uint64Array, T.Int64, T.Int64, T.Int32, T.DestPtrVarLen(T.Uint32Array, C.WALLY_CS_MAX_ASSETS, true)]);
+export const coinselect_assets_split = wrap('wally_coinselect_assets_split', [T.Uint64Array, T.Int64, T.Int64, T.Int32, T.Int32, T.DestPtrVarLen(T.Uint32Array, C.WALLY_CS_MAX_ASSETS, true)]);
 export const confidential_addr_from_addr = wrap('wally_confidential_addr_from_addr', [T.String, T.Int32, T.Bytes, T.DestPtrPtr(T.String)]);
 export const confidential_addr_from_addr_segwit = wrap('wally_confidential_addr_from_addr_segwit', [T.String, T.String, T.String, T.Bytes, T.DestPtrPtr(T.String)]);
 export const confidential_addr_segwit_to_ec_public_key = wrap('wally_confidential_addr_segwit_to_ec_public_key', [T.String, T.String, T.DestPtrSized(T.Bytes, C.EC_PUBLIC_KEY_LEN)]);
@@ -192,6 +200,7 @@ export const ec_scalar_multiply = wrap('wally_ec_scalar_multiply', [T.Bytes, T.B
 export const ec_scalar_subtract = wrap('wally_ec_scalar_subtract', [T.Bytes, T.Bytes, T.DestPtrSized(T.Bytes, C.EC_SCALAR_LEN)]);
 export const ec_scalar_verify = wrap('wally_ec_scalar_verify', [T.Bytes]);
 export const ec_sig_from_bytes_aux_len = wrap('wally_ec_sig_from_bytes_aux_len', [T.Bytes, T.Bytes, T.Bytes, T.Int32, T.DestPtr(T.Int32)]);
+export const ec_sig_from_bytes_batch_len = wrap('wally_ec_sig_from_bytes_batch_len', [T.Bytes, T.Bytes, T.Bytes, T.Int32, T.DestPtr(T.Int32)]);
 export const ec_sig_from_bytes_len = wrap('wally_ec_sig_from_bytes_len', [T.Bytes, T.Bytes, T.Int32, T.DestPtr(T.Int32)]);
 export const ec_sig_from_der = wrap('wally_ec_sig_from_der', [T.Bytes, T.DestPtrSized(T.Bytes, C.EC_SIGNATURE_LEN)]);
 export const ec_sig_normalize = wrap('wally_ec_sig_normalize', [T.Bytes, T.DestPtrSized(T.Bytes, C.EC_SIGNATURE_LEN)]);
@@ -213,6 +222,7 @@ export const free_string = wrap('wally_free_string', [T.OpaqueRef]);
 export const get_build_version = wrap('wally_get_build_version', [T.DestPtr(T.Int32)]);
 export const get_hash_prevouts = wrap('wally_get_hash_prevouts', [T.Bytes, T.Uint32Array, T.DestPtrSized(T.Bytes, C.SHA256_LEN)]);
 export const get_operations = wrap('wally_get_operations', [T.OpaqueRef]);
+export const get_stats = wrap('wally_get_stats', [T.Int32, T.OpaqueRef, T.Int32]);
 export const hash160 = wrap('wally_hash160', [T.Bytes, T.DestPtrSized(T.Bytes, C.HASH160_LEN)]);
 export const hex_from_bytes = wrap('wally_hex_from_bytes', [T.Bytes, T.DestPtrPtr(T.String)]);
 export const hex_n_to_bytes = wrap('wally_hex_n_to_bytes', [T.String, T.Int32, T.DestPtrVarLen(T.Bytes, hex_n_to_bytes_len, false)]);
@@ -267,6 +277,7 @@ export const map_sort = wrap('wally_map_sort', [T.OpaqueRef, T.Int32]);
 export const merkle_path_xonly_public_key_verify = wrap('wally_merkle_path_xonly_public_key_verify', [T.Bytes, T.Bytes]);
 export const pbkdf2_hmac_sha256 = wrap('wally_pbkdf2_hmac_sha256', [T.Bytes, T.Bytes, T.Int32, T.Int32, T.DestPtrSized(T.Bytes, C.PBKDF2_HMAC_SHA256_LEN)]);
 export const pbkdf2_hmac_sha512 = wrap('wally_pbkdf2_hmac_sha512', [T.Bytes, T.Bytes, T.Int32, T.Int32, T.DestPtrSized(T.Bytes, C.PBKDF2_HMAC_SHA512_LEN)]);
+export const pool_get_stats = wrap('wally_pool_get_stats', [T.OpaqueRef]);
 export const psbt_add_global_scalar = wrap('wally_psbt_add_global_scalar', [T.OpaqueRef, T.Bytes]);
 export const psbt_add_input_keypath = wrap('wally_psbt_add_input_keypath', [T.OpaqueRef, T.Int32, T.Bytes, T.Bytes, T.Uint32Array]);
 export const psbt_add_input_signature = wrap('wally_psbt_add_input_signature', [T.OpaqueRef, T.Int32, T.Bytes, T.Bytes]);
@@ -275,6 +286,7 @@ export const psbt_add_output_keypath = wrap('wally_psbt_add_output_keypath', [T.
 export const psbt_add_output_taproot_keypath = wrap('wally_psbt_add_output_taproot_keypath', [T.OpaqueRef, T.Int32, T.Int32, T.Bytes, T.Bytes, T.Bytes, T.Uint32Array]);
 export const psbt_add_tx_input_at = wrap('wally_psbt_add_tx_input_at', [T.OpaqueRef, T.Int32, T.Int32, T.OpaqueRef]);
 export const psbt_add_tx_output_at = wrap('wally_psbt_add_tx_output_at', [T.OpaqueRef, T.Int32, T.Int32, T.OpaqueRef]);
+export const psbt_apply_patch = wrap('wally_psbt_apply_patch', [T.OpaqueRef, T.Bytes, T.Int32]);
 export const psbt_blind = wrap('wally_psbt_blind_alloc', [T.OpaqueRef, T.OpaqueRef, T.OpaqueRef, T.OpaqueRef, T.OpaqueRef, T.Bytes, T.Int32, T.Int32, T.DestPtrPtr(T.OpaqueRef)]);
 export const psbt_blind_noalloc = wrap('wally_psbt_blind', [T.OpaqueRef, T.OpaqueRef, T.OpaqueRef, T.OpaqueRef, T.OpaqueRef, T.Bytes, T.Int32, T.Int32, T.OpaqueRef]);
 export const psbt_clear_fallback_locktime = wrap('wally_psbt_clear_fallback_locktime', [T.OpaqueRef]);
@@ -319,6 +331,7 @@ export const psbt_find_input_keypath = wrap('wally_psbt_find_input_keypath', [T.
 export const psbt_find_input_signature = wrap('wally_psbt_find_input_signature', [T.OpaqueRef, T.Int32, T.Bytes, T.DestPtr(T.Int32)]);
 export const psbt_find_input_spending_utxo = wrap('wally_psbt_find_input_spending_utxo', [T.OpaqueRef, T.Bytes, T.Int32, T.DestPtr(T.Int32)]);
 export const psbt_find_input_unknown = wrap('wally_psbt_find_input_unknown', [T.OpaqueRef, T.Int32, T.Bytes, T.DestPtr(T.Int32)]);
+export const psbt_find_inputs_spending_utxos = wrap('wally_psbt_find_inputs_spending_utxos', [T.OpaqueRef, T.Bytes, T.Uint32Array, T.DestPtrVarLen(T.Uint32Array, psbt_find_inputs_spending_utxos_len, false)]);
 export const psbt_find_output_keypath = wrap('wally_psbt_find_output_keypath', [T.OpaqueRef, T.Int32, T.Bytes, T.DestPtr(T.Int32)]);
 export const psbt_find_output_unknown = wrap('wally_psbt_find_output_unknown', [T.OpaqueRef, T.Int32, T.Bytes, T.DestPtr(T.Int32)]);
 export const psbt_free = wrap('wally_psbt_free', [T.OpaqueRef]);
@@ -402,6 +415,7 @@ export const psbt_get_output_value_blinding_rangeproof_len = wrap('wally_psbt_ge
 export const psbt_get_output_value_commitment_len = wrap('wally_psbt_get_output_value_commitment_len', [T.OpaqueRef, T.Int32, T.DestPtr(T.Int32)]);
 export const psbt_get_output_value_rangeproof_len = wrap('wally_psbt_get_output_value_rangeproof_len', [T.OpaqueRef, T.Int32, T.DestPtr(T.Int32)]);
 export const psbt_get_output_witness_script_len = wrap('wally_psbt_get_output_witness_script_len', [T.OpaqueRef, T.Int32, T.DestPtr(T.Int32)]);
+export const psbt_get_patch_length = wrap('wally_psbt_get_patch_length', [T.OpaqueRef, T.OpaqueRef, T.Int32, T.DestPtr(T.Int32)]);
 export const psbt_get_pset_modifiable_flags = wrap('wally_psbt_get_pset_modifiable_flags', [T.OpaqueRef, T.DestPtr(T.Int32)]);
 export const psbt_get_tx_modifiable_flags = wrap('wally_psbt_get_tx_modifiable_flags', [T.OpaqueRef, T.DestPtr(T.Int32)]);
 export const psbt_get_tx_version = wrap('wally_psbt_get_tx_version', [T.OpaqueRef, T.DestPtr(T.Int32)]);
@@ -496,6 +510,8 @@ export const psbt_input_taproot_keypath_add = wrap('wally_psbt_input_taproot_key
 export const psbt_is_elements = wrap('wally_psbt_is_elements', [T.OpaqueRef, T.DestPtr(T.Int32)]);
 export const psbt_is_finalized = wrap('wally_psbt_is_finalized', [T.OpaqueRef, T.DestPtr(T.Int32)]);
 export const psbt_is_input_finalized = wrap('wally_psbt_is_input_finalized', [T.OpaqueRef, T.Int32, T.DestPtr(T.Int32)]);
+export const psbt_outpoint_index_disable = wrap('wally_psbt_outpoint_index_disable', [T.OpaqueRef]);
+export const psbt_outpoint_index_enable = wrap('wally_psbt_outpoint_index_enable', [T.OpaqueRef, T.Int32]);
 export const psbt_output_clear_amount = wrap('wally_psbt_output_clear_amount', [T.OpaqueRef]);
 export const psbt_output_clear_asset = wrap('wally_psbt_output_clear_asset', [T.OpaqueRef]);
 export const psbt_output_clear_asset_blinding_surjectionproof = wrap('wally_psbt_output_clear_asset_blinding_surjectionproof', [T.OpaqueRef]);
@@ -627,6 +643,9 @@ export const scriptsig_p2pkh_from_der = wrap('wally_scriptsig_p2pkh_from_der', [
 export const scriptsig_p2pkh_from_sig = wrap('wally_scriptsig_p2pkh_from_sig', [T.Bytes, T.Bytes, T.Int32, T.DestPtrVarLen(T.Bytes, C.WALLY_SCRIPTSIG_P2PKH_MAX_LEN, true)]);
 export const scrypt = wrap('wally_scrypt', [T.Bytes, T.Bytes, T.Int32, T.Int32, T.Int32, T.DestPtrSized(T.Bytes, T.USER_PROVIDED_LEN)]);
 export const secp_randomize = wrap('wally_secp_randomize', [T.Bytes]);
+export const secure_arena_free = wrap('wally_secure_arena_free', [T.Int32]);
+export const secure_arena_init = wrap('wally_secure_arena_init', [T.Int32, T.Int32]);
+export const secure_arena_reset = wrap('wally_secure_arena_reset', [T.Int32, T.DestPtr(T.Int32)]);
 export const set_operations = wrap('wally_set_operations', [T.OpaqueRef]);
 export const sha256 = wrap('wally_sha256', [T.Bytes, T.DestPtrSized(T.Bytes, C.SHA256_LEN)]);
 export const sha256_midstate = wrap('wally_sha256_midstate', [T.Bytes, T.DestPtrSized(T.Bytes, C.SHA256_LEN)]);
@@ -809,6 +828,7 @@ export const descriptor_get_key_origin_path_str = wrap('wally_descriptor_get_key
 export const descriptor_to_script = wrap('wally_descriptor_to_script', [T.OpaqueRef, T.Int32, T.Int32, T.Int32, T.Int32, T.Int32, T.Int32, T.DestPtrVarLen(T.Bytes, descriptor_to_script_get_maximum_length, true)]);
 export const ec_sig_from_bytes = wrap('wally_ec_sig_from_bytes', [T.Bytes, T.Bytes, T.Int32, T.DestPtrSized(T.Bytes, ec_sig_from_bytes_len, false)]);
 export const ec_sig_from_bytes_aux = wrap('wally_ec_sig_from_bytes_aux', [T.Bytes, T.Bytes, T.Bytes, T.Int32, T.DestPtrSized(T.Bytes, ec_sig_from_bytes_aux_len, false)]);
+export const ec_sig_from_bytes_batch = wrap('wally_ec_sig_from_bytes_batch', [T.Bytes, T.Bytes, T.Bytes, T.Int32, T.DestPtrSized(T.Bytes, ec_sig_from_bytes_batch_len, false)]);
 export const keypath_get_path = wrap('wally_keypath_get_path', [T.Bytes, T.DestPtrVarLen(T.Uint32Array, keypath_get_path_len, false)]);
 export const map_get_item = wrap('wally_map_get_item', [T.OpaqueRef, T.Int32, T.DestPtrVarLen(T.Bytes, map_get_item_length, false)]);
 export const map_get_item_key = wrap('wally_map_get_item_key', [T.OpaqueRef, T.Int32, T.DestPtrVarLen(T.Bytes, map_get_item_key_length, false)]);
@@ -853,6 +873,7 @@ export const psbt_get_output_value_blinding_rangeproof = wrap('wally_psbt_get_ou
 export const psbt_get_output_value_commitment = wrap('wally_psbt_get_output_value_commitment', [T.OpaqueRef, T.Int32, T.DestPtrVarLen(T.Bytes, psbt_get_output_value_commitment_len, false)]);
 export const psbt_get_output_value_rangeproof = wrap('wally_psbt_get_output_value_rangeproof', [T.OpaqueRef, T.Int32, T.DestPtrVarLen(T.Bytes, psbt_get_output_value_rangeproof_len, false)]);
 export const psbt_get_output_witness_script = wrap('wally_psbt_get_output_witness_script', [T.OpaqueRef, T.Int32, T.DestPtrVarLen(T.Bytes, psbt_get_output_witness_script_len, false)]);
+export const psbt_get_patch = wrap('wally_psbt_get_patch', [T.OpaqueRef, T.OpaqueRef, T.Int32, T.DestPtrVarLen(T.Bytes, psbt_get_patch_length, false)]);
 export const psbt_input_get_amount_rangeproof = wrap('wally_psbt_input_get_amount_rangeproof', [T.OpaqueRef, T.DestPtrVarLen(T.Bytes, psbt_input_get_amount_rangeproof_len, false)]);
 export const psbt_input_get_asset = wrap('wally_psbt_input_get_asset', [T.OpaqueRef, T.DestPtrVarLen(T.Bytes, psbt_input_get_asset_len, false)]);
 export const psbt_input_get_asset_surjectionproof = wrap('wally_psbt_input_get_asset_surjectionproof', [T.OpaqueRef, T.DestPtrVarLen(T.Bytes, psbt_input_get_asset_surjectionproof_len, false)]);
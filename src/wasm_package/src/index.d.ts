@@ -100,6 +100,7 @@ export function bip32_path_from_str_n_len(path_str: string, path_str_len: number
 export function bip32_path_str_get_features(path_str: string): number;
 export function bip32_path_str_n_get_features(path_str: string, path_str_len: number): number;
 export function bip340_tagged_hash(bytes: Buffer|Uint8Array, tag: string): Buffer;
+export function bip352_scan(scan_priv_key: Buffer|Uint8Array, spend_pub_key: Buffer|Uint8Array, outpoints: Buffer|Uint8Array, pub_keys: Buffer|Uint8Array, num_pub_keys: Uint32Array|number[], output_keys: Buffer|Uint8Array, num_output_keys: Uint32Array|number[], flags: number): Buffer;
 export function bip38_get_flags(bip38: string): number;
 export function bip38_raw_get_flags(bytes: Buffer|Uint8Array): number;
 export function bip39_get_languages(): string;
@@ -114,7 +115,9 @@ export function bip85_get_languages(): string;
 export function bip85_get_rsa_entropy(hdkey: Ref_ext_key, key_bits: number, index: number): Buffer;
 export function bzero(bytes: Ref, bytes_len: number): void;
 export function cleanup(flags: number): void;
+export function coinselect(values: BigUint64Array|Array<bigint>, weights: Uint32Array|number[], target: bigint, fee_rate: bigint, long_term_fee_rate: bigint, cost_of_change: bigint, attempts: bigint, flags: number): Uint32Array;
 export function coinselect_assets(values: BigUint64Array|Array<bigint>, target: bigint, attempts: bigint, io_ratio: number): Uint32Array;
+export function coinselect_assets_split(values: BigUint64Array|Array<bigint>, target: bigint, attempts: bigint, io_ratio: number, num_subtrees: number): Uint32Array;
 export function confidential_addr_from_addr(address: string, prefix: number, pub_key: Buffer|Uint8Array): string;
 export function confidential_addr_from_addr_segwit(address: string, addr_family: string, confidential_addr_family: string, pub_key: Buffer|Uint8Array): string;
 export function confidential_addr_segwit_to_ec_public_key(address: string, confidential_addr_family: string): Buffer;
@@ -152,6 +155,7 @@ export function ec_scalar_multiply(scalar: Buffer|Uint8Array, operand: Buffer|Ui
 export function ec_scalar_subtract(scalar: Buffer|Uint8Array, operand: Buffer|Uint8Array): Buffer;
 export function ec_scalar_verify(scalar: Buffer|Uint8Array): void;
 export function ec_sig_from_bytes_aux_len(priv_key: Buffer|Uint8Array, bytes: Buffer|Uint8Array, aux_rand: Buffer|Uint8Array, flags: number): number;
+export function ec_sig_from_bytes_batch_len(priv_key: Buffer|Uint8Array, bytes: Buffer|Uint8Array, aux_rand: Buffer|Uint8Array, flags: number): number;
 export function ec_sig_from_bytes_len(priv_key: Buffer|Uint8Array, bytes: Buffer|Uint8Array, flags: number): number;
 export function ec_sig_from_der(bytes: Buffer|Uint8Array): Buffer;
 export function ec_sig_normalize(sig: Buffer|Uint8Array): Buffer;
@@ -173,6 +177,7 @@ export function free_string(str: Ref): void;
 export function get_build_version(): number;
 export function get_hash_prevouts(txhashes: Buffer|Uint8Array, utxo_indices: Uint32Array|number[]): Buffer;
 export function get_operations(output: Ref_wally_operations): void;
+export function get_stats(flags: number, output: Ref_wally_stats, num_output: number): void;
 export function hash160(bytes: Buffer|Uint8Array): Buffer;
 export function hex_from_bytes(bytes: Buffer|Uint8Array): string;
 export function hex_n_to_bytes(hex: string, hex_len: number): Buffer;
@@ -227,6 +232,7 @@ export function map_sort(map_in: Ref_wally_map, flags: number): void;
 export function merkle_path_xonly_public_key_verify(key: Buffer|Uint8Array, val: Buffer|Uint8Array): void;
 export function pbkdf2_hmac_sha256(pass: Buffer|Uint8Array, salt: Buffer|Uint8Array, flags: number, cost: number): Buffer;
 export function pbkdf2_hmac_sha512(pass: Buffer|Uint8Array, salt: Buffer|Uint8Array, flags: number, cost: number): Buffer;
+export function pool_get_stats(output: Ref_wally_pool_stats): void;
 export function psbt_add_global_scalar(psbt: Ref_wally_psbt, scalar: Buffer|Uint8Array): void;
 export function psbt_add_input_keypath(psbt: Ref_wally_psbt, index: number, pub_key: Buffer|Uint8Array, fingerprint: Buffer|Uint8Array, child_path: Uint32Array|number[]): void;
 export function psbt_add_input_signature(psbt: Ref_wally_psbt, index: number, pub_key: Buffer|Uint8Array, sig: Buffer|Uint8Array): void;
@@ -235,6 +241,7 @@ export function psbt_add_output_keypath(psbt: Ref_wally_psbt, index: number, pub
 export function psbt_add_output_taproot_keypath(psbt: Ref_wally_psbt, index: number, flags: number, pub_key: Buffer|Uint8Array, tapleaf_hashes: Buffer|Uint8Array, fingerprint: Buffer|Uint8Array, child_path: Uint32Array|number[]): void;
 export function psbt_add_tx_input_at(psbt: Ref_wally_psbt, index: number, flags: number, input: Ref_wally_tx_input): void;
 export function psbt_add_tx_output_at(psbt: Ref_wally_psbt, index: number, flags: number, output: Ref_wally_tx_output): void;
+export function psbt_apply_patch(psbt: Ref_wally_psbt, bytes: Buffer|Uint8Array, flags: number): void;
 export function psbt_blind(psbt: Ref_wally_psbt, values: Ref_wally_map, vbfs: Ref_wally_map, assets: Ref_wally_map, abfs: Ref_wally_map, entropy: Buffer|Uint8Array, output_index: number, flags: number): Ref_wally_map;
 export function psbt_blind_noalloc(psbt: Ref_wally_psbt, values: Ref_wally_map, vbfs: Ref_wally_map, assets: Ref_wally_map, abfs: Ref_wally_map, entropy: Buffer|Uint8Array, output_index: number, flags: number, output: Ref_wally_map): void;
 export function psbt_clear_fallback_locktime(psbt: Ref_wally_psbt): void;
@@ -279,6 +286,7 @@ export function psbt_find_input_keypath(psbt: Ref_wally_psbt, index: number, key
 export function psbt_find_input_signature(psbt: Ref_wally_psbt, index: number, pub_key: Buffer|Uint8Array): number;
 export function psbt_find_input_spending_utxo(psbt: Ref_wally_psbt, txhash: Buffer|Uint8Array, utxo_index: number): number;
 export function psbt_find_input_unknown(psbt: Ref_wally_psbt, index: number, key: Buffer|Uint8Array): number;
+export function psbt_find_inputs_spending_utxos(psbt: Ref_wally_psbt, txhashes: Buffer|Uint8Array, utxo_indices: Uint32Array|number[]): Uint32Array;
 export function psbt_find_output_keypath(psbt: Ref_wally_psbt, index: number, key: Buffer|Uint8Array): number;
 export function psbt_find_output_unknown(psbt: Ref_wally_psbt, index: number, key: Buffer|Uint8Array): number;
 export function psbt_free(psbt: Ref_wally_psbt): void;
@@ -362,6 +370,7 @@ export function psbt_get_output_value_blinding_rangeproof_len(psbt: Ref_wally_ps
 export function psbt_get_output_value_commitment_len(psbt: Ref_wally_psbt, index: number): number;
 export function psbt_get_output_value_rangeproof_len(psbt: Ref_wally_psbt, index: number): number;
 export function psbt_get_output_witness_script_len(psbt: Ref_wally_psbt, index: number): number;
+export function psbt_get_patch_length(base: Ref_wally_psbt, psbt: Ref_wally_psbt, flags: number): number;
 export function psbt_get_pset_modifiable_flags(psbt: Ref_wally_psbt): number;
 export function psbt_get_tx_modifiable_flags(psbt: Ref_wally_psbt): number;
 export function psbt_get_tx_version(psbt: Ref_wally_psbt): number;
@@ -456,6 +465,8 @@ export function psbt_input_taproot_keypath_add(input: Ref_wally_psbt_input, pub_
 export function psbt_is_elements(psbt: Ref_wally_psbt): number;
 export function psbt_is_finalized(psbt: Ref_wally_psbt): number;
 export function psbt_is_input_finalized(psbt: Ref_wally_psbt, index: number): number;
+export function psbt_outpoint_index_disable(psbt: Ref_wally_psbt): void;
+export function psbt_outpoint_index_enable(psbt: Ref_wally_psbt, flags: number): void;
 export function psbt_output_clear_amount(output: Ref_wally_psbt_output): void;
 export function psbt_output_clear_asset(output: Ref_wally_psbt_output): void;
 export function psbt_output_clear_asset_blinding_surjectionproof(output: Ref_wally_psbt_output): void;
@@ -587,6 +598,9 @@ export function scriptsig_p2pkh_from_der(pub_key: Buffer|Uint8Array, sig: Buffer
 export function scriptsig_p2pkh_from_sig(pub_key: Buffer|Uint8Array, sig: Buffer|Uint8Array, sighash: number): Buffer;
 export function scrypt(pass: Buffer|Uint8Array, salt: Buffer|Uint8Array, cost: number, block_size: number, parallelism: number, out_len: number): Buffer;
 export function secp_randomize(bytes: Buffer|Uint8Array): void;
+export function secure_arena_free(flags: number): void;
+export function secure_arena_init(len: number, flags: number): void;
+export function secure_arena_reset(flags: number): number;
 export function set_operations(ops: Ref_wally_operations): void;
 export function sha256(bytes: Buffer|Uint8Array): Buffer;
 export function sha256_midstate(bytes: Buffer|Uint8Array): Buffer;
@@ -769,6 +783,7 @@ export function descriptor_get_key_origin_path_str(descriptor: Ref_wally_descrip
 export function descriptor_to_script(descriptor: Ref_wally_descriptor, depth: number, index: number, variant: number, multi_index: number, child_num: number, flags: number): Buffer;
 export function ec_sig_from_bytes(priv_key: Buffer|Uint8Array, bytes: Buffer|Uint8Array, flags: number): Buffer;
 export function ec_sig_from_bytes_aux(priv_key: Buffer|Uint8Array, bytes: Buffer|Uint8Array, aux_rand: Buffer|Uint8Array, flags: number): Buffer;
+export function ec_sig_from_bytes_batch(priv_key: Buffer|Uint8Array, bytes: Buffer|Uint8Array, aux_rand: Buffer|Uint8Array, flags: number): Buffer;
 export function keypath_get_path(val: Buffer|Uint8Array): Uint32Array;
 export function map_get_item(map_in: Ref_wally_map, index: number): Buffer;
 export function map_get_item_key(map_in: Ref_wally_map, index: number): Buffer;
@@ -813,6 +828,7 @@ export function psbt_get_output_value_blinding_rangeproof(psbt: Ref_wally_psbt,
 export function psbt_get_output_value_commitment(psbt: Ref_wally_psbt, index: number): Buffer;
 export function psbt_get_output_value_rangeproof(psbt: Ref_wally_psbt, index: number): Buffer;
 export function psbt_get_output_witness_script(psbt: Ref_wally_psbt, index: number): Buffer;
+export function psbt_get_patch(base: Ref_wally_psbt, psbt: Ref_wally_psbt, flags: number): Buffer;
 export function psbt_input_get_amount_rangeproof(input: Ref_wally_psbt_input): Buffer;
 export function psbt_input_get_asset(input: Ref_wally_psbt_input): Buffer;
 export function psbt_input_get_asset_surjectionproof(input: Ref_wally_psbt_input): Buffer;
@@ -1,9 +1,24 @@
 #include "internal.h"
 #include "wordlist.h"
 
-static int bstrcmp(const void *l, const void *r)
+/* Compare a word of a given length to a NUL terminated word */
+static int word_cmp(const char *word, size_t word_len, const char *candidate)
 {
-    return strcmp(l, (*(const char **)r));
+    int ret = strncmp(word, candidate, word_len);
+    return ret ? ret : -(candidate[word_len] != '\0');
+}
+
+/* Seeded FNV-1a with a final mix. Must match word_hash() in tools/wordlist_cc.py */
+static uint32_t wordlist_hash(uint32_t seed, const char *word, size_t word_len)
+{
+    uint32_t h = 0x811c9dc5u ^ (seed * 0x9e3779b9u);
+    size_t i;
+
+    for (i = 0; i < word_len; ++i)
+        h = (h ^ (unsigned char)word[i]) * 0x01000193u;
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    return h ^ (h >> 13);
 }
 
 /* https://graphics.stanford.edu/~seander/bithacks.html#IntegerLogObvious */
@@ -67,20 +82,80 @@ struct words *wordlist_init(const char *words)
     return w;
 }
 
+/* Look up a word in a constant word list, given its seed 0 hash */
+static size_t wordlist_lookup_hashed(const struct words *w,
+                                     const char *word, size_t word_len,
+                                     uint32_t hash)
+{
+    /* Constant word lists have a minimal perfect hash. The number of
+     * words is a power of 2, so the modulus can be taken by masking */
+    const size_t mask = w->len - 1;
+    const int32_t seed = w->hash_seeds[hash & mask];
+    size_t i;
+
+    if (seed < 0)
+        i = (size_t)(-seed - 1);
+    else
+        i = w->hash_indices[wordlist_hash(seed, word, word_len) & mask];
+    /* The hash maps every input to some word: confirm it matches */
+    return word_cmp(word, word_len, w->indices[i]) ? 0u : i + 1u;
+}
+
+size_t wordlist_lookup_word_n(const struct words *w, const char *word, size_t word_len)
+{
+    size_t i;
+
+    if (w->hash_seeds)
+        return wordlist_lookup_hashed(w, word, word_len,
+                                      wordlist_hash(0, word, word_len));
+
+    if (w->sorted) {
+        size_t lo = 0, hi = w->len;
+        while (lo < hi) {
+            int cmp;
+            i = lo + (hi - lo) / 2;
+            cmp = word_cmp(word, word_len, w->indices[i]);
+            if (!cmp)
+                return i + 1u;
+            if (cmp < 0)
+                hi = i;
+            else
+                lo = i + 1;
+        }
+        return 0u;
+    }
+
+    for (i = 0; i < w->len; ++i)
+        if (!word_cmp(word, word_len, w->indices[i]))
+            return i + 1u;
+    return 0u;
+}
+
 size_t wordlist_lookup_word(const struct words *w, const char *word)
 {
-    const size_t size = sizeof(const char *);
-    const char **found = NULL;
-
-    if (w->sorted)
-        found = (const char **)bsearch(word, w->indices, w->len, size, bstrcmp);
-    else {
-        size_t i;
-        for (i = 0; i < w->len && !found; ++i)
-            if (!strcmp(word, w->indices[i]))
-                found = w->indices + i;
+    return wordlist_lookup_word_n(w, word, strlen(word));
+}
+
+uint32_t wordlist_lookup_word_multi(const struct words *const *lists,
+                                    size_t num_lists,
+                                    const char *word, size_t word_len,
+                                    size_t *idx_out)
+{
+    /* The seed 0 hash is shared by all lists, so compute it only once */
+    const uint32_t hash = wordlist_hash(0, word, word_len);
+    uint32_t found = 0;
+    size_t i;
+
+    for (i = 0; i < num_lists; ++i) {
+        const struct words *w = lists[i];
+        if (w->hash_seeds)
+            idx_out[i] = wordlist_lookup_hashed(w, word, word_len, hash);
+        else
+            idx_out[i] = wordlist_lookup_word_n(w, word, word_len);
+        if (idx_out[i])
+            found |= 1u << i;
     }
-    return found ? found - w->indices + 1u : 0u;
+    return found;
 }
 
 const char *wordlist_lookup_index(const struct words *w, size_t idx)
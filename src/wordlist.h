@@ -3,6 +3,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 /**
  * struct words- structure representing a parsed list of words
@@ -20,6 +21,11 @@ struct words {
     size_t str_len;
     /* Pointers to the individual words */
     const char **indices;
+    /* Perfect hash seeds for constant word lists, or NULL. Negative
+     * values hold -(index + 1) for buckets containing a single word */
+    const int16_t *hash_seeds;
+    /* Perfect hash word indices for constant word lists */
+    const uint16_t *hash_indices;
 };
 
 /**
@@ -45,6 +51,40 @@ size_t wordlist_lookup_word(
     const struct words *w,
     const char *word);
 
+/**
+ * Find a word of a given length in a wordlist.
+ *
+ * @w: Parsed list of words to look up in.
+ * @word: The word to look up. Need not be NUL terminated.
+ * @word_len: The length of @word in bytes.
+ *
+ * Returns 0 if not found, idx + 1 otherwise.
+ * @see wordlist_init.
+ */
+size_t wordlist_lookup_word_n(
+    const struct words *w,
+    const char *word,
+    size_t word_len);
+
+/**
+ * Find a word of a given length in several wordlists at once.
+ *
+ * @lists: Parsed lists of words to look up in.
+ * @num_lists: The number of lists in @lists. Must be 32 or fewer.
+ * @word: The word to look up. Need not be NUL terminated.
+ * @word_len: The length of @word in bytes.
+ * @idx_out: Destination for the result for each list: 0 if not
+ *           found, idx + 1 otherwise.
+ *
+ * Returns a bitmask of the lists that contain the word.
+ */
+uint32_t wordlist_lookup_word_multi(
+    const struct words *const *lists,
+    size_t num_lists,
+    const char *word,
+    size_t word_len,
+    size_t *idx_out);
+
 /**
  * Return the Nth word in a wordlist.
  *
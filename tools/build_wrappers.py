@@ -13,12 +13,28 @@ EXCLUDED_FUNCS = {
     'wally_ec_scalar_subtract_from',
     # Map getters returning internal pointers are only for C/C++ use
     'wally_map_get', 'wally_map_get_integer',
+    # String output buffer variants are only for C/C++ use
+    'wally_base58_from_bytes_into', 'wally_addr_segwit_from_bytes_into',
+    'wally_scriptpubkey_to_address_into', 'wally_bip32_key_to_address_into',
+    'wally_bip32_key_to_addr_segwit_into',
+    # Batch calls using fixed-size string slots are only for C/C++ use
+    'wally_addr_segwit_from_bytes_batch', 'wally_addr_segwit_to_bytes_batch',
+    'wally_addr_segwit_verify_batch', 'wally_descriptor_to_addresses_into',
+    'bip39_mnemonics_validate_batch',
 }
 
 # BIP38's Scrypt can't work due to WASM's memory restrictions
+# Batch calls writing to caller provided buffers are for native bindings
 WASM_EXCLUDED_FUNCS = EXCLUDED_FUNCS | {
     'bip38_from_private_key', 'bip38_raw_from_private_key',
     'bip38_raw_to_private_key', 'bip38_to_private_key',
+    'wally_hash160_batch', 'wally_tx_get_input_signature_hash_batch',
+    'wally_tx_get_txids_batch',
+}
+
+# Functions whose last pointer argument is an input rather than an output
+INPUT_LAST_ARG_FUNCS = {
+    'wally_psbt_outpoint_index_disable',
 }
 
 # Output buffer length functions that aren't yet part of the API
@@ -26,12 +42,14 @@ WASM_EXCLUDED_FUNCS = EXCLUDED_FUNCS | {
 # True = Yes, False = Exact length
 MISSING_LEN_FUNCS = {
     'wally_base58_to_bytes': True,
+    'wally_bip352_scan': True,
     'wally_base58_n_to_bytes': True,
     'wally_elements_pegin_contract_script_from_bytes': True,
     'wally_elements_pegout_script_from_bytes': True,
     'wally_format_bitcoin_message': True,
     'wally_hex_n_to_bytes': False,
     'wally_hex_to_bytes': False,
+    'wally_psbt_find_inputs_spending_utxos': False,
     'wally_script_push_from_bytes': True,
     'wally_scriptpubkey_csv_2of2_then_1_from_bytes': True,
     'wally_scriptpubkey_csv_2of2_then_1_from_bytes_opt': True,
@@ -314,7 +332,8 @@ def gen_wally_hpp(funcs, all_funcs):
                 cpp_args.append(f'{arg.type} {arg.name}')
                 call_args.append(f'{arg.name}')
             elif arg.is_pointer:
-                if arg.is_pointer_pointer or n == num_args - 1:
+                is_output = n == num_args - 1 and func.name not in INPUT_LAST_ARG_FUNCS
+                if arg.is_pointer_pointer or is_output:
                     cpp_args.append(f'{arg.type} {arg.name}')
                     call_args.append(f'{arg.name}')
                 else:
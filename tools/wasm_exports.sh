@@ -83,8 +83,10 @@ EXPORTED_FUNCTIONS="['_malloc','_free','_bip32_key_free' \
 ,'_wally_bip32_key_to_addr_segwit' \
 ,'_wally_bip32_key_to_address' \
 ,'_wally_bip340_tagged_hash' \
+,'_wally_bip352_scan' \
 ,'_wally_bzero' \
 ,'_wally_cleanup' \
+,'_wally_coinselect' \
 ,'_wally_descriptor_canonicalize' \
 ,'_wally_descriptor_free' \
 ,'_wally_descriptor_get_checksum' \
@@ -121,6 +123,8 @@ EXPORTED_FUNCTIONS="['_malloc','_free','_bip32_key_free' \
 ,'_wally_ec_sig_from_bytes' \
 ,'_wally_ec_sig_from_bytes_aux' \
 ,'_wally_ec_sig_from_bytes_aux_len' \
+,'_wally_ec_sig_from_bytes_batch' \
+,'_wally_ec_sig_from_bytes_batch_len' \
 ,'_wally_ec_sig_from_bytes_len' \
 ,'_wally_ec_sig_from_der' \
 ,'_wally_ec_sig_normalize' \
@@ -134,6 +138,7 @@ EXPORTED_FUNCTIONS="['_malloc','_free','_bip32_key_free' \
 ,'_wally_get_build_version' \
 ,'_wally_get_hash_prevouts' \
 ,'_wally_get_operations' \
+,'_wally_get_stats' \
 ,'_wally_hash160' \
 ,'_wally_hex_from_bytes' \
 ,'_wally_hex_n_to_bytes' \
@@ -192,6 +197,7 @@ EXPORTED_FUNCTIONS="['_malloc','_free','_bip32_key_free' \
 ,'_wally_merkle_path_xonly_public_key_verify' \
 ,'_wally_pbkdf2_hmac_sha256' \
 ,'_wally_pbkdf2_hmac_sha512' \
+,'_wally_pool_get_stats' \
 ,'_wally_psbt_add_input_keypath' \
 ,'_wally_psbt_add_input_signature' \
 ,'_wally_psbt_add_input_taproot_keypath' \
@@ -199,6 +205,7 @@ EXPORTED_FUNCTIONS="['_malloc','_free','_bip32_key_free' \
 ,'_wally_psbt_add_output_taproot_keypath' \
 ,'_wally_psbt_add_tx_input_at' \
 ,'_wally_psbt_add_tx_output_at' \
+,'_wally_psbt_apply_patch' \
 ,'_wally_psbt_clear_fallback_locktime' \
 ,'_wally_psbt_clear_input_required_lockheight' \
 ,'_wally_psbt_clear_input_required_locktime' \
@@ -214,6 +221,7 @@ EXPORTED_FUNCTIONS="['_malloc','_free','_bip32_key_free' \
 ,'_wally_psbt_find_input_signature' \
 ,'_wally_psbt_find_input_spending_utxo' \
 ,'_wally_psbt_find_input_unknown' \
+,'_wally_psbt_find_inputs_spending_utxos' \
 ,'_wally_psbt_find_output_keypath' \
 ,'_wally_psbt_find_output_unknown' \
 ,'_wally_psbt_free' \
@@ -279,6 +287,8 @@ EXPORTED_FUNCTIONS="['_malloc','_free','_bip32_key_free' \
 ,'_wally_psbt_get_output_unknowns_size' \
 ,'_wally_psbt_get_output_witness_script' \
 ,'_wally_psbt_get_output_witness_script_len' \
+,'_wally_psbt_get_patch' \
+,'_wally_psbt_get_patch_length' \
 ,'_wally_psbt_get_tx_modifiable_flags' \
 ,'_wally_psbt_get_tx_version' \
 ,'_wally_psbt_get_version' \
@@ -318,6 +328,8 @@ EXPORTED_FUNCTIONS="['_malloc','_free','_bip32_key_free' \
 ,'_wally_psbt_is_elements' \
 ,'_wally_psbt_is_finalized' \
 ,'_wally_psbt_is_input_finalized' \
+,'_wally_psbt_outpoint_index_disable' \
+,'_wally_psbt_outpoint_index_enable' \
 ,'_wally_psbt_output_clear_amount' \
 ,'_wally_psbt_output_find_keypath' \
 ,'_wally_psbt_output_find_unknown' \
@@ -388,6 +400,9 @@ EXPORTED_FUNCTIONS="['_malloc','_free','_bip32_key_free' \
 ,'_wally_scriptsig_p2pkh_from_sig' \
 ,'_wally_scrypt' \
 ,'_wally_secp_randomize' \
+,'_wally_secure_arena_free' \
+,'_wally_secure_arena_init' \
+,'_wally_secure_arena_reset' \
 ,'_wally_set_operations' \
 ,'_wally_sha256' \
 ,'_wally_sha256_midstate' \
@@ -526,6 +541,7 @@ if [ -z "$DISABLE_ELEMENTS" ]; then
 ,'_wally_asset_unblind_with_nonce' \
 ,'_wally_asset_value_commitment' \
 ,'_wally_coinselect_assets' \
+,'_wally_coinselect_assets_split' \
 ,'_wally_confidential_addr_from_addr' \
 ,'_wally_confidential_addr_from_addr_segwit' \
 ,'_wally_confidential_addr_segwit_to_ec_public_key' \
@@ -3,6 +3,44 @@ import sys
 def as_hex(s):
     return ','.join([hex(c) for c in s.encode('utf8')])
 
+def word_hash(seed, word):
+    # Must match wordlist_hash() in src/wordlist.c
+    h = (0x811c9dc5 ^ (seed * 0x9e3779b9)) & 0xffffffff
+    for c in word.encode('utf8'):
+        h = ((h ^ c) * 0x01000193) & 0xffffffff
+    h ^= h >> 16
+    h = (h * 0x85ebca6b) & 0xffffffff
+    return h ^ (h >> 13)
+
+def perfect_hash(words):
+    # Hash and displace: words are bucketed by their seed 0 hash. Buckets
+    # with one word store its index directly as -(index + 1), larger
+    # buckets store the seed that places all of their words into free slots.
+    size = len(words)
+    buckets = [[] for _ in range(size)]
+    for i, w in enumerate(words):
+        buckets[word_hash(0, w) % size].append(i)
+    seeds, indices = [0] * size, [0] * size
+    used = [False] * size
+    for b in sorted(range(size), key=lambda b: -len(buckets[b])):
+        bucket = buckets[b]
+        if not bucket:
+            break # Remaining buckets are empty
+        if len(bucket) == 1:
+            seeds[b] = -bucket[0] - 1
+            continue
+        seed = 1
+        while True:
+            slots = [word_hash(seed, words[i]) % size for i in bucket]
+            if len(set(slots)) == len(slots) and not any(used[s] for s in slots):
+                break
+            seed += 1
+        assert seed < 2 ** 15
+        seeds[b] = seed
+        for i, s in zip(bucket, slots):
+            indices[s], used[s] = i, True
+    return seeds, indices
+
 if __name__ == "__main__":
 
     bits = { 2 ** x : x for x in range(12) } # Up to 4k words
@@ -16,6 +54,7 @@ if __name__ == "__main__":
         is_sorted = sorted(words) == words
         assert len(words) >= 2
         assert len(words) in bits
+        assert len(set(words)) == len(words)
 
         lengths = [ 0 ]
         for w in words:
@@ -41,6 +80,17 @@ if __name__ == "__main__":
         print('   };')
         print('#undef %s' % string_name)
 
+        seeds, indices = perfect_hash(words)
+        print()
+        print('static const int16_t %s_g[] = {' % string_name)
+        for i in range(0, len(seeds), 12):
+            print('    %s,' % ','.join([str(s) for s in seeds[i : i + 12]]))
+        print('};')
+        print('static const uint16_t %s_v[] = {' % string_name)
+        for i in range(0, len(indices), 12):
+            print('    %s,' % ','.join([str(s) for s in indices[i : i + 12]]))
+        print('};')
+
         print()
         print('static const struct words %s = {' % struct_name)
         print('    {0},'.format(len(words)))
@@ -48,5 +98,7 @@ if __name__ == "__main__":
         print('    {0},'.format(str(is_sorted).lower()))
         print('    (const char *)%s_,' % string_name)
         print('    0, /* Constant string */')
-        print('    %s_i' % string_name)
+        print('    %s_i,' % string_name)
+        print('    %s_g,' % string_name)
+        print('    %s_v' % string_name)
         print('};')